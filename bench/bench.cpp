@@ -0,0 +1,397 @@
+/*
+    bench/bench.cpp -- Microbenchmarks of performance-critical code paths
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+
+    Usage: drjit-bench [--json] [--filter <substring>] [--repeat <count>]
+
+    Every benchmark runs a fixed workload with deterministic inputs, discards
+    two warm-up iterations, and reports the median/minimum/median absolute
+    deviation of the time per processed item over the remaining runs. The
+    '--json' flag switches to a machine-readable output format for regression
+    tracking.
+*/
+
+#include <drjit/packet.h>
+#include <drjit/math.h>
+#include <drjit/jit.h>
+#include <drjit/autodiff.h>
+#include <drjit/call.h>
+#include <drjit/texture.h>
+#include <drjit/dynamic.h>
+#include <drjit/color.h>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace dr = drjit;
+
+// -----------------------------------------------------------------------
+//! @{ \name Benchmark harness
+// -----------------------------------------------------------------------
+
+struct Result {
+    std::string name;
+    const char *unit;
+    size_t items;
+    double median, min, mad;
+};
+
+struct Harness {
+    const char *filter = nullptr;
+    size_t repeat = 20;
+    std::vector<Result> results;
+
+    /// Run 'func' (which processes 'items' units of work) and record its timing
+    void run(const char *name, const char *unit, size_t items,
+             const std::function<void()> &func) {
+        if (filter && !strstr(name, filter))
+            return;
+
+        for (int i = 0; i < 2; ++i)
+            func();
+
+        std::vector<double> times(repeat);
+        for (size_t i = 0; i < repeat; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            func();
+            auto end = std::chrono::steady_clock::now();
+            times[i] = std::chrono::duration<double, std::nano>(end - start).count() /
+                       (double) items;
+        }
+
+        std::sort(times.begin(), times.end());
+        double median = times[times.size() / 2];
+
+        std::vector<double> dev(times.size());
+        for (size_t i = 0; i < times.size(); ++i)
+            dev[i] = std::abs(times[i] - median);
+        std::sort(dev.begin(), dev.end());
+
+        results.push_back({ name, unit, items, median, times[0], dev[dev.size() / 2] });
+        fprintf(stderr, "%-28s %12.3f %-10s (min %.3f, mad %.3f)\n", name,
+                median, unit, times[0], dev[dev.size() / 2]);
+    }
+
+    void print_json() const {
+        printf("{\n  \"repeat\": %zu,\n  \"benchmarks\": [\n", repeat);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result &r = results[i];
+            printf("    { \"name\": \"%s\", \"unit\": \"%s\", \"items\": %zu, "
+                   "\"median\": %.6g, \"min\": %.6g, \"mad\": %.6g }%s\n",
+                   r.name.c_str(), r.unit, r.items, r.median, r.min, r.mad,
+                   i + 1 < results.size() ? "," : "");
+        }
+        printf("  ]\n}\n");
+    }
+};
+
+/// Prevent the compiler from optimizing away the computation of 'value'
+template <typename T> void do_not_optimize(const T &value) {
+#if defined(_MSC_VER)
+    static volatile char sink;
+    sink = *(const volatile char *) &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+// -----------------------------------------------------------------------
+//! @{ \name Packet math
+// -----------------------------------------------------------------------
+
+template <typename Func>
+void bench_packet(Harness &h, const char *name, Func func) {
+    using Packet = dr::Packet<float>;
+    constexpr size_t N = 1 << 20;
+
+    std::vector<float> input(N);
+    for (size_t i = 0; i < N; ++i)
+        input[i] = 0.5f + 4.f * (float) i / (float) N;
+
+    h.run(name, "ns/elem", N, [&] {
+        Packet accum = 0.f;
+        for (size_t i = 0; i < N; i += Packet::Size)
+            accum += func(dr::load<Packet>(input.data() + i));
+        do_not_optimize(accum);
+    });
+}
+
+void bench_packets(Harness &h) {
+    bench_packet(h, "packet.sin", [](auto x) { return dr::sin(x); });
+    bench_packet(h, "packet.exp", [](auto x) { return dr::exp(x); });
+    bench_packet(h, "packet.log", [](auto x) { return dr::log(x); });
+    bench_packet(h, "packet.atan2", [](auto x) { return dr::atan2(x, x - 1.f); });
+    bench_packet(h, "packet.rsqrt", [](auto x) { return dr::rsqrt(x); });
+
+    // Histogram with frequent duplicate bins within each packet
+    using FloatP  = dr::Packet<float>;
+    using UInt32P = dr::uint32_array_t<FloatP>;
+    constexpr size_t N = 1 << 20, Bins = 64;
+
+    std::vector<uint32_t> keys(N);
+    for (size_t i = 0; i < N; ++i)
+        keys[i] = ((uint32_t) i * 2654435761u) % Bins;
+
+    std::vector<float> hist(Bins);
+    h.run("packet.scatter_add", "ns/elem", N, [&] {
+        float *ptr = hist.data();
+        for (size_t i = 0; i < N; i += FloatP::Size)
+            dr::scatter_add(ptr, FloatP(1.f), dr::load<UInt32P>(keys.data() + i));
+        do_not_optimize(hist[0]);
+    });
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+// -----------------------------------------------------------------------
+//! @{ \name Color space conversions
+// -----------------------------------------------------------------------
+
+void bench_color(Harness &h) {
+    using FloatP  = dr::Packet<float>;
+    using UInt32P = dr::uint32_array_t<FloatP>;
+    using Array4f = dr::Array<FloatP, 4>;
+    constexpr size_t N = 1 << 20;
+
+    std::vector<uint32_t> pixels(N);
+    for (size_t i = 0; i < N; ++i)
+        pixels[i] = (uint32_t) i * 2654435761u;
+
+    h.run("color.rgba8_decode_poly", "ns/pixel", N, [&] {
+        Array4f accum = 0.f;
+        for (size_t i = 0; i < N; i += FloatP::Size) {
+            UInt32P p = dr::load<UInt32P>(pixels.data() + i);
+            accum += Array4f(
+                dr::srgb_to_linear(FloatP(p & 0xFFu) * (1.f / 255.f)),
+                dr::srgb_to_linear(FloatP(dr::sr<8>(p) & 0xFFu) * (1.f / 255.f)),
+                dr::srgb_to_linear(FloatP(dr::sr<16>(p) & 0xFFu) * (1.f / 255.f)),
+                FloatP(dr::sr<24>(p)) * (1.f / 255.f));
+        }
+        do_not_optimize(accum);
+    });
+
+    h.run("color.rgba8_decode_lut", "ns/pixel", N, [&] {
+        Array4f accum = 0.f;
+        for (size_t i = 0; i < N; i += FloatP::Size)
+            accum += dr::rgba8_to_linear<FloatP>(dr::load<UInt32P>(pixels.data() + i));
+        do_not_optimize(accum);
+    });
+
+    h.run("color.rgba8_encode", "ns/pixel", N, [&] {
+        UInt32P accum = 0u;
+        for (size_t i = 0; i < N; i += FloatP::Size) {
+            FloatP x = FloatP(dr::load<UInt32P>(pixels.data() + i) & 0xFFFFu) *
+                       (1.f / 65535.f);
+            accum ^= dr::linear_to_rgba8(Array4f(x, 1.f - x, x * x, x));
+        }
+        do_not_optimize(accum);
+    });
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+// -----------------------------------------------------------------------
+//! @{ \name Host-side dynamic arrays
+// -----------------------------------------------------------------------
+
+void bench_dynamic(Harness &h) {
+    using ArrayXf = dr::DynamicArray<float>;
+    constexpr size_t N = 100000;
+
+    // Per-object temporaries of a scene loader: small arrays, copied around
+    auto func = [] {
+        for (size_t i = 0; i < N; ++i) {
+            ArrayXf a = dr::full<ArrayXf>((float) i, 1 + i % 8);
+            ArrayXf b = a.copy();
+            do_not_optimize(b.data()[0]);
+        }
+    };
+
+    h.run("dynamic.copy", "ns/array", N, func);
+
+    h.run("dynamic.copy_arena", "ns/array", N, [&] {
+        dr::DynamicArena arena;
+        dr::scoped_dynamic_allocator guard(&arena);
+        func();
+    });
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+// -----------------------------------------------------------------------
+//! @{ \name JIT/AD recording and traversal
+// -----------------------------------------------------------------------
+
+using Float      = dr::LLVMArray<float>;
+using FloatD     = dr::DiffArray<JitBackend::LLVM, float>;
+using UInt32D    = dr::uint32_array_t<FloatD>;
+
+static constexpr size_t ChainLength = 10000;
+
+/// Record a long chain of arithmetic operations
+template <typename T> T record_chain(const T &x) {
+    T y = x;
+    for (size_t i = 0; i < ChainLength; ++i)
+        y = dr::fmadd(y, x, 1.f);
+    return y;
+}
+
+void bench_recording(Harness &h) {
+    h.run("jit.record", "ns/op", ChainLength, [] {
+        Float x = dr::arange<Float>(1024);
+        do_not_optimize(record_chain(x).index());
+    });
+
+    h.run("ad.record", "ns/op", ChainLength, [] {
+        FloatD x = dr::arange<FloatD>(1024);
+        dr::enable_grad(x);
+        do_not_optimize(record_chain(x).index());
+    });
+
+    FloatD x = dr::arange<FloatD>(1024);
+    dr::enable_grad(x);
+
+    // Each traversal processes 'ChainLength' edges (re-recorded outside of the timed region)
+    std::vector<FloatD> chains;
+    for (size_t i = 0; i < h.repeat + 2; ++i)
+        chains.push_back(record_chain(x));
+
+    size_t counter = 0;
+    h.run("ad.traverse", "ns/edge", ChainLength, [&] {
+        dr::backward_from(chains[counter++ % chains.size()]);
+        dr::clear_grad(x);
+    });
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+// -----------------------------------------------------------------------
+//! @{ \name Vectorized method calls
+// -----------------------------------------------------------------------
+
+struct BenchBase {
+    virtual FloatD f(FloatD x) = 0;
+
+    BenchBase() { jit_registry_put(JitBackend::LLVM, "BenchBase", this); }
+    virtual ~BenchBase() { jit_registry_remove(this); }
+};
+
+struct BenchA : BenchBase {
+    FloatD f(FloatD x) override { return x * 2.f + 1.f; }
+};
+
+struct BenchB : BenchBase {
+    FloatD f(FloatD x) override { return dr::sqrt(x); }
+};
+
+DRJIT_CALL_BEGIN(BenchBase)
+    DRJIT_CALL_METHOD(f)
+DRJIT_CALL_END(BenchBase)
+
+void bench_calls(Harness &h) {
+    using BasePtr = dr::replace_value_t<FloatD, BenchBase *>;
+    BenchA a;
+    BenchB b;
+
+    UInt32D index = dr::arange<UInt32D>(1024);
+    BasePtr ptr = dr::select(index % 2u == 0u, BasePtr(&a), BasePtr(&b));
+    FloatD x = dr::arange<FloatD>(1024);
+    dr::eval(ptr, x);
+
+    constexpr size_t Calls = 100;
+    h.run("call.record", "ns/call", Calls, [&] {
+        for (size_t i = 0; i < Calls; ++i)
+            do_not_optimize(ptr->f(x).index());
+    });
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+// -----------------------------------------------------------------------
+//! @{ \name Textures
+// -----------------------------------------------------------------------
+
+void bench_textures(Harness &h) {
+    using Texture = dr::Texture<Float, 2>;
+    using Array2f = dr::Array<Float, 2>;
+
+    size_t shape[2] = { 256, 256 };
+    Texture tex(shape, 4);
+    Float data = dr::arange<Float>(256 * 256 * 4) * (1.f / 1024.f);
+    tex.set_value(data);
+
+    constexpr size_t N = 1 << 20;
+    Float t = dr::arange<Float>(N) * (1.f / N);
+    Array2f pos(t, dr::fmadd(t, 7.f, .25f) - dr::floor(dr::fmadd(t, 7.f, .25f)));
+    dr::eval(pos);
+
+    h.run("texture.eval", "ns/lookup", N, [&] {
+        Float out[4];
+        tex.eval(pos, out);
+        dr::eval(out[0], out[1], out[2], out[3]);
+        jit_sync_thread();
+    });
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
+int main(int argc, char **argv) {
+    Harness h;
+    bool json = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            h.filter = argv[++i];
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            h.repeat = (size_t) std::max(1, atoi(argv[++i]));
+        } else {
+            fprintf(stderr, "Usage: %s [--json] [--filter <substring>] "
+                            "[--repeat <count>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench_packets(h);
+    bench_color(h);
+    bench_dynamic(h);
+
+    jit_init((uint32_t) JitBackend::LLVM);
+    if (jit_has_backend(JitBackend::LLVM)) {
+        // Avoid variability due to the thread pool size
+        jit_set_thread_count(4);
+        bench_recording(h);
+        bench_calls(h);
+        bench_textures(h);
+    } else {
+        fprintf(stderr, "drjit-bench: LLVM backend unavailable, skipping "
+                        "JIT/AD benchmarks.\n");
+    }
+
+    if (json)
+        h.print_json();
+
+    jit_shutdown(0);
+    return 0;
+}
@@ -0,0 +1,70 @@
+"""
+Microbenchmarks of the Python binding layer (``src/python/apply.cpp``)
+
+The operations below act on tiny arrays so that the measured time is dominated
+by argument dispatch, type promotion, and result construction rather than by
+the arithmetic itself. The output format matches the one of ``drjit-bench
+--json``.
+
+Usage: python bench_python.py [--json] [--filter <substring>] [--repeat <count>]
+"""
+
+import argparse
+import json
+import sys
+import timeit
+
+import drjit as dr
+
+
+def benchmarks():
+    from drjit.scalar import Array3f
+    from drjit.llvm import Float, UInt32
+
+    a, b = Array3f(1, 2, 3), Array3f(4, 5, 6)
+    x, y = Float(1, 2, 3, 4), Float(5, 6, 7, 8)
+    i = UInt32(0, 1, 2, 3)
+
+    return [
+        ('python.scalar_add', lambda: a + b),
+        ('python.scalar_fma', lambda: dr.fma(a, b, a)),
+        ('python.scalar_index', lambda: a[1]),
+        ('python.scalar_sum', lambda: dr.sum(a)),
+        ('python.jit_add', lambda: x + y),
+        ('python.jit_add_scalar', lambda: x + 1.0),
+        ('python.jit_fma', lambda: dr.fma(x, y, x)),
+        ('python.jit_select', lambda: dr.select(x > 2, x, y)),
+        ('python.jit_gather', lambda: dr.gather(Float, x, i)),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--json', action='store_true')
+    parser.add_argument('--filter', default=None)
+    parser.add_argument('--repeat', type=int, default=20)
+    args = parser.parse_args()
+
+    number, results = 10000, []
+
+    for name, func in benchmarks():
+        if args.filter and args.filter not in name:
+            continue
+        timer = timeit.Timer(func)
+        timer.timeit(number) # Warm up
+        times = sorted(t / number * 1e9 for t in
+                       timer.repeat(repeat=max(args.repeat, 1), number=number))
+        median = times[len(times) // 2]
+        dev = sorted(abs(t - median) for t in times)
+        mad = dev[len(dev) // 2]
+        results.append({'name': name, 'unit': 'ns/call', 'items': number,
+                        'median': median, 'min': times[0], 'mad': mad})
+        print(f'{name:<28} {median:12.3f} ns/call    (min {times[0]:.3f}, '
+              f'mad {mad:.3f})', file=sys.stderr)
+
+    if args.json:
+        print(json.dumps({'repeat': args.repeat, 'benchmarks': results}, indent=2))
+
+
+if __name__ == '__main__':
+    main()
@@ -29,6 +29,9 @@ del sys
 
 from .ast import syntax, hint
 from .interop import wrap
+from ._view import TensorView
+from ._queue import Queue
+from ._quantized import QuantizedArray
 import warnings as _warnings
 
 
@@ -751,6 +754,154 @@ def polar_decomp(arg, it=10):
     return q0, q0.T @ arg
 
 
+def cholesky(arg, /):
+    '''
+    Compute the Cholesky factorization of a symmetric positive definite matrix.
+
+    The function returns the lower triangular matrix :math:`\\mathbf{L}` with
+    :math:`\\mathbf{A}=\\mathbf{L}\\mathbf{L}^T`. Like the other small dense
+    solvers (:py:func:`drjit.lu`, :py:func:`drjit.eigh`,
+    :py:func:`drjit.svd`), the implementation is fully unrolled for the static
+    matrix size and vectorizes over the entries of Jit-compiled matrix types.
+    It is differentiable.
+
+    Args:
+        arg (drjit.ArrayBase): A Dr.Jit matrix type
+
+    Returns:
+        drjit.ArrayBase: The lower triangular Cholesky factor.
+    '''
+    if not is_matrix_v(arg):
+        raise Exception('drjit.cholesky(): unsupported input type!')
+
+    from . import _linalg as _linalg
+    return _linalg.cholesky(arg)
+
+
+def cholesky_solve(L, b, /):
+    '''
+    Solve the linear system :math:`\\mathbf{A}\\mathbf{x}=\\mathbf{b}` given the
+    Cholesky factor :math:`\\mathbf{L}` of :math:`\\mathbf{A}` computed by
+    :py:func:`drjit.cholesky()`.
+
+    Args:
+        L (drjit.ArrayBase): A Dr.Jit matrix type storing the Cholesky factor.
+
+        b (drjit.ArrayBase): The right hand side vector.
+
+    Returns:
+        drjit.ArrayBase: The solution vector :math:`\\mathbf{x}`.
+    '''
+    if not is_matrix_v(L):
+        raise Exception('drjit.cholesky_solve(): unsupported input type!')
+
+    from . import _linalg as _linalg
+    return _linalg.cholesky_solve(L, b)
+
+
+def lu(arg, /):
+    '''
+    Compute the LU factorization of a square matrix with partial pivoting.
+
+    The function returns a tuple ``(LU, perm)``. The matrix ``LU`` stores the
+    unit lower triangular factor :math:`\\mathbf{L}` (below the diagonal, the
+    diagonal itself is implicit) and the upper triangular factor
+    :math:`\\mathbf{U}` (on and above the diagonal). The integer vector
+    ``perm`` specifies the row permutation: row ``i`` of :math:`\\mathbf{L}
+    \\mathbf{U}` equals row ``perm[i]`` of ``arg``. Pivots are chosen
+    independently for each lane via :py:func:`drjit.select()`.
+
+    Args:
+        arg (drjit.ArrayBase): A Dr.Jit matrix type
+
+    Returns:
+        tuple: The packed factors and the row permutation.
+    '''
+    if not is_matrix_v(arg):
+        raise Exception('drjit.lu(): unsupported input type!')
+
+    from . import _linalg as _linalg
+    return _linalg.lu(arg)
+
+
+def lu_solve(LU, perm, b, /):
+    '''
+    Solve the linear system :math:`\\mathbf{A}\\mathbf{x}=\\mathbf{b}` given
+    the LU factorization of :math:`\\mathbf{A}` computed by
+    :py:func:`drjit.lu()`.
+
+    Args:
+        LU (drjit.ArrayBase): The packed LU factors.
+
+        perm (drjit.ArrayBase): The row permutation.
+
+        b (drjit.ArrayBase): The right hand side vector.
+
+    Returns:
+        drjit.ArrayBase: The solution vector :math:`\\mathbf{x}`.
+    '''
+    if not is_matrix_v(LU):
+        raise Exception('drjit.lu_solve(): unsupported input type!')
+
+    from . import _linalg as _linalg
+    return _linalg.lu_solve(LU, perm, b)
+
+
+def eigh(arg, sweeps=8):
+    '''
+    Compute the eigendecomposition of a symmetric matrix.
+
+    The function returns a tuple ``(w, V)`` containing the eigenvalues in
+    ascending order and a matrix storing the associated eigenvectors as
+    columns, so that :math:`\\mathbf{A}=\\mathbf{V}\\,\\mathrm{diag}(\\mathbf{w})
+    \\,\\mathbf{V}^T`.
+
+    The implementation performs a fixed number of sweeps of the cyclic Jacobi
+    method, which converges quadratically. The default is sufficient for
+    double precision accuracy with matrices up to size 4.
+
+    Args:
+        arg (drjit.ArrayBase): A symmetric Dr.Jit matrix
+
+        sweeps (int): Number of Jacobi sweeps.
+
+    Returns:
+        tuple: The eigenvalues and eigenvectors.
+    '''
+    if not is_matrix_v(arg):
+        raise Exception('drjit.eigh(): unsupported input type!')
+
+    from . import _linalg as _linalg
+    return _linalg.eigh(arg, sweeps)
+
+
+def svd(arg, sweeps=8):
+    '''
+    Compute the singular value decomposition of a square matrix.
+
+    The function returns a tuple ``(U, sigma, V)`` with orthogonal matrices
+    ``U`` and ``V`` and the singular values ``sigma`` in descending order, so
+    that :math:`\\mathbf{A}=\\mathbf{U}\\,\\mathrm{diag}(\\boldsymbol{\\sigma})
+    \\,\\mathbf{V}^T`.
+
+    The implementation performs a fixed number of sweeps of the one-sided
+    (Hestenes) Jacobi method.
+
+    Args:
+        arg (drjit.ArrayBase): A Dr.Jit matrix type
+
+        sweeps (int): Number of Jacobi sweeps.
+
+    Returns:
+        tuple: The matrices ``U`` and ``V`` along with the singular values.
+    '''
+    if not is_matrix_v(arg):
+        raise Exception('drjit.svd(): unsupported input type!')
+
+    from . import _linalg as _linalg
+    return _linalg.svd(arg, sweeps)
+
+
 def matrix_to_quat(mtx, /):
     '''
     matrix_to_quat(arg, /)
@@ -922,6 +1073,83 @@ def euler_to_quat(a, /):
     return Quaternion4f(x, y, z, w)
 
 
+def slerp(q0, q1, t, /):
+    '''
+    slerp(q0, q1, t, /)
+    Spherical linear interpolation between two unit quaternions.
+
+    The function interpolates along the shorter of the two arcs connecting
+    ``q0`` and ``q1``. Nearly parallel inputs fall back to normalized linear
+    interpolation. The implementation is branch-free: it blends the inputs
+    using two scalar weights instead of selecting between candidate
+    quaternions.
+
+    Args:
+        q0 (drjit.ArrayBase): A Dr.Jit quaternion type
+
+        q1 (drjit.ArrayBase): A Dr.Jit quaternion type
+
+        t (float | drjit.ArrayBase): Interpolation parameter in :math:`[0, 1]`.
+
+    Returns:
+        drjit.ArrayBase: The interpolated quaternion.
+    '''
+    if not is_quaternion_v(q0) or not is_quaternion_v(q1):
+        raise Exception('drjit.slerp(): unsupported input type!')
+
+    Q = type(q0)
+
+    cos_theta = fma(q0.x, q1.x, fma(q0.y, q1.y, fma(q0.z, q1.z, q0.w * q1.w)))
+    q1 = Q(mulsign(q1.x, cos_theta), mulsign(q1.y, cos_theta),
+           mulsign(q1.z, cos_theta), mulsign(q1.w, cos_theta))
+    cos_theta = minimum(abs(cos_theta), 1.0)
+
+    theta = acos(cos_theta)
+    inv_sin_theta = rsqrt(maximum(fma(-cos_theta, cos_theta, 1.0), 1e-12))
+
+    linear = cos_theta > 0.9995
+    w0 = select(linear, 1.0 - t, sin((1.0 - t) * theta) * inv_sin_theta)
+    w1 = select(linear, t, sin(t * theta) * inv_sin_theta)
+
+    x, y = fma(q0.x, w0, q1.x * w1), fma(q0.y, w0, q1.y * w1)
+    z, w = fma(q0.z, w0, q1.z * w1), fma(q0.w, w0, q1.w * w1)
+
+    scale = select(linear, rsqrt(fma(x, x, fma(y, y, fma(z, z, w * w)))), 1.0)
+    return Q(x * scale, y * scale, z * scale, w * scale)
+
+
+def squad(q0, q1, s0, s1, t, /):
+    '''
+    squad(q0, q1, s0, s1, t, /)
+    Spherical quadrangle interpolation between the unit quaternions ``q0`` and
+    ``q1`` with the inner control points ``s0`` and ``s1``.
+
+    This function evaluates
+
+    .. code-block:: python
+
+       dr.slerp(dr.slerp(q0, q1, t), dr.slerp(s0, s1, t), 2*t*(1-t))
+
+    which produces a smooth rotation curve when the control points of
+    successive segments are chosen appropriately.
+
+    Args:
+        q0 (drjit.ArrayBase): Start of the segment
+
+        q1 (drjit.ArrayBase): End of the segment
+
+        s0 (drjit.ArrayBase): Inner control point associated with ``q0``
+
+        s1 (drjit.ArrayBase): Inner control point associated with ``q1``
+
+        t (float | drjit.ArrayBase): Interpolation parameter in :math:`[0, 1]`.
+
+    Returns:
+        drjit.ArrayBase: The interpolated quaternion.
+    '''
+    return slerp(slerp(q0, q1, t), slerp(s0, s1, t), 2.0 * t * (1.0 - t))
+
+
 def transform_decompose(a, it=10):
     '''
     transform_decompose(arg, it=10)
@@ -1336,6 +1564,441 @@ def isolate_grad(when=True):
     return detail.ADContextManager(detail.ADScope.Isolate, [])
 
 
+class _CheckpointOp(CustomOp):
+    '''
+    Dr.Jit custom operation that implements :py:func:`drjit.checkpoint()`
+    '''
+    def eval(self, func, args, kwargs):
+        # 'args' and 'kwargs' are detached, hence no AD graph is recorded here
+        self.func = func
+        self.args = args
+        self.kwargs = kwargs
+        return func(*args, **kwargs)
+
+    def rerecord(self):
+        # Replay the region with gradient tracking enabled
+        args, kwargs = copy(self.args), copy(self.kwargs)
+        enable_grad(args, kwargs)
+        return args, kwargs, self.func(*args, **kwargs)
+
+    def forward(self):
+        args, kwargs, out = self.rerecord()
+        set_grad(args, self.grad_in('args'))
+        set_grad(kwargs, self.grad_in('kwargs'))
+        enqueue(ADMode.Forward, args, kwargs)
+        traverse(ADMode.Forward)
+        self.set_grad_out(grad(out))
+
+    def backward(self):
+        args, kwargs, out = self.rerecord()
+        set_grad(out, self.grad_out())
+        enqueue(ADMode.Backward, out)
+        traverse(ADMode.Backward)
+        self.set_grad_in('args', grad(args))
+        self.set_grad_in('kwargs', grad(kwargs))
+
+
+def checkpoint(func, /):
+    """
+    Wrap a function so that its AD graph is rematerialized on demand
+    (gradient checkpointing).
+
+    Normally, differentiating a long computation keeps every intermediate
+    AD edge weight in memory until the AD traversal has finished. The function
+    returned by :py:func:`drjit.checkpoint` instead evaluates ``func`` without
+    recording its interior AD graph, and only keeps the inputs and outputs
+    (the boundary of the region). When a subsequent forward or reverse-mode
+    traversal reaches the region, ``func`` is re-run with gradient tracking
+    enabled to obtain the needed derivatives.
+
+    .. code-block:: python
+
+       @dr.checkpoint
+       def step(state):
+           # .. long differentiable computation ..
+           return new_state
+
+       for i in range(1000):
+           state = step(state)
+
+       dr.backward(loss(state))
+
+    This trades memory for computation: the wrapped function runs once more
+    during every AD traversal that involves it. The function should be
+    deterministic, and it should only depend on the AD graph through its
+    arguments, since differentiable values captured in other ways (e.g., via
+    closures or global variables) are not re-recorded.
+
+    Args:
+        func (Callable): A Python callable that accepts Dr.Jit arrays,
+          tensors, or :ref:`PyTrees <pytrees>` as positional and keyword
+          arguments and returns a result of the same kind.
+
+    Returns:
+        Callable: A wrapper with the same interface as ``func``.
+    """
+    import functools
+
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        return custom(_CheckpointOp, func, args, kwargs)
+
+    return wrapper
+
+
+def _freeze_key(arg):
+    """
+    Compute a hashable description of the layout of a PyTree (structure,
+    types, and sizes) that determines the kernels launched by a frozen function
+    """
+    tp = type(arg)
+    if is_array_v(tp):
+        if is_tensor_v(tp):
+            return (tp, arg.shape)
+        elif is_jit_v(tp):
+            return (tp, width(arg))
+        return (tp, repr(arg))
+    elif tp is tuple or tp is list:
+        return (tp, tuple(_freeze_key(v) for v in arg))
+    elif tp is dict:
+        return (tp, tuple((k, _freeze_key(v)) for k, v in arg.items()))
+    elif is_struct_v(tp):
+        return (tp, tuple((k, _freeze_key(getattr(arg, k)))
+                          for k in tp.DRJIT_STRUCT))
+    elif tp in (int, float, bool, str, type(None)):
+        # Python scalars are baked into the generated code as literals
+        return (tp, arg)
+    return (tp, id(arg))
+
+
+def freeze(func=None, /, *, eval: bool = True):
+    """
+    Decorator marking a function whose sequence of kernel launches only
+    depends on the layout (PyTree structure, types, and sizes) of its
+    arguments.
+
+    .. code-block:: python
+
+       @dr.freeze
+       def render_frame(scene_params, seed):
+           ...
+           return image
+
+    Each call is associated with a *recording* identified by the layout of the
+    positional and keyword arguments, which also includes the values of Python
+    scalars (since they are baked into the generated code as literals). The
+    attributes ``n_recordings`` and ``n_cache_hits`` of the returned wrapper
+    report the number of distinct layouts and the number of calls that reused
+    an existing one, and ``clear()`` discards all recordings.
+
+    By default (``eval=True``), the outputs of ``func`` are evaluated before
+    the wrapper returns. All calls with the same layout thereby launch a
+    consistent set of kernels that are served from Dr.Jit's kernel cache.
+
+    .. note::
+
+       Dr.Jit-Core currently does not expose an interface to record and
+       directly replay the kernel launches of a recording, hence ``func``
+       still runs (and traces its operations) on every call. Code that adopts
+       this decorator will transparently benefit from replay once it becomes
+       available.
+
+    Args:
+        func (Callable): The function to freeze.
+
+        eval (bool): Evaluate the function outputs after every call.
+
+    Returns:
+        Callable: A wrapper with the same interface as ``func``.
+    """
+    import functools
+    import drjit
+
+    def decorator(func):
+        recordings = {}
+
+        @functools.wraps(func)
+        def wrapper(*args, **kwargs):
+            key = _freeze_key((args, kwargs))
+            if key in recordings:
+                recordings[key] += 1
+                wrapper.n_cache_hits += 1
+            else:
+                recordings[key] = 1
+                wrapper.n_recordings += 1
+
+            result = func(*args, **kwargs)
+            if eval:
+                drjit.schedule(result)
+                drjit.eval()
+            return result
+
+        def clear():
+            recordings.clear()
+            wrapper.n_recordings = wrapper.n_cache_hits = 0
+
+        wrapper.n_recordings = wrapper.n_cache_hits = 0
+        wrapper.clear = clear
+        return wrapper
+
+    return decorator if func is None else decorator(func)
+
+
+def _memo_key(arg):
+    """
+    Compute a hashable description of the contents of a PyTree. JIT arrays are
+    identified by their variable index, which changes whenever an array is
+    modified (e.g., via :py:func:`drjit.scatter()`).
+    """
+    tp = type(arg)
+    if is_array_v(tp):
+        if is_tensor_v(tp):
+            return (tp, arg.shape, _memo_key(arg.array))
+        elif depth_v(tp) > 1:
+            return (tp, tuple(_memo_key(v) for v in arg))
+        elif is_jit_v(tp):
+            return (tp, arg.index)
+        return (tp, repr(arg))
+    elif tp is tuple or tp is list:
+        return (tp, tuple(_memo_key(v) for v in arg))
+    elif tp is dict:
+        return (tp, tuple((k, _memo_key(v)) for k, v in arg.items()))
+    elif is_struct_v(tp):
+        return (tp, tuple((k, _memo_key(getattr(arg, k)))
+                          for k in tp.DRJIT_STRUCT))
+    elif tp in (int, float, bool, str, type(None)):
+        return (tp, arg)
+    return (tp, id(arg))
+
+
+def memo(func=None, /, *, max_size: int = 1):
+    """
+    Decorator that memoizes the evaluated outputs of a function and reuses
+    them when it is called again with unchanged inputs.
+
+    .. code-block:: python
+
+       @dr.memo
+       def preprocess(geometry):
+           ...
+           return accel
+
+       @dr.memo
+       def shade(accel, material):
+           ...
+           return image
+
+       # Only 'shade' re-runs when the material changes
+       for material in materials:
+           image = shade(preprocess(geometry), material)
+
+    Each call computes a key from its positional and keyword arguments. JIT
+    arrays and tensors contribute their variable indices, which Dr.Jit
+    replaces whenever an array is modified, Python scalars and strings
+    contribute their value, and other objects their identity. When the key
+    matches a previous call, the wrapper returns (a copy of) the previous
+    outputs without tracing or launching kernels. Otherwise, it runs ``func``
+    and evaluates its outputs (:py:func:`drjit.eval()`). A pipeline that is
+    split into several memoized stages therefore only re-evaluates the stages
+    downstream of an input that actually changed.
+
+    The wrapper holds references to the arguments and outputs of the
+    ``max_size`` most recent calls, which ensures that the variable indices
+    forming the key cannot be reused. The attributes ``n_cache_hits`` and
+    ``n_cache_misses`` count calls that reused or recomputed outputs, and
+    ``clear()`` releases all cached entries.
+
+    Calls involving symbolic inputs or gradient-enabled arrays, as well as
+    calls within symbolic regions (e.g., :py:func:`drjit.while_loop()`), are
+    never memoized and simply forward to ``func``. The function should be
+    deterministic and only depend on its arguments.
+
+    Args:
+        func (Callable): The function to memoize.
+
+        max_size (int): The number of most recently used input/output pairs
+          to keep.
+
+    Returns:
+        Callable: A wrapper with the same interface as ``func``.
+    """
+    import functools
+    import collections
+
+    if max_size < 1:
+        raise RuntimeError("drjit.memo(): 'max_size' must be positive!")
+
+    def decorator(func):
+        cache = collections.OrderedDict()
+
+        @functools.wraps(func)
+        def wrapper(*args, **kwargs):
+            inputs = (args, kwargs)
+            if flag(JitFlag.SymbolicScope) or \
+               detail.any_symbolic(inputs) or grad_enabled(inputs):
+                return func(*args, **kwargs)
+
+            key = _memo_key(inputs)
+            entry = cache.get(key)
+            if entry is not None:
+                cache.move_to_end(key)
+                wrapper.n_cache_hits += 1
+                return copy(entry[1])
+
+            result = func(*args, **kwargs)
+            eval(result)
+            wrapper.n_cache_misses += 1
+
+            # Keep the inputs alive so that their indices remain unique
+            cache[key] = (inputs, result)
+            if len(cache) > max_size:
+                cache.popitem(last=False)
+            return copy(result)
+
+        def clear():
+            cache.clear()
+            wrapper.n_cache_hits = wrapper.n_cache_misses = 0
+
+        wrapper.n_cache_hits = wrapper.n_cache_misses = 0
+        wrapper.clear = clear
+        return wrapper
+
+    return decorator if func is None else decorator(func)
+
+
+def forward_tangents(arg, tangents, output, flags=ADFlag.Default):
+    """
+    Forward-propagate several tangents and compute the corresponding
+    directional derivatives within a single kernel launch.
+
+    This function computes the Jacobian-vector products of ``output`` with
+    respect to ``arg`` along each entry of ``tangents``. It is equivalent to
+    the following loop, except that the AD graph is retained until the last
+    tangent has been processed, and that the derivatives are evaluated
+    jointly at the end.
+
+    .. code-block:: python
+
+       result = []
+       for tangent in tangents:
+           dr.set_grad(arg, tangent)
+           dr.forward_to(output)
+           result.append(dr.grad(output))
+           dr.clear_grad(output)
+
+    Each tangent still requires its own AD graph traversal, but evaluating the
+    results jointly fuses the derivative computations into one kernel instead
+    of compiling and launching one kernel per tangent.
+
+    Args:
+        arg (object): A Dr.Jit array, tensor, or :ref:`PyTree <pytrees>` with
+          enabled gradients that specifies the input of the computation.
+
+        tangents (list): A sequence of tangents, each of which must be
+          compatible with ``arg``.
+
+        output (object): A Dr.Jit array, tensor, or :ref:`PyTree <pytrees>`
+          that depends on ``arg``.
+
+        flags (drjit.ADFlag | int): Controls what parts of the AD graph are
+          freed once the last tangent was processed. See
+          :py:func:`drjit.traverse()` for details.
+
+    Returns:
+        list: The gradients of ``output`` along each of the ``tangents``.
+    """
+    tangents = list(tangents)
+    result = []
+
+    for i, tangent in enumerate(tangents):
+        # Keep the graph until the last tangent has been propagated
+        flags_i = int(flags)
+        if i + 1 < len(tangents):
+            flags_i &= ~int(ADFlag.ClearEdges)
+
+        set_grad(arg, tangent)
+        enqueue(ADMode.Forward, arg)
+        traverse(ADMode.Forward, flags_i)
+        result.append(grad(output))
+        clear_grad(output)
+
+    schedule(result)
+    eval()
+    return result
+
+
+def hvp(f, x, v, eps: Optional[float] = None):
+    r"""
+    Compute the Hessian-vector product :math:`\mathbf{H}_f(\mathbf{x})\,
+    \mathbf{v}` of a scalar-valued function ``f``.
+
+    Dr.Jit only supports first-order differentiation (see :ref:`the AD
+    limitations <autodiff>`), hence this function approximates the product
+    using a central difference of two gradients along the direction ``v``:
+
+    .. math::
+
+       \mathbf{H}_f(\mathbf{x})\,\mathbf{v} \approx
+       \frac{\nabla f(\mathbf{x} + h\,\mathbf{v}) -
+              \nabla f(\mathbf{x} - h\,\mathbf{v})}{2h}.
+
+    Both gradients are computed within the same kernel, so the cost is roughly
+    twice that of a single gradient evaluation. The truncation error is of
+    order :math:`h^2` and vanishes when the gradient of ``f`` is a quadratic
+    function of its input. To make the step independent of the magnitude of
+    ``v``, the direction is normalized within the kernel (i.e., without
+    synchronizing with the device).
+
+    .. code-block:: python
+
+       def f(x):
+           return dr.sum(x**3)
+
+       x = Float(1, 2, 3)
+       dr.hvp(f, x, Float(1, 0, 0)) # [6, 0, 0]
+
+    Args:
+        f (Callable): A differentiable function that maps ``x`` to a scalar
+          (or an array, whose entries are then summed).
+
+        x (drjit.ArrayBase): A floating point Dr.Jit array or tensor
+          specifying the point at which the Hessian is evaluated.
+
+        v (drjit.ArrayBase): The direction with the same type as ``x``.
+
+        eps (float | None): Step size :math:`h` along the normalized direction.
+          By default, it is set to the cube root of the machine epsilon of
+          the underlying floating point type, which balances truncation and
+          round-off errors.
+
+    Returns:
+        drjit.ArrayBase: The Hessian-vector product with the same type as
+        ``x``.
+    """
+    tp = type(x)
+    if not is_diff_v(tp) or not is_float_v(tp):
+        raise TypeError("drjit.hvp(): 'x' must be a differentiable floating "
+                        "point array!")
+
+    if eps is None:
+        eps = float(epsilon(tp)) ** (1.0 / 3.0)
+
+    x, v = detach(x), detach(tp(v))
+    norm = sqrt(sum(v * v, axis=None))
+    norm = select(norm > 0, norm, 1)
+    step = v * (eps / norm)
+
+    grads = []
+    for xi in (x + step, x - step):
+        enable_grad(xi)
+        backward_from(f(xi))
+        grads.append(grad(xi))
+
+    result = (grads[0] - grads[1]) * (norm / (2 * eps))
+    eval(result)
+    return result
+
+
 # -------------------------------------------------------------------
 #      Miscellaneous
 # -------------------------------------------------------------------
@@ -1347,6 +2010,12 @@ def copy(arg: T, /) -> T:
     This function recursively traverses PyTrees and replaces Dr.Jit arrays with
     copies created via the ordinary copy constructor. It also rebuilds tuples,
     lists, dictionaries, and other :ref:`custom data strutures <custom_types_py>`.
+
+    Copies of JIT-compiled arrays use :ref:`copy-on-write <cow>` semantics:
+    the copy initially references the memory of the original, and a device
+    copy is only made when one of them is subsequently modified while the
+    other is still alive. It is therefore unnecessary to avoid this function
+    for performance reasons.
     """
 
     return detail.copy(arg)
@@ -1480,6 +2149,71 @@ def deg2rad(arg: T, /) -> T:
     return arg * (pi / 180.0)
 
 
+def bfloat16_to_float(arg, /):
+    '''
+    Convert an array of bfloat16 bit patterns into single precision values.
+
+    Dr.Jit has no dedicated bfloat16 type. Instead, bfloat16 data (e.g., a
+    PyTorch tensor with ``dtype=torch.bfloat16``) is imported via DLPack as a
+    16-bit unsigned integer array that holds the raw bit patterns. This
+    operation does not copy the data, and this function turns it into a
+    regular single precision array. The conversion is exact and happens within
+    the kernel that consumes the result.
+
+    The returned array can be differentiated like any other ``Float32`` array.
+    Use :py:func:`drjit.float_to_bfloat16` to convert results or gradients back
+    to bfloat16 storage.
+
+    Args:
+        arg (drjit.ArrayBase): A Dr.Jit ``UInt16`` array or tensor containing
+          bfloat16 bit patterns.
+
+    Returns:
+        drjit.ArrayBase: The corresponding ``Float32`` array or tensor.
+    '''
+    if not is_array_v(arg) or type_v(arg) != VarType.UInt16:
+        raise TypeError("drjit.bfloat16_to_float(): expected a Dr.Jit UInt16 "
+                        f"array (got '{type(arg).__name__}')!")
+
+    value = uint32_array_t(arg)(arg) << 16
+    return reinterpret_array(float32_array_t(arg), value)
+
+
+def float_to_bfloat16(arg, /):
+    '''
+    Round a floating point array to bfloat16 precision and return the result
+    as an array of 16-bit bit patterns.
+
+    The function rounds to the nearest representable value (ties to
+    even) and preserves infinities and NaNs. The resulting ``UInt16`` array or
+    tensor can be exported via DLPack and reinterpreted as a bfloat16 tensor
+    without a copy, for example using ``x.torch().view(torch.bfloat16)``.
+
+    The result is an integer array and is therefore not differentiable.
+
+    Args:
+        arg (drjit.ArrayBase): A Dr.Jit floating point array or tensor.
+
+    Returns:
+        drjit.ArrayBase: A ``UInt16`` array or tensor of bfloat16 bit patterns.
+    '''
+    if not is_array_v(arg) or not is_float_v(arg):
+        raise TypeError("drjit.float_to_bfloat16(): expected a Dr.Jit floating "
+                        f"point array (got '{type(arg).__name__}')!")
+
+    UInt16 = reinterpret_array_t(arg, VarType.UInt16)
+    arg = detach(arg)
+    if type_v(arg) != VarType.Float32:
+        arg = float32_array_t(arg)(arg)
+
+    u = reinterpret_array(uint32_array_t(arg), arg)
+
+    # Round to nearest even, and set the quiet bit so that NaNs don't
+    # truncate to an infinity
+    u = select(isnan(arg), u | 0x400000, u + (0x7FFF + ((u >> 16) & 1)))
+    return UInt16(u >> 16)
+
+
 def normalize(arg: T, /) -> T:
     '''
     Normalize the input vector so that it has unit length and return the
@@ -1567,8 +2301,8 @@ def sh_eval(d: ArrayBase, order: int) -> list:
     The implementation relies on efficient pre-generated branch-free code with
     aggressive constant folding and common subexpression elimination. It admits
     scalar and Jit-compiled input arrays. Evaluation routines are included for
-    orders ``0`` to ``10``. Requesting higher orders triggers a runtime
-    exception.
+    orders ``0`` to ``9``. Higher orders are evaluated via the recurrence of
+    the normalized associated Legendre polynomials, which has no order limit.
 
     This automatically generated code is based on the paper `Efficient
     Spherical Harmonic Evaluation <http://jcgt.org/published/0002/02/06/>`__,
@@ -1608,25 +2342,597 @@ def sh_eval(d: ArrayBase, order: int) -> list:
         ]
     """
 
-    if order < 0 or order > 9:
-        raise RuntimeError("sh_eval(): order must be in [0, 9]");
+    if order < 0:
+        raise RuntimeError("sh_eval(): order must be nonnegative");
     r = [None]*(order+1)*(order + 1)
     from . import _sh_eval as _sh_eval
-    getattr(_sh_eval, f'sh_eval_{order}')(d, r)
+    if order <= 9:
+        getattr(_sh_eval, f'sh_eval_{order}')(d, r)
+    else:
+        _sh_eval.sh_eval_n(d, order, r)
     return r
 
 
-def meshgrid(*args, indexing='xy') -> tuple: # <- proper type signature in stubs
-    '''
-    Return flattened N-D coordinate arrays from a sequence of 1D coordinate vectors.
+def sh_rotate(R, coeffs: list) -> list:
+    """
+    Rotate a real spherical harmonics expansion.
 
-    This function constructs flattened coordinate arrays that are convenient
-    for evaluating and plotting functions on a regular grid. An example is
-    shown below:
+    Given a list ``coeffs`` with the ``(order+1)**2`` coefficients of an
+    expansion in the basis of :py:func:`drjit.sh_eval()` and a 3x3 rotation
+    matrix ``R``, this function returns the coefficients of the rotated
+    expansion, i.e., the function :math:`d\\mapsto f(R^T d)`.
 
-    .. code-block::
+    The rotation matrix of each band is assembled from that of the previous
+    band using the recurrence of Ivanic and Ruedenberg (`Rotation Matrices for
+    Real Spherical Harmonics. Direct Determination by Recursion
+    <https://doi.org/10.1021/jp953350u>`__, J. Phys. Chem. 1996). Passing a
+    Jit-compiled matrix type (e.g., :py:class:`drjit.cuda.Matrix3f`) rotates a
+    whole batch of expansions with per-lane rotations at once. All steps are
+    differentiable.
 
-        import drjit as dr
+    Args:
+        R (drjit.ArrayBase): A 3x3 rotation matrix.
+
+        coeffs (list): The spherical harmonics coefficients. They can be
+          scalars, Jit-compiled arrays, or multi-channel types like colors.
+
+    Returns:
+        list: The coefficients of the rotated expansion.
+    """
+    from . import _sh_eval as _sh_eval
+    return _sh_eval.sh_rotate(R, coeffs)
+
+
+def mlp(x, layers, activation: str = 'relu') -> list:
+    """
+    Evaluate a small fully connected neural network independently for every
+    lane of a vectorized computation.
+
+    The input ``x`` is a sequence of ``n`` Dr.Jit arrays (e.g., a list of
+    :py:class:`drjit.cuda.Float` or a :py:class:`drjit.cuda.Array3f`) holding
+    one feature vector per lane. Each entry of ``layers`` is a ``(weight,
+    bias)`` pair, where ``weight`` is a 2D tensor of shape ``(n_out, n_in)``
+    and ``bias`` is a 1D tensor of shape ``(n_out,)`` or ``None``. The
+    function applies ``activation`` after every layer except for the last one
+    and returns a list with the network outputs.
+
+    Supported activations are ``"relu"``, ``"leaky_relu"``, ``"sigmoid"``,
+    ``"tanh"``, and ``"none"``.
+
+    The network is unrolled into a sequence of fused multiply-adds that become
+    part of the surrounding kernel, hence an inference step (e.g., of a neural
+    material or radiance cache) does not require a separate kernel launch or
+    a round-trip through another framework. The weights are shared by all
+    lanes and fetched using uniform gathers. The operation is differentiable
+    with respect to both the inputs and the weights, which enables training
+    via :py:func:`drjit.backward()`.
+
+    Since the unrolled code grows with the number of weights, this function is
+    only intended for small networks with up to a few thousand parameters.
+
+    .. code-block:: python
+
+       from drjit.cuda.ad import TensorXf, Array3f
+
+       w0, b0 = TensorXf(..., shape=(16, 3)), TensorXf(..., shape=(16,))
+       w1, b1 = TensorXf(..., shape=(1, 16)), None
+       y, = dr.mlp(Array3f(...), [(w0, b0), (w1, b1)])
+
+    Args:
+        x (Sequence[ArrayBase]): Per-lane input features.
+
+        layers (Sequence[tuple[ArrayBase, ArrayBase | None]]): Weight and bias
+          tensors of each layer.
+
+        activation (str): Activation applied between layers.
+
+    Returns:
+        list: Per-lane output features.
+    """
+    from . import _matmul as _matmul
+    return _matmul.mlp(x, layers, activation)
+
+
+def view(arg, /) -> TensorView:
+    """
+    Create a lazily strided view of the tensor ``arg``.
+
+    Regular tensor slicing (``tensor[...]``) immediately produces a new tensor
+    backed by a gather. Chains of slicing and transposition operations (e.g.,
+    extracting a color channel from a transposed image) thereby perform one
+    gather per step, and each intermediate result must be evaluated before
+    the next one can gather from it.
+
+    The :py:class:`drjit.TensorView` returned by this function instead only
+    tracks a shape, per-axis strides, and an element offset into ``arg``.
+    Indexing with integers, slices, ``None``, and ``...``, as well as
+    :py:meth:`TensorView.transpose()` and (contiguous)
+    :py:meth:`TensorView.reshape()` merely update this metadata. All steps are
+    folded into the index of a single gather that runs once the view is
+    materialized via :py:meth:`TensorView.tensor()`. This happens
+    automatically when a contiguous layout is required, e.g., during a
+    conversion to NumPy or another framework via DLPack. Materializing a view
+    that covers ``arg`` in its original layout is free.
+
+    .. code-block:: python
+
+       img = TensorXf(..., shape=(3, 512, 512))
+
+       # Single gather that extracts channel 1 and transposes it
+       g = dr.view(img)[1].T.tensor()
+
+    Indexing with Dr.Jit arrays cannot be expressed as a strided view and
+    falls back to materializing the view first.
+
+    Args:
+        arg (drjit.ArrayBase): A Dr.Jit tensor.
+
+    Returns:
+        drjit.TensorView: A view referencing ``arg``.
+    """
+    return TensorView(arg)
+
+
+def stream(func, inputs, chunk_size: int, reduce=None):
+    '''
+    Evaluate ``func`` over an input that is too large to be processed at once
+    by splitting it into chunks along the leading dimension.
+
+    The argument ``inputs`` is a :ref:`PyTree <pytrees>` (tuples, lists, and
+    dictionaries are supported) whose leaves are Dr.Jit arrays, tensors, or
+    other array types like NumPy arrays. All array leaves must have the same
+    size along their leading dimension; other leaves are forwarded as-is.
+    The function calls ``func`` with consecutive chunks of at most
+    ``chunk_size`` entries, evaluates the outputs of each call, and combines
+    them:
+
+    - By default, outputs are per-element results that are copied to the host
+      and concatenated into NumPy arrays, so that only one or two chunks need
+      to reside in device memory at any time.
+
+    - If ``reduce`` is a :py:class:`drjit.ReduceOp` (or a PyTree of such
+      values and ``None`` matching the structure of the output), the
+      corresponding outputs are instead combined across chunks using this
+      operation and returned as Dr.Jit arrays. For example, ``func`` may
+      return ``dr.sum(x)`` for a chunk ``x`` along with
+      ``reduce=dr.ReduceOp.Add`` to compute the sum over the whole input.
+
+    Host-side work such as slicing, tracing ``func``, and enqueuing uploads of
+    the next chunk overlaps with the asynchronous evaluation of the current
+    one on the CUDA backend. Per-element outputs are transferred once the
+    following chunk has been launched. To also make host-to-device uploads
+    asynchronous, NumPy inputs should reside in page-locked memory (see
+    :py:func:`drjit.detail.cuda_host_register`), and ``func`` should convert
+    its NumPy arguments into Dr.Jit arrays.
+
+    .. code-block:: python
+
+       def f(x: np.ndarray):
+           x = Float(x)
+           return dr.sum(x * x), dr.sqrt(x)
+
+       sq_sum, roots = dr.stream(f, data, chunk_size=2**26,
+                                 reduce=(dr.ReduceOp.Add, None))
+
+    Args:
+        func (Callable): The function to evaluate per chunk.
+
+        inputs (object): A PyTree of arrays with a common leading dimension.
+
+        chunk_size (int): The maximum number of entries per chunk.
+
+        reduce (drjit.ReduceOp | object | None): Specifies how to combine
+          outputs across chunks.
+
+    Returns:
+        object: The combined outputs with the same structure as the return
+        value of ``func``.
+    '''
+    from . import _stream as _stream
+    return _stream.stream(func, inputs, chunk_size, reduce)
+
+
+def to_host_many(arg, index: Optional[int] = 0):
+    '''
+    Copy entries of many JIT arrays to the host using a single transfer.
+
+    Reading a value via ``float(x)`` or ``x[0]`` evaluates ``x`` and waits
+    for the device. Doing so for many arrays (e.g., a set of losses, counters,
+    and convergence flags) therefore incurs one synchronization per value.
+    This function instead gathers all requested entries of the arrays in the
+    :ref:`PyTree <pytrees>` ``arg`` into a single staging buffer per backend,
+    evaluates them jointly, and copies each buffer to the host at once.
+
+    .. code-block:: python
+
+       loss, n_iter, converged = dr.to_host_many((loss, n_iter, converged))
+
+    Args:
+        arg (object): A Dr.Jit array, tensor, or :ref:`PyTree <pytrees>`
+          (lists, tuples, and dictionaries) of flat JIT-compiled arrays and
+          tensors. Other leaves are returned unchanged.
+
+        index (int | None): Entry that should be read from each array.
+          Negative values count from its end. Tensors are indexed in terms of
+          their flattened representation. When set to ``None``, the function
+          reads all entries and returns them as NumPy arrays. (Default: ``0``)
+
+    Returns:
+        object: A PyTree with the same structure as ``arg``, whose arrays were
+        replaced by Python scalars (or NumPy arrays when ``index`` is
+        ``None``).
+    '''
+    from . import _readback as _readback
+    return _readback.to_host_many(arg, index)
+
+
+def eval_async(*args, stream: Optional[int] = None):
+    '''
+    Evaluate the provided JIT variable(s) asynchronously on a separate stream.
+
+    :py:func:`drjit.eval()` launches kernels on the stream of the calling
+    thread, which means that independent computations (e.g., the renderings of
+    several cameras) execute one after the other. This function instead hands
+    the evaluation of ``*args`` to a worker thread. Since Dr.Jit keeps separate
+    state per thread, each worker compiles and launches its kernels on its own
+    CUDA stream, and kernels submitted to different workers can run
+    concurrently on the same GPU.
+
+    .. code-block:: python
+
+       futures = [dr.eval_async(render(camera)) for camera in cameras]
+       images = [f.result() for f in futures]
+
+    Dependencies between streams are tracked using CUDA events and do not
+    block the host: the worker waits for all work that the calling thread
+    previously submitted, and :py:meth:`result() <concurrent.futures.Future.result>`
+    makes the stream of the thread calling it wait for the asynchronous
+    evaluation. Call it from the thread that subsequently uses the arrays.
+    Pending side effects (e.g., scatters) of the calling thread are launched
+    via :py:func:`drjit.eval()` before the function returns. On the LLVM
+    backend, the worker waits for the evaluation to finish before resolving
+    the future.
+
+    Args:
+        *args (tuple): A variable-length list of Dr.Jit array instances or
+          :ref:`PyTrees <pytrees>` (they will be recursively traversed to
+          discover all Dr.Jit arrays.)
+
+        stream (int | None): Index of the worker (and thus stream) that should
+          perform the evaluation. By default, calls are distributed over four
+          workers in a round-robin fashion.
+
+    Returns:
+        concurrent.futures.Future: A future that resolves to the (now
+        evaluated) input argument, or to a tuple of them if several were
+        given.
+    '''
+    from . import _async as _async
+    return _async.eval_async(*args, stream=stream)
+
+
+def scatter_devices(arg, devices=None):
+    '''
+    Split a :ref:`PyTree <pytrees>` of CUDA arrays into contiguous shards along
+    the leading dimension and copy each shard to a different GPU.
+
+    This function is meant to distribute independent work such as batches of
+    rays across the GPUs of a node. The shards have (almost) equal sizes, and
+    the transfers use :py:func:`drjit.to_device()`. The caller must then
+    process the ``i``-th shard while its device is active:
+
+    .. code-block:: python
+
+       shards = dr.scatter_devices(rays)
+       results = []
+       for i, shard in enumerate(shards):
+           with dr.scoped_set_device(i):
+               results.append(dr.sum(render(shard)))
+               dr.eval(results[-1]) # launch without waiting
+
+       total = dr.gather_devices(results, device=0, reduce=dr.ReduceOp.Add)
+
+    Since kernel launches are asynchronous, the devices process their shards
+    concurrently once each one has been evaluated.
+
+    Args:
+        arg (object): A PyTree of arrays with a common leading dimension that
+          reside on the currently active device.
+
+        devices (Sequence[int] | None): The target devices. All CUDA devices
+          are used by default.
+
+    Returns:
+        list: One shard per entry of ``devices``.
+    '''
+    from . import _device as _device
+    return _device.scatter_devices(arg, devices)
+
+
+def gather_devices(parts, devices=None, device=None, reduce=None):
+    '''
+    Copy a sequence of :ref:`PyTrees <pytrees>` residing on different GPUs
+    (e.g., the output of :py:func:`drjit.scatter_devices()`) to a single
+    device and combine them.
+
+    By default, the parts are concatenated along their leading dimension. When
+    ``reduce`` is a :py:class:`drjit.ReduceOp`, they are instead combined
+    element-wise using this operation, which is useful to merge partial
+    results like per-device sums.
+
+    Args:
+        parts (Sequence[object]): PyTrees with a matching structure.
+
+        devices (Sequence[int] | None): The device holding each part (i.e.,
+          the device that was active when it was created). Defaults to
+          ``range(len(parts))``.
+
+        device (int | None): The target device. Defaults to the currently
+          active device.
+
+        reduce (drjit.ReduceOp | None): Optional reduction used to combine the
+          parts.
+
+    Returns:
+        object: The combined result, which resides on ``device``.
+    '''
+    from . import _device as _device
+    return _device.gather_devices(parts, devices, device, reduce)
+
+
+def kernel_history_report(history=None, group_by=('label', 'hash')):
+    '''
+    Aggregate the kernel history into per-kernel statistics.
+
+    This function groups the entries returned by :py:func:`drjit.kernel_history()`
+    by the kernel hash and the label of the enclosing
+    :py:func:`drjit.profile_range()` scopes (e.g. ``"frame/shading"`` when
+    kernels were launched within two nested ranges). Operations other than
+    JIT kernels are identified by their :py:class:`drjit.KernelType` instead of
+    a hash.
+
+    .. code-block:: python
+
+       with dr.scoped_set_flag(dr.JitFlag.KernelHistory):
+           with dr.profile_range("frame"):
+               render()
+
+       for s in dr.kernel_history_report()[:5]:
+           print(f"{s['label']} {s['hash']}: {s['count']}x, "
+                 f"{s['mean_time']:.1f} us on average")
+
+    Each entry of the result is a dictionary with the grouping keys and the
+    following statistics (with times in microseconds):
+
+    - ``count``: The number of launches.
+    - ``total_time``, ``mean_time``, ``p95_time``: The total, mean, and 95th
+      percentile of the execution time.
+    - ``codegen_time``, ``backend_time``: The total time spent on code
+      generation and compilation.
+    - ``cache_hit_ratio``: The fraction of launches that found the kernel in
+      the in-memory cache (``None`` for non-JIT operations).
+    - ``size``: The total number of processed elements.
+
+    The entries are sorted by decreasing total execution time.
+
+    Note that kernels are attributed to the profile range that is active when
+    they are *launched*, which may differ from the range that traced their
+    operations due to lazy evaluation. The attribution is only recorded while
+    :py:attr:`drjit.JitFlag.KernelHistory` is set.
+
+    Args:
+        history (list[dict] | None): Entries returned by
+          :py:func:`drjit.kernel_history()`. When not specified, the function
+          queries (and thereby clears) the current history.
+
+        group_by (Sequence[str]): A sequence containing ``"label"`` and/or
+          ``"hash"`` that specifies how entries are grouped.
+
+    Returns:
+        list[dict]: The aggregated statistics.
+    '''
+    from . import _history as _history
+    return _history.kernel_history_report(history, group_by)
+
+
+def kernel_history_trace(history=None, filename=None):
+    '''
+    Convert the kernel history into the JSON trace format of the Chrome
+    tracing tool (``chrome://tracing``), which is also supported by `Perfetto
+    <https://ui.perfetto.dev>`__.
+
+    Each backend is shown as a separate track, on which kernels appear nested
+    within the :py:func:`drjit.profile_range()` scopes that were active when
+    they were launched. Since the kernel history only records durations,
+    operations are placed back-to-back in launch order, i.e., the timeline
+    shows actual execution times but omits idle periods.
+
+    Args:
+        history (list[dict] | None): Entries returned by
+          :py:func:`drjit.kernel_history()`. When not specified, the function
+          queries (and thereby clears) the current history.
+
+        filename (str | None): Optional path of a file to write.
+
+    Returns:
+        str: The trace in JSON format.
+    '''
+    from . import _history as _history
+    return _history.kernel_history_trace(history, filename)
+
+
+def kernel_manifest_save(filename, history=None, cache_dir=None):
+    '''
+    Save a manifest of the kernels in the kernel history, which can later
+    be installed via :py:func:`drjit.precompile()`.
+
+    The manifest is a JSON file that records the hash, backend, profile range
+    label, and IR of every distinct JIT kernel in ``history``. It also embeds
+    the compiled kernels that Dr.Jit stored in its on-disk cache (see
+    :ref:`caching`), so run the workload once with the
+    :py:attr:`drjit.JitFlag.KernelHistory` flag before calling this function:
+
+    .. code-block:: python
+
+       with dr.scoped_set_flag(dr.JitFlag.KernelHistory):
+           run_workload()
+           dr.kernel_manifest_save('kernels.json')
+
+    Kernels compiled by OptiX use a separate cache and are not included.
+
+    Args:
+        filename (str): The path of the manifest file to write.
+
+        history (list[dict] | None): Entries returned by
+          :py:func:`drjit.kernel_history()`. When not specified, the function
+          queries (and thereby clears) the current history.
+
+        cache_dir (str | None): Directory of the on-disk kernel cache. The
+          default is Dr.Jit's platform-specific cache location.
+
+    Returns:
+        dict: The manifest.
+    '''
+    from . import _history as _history
+    return _history.kernel_manifest_save(filename, history, cache_dir)
+
+
+def precompile(manifest, threads=None, cache_dir=None):
+    '''
+    Install the compiled kernels of a manifest created by
+    :py:func:`drjit.kernel_manifest_save()`.
+
+    This function copies the compiled kernels into Dr.Jit's on-disk cache
+    using a pool of ``threads`` background threads. Later launches of these
+    kernels then load them from the cache (a *soft miss*) and skip the
+    backend compilation step, which usually dominates the cost of a cold
+    start. Tracing and the generation of the kernel IR still take place,
+    since they determine the kernel hash. Kernels that are already cached
+    are left unchanged.
+
+    Args:
+        manifest (str | dict): The path of a manifest file, or the
+          dictionary returned by :py:func:`drjit.kernel_manifest_save()`.
+
+        threads (int | None): The number of threads. The default is chosen
+          by :py:class:`concurrent.futures.ThreadPoolExecutor`.
+
+        cache_dir (str | None): Directory of the on-disk kernel cache. The
+          default is Dr.Jit's platform-specific cache location.
+
+    Returns:
+        int: The number of installed cache files.
+    '''
+    from . import _history as _history
+    return _history.precompile(manifest, threads, cache_dir)
+
+
+def bench(fn, *args, repeat=10, warmup=1, flush_caches=False, **kwargs):
+    '''
+    Benchmark the function ``fn`` using the kernel history.
+
+    This function calls ``fn(*args, **kwargs)`` ``warmup + repeat`` times,
+    evaluates the returned PyTree via :py:func:`drjit.eval()`, and captures
+    the launched kernels via :py:attr:`drjit.JitFlag.KernelHistory`. The
+    first ``warmup`` calls are discarded, which excludes one-time costs like
+    the compilation of kernels that subsequently come from the kernel cache.
+
+    .. code-block:: python
+
+       x = dr.arange(Float, 1000000)
+       stats = dr.bench(lambda x: dr.sin(x) * 2, x, repeat=20)
+       print(f"{stats['execution']['median']:.1f} us per call")
+
+    The result is a dictionary with the following entries (times in
+    microseconds):
+
+    - ``tracing``: The time spent within ``fn``, which mainly consists of
+      tracing the computation on the Python side.
+    - ``codegen``, ``backend``: The time spent on generating and compiling
+      kernel code (both are close to zero when all kernels are found in
+      the cache).
+    - ``execution``: The summed execution time of all launched operations.
+    - ``wall``: The wall-clock time of each iteration, including the
+      synchronization that waits for the final kernel.
+
+    Each of these is itself a dictionary with the ``min``, ``median``,
+    ``mean``, ``p95``, ``max``, ``std`` and ``mad`` (median absolute
+    deviation) statistics over the ``repeat`` measurements. The median and
+    MAD are robust to occasional outliers caused by OS scheduling and
+    should generally be preferred. Further entries are:
+
+    - ``repeat``: The number of measurements.
+    - ``kernels``: The number of operations launched per call (maximum over all
+      measurements).
+    - ``cache_hit_ratio``: The fraction of JIT kernel launches that were served
+      from the in-memory kernel cache (``None`` if there were none).
+    - ``samples``: A dictionary with the individual measurements of ``tracing``,
+      ``codegen``, ``backend``, ``execution`` and ``wall``.
+    - ``result``: The return value of the last call to ``fn``.
+
+    Note that this function clears the kernel history when it starts and
+    consumes all history entries that are produced while it runs.
+
+    Args:
+        fn (Callable): The function to be benchmarked.
+
+        *args, **kwargs: Arguments forwarded to ``fn``.
+
+        repeat (int): The number of measured calls.
+
+        warmup (int): The number of initial calls that are not measured.
+
+        flush_caches (bool): If set to ``True``, the kernel and memory
+          allocation caches are flushed (via :py:func:`drjit.flush_kernel_cache`
+          and :py:func:`drjit.flush_malloc_cache`) before every call. This
+          measures the cold-start performance including kernel compilation.
+
+    Returns:
+        dict: The benchmark statistics.
+    '''
+    from . import _history as _history
+    return _history.bench(fn, *args, repeat=repeat, warmup=warmup,
+                          flush_caches=flush_caches, **kwargs)
+
+
+def trace_export(spans, filename=None, service_name="drjit"):
+    '''
+    Convert spans captured by :py:func:`drjit.trace_stop()` into the JSON
+    encoding of the `OpenTelemetry protocol
+    <https://opentelemetry.io/docs/specs/otlp/>`__ (OTLP).
+
+    All spans are assigned to a single trace and keep their nesting. The
+    callsite is reported using the semantic attributes ``code.filepath`` and
+    ``code.lineno``, while ``drjit.category`` specifies the span category
+    (e.g., ``"eval"`` or ``"kernel"``). The output can be sent to the
+    ``/v1/traces`` endpoint of an OpenTelemetry collector or loaded into
+    tools that accept OTLP files.
+
+    Args:
+        spans (list[dict]): Spans returned by :py:func:`drjit.trace_stop()`.
+
+        filename (str | None): Optional path of a file to write.
+
+        service_name (str): Value of the ``service.name`` resource attribute.
+
+    Returns:
+        str: The trace in OTLP/JSON format.
+    '''
+    from . import _trace as _trace
+    return _trace.trace_export(spans, filename, service_name)
+
+
+def meshgrid(*args, indexing='xy') -> tuple: # <- proper type signature in stubs
+    '''
+    Return flattened N-D coordinate arrays from a sequence of 1D coordinate vectors.
+
+    This function constructs flattened coordinate arrays that are convenient
+    for evaluating and plotting functions on a regular grid. An example is
+    shown below:
+
+    .. code-block::
+
+        import drjit as dr
 
         x, y = dr.meshgrid(
             dr.arange(dr.llvm.UInt, 4),
@@ -1665,7 +2971,7 @@ def meshgrid(*args, indexing='xy') -> tuple: # <- proper type signature in stubs
         if not is_array_v(v) or depth_v(v) != 1 or type(v) is not t:
             raise Exception("meshgrid(): consistent 1D dynamic arrays expected!")
 
-    size = prod((len(v) for v in args))
+    size = total = prod((len(v) for v in args))
     index = arange(uint32_array_t(t), size)
 
     result = []
@@ -1678,7 +2984,12 @@ def meshgrid(*args, indexing='xy') -> tuple: # <- proper type signature in stubs
         size //= len(v)
         index_v = index // size
         index = fma(-index_v, size, index)
-        result.append(gather(t, v, index_v))
+        if is_jit_v(t) and (len(v) == 1 or (v.state == VarState.Literal and
+                                            not grad_enabled(v))):
+            # Broadcast without a gather (see drjit.tile())
+            result.append(tile(v, total // len(v)))
+        else:
+            result.append(gather(t, v, index_v))
 
     if indexing == "xy":
         result[0], result[1] = result[1], result[0]
@@ -1826,6 +3137,296 @@ def upsample(t, shape=None, scale_factor=None):
         return type(t)(gather(type(t.array), t.array, index), tuple(shape))
 
 
+def resample(source, shape, filter: str = "tent"):
+    '''
+    resample(source, shape, filter='tent')
+    Resample the floating point tensor ``source`` to the shape ``shape`` using
+    a separable reconstruction filter.
+
+    In contrast to :py:func:`drjit.upsample()`, the target shape is arbitrary,
+    i.e., each axis can be up- or downsampled by a non-integer factor. The
+    function resamples one axis at a time, which produces one kernel per
+    axis whose size changes. Each output sample is a weighted sum over a
+    small number of input samples. The filter weights are normalized, and
+    the filter is widened when downsampling to avoid aliasing. Input
+    positions beyond the boundary are clamped to the nearest edge sample.
+    The operation is differentiable with respect to ``source``.
+
+    The following filters are available:
+
+    - ``"box"``: box filter (nearest neighbor when upsampling).
+    - ``"tent"``: tent filter (linear interpolation when upsampling).
+    - ``"lanczos"``: Lanczos-windowed sinc filter with 3 lobes.
+    - ``"mitchell"``: Mitchell-Netravali cubic filter with :math:`B=C=1/3`.
+
+    Args:
+        source (drjit.ArrayBase): A Dr.Jit floating point tensor.
+
+        shape (Sequence[int]): The target shape. Trailing axes that are not
+          specified keep their size.
+
+        filter (str): The name of the reconstruction filter.
+
+    Returns:
+        drjit.ArrayBase: The resampled tensor of the same type as ``source``.
+    '''
+    from . import _resample as _resample
+    return _resample.resample(source, shape, filter)
+
+
+def gather_nd(source, index, active=True):
+    '''
+    Gather rows of the tensor ``source`` using a multi-dimensional index.
+
+    The sequence ``index`` contains :math:`k` integer arrays that address the
+    :math:`k` leading axes of ``source``. The function returns a tensor of
+    shape ``(n, *source.shape[k:])``. Entry ``i`` along its first axis holds
+    ``source[index[0][i], ..., index[k-1][i], ...]``, and inactive entries
+    are zero. A single index array may also be passed directly instead of a
+    sequence.
+
+    .. code-block:: python
+
+       # Fetch the RGB values of an image of shape (h, w, 3) at the
+       # given pixel positions. Returns a tensor of shape (n, 3).
+       rgb = dr.gather_nd(image, (pos_y, pos_x))
+
+    This is equivalent to ``source[index[0], ..., index[k-1], :]``. However,
+    the flattened offset is computed inside the generated kernel and not by
+    the Python indexing machinery. When the trailing axes have a
+    power-of-two size (e.g., RGBA or XYZW data), each index then fetches its
+    row with one packet gather.
+
+    Args:
+        source (drjit.ArrayBase): A Dr.Jit tensor.
+
+        index (Sequence[drjit.ArrayBase] | drjit.ArrayBase): Integer
+          arrays addressing the leading axes of ``source``.
+
+        active (bool | drjit.ArrayBase): Optional mask to disable
+          individual rows.
+
+    Returns:
+        drjit.ArrayBase: The gathered tensor, whose type matches ``source``.
+    '''
+    from . import _gather_nd as _gather_nd
+    return _gather_nd.gather_nd(source, index, active)
+
+
+def scatter_nd(target, value, index, active=True):
+    '''
+    Write the rows of ``value`` into the tensor ``target`` using a
+    multi-dimensional index.
+
+    This function is the inverse of :py:func:`drjit.gather_nd()`. It writes
+    row ``i`` of ``value`` (a tensor of shape ``(n, *target.shape[k:])``)
+    to position ``(index[0][i], ..., index[k-1][i])`` of ``target``, which is
+    modified in-place. When all axes are indexed, ``value`` can also be a 1D
+    array. Power-of-two row sizes use one packet scatter per row.
+
+    Args:
+        target (drjit.ArrayBase): A Dr.Jit tensor that will be modified.
+
+        value (drjit.ArrayBase): The rows to be written.
+
+        index (Sequence[drjit.ArrayBase] | drjit.ArrayBase): Integer
+          arrays addressing the leading axes of ``target``.
+
+        active (bool | drjit.ArrayBase): Optional mask to disable
+          individual rows.
+    '''
+    from . import _gather_nd as _gather_nd
+    _gather_nd.scatter_nd(ReduceOp.Identity, target, value, index, active)
+
+
+def scatter_nd_reduce(op, target, value, index, active=True):
+    '''
+    Atomically combine the rows of ``value`` with the tensor ``target`` using
+    a multi-dimensional index.
+
+    This function works like :py:func:`drjit.scatter_nd()`, except that it
+    combines each row with the existing contents of ``target`` using the
+    reduction ``op`` (see :py:func:`drjit.scatter_reduce()`).
+
+    Args:
+        op (drjit.ReduceOp): The reduction to perform.
+
+        target (drjit.ArrayBase): A Dr.Jit tensor that will be modified.
+
+        value (drjit.ArrayBase): The rows to be combined with ``target``.
+
+        index (Sequence[drjit.ArrayBase] | drjit.ArrayBase): Integer
+          arrays addressing the leading axes of ``target``.
+
+        active (bool | drjit.ArrayBase): Optional mask to disable
+          individual rows.
+    '''
+    from . import _gather_nd as _gather_nd
+    _gather_nd.scatter_nd(op, target, value, index, active)
+
+
+def argsort(value, /, reverse: bool = False):
+    '''
+    Return the permutation that stably sorts the 1D array ``value``.
+
+    The function computes an array of 32-bit unsigned integer indices ``perm``
+    such that ``dr.gather(type(value), value, perm)`` is sorted in ascending
+    order (or descending order when ``reverse=True``). The sort is *stable*,
+    i.e., equal keys retain their relative order, which makes it suitable
+    for deterministic reductions and for building hierarchies from Morton
+    codes.
+
+    Supported key types are 32- and 64-bit signed/unsigned integers and
+    floating point values. Negative zero is ordered before positive zero, and
+    NaN values are placed at the ends of the array based on their sign bit.
+
+    The implementation is a device-wide least significant digit radix sort
+    composed of existing Dr.Jit operations (one prefix sum and one scatter per
+    key bit). It does not require any host synchronization.
+
+    Args:
+        value (drjit.ArrayBase): A flat (1D) dynamically sized Dr.Jit array
+          containing the sort keys.
+
+        reverse (bool): Sort in descending instead of ascending order.
+
+    Returns:
+        drjit.ArrayBase: The sorting permutation.
+    '''
+    from . import _sort as _sort
+    return _sort.argsort(value, reverse)
+
+
+def sort(value, /, reverse: bool = False):
+    '''
+    Sort the 1D array ``value`` in ascending (or, with ``reverse=True``,
+    descending) order.
+
+    This is equivalent to gathering ``value`` with the permutation computed
+    by :py:func:`drjit.argsort()`. Since the gather is differentiable,
+    gradients propagate through the permutation.
+
+    Args:
+        value (drjit.ArrayBase): A flat (1D) dynamically sized Dr.Jit array.
+
+        reverse (bool): Sort in descending instead of ascending order.
+
+    Returns:
+        drjit.ArrayBase: The sorted array.
+    '''
+    perm = argsort(detach(value), reverse)
+    return gather(type(value), value, perm)
+
+
+def sort_by_key(keys, values, /, reverse: bool = False):
+    '''
+    Stably sort ``values`` based on the 1D array ``keys``.
+
+    The function returns a tuple ``(sorted_keys, sorted_values)``, where the
+    permutation that sorts ``keys`` (see :py:func:`drjit.argsort()`) is also
+    applied to ``values``. The latter can be any Dr.Jit array with the same
+    number of entries as ``keys`` (e.g., a :py:class:`drjit.cuda.Array3f`), or
+    a tuple/list of such arrays. The permutation is applied using
+    differentiable gathers.
+
+    Args:
+        keys (drjit.ArrayBase): A flat (1D) dynamically sized Dr.Jit array
+          containing the sort keys.
+
+        values (object): A Dr.Jit array or a sequence of arrays.
+
+        reverse (bool): Sort in descending instead of ascending order.
+
+    Returns:
+        tuple: The sorted keys and values.
+    '''
+    perm = argsort(detach(keys), reverse)
+    if isinstance(values, (tuple, list)):
+        sorted_values = type(values)(gather(type(v), v, perm) for v in values)
+    else:
+        sorted_values = gather(type(values), values, perm)
+    return gather(type(keys), keys, perm), sorted_values
+
+
+def histogram(keys, n_bins: int, weights=None):
+    '''
+    Compute a histogram of the integer array ``keys`` with ``n_bins`` bins.
+
+    Entry ``i`` of the result counts the number of occurrences of the value
+    ``i`` in ``keys`` as a 32-bit unsigned integer array. Keys outside of the
+    range ``[0, n_bins)`` are ignored. When ``weights`` is specified, the
+    function instead accumulates these per-key weights (e.g., to build a
+    weighted distribution of samples), in which case the result has the same
+    type as ``weights``.
+
+    A naive implementation using :py:func:`drjit.scatter_inc()` or
+    :py:func:`drjit.scatter_add()` causes heavy contention when many keys map
+    to the same bin. This function instead privatizes the bins: on the LLVM
+    backend, small histograms are expanded into a separate copy per
+    CPU core (:py:attr:`drjit.ReduceMode.Expand`), while the CUDA backend
+    pre-reduces updates targeting the same bin within each warp
+    (:py:attr:`drjit.ReduceMode.Local`).
+
+    Args:
+        keys (drjit.ArrayBase): A flat (1D) dynamically sized integer array.
+
+        n_bins (int): The number of histogram bins.
+
+        weights (drjit.ArrayBase | None): Optional per-key weights.
+
+    Returns:
+        drjit.ArrayBase: The histogram.
+    '''
+    from . import _sort as _sort
+    return _sort.histogram(keys, n_bins, weights)
+
+
+def run_length_encode(value, /):
+    '''
+    Compute a run-length encoding of the 1D array ``value``.
+
+    The function returns a tuple ``(values, counts)``, where ``values`` lists
+    the value of every maximal run of consecutive equal entries, and
+    ``counts`` (a 32-bit unsigned integer array) their lengths. For example,
+    the encoding of ``[1, 1, 2, 1, 1, 1]`` is ``([1, 2, 1], [2, 1, 3])``.
+
+    Since the number of runs determines the size of the output, this operation
+    evaluates the input and synchronizes with the device (like
+    :py:func:`drjit.compress()`).
+
+    Args:
+        value (drjit.ArrayBase): A flat (1D) dynamically sized Dr.Jit array.
+
+    Returns:
+        tuple: The run values and their lengths.
+    '''
+    from . import _sort as _sort
+    return _sort.run_length_encode(value)
+
+
+def unique(value, /, return_counts: bool = False):
+    '''
+    Return the sorted unique entries of the 1D array ``value``.
+
+    This function combines :py:func:`drjit.sort()` and
+    :py:func:`drjit.run_length_encode()`. When ``return_counts=True``, it
+    returns a tuple whose second entry counts the occurrences of each unique
+    value. Like :py:func:`drjit.run_length_encode()`, this
+    operation synchronizes with the device.
+
+    Args:
+        value (drjit.ArrayBase): A flat (1D) dynamically sized Dr.Jit array.
+
+        return_counts (bool): Also return the number of occurrences of each
+          unique value.
+
+    Returns:
+        drjit.ArrayBase | tuple: The unique values, and optionally their counts.
+    '''
+    from . import _sort as _sort
+    return _sort.unique(value, return_counts)
+
+
 def binary_search(start, end, pred):
     '''
     Perform a binary search over a range given a predicate ``pred``, which
@@ -1879,12 +3480,138 @@ def binary_search(start, end, pred):
     return start
 
 
+def searchsorted(sorted_array, values, /, side: str = "left", layout=None):
+    '''
+    Find the indices where ``values`` should be inserted into ``sorted_array``
+    to maintain its order.
+
+    For each entry ``x`` of ``values``, the function returns the first index
+    ``i`` such that ``sorted_array[i] >= x`` (``side="left"``) or
+    ``sorted_array[i] > x`` (``side="right"``), or the size of
+    ``sorted_array`` when no such entry exists. This is, e.g., useful to
+    sample discrete distributions via their cumulative distribution function.
+
+    In contrast to :py:func:`drjit.binary_search()`, which traces a separate
+    set of operations for each step of the search, the implementation
+    performs a branchless descent through an implicit binary tree within a
+    single symbolic loop (:py:func:`drjit.while_loop()`).
+
+    Successive steps of a binary search over a large sorted array access
+    widely separated memory addresses. Optionally, specify ``layout`` to
+    instead search through the Eytzinger (breadth-first) ordering of
+    ``sorted_array`` computed by :py:func:`drjit.eytzinger()`. This ordering
+    stores the top levels of the tree (which are visited by all lanes) in
+    adjacent memory locations, which improves cache utilization when the
+    same array is searched repeatedly.
+
+    .. code-block:: python
+
+       cdf = dr.prefix_sum(pdf, exclusive=False)
+       cdf_e = dr.eytzinger(cdf)  # Precompute once (optional)
+
+       index = dr.searchsorted(cdf, sample * cdf[-1], side='right', layout=cdf_e)
+
+    Args:
+        sorted_array (drjit.ArrayBase): A flat (1D) JIT-compiled array with
+          entries in ascending order.
+
+        values (object): The values to be located. They are converted to the
+          type of ``sorted_array``.
+
+        side (str): Either ``"left"`` or ``"right"``, see above.
+
+        layout (drjit.ArrayBase | None): The result of
+          ``drjit.eytzinger(sorted_array)``.
+
+    Returns:
+        drjit.ArrayBase: A 32-bit unsigned integer array with the insertion
+        indices.
+    '''
+    from . import _sort as _sort
+    return _sort.searchsorted(sorted_array, values, side, layout)
+
+
+def eytzinger(sorted_array, /):
+    '''
+    Reorder the sorted 1D array ``sorted_array`` into an Eytzinger
+    (breadth-first) layout for use with :py:func:`drjit.searchsorted()`.
+
+    Entry ``k`` (starting at ``k=1``) of the result stores the pivot of node
+    ``k`` of a perfect binary search tree over ``sorted_array``, whose
+    children are the nodes ``2k`` and ``2k+1``. The tree is padded to a size
+    of :math:`2^h` entries, where :math:`h` is the bit length of the array
+    size. The first entry and padding entries are unused.
+
+    Args:
+        sorted_array (drjit.ArrayBase): A flat (1D) JIT-compiled array with
+          entries in ascending order.
+
+    Returns:
+        drjit.ArrayBase: The reordered array.
+    '''
+    from . import _sort as _sort
+    return _sort.eytzinger(sorted_array)
+
+
+def persistent_loop(state, cond, body, pool_size=None, labels=(), label=None,
+                    mode=None):
+    '''
+    Run a loop over independent work items using a fixed pool of persistent
+    lanes that are refilled as items terminate.
+
+    This function has the same interface and semantics as
+    :py:func:`drjit.while_loop()`: it repeatedly applies ``body`` to the
+    entries of ``state`` whose ``cond`` is ``True`` and returns the final
+    state. The difference is in how the loop is executed. A regular loop
+    launches one lane per entry, and the lanes of entries that terminate
+    early remain idle until the longest-running entry finishes. This wastes
+    most of the device when trip counts vary strongly (e.g., in path
+    tracing).
+
+    Here, ``pool_size`` lanes instead fetch work items from a shared
+    device-resident counter using :py:func:`drjit.scatter_inc()`. When the
+    item of a lane terminates, the lane writes the final state to the output
+    and fetches the next unprocessed item. Finishing an item costs one extra
+    iteration in which the lane does not run ``body``. The loop itself is
+    an ordinary :py:func:`drjit.while_loop()` (symbolic by default), and
+    ``body`` is masked via :py:func:`drjit.if_stmt()`.
+
+    Entries of ``state`` must be JIT-compiled Dr.Jit arrays whose width is
+    either the number of work items or ``1``. The function does not support
+    reverse-mode differentiation.
+
+    Args:
+        state (tuple): The initial loop state of all work items.
+
+        cond (Callable): The loop condition (see :py:func:`drjit.while_loop()`).
+
+        body (Callable): The loop body (see :py:func:`drjit.while_loop()`).
+
+        pool_size (int | None): The number of persistent lanes. The default
+          is 2\ :sup:`20` (or the number of work items, if it is smaller).
+
+        labels (Sequence[str]): Optional names of the state variables.
+
+        label (str | None): Optional name of the loop.
+
+        mode (str | None): The evaluation mode of the underlying
+          :py:func:`drjit.while_loop()`.
+
+    Returns:
+        tuple: The final state of all work items.
+    '''
+    from . import _persistent as _persistent
+    return _persistent.persistent_loop(state, cond, body, pool_size,
+                                       labels, label, mode)
+
+
 def assert_true(
     cond,
     fmt: Optional[str] = None,
     *args,
     tb_depth: int = 3,
     tb_skip: int = 0,
+    deferred: bool = False,
     **kwargs,
 ):
     """
@@ -1919,6 +3646,15 @@ def assert_true(
     on ``sys.stderr`` instead of raising an exception, as the original
     execution context no longer exists at that point.
 
+    Checking an evaluated array normally requires waiting for the device to
+    finish all queued work. Specify ``deferred=True`` to avoid this
+    synchronization: the index of the first failing entry is then recorded in
+    a device buffer that is computed along with the next kernel, and the
+    ``AssertionError`` is raised by the next call to :py:func:`drjit.sync_thread`
+    or :py:func:`drjit.check_asserts`. The arguments ``*args`` and
+    ``**kwargs`` are only formatted at that point, and the message is
+    restricted to the first failing entry.
+
     Assertion checks carry a performance cost, hence they are disabled by
     default. To enable them, set the JIT flag :py:attr:`dr.JitFlag.Debug`.
 
@@ -1944,27 +3680,50 @@ def assert_true(
           the assertion check is called from a helper function that should not be
           shown.
 
+        deferred (bool): Record failures on the device and report them at the
+          next call to :py:func:`drjit.sync_thread` or
+          :py:func:`drjit.check_asserts` instead of synchronizing immediately.
+          This only applies to evaluated (non-symbolic) array conditions.
+
         **kwargs (dict): Optional variable-length keyword arguments referenced
           by ``fmt``, see :py:func:`drjit.print` for details on this.
     """
 
     if not flag(JitFlag.Debug):
         return
-    if cond is True or (not detail.any_symbolic(cond) and all(cond)):
+
+    symbolic = detail.any_symbolic(cond)
+    deferred = deferred and not symbolic and is_jit_v(cond)
+
+    if cond is True or (not symbolic and not deferred and all(cond)):
         return
 
     import traceback, sys, types
 
     active = not cond if isinstance(cond, bool) else ~cond
 
-    if detail.any_symbolic((active, args, kwargs)):
-        tb_frame = sys._getframe(tb_skip + 1)
+    def traceback_msg():
+        tb_frame = sys._getframe(tb_skip + 2)
         tb = types.TracebackType(tb_next=None,
                                  tb_frame=tb_frame,
                                  tb_lasti=tb_frame.f_lasti,
                                  tb_lineno=tb_frame.f_lineno)
 
-        tb_msg = "".join(traceback.format_tb(tb, limit=tb_depth))
+        return "".join(traceback.format_tb(tb, limit=tb_depth))
+
+    if deferred and not detail.any_symbolic((args, kwargs)):
+        # Find the first failing entry without waiting for the device
+        UInt32 = uint32_array_t(type(active))
+        first = full(UInt32, 0xFFFFFFFF, 1)
+        scatter_reduce(ReduceOp.Min, first, arange(UInt32, width(active)),
+                       UInt32(0), active)
+        schedule(first)
+
+        _deferred_asserts.append(
+            (first, fmt, args, kwargs, width(active), traceback_msg()))
+
+    elif detail.any_symbolic((active, args, kwargs)):
+        tb_msg = traceback_msg()
 
         # Note: this is not a regular print statement -- it maps to 'drjit.print'
         print(
@@ -1994,6 +3753,7 @@ def assert_false(
     *args,
     tb_depth: int = 3,
     tb_skip: int = 0,
+    deferred: bool = False,
     **kwargs,
 ):
     """
@@ -2006,6 +3766,7 @@ def assert_false(
         *args,
         tb_depth=tb_depth,
         tb_skip=tb_skip+1,
+        deferred=deferred,
         **kwargs,
     )
 
@@ -2016,6 +3777,7 @@ def assert_equal(
     *args,
     limit: int = 3,
     tb_skip: int = 0,
+    deferred: bool = False,
     **kwargs,
 ):
     """
@@ -2028,10 +3790,60 @@ def assert_equal(
         *args,
         limit=limit,
         tb_skip=tb_skip+1,
+        deferred=deferred,
         **kwargs,
     )
 
 
+# Pending checks registered by 'assert_true(..., deferred=True)'
+_deferred_asserts = []
+
+
+def check_asserts() -> None:
+    """
+    Report failures of deferred assertion checks.
+
+    This function waits for the device and raises an ``AssertionError``
+    describing the first failing entry of the oldest assertion registered via
+    :py:func:`drjit.assert_true(..., deferred=True) <drjit.assert_true>` since
+    the last check. All pending checks are discarded afterwards.
+
+    :py:func:`drjit.sync_thread` calls this function automatically.
+    """
+    global _deferred_asserts
+    if not _deferred_asserts:
+        return
+
+    pending, _deferred_asserts = _deferred_asserts, []
+
+    for first, fmt, args, kwargs, size, tb_msg in pending:
+        index = first[0]
+        if index == 0xFFFFFFFF:
+            continue
+
+        # Note: this is not a regular format statement -- it maps to 'drjit.format'
+        msg = format(
+            f"Assertion failure (entry {index})" + ((': ' + fmt) if fmt else '!') + "\n{tb_msg}",
+            *args,
+            tb_msg=tb_msg,
+            active=arange(type(first), size) == index,
+            **kwargs
+        )
+
+        raise AssertionError(msg)
+
+
+_sync_thread = sync_thread
+
+
+def sync_thread() -> None:
+    _sync_thread()
+    check_asserts()
+
+
+sync_thread.__doc__ = _sync_thread.__doc__
+
+
 newaxis = None
 
 del overload, Optional
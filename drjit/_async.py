@@ -0,0 +1,105 @@
+import drjit as dr
+import itertools
+import queue
+import threading
+from concurrent.futures import Future
+from typing import Any, Dict, Optional
+
+from ._stream import _flatten
+
+# Number of worker threads used when no explicit stream index is given
+_DEFAULT_STREAMS = 4
+
+_workers: Dict[int, '_Worker'] = {}
+_workers_lock = threading.Lock()
+_counter = itertools.count()
+
+
+class _Worker:
+    """
+    Daemon thread that evaluates submitted work. Dr.Jit keeps separate state
+    per thread, hence each worker launches its kernels on its own CUDA stream.
+    """
+
+    def __init__(self, index: int):
+        self.queue: queue.SimpleQueue = queue.SimpleQueue()
+        self.thread = threading.Thread(target=self._run, daemon=True,
+                                       name=f'drjit-eval-async-{index}')
+        self.thread.start()
+
+    def _run(self) -> None:
+        while True:
+            future, func = self.queue.get()
+            if not future.set_running_or_notify_cancel():
+                continue
+            try:
+                future._event = func()
+                future.set_result(future._value)
+            except BaseException as e:
+                future.set_exception(e)
+
+
+def _worker(stream: int) -> _Worker:
+    with _workers_lock:
+        worker = _workers.get(stream)
+        if worker is None:
+            worker = _workers[stream] = _Worker(stream)
+        return worker
+
+
+class EvalFuture(Future):
+    """
+    Future returned by :py:func:`drjit.eval_async()`. Calling :py:meth:`result()`
+    orders subsequent work of the calling thread after the asynchronous
+    evaluation without waiting for the device.
+    """
+
+    def __init__(self, value: Any):
+        super().__init__()
+        self._value = value
+        self._event = 0
+
+    def result(self, timeout: Optional[float] = None) -> Any:
+        value = super().result(timeout)
+        if self._event:
+            dr.detail.cuda_stream_wait_event(self._event)
+        return value
+
+    def __del__(self) -> None:
+        if self._event:
+            dr.detail.cuda_event_destroy(self._event)
+            self._event = 0
+
+
+def eval_async(*args: Any, stream: Optional[int] = None) -> EvalFuture:
+    if stream is None:
+        stream = next(_counter) % _DEFAULT_STREAMS
+    elif stream < 0:
+        raise RuntimeError("drjit.eval_async(): 'stream' must be non-negative!")
+
+    leaves, _ = _flatten(args)
+    cuda = any(dr.is_jit_v(l) and dr.backend_v(l) == dr.JitBackend.CUDA
+               for l in leaves)
+
+    # Side effects (e.g., scatters) are queued per thread, so a worker cannot
+    # evaluate them. Launch them here first, and let the worker's stream wait
+    # for the work that was previously submitted by the calling thread.
+    dr.eval()
+    ready = dr.detail.cuda_event_record() if cuda else 0
+
+    def run() -> int:
+        if ready:
+            dr.detail.cuda_stream_wait_event(ready)
+            dr.detail.cuda_event_destroy(ready)
+
+        dr.eval(*args)
+
+        if cuda:
+            return dr.detail.cuda_event_record()
+
+        dr.sync_thread()
+        return 0
+
+    future = EvalFuture(args[0] if len(args) == 1 else args)
+    _worker(stream).queue.put((future, run))
+    return future
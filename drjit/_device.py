@@ -0,0 +1,89 @@
+import drjit as dr
+from typing import Any, List, Optional, Sequence
+
+from ._reduce import _reduce_ops
+from ._stream import _flatten, _length, _chunk
+
+
+def _concat(parts: List[Any]) -> Any:
+    """Concatenate Dr.Jit arrays or tensors along the leading dimension"""
+    first = parts[0]
+    if not dr.is_array_v(first):
+        return first
+
+    if dr.is_tensor_v(first):
+        Tensor = type(first)
+        shape = (sum(p.shape[0] for p in parts),) + tuple(first.shape[1:])
+        return Tensor(_concat([p.array for p in parts]), shape)
+
+    tp = index_tp = type(first)
+    while dr.depth_v(index_tp) > 1:
+        index_tp = dr.value_t(index_tp)
+    UInt32 = dr.uint32_array_t(index_tp)
+    sizes = [dr.width(p) for p in parts]
+    result = dr.empty(tp, sum(sizes))
+
+    offset = 0
+    for p, n in zip(parts, sizes):
+        dr.scatter(result, p, dr.arange(UInt32, offset, offset + n))
+        offset += n
+    return result
+
+
+def scatter_devices(arg: Any, devices: Optional[Sequence[int]] = None) -> List[Any]:
+    if devices is None:
+        devices = range(dr.cuda_device_count())
+    devices = list(devices)
+    if not devices:
+        raise RuntimeError("drjit.scatter_devices(): 'devices' must not be empty.")
+
+    leaves, rebuild = _flatten(arg)
+    sizes = set(n for n in map(_length, leaves) if n is not None)
+    if len(sizes) != 1:
+        raise RuntimeError(
+            "drjit.scatter_devices(): 'arg' must contain arrays with a "
+            f"consistent leading dimension (got sizes {sorted(sizes)}).")
+    size = sizes.pop()
+
+    # Split into contiguous shards of (almost) equal size
+    result, k = [], len(devices)
+    for i, device in enumerate(devices):
+        start, end = (i * size) // k, ((i + 1) * size) // k
+        shard = rebuild([_chunk(v, start, end) for v in leaves])
+        result.append(dr.to_device(shard, device))
+    return result
+
+
+def gather_devices(parts: Sequence[Any], devices: Optional[Sequence[int]] = None,
+                   device: Optional[int] = None,
+                   reduce: Optional[dr.ReduceOp] = None) -> Any:
+    if not parts:
+        raise RuntimeError("drjit.gather_devices(): 'parts' must not be empty.")
+    devices = list(range(len(parts)) if devices is None else devices)
+    if len(devices) != len(parts):
+        raise RuntimeError("drjit.gather_devices(): 'parts' and 'devices' "
+                           "must have the same length.")
+    if device is None:
+        device = dr.cuda_device()
+
+    # Transfers start from the device that holds the respective part
+    leaves = []
+    for p, d in zip(parts, devices):
+        with dr.scoped_set_device(d):
+            leaves.append(_flatten(dr.to_device(p, device))[0])
+
+    with dr.scoped_set_device(device):
+        _, rebuild = _flatten(parts[0])
+
+        result = []
+        for i in range(len(leaves[0])):
+            values = [l[i] for l in leaves]
+            if reduce is None:
+                result.append(_concat(values))
+            else:
+                value = values[0]
+                for v in values[1:]:
+                    value = _reduce_ops[reduce](value, v)
+                result.append(value)
+
+        return rebuild(result)
@@ -0,0 +1,108 @@
+import drjit as dr
+import math
+import sys
+from typing import Any, Sequence, Tuple
+
+
+def _rows(name: str, tensor: Any, index: Any) -> Tuple[Any, int, Tuple[int, ...]]:
+    """
+    Convert the multi-dimensional ``index`` into the leading axes of
+    ``tensor`` into a flat row index. Returns the row index along with the
+    number of entries per row and the shape of each row.
+    """
+    if not dr.is_tensor_v(tensor) or not dr.is_jit_v(tensor):
+        raise TypeError(f"drjit.{name}(): expected a JIT-compiled tensor (got "
+                        f"'{type(tensor).__name__}')!")
+
+    if dr.is_array_v(index) and dr.depth_v(index) == 1:
+        index = (index,)
+    index = tuple(index)
+
+    shape = tensor.shape
+    k = len(index)
+    if k == 0 or k > len(shape):
+        raise RuntimeError(f"drjit.{name}(): expected between 1 and "
+                           f"{len(shape)} index arrays (got {k})!")
+
+    UInt32 = dr.uint32_array_t(type(tensor.array))
+
+    # Horner scheme over the indexed axes, computed inside the kernel
+    row = UInt32(index[0])
+    for i in range(1, k):
+        row = dr.fma(row, shape[i], UInt32(index[i]))
+
+    trailing = tuple(shape[k:])
+    return row, math.prod(trailing), trailing
+
+
+def _row_type(tensor: Any) -> type:
+    """Return the dynamically sized nested array type matching ``tensor``"""
+    Array = type(tensor.array)
+    return dr.replace_type_t(sys.modules[Array.__module__].ArrayXf, dr.type_v(Array))
+
+
+def _expand(row: Any, active: Any, inner: int) -> Tuple[Any, Any]:
+    """Turn row indices into per-entry indices (rows of size ``inner``)"""
+    k = dr.arange(type(row), dr.width(row) * inner)
+    index = dr.fma(dr.repeat(row, inner), inner, k % inner)
+    if dr.is_array_v(active):
+        active = dr.repeat(dr.mask_t(row)(active), inner)
+    return index, active
+
+
+def gather_nd(source: Any, index: Sequence[Any], active: Any = True) -> Any:
+    row, inner, trailing = _rows("gather_nd", source, index)
+    Array = type(source.array)
+    n = dr.width(row)
+
+    if inner == 1:
+        value = dr.gather(Array, source.array, row, active)
+    elif inner & (inner - 1) == 0:
+        # Fetch each row using a single packet gather and store it with a
+        # packet scatter (power-of-two row sizes)
+        rows = dr.gather(_row_type(source), source.array, row, active,
+                         shape=(inner, n))
+        value = dr.empty(Array, n * inner)
+        dr.scatter(value, rows, dr.arange(type(row), n))
+    else:
+        value = dr.gather(Array, source.array, *_expand(row, active, inner))
+
+    return type(source)(value, (n,) + trailing)
+
+
+def scatter_nd(op: dr.ReduceOp, target: Any, value: Any,
+               index: Sequence[Any], active: Any = True) -> None:
+    name = "scatter_nd" if op == dr.ReduceOp.Identity else "scatter_nd_reduce"
+    row, inner, trailing = _rows(name, target, index)
+    n = dr.width(row)
+
+    if dr.is_tensor_v(value):
+        if value.shape[1:] != trailing:
+            raise RuntimeError(
+                f"drjit.{name}(): 'value' must have shape "
+                f"(n, {', '.join(str(s) for s in trailing)}) "
+                f"(got {value.shape})!")
+        if n == 1:
+            n = value.shape[0]
+            row = dr.zeros(type(row), n) + row
+        value = value.array
+    elif inner != 1:
+        raise TypeError(f"drjit.{name}(): 'value' must be a tensor when "
+                        "the index does not address individual entries!")
+
+    def scatter(value, index, active):
+        if op == dr.ReduceOp.Identity:
+            dr.scatter(target.array, value, index, active)
+        else:
+            dr.scatter_reduce(op, target.array, value, index, active)
+
+    if inner == 1:
+        scatter(value, row, active)
+    elif inner & (inner - 1) == 0:
+        # Load each row using a packet gather and write it with a packet
+        # scatter (power-of-two row sizes)
+        rows = dr.gather(_row_type(target), value, dr.arange(type(row), n),
+                         shape=(inner, n))
+        scatter(rows, row, active)
+    else:
+        scatter(value, *_expand(row, active, inner))
@@ -0,0 +1,268 @@
+import drjit as dr
+import math
+from typing import Any, Callable, Dict, List, Optional, Sequence
+
+
+def _kernel_name(entry: Dict[str, Any]) -> str:
+    """Identify a kernel by its hash or (for non-JIT operations) its type"""
+    if entry["type"] == dr.KernelType.JIT:
+        return entry["hash"]
+    return entry["type"].name
+
+
+def _percentile(values: List[float], p: float) -> float:
+    """Nearest-rank percentile of a sorted list"""
+    return values[max(0, math.ceil(p * len(values)) - 1)]
+
+
+def kernel_history_report(history: Optional[List[Dict[str, Any]]] = None,
+                          group_by: Sequence[str] = ("label", "hash")):
+    if history is None:
+        history = dr.kernel_history()
+
+    for k in group_by:
+        if k not in ("label", "hash"):
+            raise RuntimeError("drjit.kernel_history_report(): 'group_by' may "
+                               f"only contain \"label\" and \"hash\" (got \"{k}\").")
+
+    groups: Dict[tuple, List[Dict[str, Any]]] = {}
+    for entry in history:
+        key = tuple(entry.get("label", "") if k == "label" else
+                    _kernel_name(entry) for k in group_by)
+        groups.setdefault(key, []).append(entry)
+
+    result = []
+    for key, entries in groups.items():
+        times = sorted(e["execution_time"] for e in entries)
+        total = sum(times)
+        jit = [e for e in entries if e["type"] == dr.KernelType.JIT]
+
+        stats = dict(zip(group_by, key))
+        stats.update({
+            "count": len(entries),
+            "total_time": total,
+            "mean_time": total / len(entries),
+            "p95_time": _percentile(times, 0.95),
+            "codegen_time": sum(e["codegen_time"] for e in jit),
+            "backend_time": sum(e["backend_time"] for e in jit),
+            "cache_hit_ratio": sum(1 for e in jit if e["cache_hit"]) / len(jit)
+                               if jit else None,
+            "size": sum(e["size"] for e in entries),
+        })
+        result.append(stats)
+
+    result.sort(key=lambda s: s["total_time"], reverse=True)
+    return result
+
+
+def kernel_history_trace(history: Optional[List[Dict[str, Any]]] = None,
+                         filename: Optional[str] = None) -> str:
+    import json
+
+    if history is None:
+        history = dr.kernel_history()
+
+    # The history only records durations. Operations are therefore laid out
+    # back-to-back in launch order, with one track per backend.
+    events: List[Dict[str, Any]] = []
+    clock: Dict[Any, float] = {}
+    open_ranges: Dict[Any, List[list]] = {}
+
+    def close_ranges(tid, depth: int):
+        stack = open_ranges.setdefault(tid, [])
+        while len(stack) > depth:
+            name, start = stack.pop()
+            events.append({"name": name, "cat": "range", "ph": "X", "pid": 0,
+                           "tid": tid, "ts": start, "dur": clock[tid] - start})
+
+    for entry in history:
+        tid = entry["backend"].name
+        ts = clock.setdefault(tid, 0.0)
+
+        # Emit 'drjit.profile_range' scopes as enclosing slices
+        label = entry.get("label", "")
+        labels = label.split("/") if label else []
+        stack = open_ranges.setdefault(tid, [])
+        depth = 0
+        while depth < min(len(stack), len(labels)) and \
+              stack[depth][0] == labels[depth]:
+            depth += 1
+        close_ranges(tid, depth)
+        for name in labels[depth:]:
+            stack.append([name, ts])
+
+        args = { k: entry[k] for k in ("size", "input_count", "output_count",
+                                       "operation_count", "cache_hit",
+                                       "cache_disk", "codegen_time",
+                                       "backend_time") if k in entry }
+        events.append({"name": _kernel_name(entry), "cat": entry["type"].name,
+                       "ph": "X", "pid": 0, "tid": tid, "ts": ts,
+                       "dur": entry["execution_time"], "args": args})
+        clock[tid] = ts + entry["execution_time"]
+
+    for tid in open_ranges:
+        close_ranges(tid, 0)
+
+    result = json.dumps({"traceEvents": events, "displayTimeUnit": "ms"})
+    if filename is not None:
+        with open(filename, "w") as f:
+            f.write(result)
+    return result
+
+
+def _cache_dir(cache_dir: Optional[str]) -> str:
+    """Return the directory of the on-disk kernel cache of Dr.Jit-Core"""
+    import os, sys, tempfile
+    if cache_dir is not None:
+        return cache_dir
+    if sys.platform == "win32":
+        return os.path.join(tempfile.gettempdir(), "drjit")
+    return os.path.join(os.path.expanduser("~"), ".drjit")
+
+
+def kernel_manifest_save(filename: str,
+                         history: Optional[List[Dict[str, Any]]] = None,
+                         cache_dir: Optional[str] = None) -> Dict[str, Any]:
+    import base64, glob, json, os
+
+    if history is None:
+        history = dr.kernel_history()
+
+    directory = _cache_dir(cache_dir)
+    kernels: Dict[str, Dict[str, Any]] = {}
+
+    for entry in history:
+        if entry["type"] != dr.KernelType.JIT or entry.get("uses_optix", False):
+            continue
+        h = entry["hash"]
+        if h in kernels:
+            continue
+
+        # Embed the compiled kernels that Dr.Jit-Core stored on disk
+        files = {}
+        for path in glob.glob(os.path.join(glob.escape(directory), h + ".*")):
+            with open(path, "rb") as f:
+                files[os.path.basename(path)] = base64.b64encode(f.read()).decode("ascii")
+
+        ir = entry["ir"]
+        kernels[h] = {
+            "backend": entry["backend"].name,
+            "label": entry.get("label", ""),
+            "ir": ir.getvalue() if hasattr(ir, "getvalue") else str(ir),
+            "files": files,
+        }
+
+    manifest = {"version": 1, "kernels": kernels}
+    with open(filename, "w") as f:
+        json.dump(manifest, f)
+    return manifest
+
+
+def precompile(manifest: Any, threads: Optional[int] = None,
+               cache_dir: Optional[str] = None) -> int:
+    import base64, json, os
+    from concurrent.futures import ThreadPoolExecutor
+
+    if isinstance(manifest, (str, os.PathLike)):
+        with open(manifest, "r") as f:
+            manifest = json.load(f)
+
+    if manifest.get("version") != 1:
+        raise RuntimeError("drjit.precompile(): unsupported manifest version!")
+
+    directory = _cache_dir(cache_dir)
+    os.makedirs(directory, exist_ok=True)
+
+    def install(item) -> int:
+        name, data = item
+        path = os.path.join(directory, os.path.basename(name))
+        if os.path.exists(path):
+            return 0
+
+        # Write to a temporary file first so that concurrently running
+        # processes never observe a partially written kernel
+        tmp = f"{path}.{os.getpid()}.tmp"
+        with open(tmp, "wb") as f:
+            f.write(base64.b64decode(data))
+        os.replace(tmp, path)
+        return 1
+
+    items = [item for k in manifest["kernels"].values()
+             for item in k["files"].items()]
+    with ThreadPoolExecutor(max_workers=threads) as pool:
+        return sum(pool.map(install, items))
+
+
+def _stats(values: List[float]) -> Dict[str, float]:
+    """Summary statistics that are robust to outliers (e.g., OS jitter)"""
+    values = sorted(values)
+    n = len(values)
+    median = (values[(n - 1) // 2] + values[n // 2]) / 2
+    mean = sum(values) / n
+    deviations = sorted(abs(v - median) for v in values)
+    return {
+        "min": values[0],
+        "median": median,
+        "mean": mean,
+        "p95": _percentile(values, 0.95),
+        "max": values[-1],
+        "std": math.sqrt(sum((v - mean) ** 2 for v in values) / n),
+        "mad": (deviations[(n - 1) // 2] + deviations[n // 2]) / 2,
+    }
+
+
+def bench(fn: Callable, *args, repeat: int = 10, warmup: int = 1,
+          flush_caches: bool = False, **kwargs) -> Dict[str, Any]:
+    import time
+
+    if repeat <= 0 or warmup < 0:
+        raise RuntimeError("drjit.bench(): 'repeat' must be positive and "
+                           "'warmup' must be nonnegative.")
+
+    keys = ("tracing", "codegen", "backend", "execution", "wall")
+    samples: Dict[str, List[float]] = {k: [] for k in keys}
+    kernels: List[int] = []
+    cache_hits = 0
+    jit_launches = 0
+    result = None
+
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        dr.sync_thread()
+        dr.kernel_history_clear()
+
+        for it in range(warmup + repeat):
+            if flush_caches:
+                dr.flush_kernel_cache()
+                dr.flush_malloc_cache()
+
+            t0 = time.perf_counter()
+            result = fn(*args, **kwargs)
+            t1 = time.perf_counter()
+            dr.eval(result)
+            dr.sync_thread()
+            t2 = time.perf_counter()
+
+            history = dr.kernel_history()
+            if it < warmup:
+                continue
+
+            jit = [e for e in history if e["type"] == dr.KernelType.JIT]
+            samples["tracing"].append((t1 - t0) * 1e6)
+            samples["wall"].append((t2 - t0) * 1e6)
+            samples["codegen"].append(sum(e["codegen_time"] for e in jit))
+            samples["backend"].append(sum(e["backend_time"] for e in jit))
+            samples["execution"].append(
+                sum(e["execution_time"] for e in history))
+            kernels.append(len(history))
+            cache_hits += sum(1 for e in jit if e["cache_hit"])
+            jit_launches += len(jit)
+
+    stats: Dict[str, Any] = {k: _stats(samples[k]) for k in keys}
+    stats.update({
+        "repeat": repeat,
+        "kernels": max(kernels),
+        "cache_hit_ratio": cache_hits / jit_launches if jit_launches else None,
+        "samples": samples,
+        "result": result,
+    })
+    return stats
@@ -0,0 +1,230 @@
+import drjit as dr
+from typing import Any, List, Tuple
+
+# Small dense linear algebra for Dr.Jit matrix types. All routines operate
+# on the individual matrix entries and are fully unrolled for the static
+# matrix size, which means that they produce straight-line code that is
+# vectorized over the lanes of Jit-compiled arrays. Data-dependent decisions
+# (pivoting, sorting) are expressed using selects, and all steps are
+# differentiable.
+
+
+def _entries(A) -> List[List[Any]]:
+    n = len(A)
+    return [[A[i][j] for j in range(n)] for i in range(n)]
+
+
+def _safe(v):
+    # Replace zero-valued divisors by one. This keeps derivatives finite in
+    # lanes where the associated result is discarded via dr.select().
+    return dr.select(v == 0, 1, v)
+
+
+def _rotation(a_pp, a_qq, a_pq):
+    """
+    Jacobi rotation ``(c, s)`` that annihilates the off-diagonal entry of the
+    symmetric 2x2 matrix ``[[a_pp, a_pq], [a_pq, a_qq]]``.
+    """
+    zero = a_pq == 0
+    theta = (a_qq - a_pp) * (0.5 * dr.rcp(_safe(a_pq)))
+    t = dr.copysign(1.0, theta) * dr.rcp(dr.abs(theta) + dr.sqrt(dr.fma(theta, theta, 1)))
+    t = dr.select(zero, 0, t)
+    c = dr.rcp(dr.sqrt(dr.fma(t, t, 1)))
+    return c, t * c
+
+
+def _rotate_cols(M, p: int, q: int, c, s) -> None:
+    for k in range(len(M)):
+        m_p, m_q = M[k][p], M[k][q]
+        M[k][p] = dr.fma(c, m_p, -s * m_q)
+        M[k][q] = dr.fma(s, m_p, c * m_q)
+
+
+def _rotate_rows(M, p: int, q: int, c, s) -> None:
+    for k in range(len(M)):
+        m_p, m_q = M[p][k], M[q][k]
+        M[p][k] = dr.fma(c, m_p, -s * m_q)
+        M[q][k] = dr.fma(s, m_p, c * m_q)
+
+
+def _identity(n: int, like) -> List[List[Any]]:
+    zero, one = like * 0, like * 0 + 1
+    return [[one if i == j else zero for j in range(n)] for i in range(n)]
+
+
+def _sort(values: List[Any], cols: List[List[List[Any]]], descending: bool) -> None:
+    """
+    Sort ``values`` and permute the columns of the matrices in ``cols``
+    accordingly (odd-even transposition sort via selects)
+    """
+    n = len(values)
+    for it in range(n):
+        for i in range(it % 2, n - 1, 2):
+            a, b = values[i], values[i + 1]
+            swap = a < b if descending else a > b
+            values[i], values[i + 1] = dr.select(swap, b, a), dr.select(swap, a, b)
+            for M in cols:
+                for k in range(n):
+                    u, v = M[k][i], M[k][i + 1]
+                    M[k][i], M[k][i + 1] = dr.select(swap, v, u), dr.select(swap, u, v)
+
+
+def cholesky(A):
+    M = _entries(A)
+    n = len(M)
+    zero = M[0][0] * 0
+    L = [[zero] * n for _ in range(n)]
+
+    for j in range(n):
+        acc = M[j][j]
+        for k in range(j):
+            acc = dr.fma(-L[j][k], L[j][k], acc)
+        L[j][j] = dr.sqrt(acc)
+        inv = dr.rcp(L[j][j])
+
+        for i in range(j + 1, n):
+            acc = M[i][j]
+            for k in range(j):
+                acc = dr.fma(-L[i][k], L[j][k], acc)
+            L[i][j] = acc * inv
+
+    return type(A)(L)
+
+
+def cholesky_solve(L, b):
+    n = len(b)
+    y = [None] * n
+    for i in range(n):
+        acc = b[i]
+        for k in range(i):
+            acc = dr.fma(-L[i][k], y[k], acc)
+        y[i] = acc * dr.rcp(L[i][i])
+
+    x = [None] * n
+    for i in reversed(range(n)):
+        acc = y[i]
+        for k in range(i + 1, n):
+            acc = dr.fma(-L[k][i], x[k], acc)
+        x[i] = acc * dr.rcp(L[i][i])
+
+    return type(b)(x)
+
+
+def lu(A):
+    M = _entries(A)
+    n = len(M)
+    UInt32 = dr.uint32_array_t(type(M[0][0]))
+    perm = [UInt32(i) for i in range(n)]
+
+    for k in range(n):
+        # Partial pivoting: find the largest entry within column 'k'
+        piv, best = UInt32(k), dr.abs(M[k][k])
+        for i in range(k + 1, n):
+            bigger = dr.abs(M[i][k]) > best
+            best = dr.select(bigger, dr.abs(M[i][k]), best)
+            piv = dr.select(bigger, UInt32(i), piv)
+
+        # Swap rows 'k' and 'piv'
+        for i in range(k + 1, n):
+            swap = piv == i
+            for j in range(n):
+                a, b = M[k][j], M[i][j]
+                M[k][j], M[i][j] = dr.select(swap, b, a), dr.select(swap, a, b)
+            a, b = perm[k], perm[i]
+            perm[k], perm[i] = dr.select(swap, b, a), dr.select(swap, a, b)
+
+        # Eliminate the entries below the pivot
+        inv = dr.rcp(M[k][k])
+        for i in range(k + 1, n):
+            M[i][k] = M[i][k] * inv
+            for j in range(k + 1, n):
+                M[i][j] = dr.fma(-M[i][k], M[k][j], M[i][j])
+
+    Perm = dr.uint32_array_t(dr.value_t(type(A)))
+    return type(A)(M), Perm(perm)
+
+
+def lu_solve(LU, perm, b):
+    n = len(b)
+
+    # Apply the row permutation
+    y = [None] * n
+    for i in range(n):
+        value = b[0]
+        for j in range(1, n):
+            value = dr.select(perm[i] == j, b[j], value)
+        y[i] = value
+
+    # Forward substitution (unit lower triangular factor)
+    for i in range(n):
+        for k in range(i):
+            y[i] = dr.fma(-LU[i][k], y[k], y[i])
+
+    # Backward substitution
+    x = [None] * n
+    for i in reversed(range(n)):
+        acc = y[i]
+        for k in range(i + 1, n):
+            acc = dr.fma(-LU[i][k], x[k], acc)
+        x[i] = acc * dr.rcp(LU[i][i])
+
+    return type(b)(x)
+
+
+def eigh(A, sweeps: int = 8):
+    M = _entries(A)
+    n = len(M)
+    V = _identity(n, M[0][0])
+
+    # Cyclic Jacobi method
+    for _ in range(sweeps):
+        for p in range(n - 1):
+            for q in range(p + 1, n):
+                c, s = _rotation(M[p][p], M[q][q], M[p][q])
+                _rotate_cols(M, p, q, c, s)
+                _rotate_rows(M, p, q, c, s)
+                _rotate_cols(V, p, q, c, s)
+
+    w = [M[i][i] for i in range(n)]
+    _sort(w, [V], descending=False)
+
+    Vector = dr.value_t(type(A))
+    return Vector(w), type(A)(V)
+
+
+def svd(A, sweeps: int = 8):
+    U = _entries(A)
+    n = len(U)
+    V = _identity(n, U[0][0])
+
+    # One-sided Jacobi method (Hestenes): orthogonalize the columns of 'U'
+    for _ in range(sweeps):
+        for p in range(n - 1):
+            for q in range(p + 1, n):
+                a_pp = a_qq = a_pq = None
+                for k in range(n):
+                    u_p, u_q = U[k][p], U[k][q]
+                    a_pp = u_p * u_p if a_pp is None else dr.fma(u_p, u_p, a_pp)
+                    a_qq = u_q * u_q if a_qq is None else dr.fma(u_q, u_q, a_qq)
+                    a_pq = u_p * u_q if a_pq is None else dr.fma(u_p, u_q, a_pq)
+                c, s = _rotation(a_pp, a_qq, a_pq)
+                _rotate_cols(U, p, q, c, s)
+                _rotate_cols(V, p, q, c, s)
+
+    # Singular values are the column norms
+    sigma = []
+    for j in range(n):
+        acc = U[0][j] * U[0][j]
+        for k in range(1, n):
+            acc = dr.fma(U[k][j], U[k][j], acc)
+        sigma.append(dr.sqrt(acc))
+
+    for j in range(n):
+        inv = dr.select(sigma[j] == 0, 0, dr.rcp(_safe(sigma[j])))
+        for k in range(n):
+            U[k][j] = U[k][j] * inv
+
+    _sort(sigma, [U, V], descending=True)
+
+    Vector = dr.value_t(type(A))
+    return type(A)(U), Vector(sigma), type(A)(V)
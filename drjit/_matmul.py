@@ -0,0 +1,129 @@
+import drjit as dr
+from typing import Sequence, Tuple, Optional, TypeVar
+
+ArrayT = TypeVar("ArrayT", bound=dr.ArrayBase)
+
+
+def tensor_matmul(a: ArrayT, b: ArrayT) -> ArrayT:
+    """
+    Multiply two tensors following the semantics of NumPy's ``@`` operator for
+    1D and 2D inputs. It is an implementation detail of the top-level function
+    :py:func:`drjit.matmul()` used to handle tensor arguments.
+
+    The product ``C[i, j] = sum_k A[i, k] * B[k, j]`` is expressed as a single
+    symbolic gather over the ``M*N*K`` partial products followed by a
+    :py:func:`drjit.block_sum()` over contiguous groups of ``K`` entries. The
+    partial products are therefore never stored in memory, and both steps are
+    differentiable.
+    """
+    if not dr.is_tensor_v(a):
+        a = type(b)(a)
+    if not dr.is_tensor_v(b):
+        b = type(a)(b)
+
+    Tensor = type(a)
+    Value = dr.array_t(a)
+    Index = dr.uint32_array_t(Value)
+
+    nd_a, nd_b = a.ndim, b.ndim
+    if nd_a == 0 or nd_b == 0:
+        return a * b
+    if nd_a > 2 or nd_b > 2:
+        raise RuntimeError("tensor_matmul(): only 1D and 2D tensors are supported.")
+
+    # Promote vectors to matrices, the extra axes are removed further below
+    shape_a = a.shape if nd_a == 2 else (1, a.shape[0])
+    shape_b = b.shape if nd_b == 2 else (b.shape[0], 1)
+
+    (m, k), (k2, n) = shape_a, shape_b
+    if k != k2:
+        raise RuntimeError(
+            f"tensor_matmul(): incompatible shapes {a.shape} and {b.shape}."
+        )
+
+    if k == 0:
+        out = dr.zeros(Value, m * n)
+    else:
+        index = dr.arange(Index, m * n * k)
+        ij, kk = index // k, index % k
+        i, j = ij // n, ij % n
+
+        prod = dr.gather(Value, a.array, i * k + kk) * \
+               dr.gather(Value, b.array, kk * n + j)
+
+        out = prod if k == 1 else dr.block_sum(prod, k)
+
+    if nd_a == 2 and nd_b == 2:
+        shape = (m, n)
+    elif nd_a == 2:
+        shape = (m,)
+    elif nd_b == 2:
+        shape = (n,)
+    else:
+        shape = ()
+
+    return Tensor(out, shape)
+
+
+def mlp(
+    x: Sequence[ArrayT],
+    layers: Sequence[Tuple[dr.ArrayBase, Optional[dr.ArrayBase]]],
+    activation: str = "relu",
+) -> list:
+    """
+    Evaluate a small fully connected network independently for every lane. See
+    :py:func:`drjit.mlp()` for details.
+    """
+    if activation == "relu":
+        act = lambda v: dr.maximum(v, 0)
+    elif activation == "leaky_relu":
+        act = lambda v: dr.select(v > 0, v, v * 0.01)
+    elif activation == "sigmoid":
+        act = lambda v: dr.rcp(1 + dr.exp(-v))
+    elif activation == "tanh":
+        act = dr.tanh
+    elif activation == "none":
+        act = None
+    else:
+        raise RuntimeError(f'mlp(): unsupported activation "{activation}".')
+
+    h = list(x)
+    if len(h) == 0:
+        raise RuntimeError("mlp(): the input must have at least one feature.")
+
+    Value = type(h[0])
+    Index = dr.uint32_array_t(Value)
+
+    for li, (w, bias) in enumerate(layers):
+        if w.ndim != 2 or w.shape[1] != len(h):
+            raise RuntimeError(
+                f"mlp(): layer {li} expects a weight matrix of shape "
+                f"(*, {len(h)}), got {w.shape}."
+            )
+        n_out, n_in = w.shape
+        if bias is not None and bias.shape != (n_out,):
+            raise RuntimeError(
+                f"mlp(): layer {li} expects a bias of shape ({n_out},), got "
+                f"{bias.shape}."
+            )
+
+        # The weights are uniform across lanes: gathering them with literal
+        # indices yields broadcast scalars that remain attached to the AD graph
+        wa = w.array
+        ba = bias.array if bias is not None else None
+
+        out = []
+        for r in range(n_out):
+            if ba is not None:
+                v = dr.gather(Value, ba, Index(r))
+            else:
+                v = Value(0)
+            for c in range(n_in):
+                v = dr.fma(dr.gather(Value, wa, Index(r * n_in + c)), h[c], v)
+            out.append(v)
+
+        if act is not None and li + 1 < len(layers):
+            out = [act(v) for v in out]
+        h = out
+
+    return h
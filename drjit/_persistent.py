@@ -0,0 +1,80 @@
+import drjit as dr
+from typing import Any, Callable, Optional, Sequence, Tuple
+
+
+def _fetch(x: Any, index: Any, active: Any) -> Any:
+    """Gather the entries ``index`` of the state variable ``x``"""
+    if dr.width(x) == 1:
+        index = dr.zeros(type(index), dr.width(index))
+    return dr.gather(type(x), x, index, active)
+
+
+def persistent_loop(state: Tuple[Any, ...],
+                    cond: Callable[..., Any],
+                    body: Callable[..., Tuple[Any, ...]],
+                    pool_size: Optional[int],
+                    labels: Sequence[str],
+                    label: Optional[str],
+                    mode: Optional[str]) -> Tuple[Any, ...]:
+    state = tuple(state)
+
+    for x in state:
+        if not dr.is_jit_v(x) or dr.is_tensor_v(x):
+            raise TypeError("drjit.persistent_loop(): state variables must "
+                            f"be JIT-compiled Dr.Jit arrays (got '{type(x).__name__}')!")
+
+    active_tp = type(cond(*state))
+    if not dr.is_jit_v(active_tp) or dr.type_v(active_tp) != dr.VarType.Bool:
+        raise TypeError("drjit.persistent_loop(): 'cond' must return a "
+                        "JIT-compiled boolean array!")
+
+    UInt32 = dr.uint32_array_t(dr.detached_t(active_tp))
+    n = dr.width(state)
+    if pool_size is None:
+        pool_size = 1 << 20
+    if pool_size < 1:
+        raise RuntimeError("drjit.persistent_loop(): 'pool_size' must be positive!")
+    pool_size = min(pool_size, n)
+
+    # Output storage, and a counter referencing the next unassigned work item
+    result = tuple(dr.zeros(type(x), n) for x in state)
+    counter = dr.opaque(UInt32, pool_size)
+
+    def loop_body(item, *s):
+        c = cond(*s)
+
+        # Lanes whose work item terminated store its final state and fetch
+        # the next one. It starts running in the following iteration.
+        done = ~c
+        for out, v in zip(result, s):
+            dr.scatter(out, v, item, done)
+
+        item_new = dr.scatter_inc(counter, UInt32(0), done)
+        refill = done & (item_new < n)
+        s = tuple(dr.select(done, _fetch(x, item_new, refill), v)
+                  for x, v in zip(state, s))
+        item = dr.select(done, item_new, item)
+
+        s = dr.if_stmt(
+            args=s,
+            cond=c,
+            true_fn=body,
+            false_fn=lambda *args: args,
+            arg_labels=labels,
+            rv_labels=labels,
+            label=label,
+        )
+
+        return (item, *s)
+
+    item = dr.arange(UInt32, pool_size)
+    dr.while_loop(
+        state=(item, *(_fetch(x, item, True) for x in state)),
+        cond=lambda item, *s: item < n,
+        body=loop_body,
+        labels=("item", *labels) if labels else (),
+        label=label,
+        mode=mode,
+    )
+
+    return result
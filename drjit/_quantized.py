@@ -0,0 +1,128 @@
+import drjit as dr
+import sys
+from typing import Any, Optional
+
+
+class QuantizedArray:
+    """
+    Lookup table that stores floating point values as 8-bit integers.
+
+    Each entry ``x`` is represented by an integer ``q`` so that ``x ≈ (q -
+    zero_point) * scale``. This shrinks the table by a factor of four compared
+    to single precision storage, which also reduces the memory bandwidth of
+    kernels that read from it.
+
+    :py:meth:`gather()` reads the integer storage and dequantizes it within the
+    same kernel. :py:meth:`scatter_add()` quantizes the added values using
+    stochastic rounding. This keeps the updates unbiased even when they are
+    much smaller than ``scale``.
+
+    .. code-block:: python
+
+       table = dr.QuantizedArray(Float(values))
+       features = table.gather(index)
+       table.scatter_add(step, index)
+
+    Args:
+        value (drjit.ArrayBase): A flat JIT-compiled floating point array
+          holding the initial table contents.
+
+        signed (bool): Use signed (``Int8``) instead of unsigned (``UInt8``)
+          storage.
+
+        scale (float | None): Size of one quantization step. By default, the
+          value range of ``value`` is mapped onto the 256 quantization levels.
+
+        zero_point (int | None): Integer that represents zero. It is derived
+          from the value range when not specified.
+    """
+
+    __slots__ = ("dtype", "data", "scale", "zero_point", "_lo", "_hi",
+                 "_storage", "_seed")
+
+    def __init__(self, value: Any, signed: bool = False,
+                 scale: Optional[float] = None,
+                 zero_point: Optional[int] = None):
+        tp = type(value)
+        if not dr.is_jit_v(tp) or not dr.is_float_v(tp) or \
+           dr.depth_v(tp) != 1 or dr.is_tensor_v(tp):
+            raise TypeError("drjit.QuantizedArray(): 'value' must be a flat "
+                            "JIT-compiled floating point array!")
+
+        self.dtype = dr.detached_t(tp)
+        vt = dr.VarType.Int8 if signed else dr.VarType.UInt8
+        self._storage = dr.reinterpret_array_t(self.dtype, vt)
+        self._lo, self._hi = (-128, 127) if signed else (0, 255)
+        self._seed = 0
+
+        if scale is None or zero_point is None:
+            lo = min(dr.min(value, axis=None)[0], 0.0)
+            hi = max(dr.max(value, axis=None)[0], 0.0)
+            if scale is None:
+                scale = (hi - lo) / (self._hi - self._lo)
+                if scale == 0:
+                    scale = 1.0
+            if zero_point is None:
+                zero_point = self._lo - round(lo / scale)
+
+        if scale <= 0:
+            raise RuntimeError("drjit.QuantizedArray(): 'scale' must be positive!")
+        if zero_point < self._lo or zero_point > self._hi:
+            raise RuntimeError("drjit.QuantizedArray(): 'zero_point' is not "
+                               "representable by the storage type!")
+
+        self.scale = float(scale)
+        self.zero_point = int(zero_point)
+        self.data = self._quantize(dr.round(dr.detach(value) / self.scale))
+
+    def _quantize(self, q: Any) -> Any:
+        """Offset, clamp, and convert quantization levels to the storage type"""
+        return self._storage(dr.clip(q + self.zero_point, self._lo, self._hi))
+
+    def __len__(self) -> int:
+        return dr.width(self.data)
+
+    def gather(self, index: Any, active: Any = True) -> Any:
+        """
+        Fetch and dequantize the entries ``index`` of the table.
+
+        The conversion to floating point happens within the kernel that
+        consumes the result, so only the 8-bit storage is read from memory.
+        """
+        q = dr.gather(self._storage, self.data, index, active)
+        return (self.dtype(q) - self.zero_point) * self.scale
+
+    def scatter_add(self, value: Any, index: Any, active: Any = True) -> None:
+        """
+        Atomically add ``value`` to the entries ``index`` of the table.
+
+        Each value is converted into an integer number of quantization steps
+        using stochastic rounding, i.e., it is rounded up with a probability
+        that equals the fractional part. The random numbers come from a
+        :py:class:`PCG32` instance whose sequence advances with each call.
+        The increments are accumulated at 32-bit precision before the table is
+        updated, and the result saturates at the limits of the storage type.
+        """
+        Float = self.dtype
+        Int32 = dr.int32_array_t(Float)
+        value = Float(dr.detach(value))
+
+        PCG32 = sys.modules[Float.__module__].PCG32
+        rng = PCG32(dr.width((value, index)), initseq=self._seed)
+        self._seed += 1
+
+        q = dr.floor(value / self.scale + rng.next_float32())
+        acc = dr.zeros(Int32, len(self))
+        dr.scatter_reduce(dr.ReduceOp.Add, acc, Int32(q), index, active)
+
+        self.data = self._storage(dr.clip(Int32(self.data) + acc,
+                                          self._lo, self._hi))
+
+    def dequantize(self) -> Any:
+        """Return the full table as a floating point array"""
+        return (self.dtype(self.data) - self.zero_point) * self.scale
+
+    def __repr__(self) -> str:
+        return (f"QuantizedArray[dtype={self.dtype.__name__}, "
+                f"storage={self._storage.__name__}, size={len(self)}, "
+                f"scale={self.scale}, zero_point={self.zero_point}]")
@@ -0,0 +1,106 @@
+import drjit as dr
+from typing import Any, Tuple
+
+
+class Queue:
+    """
+    Fixed-capacity append queue whose size counter resides on the device.
+
+    Queues collect the outputs of *wavefront*-style programs, where each
+    kernel appends work items for the next one. :py:meth:`push()` reserves
+    slots by atomically incrementing a device-resident counter
+    (:py:func:`drjit.scatter_inc()`) and then writes the enqueued values
+    there. Neither the size query (:py:meth:`size()`) nor the read-back of
+    the enqueued items (:py:meth:`items()`) synchronizes with the host.
+    Instead, the consuming kernel launches with ``capacity`` lanes and
+    deactivates lanes beyond the current size.
+
+    .. code-block:: python
+
+       q = dr.Queue(Array3f, capacity=1024)
+       q.push(p, active=hit)
+
+       # Next wavefront: process the enqueued items
+       p2, active = q.items()
+
+    Items pushed beyond the capacity are dropped, which can be detected via
+    :py:meth:`overflowed()`.
+
+    Args:
+        dtype (type): A JIT-compiled Dr.Jit array type (e.g.,
+          :py:class:`drjit.cuda.Array3f`).
+
+        capacity (int): The maximum number of items.
+    """
+
+    __slots__ = ("dtype", "capacity", "counter", "data", "_uint32")
+
+    def __init__(self, dtype: type, capacity: int):
+        if not dr.is_jit_v(dtype) or dr.is_tensor_v(dtype):
+            raise TypeError("drjit.Queue(): 'dtype' must be a JIT-compiled Dr.Jit array type!")
+        if capacity < 1:
+            raise RuntimeError("drjit.Queue(): 'capacity' must be positive!")
+
+        tp = dtype
+        while dr.depth_v(tp) > 1:
+            tp = dr.value_t(tp)
+        self._uint32 = dr.uint32_array_t(dr.detached_t(tp))
+        self.dtype = dtype
+        self.capacity = capacity
+        self.data = dr.empty(dtype, capacity)
+        self.reset()
+
+    def push(self, value: Any, active: Any = True) -> Any:
+        """
+        Append the entries of ``value`` whose ``active`` mask is set.
+
+        Returns the slot of each entry in the queue. Entries whose slot equals
+        or exceeds the capacity are dropped. The slots of inactive entries are
+        undefined.
+        """
+        UInt32 = self._uint32
+        Bool = dr.mask_t(UInt32)
+        active = Bool(active)
+
+        slot = dr.scatter_inc(self.counter, UInt32(0), active)
+        dr.scatter(self.data, value, slot, active & (slot < self.capacity))
+        return slot
+
+    def size(self) -> Any:
+        """
+        Return the number of enqueued items as a device-resident 32-bit
+        unsigned integer array with one entry. This does not synchronize with
+        the host.
+        """
+        return dr.minimum(dr.gather(self._uint32, self.counter, 0), self.capacity)
+
+    def overflowed(self) -> Any:
+        """
+        Return a device-resident boolean array with one entry that states
+        whether items were dropped since the last :py:meth:`reset()`.
+        """
+        return dr.gather(self._uint32, self.counter, 0) > self.capacity
+
+    def items(self) -> Tuple[Any, Any]:
+        """
+        Return a tuple ``(value, active)`` that provides access to the
+        enqueued items.
+
+        Both entries have ``capacity`` lanes, where ``active`` disables lanes
+        beyond the current size of the queue. Pass it as a mask to the
+        operations of the next wavefront to process the enqueued items
+        without a host round-trip.
+        """
+        index = dr.arange(self._uint32, self.capacity)
+        active = index < self.size()
+        return dr.gather(self.dtype, self.data, index, active), active
+
+    def reset(self) -> None:
+        """
+        Empty the queue. The storage is retained and reused by subsequent
+        calls to :py:meth:`push()`.
+        """
+        self.counter = dr.opaque(self._uint32, 0, 1)
+
+    def __repr__(self) -> str:
+        return f"Queue[dtype={self.dtype.__name__}, capacity={self.capacity}]"
@@ -0,0 +1,130 @@
+import drjit as dr
+from typing import Any, Dict, List, Optional, Tuple
+
+from ._stream import _flatten
+
+
+def _numpy_dtype(vt: dr.VarType) -> str:
+    """NumPy dtype describing the host representation of a Dr.Jit type"""
+    return {
+        dr.VarType.Bool: 'bool', dr.VarType.Float16: 'float16',
+        dr.VarType.Float32: 'float32', dr.VarType.Float64: 'float64',
+        dr.VarType.Int8: 'int8', dr.VarType.UInt8: 'uint8',
+        dr.VarType.Int16: 'int16', dr.VarType.UInt16: 'uint16',
+        dr.VarType.Int32: 'int32', dr.VarType.UInt32: 'uint32',
+        dr.VarType.Int64: 'int64', dr.VarType.UInt64: 'uint64',
+    }[vt]
+
+
+def _to_words(value: Any, UInt32: type) -> Tuple[List[Any], str]:
+    """
+    Convert a flat JIT array into one or two 32-bit word arrays along with a
+    tag that specifies how the host should decode them
+    """
+    vt = dr.type_v(value)
+    tp = type(value)
+
+    if vt == dr.VarType.Bool:
+        return [dr.select(value, UInt32(1), UInt32(0))], 'bool'
+    elif vt in (dr.VarType.Float64, dr.VarType.Int64, dr.VarType.UInt64):
+        UInt64 = dr.uint64_array_t(tp)
+        u = dr.reinterpret_array(UInt64, value)
+        return [UInt32(u & 0xFFFFFFFF), UInt32(u >> 32)], 'u64'
+    elif vt == dr.VarType.Float16:
+        value = dr.float32_array_t(tp)(value)
+        return [dr.reinterpret_array(UInt32, value)], 'float32'
+    elif vt == dr.VarType.Float32:
+        return [dr.reinterpret_array(UInt32, value)], 'float32'
+    elif vt in (dr.VarType.Int8, dr.VarType.Int16, dr.VarType.Int32):
+        value = dr.int32_array_t(tp)(value)
+        return [dr.reinterpret_array(UInt32, value)], 'int32'
+    elif vt in (dr.VarType.UInt8, dr.VarType.UInt16, dr.VarType.UInt32):
+        return [UInt32(value)], 'uint32'
+
+    raise TypeError(f"drjit.to_host_many(): unsupported array type "
+                    f"'{tp.__name__}'!")
+
+
+def to_host_many(arg: Any, index: Optional[int] = 0) -> Any:
+    import numpy as np
+
+    leaves, rebuild = _flatten(arg)
+
+    # Per backend: the 32-bit word arrays that will be packed into one buffer
+    parts: Dict[dr.JitBackend, List[Any]] = {}
+    offsets: Dict[dr.JitBackend, int] = {}
+    plan: List[Optional[Tuple[Any, ...]]] = []
+
+    for leaf in leaves:
+        if not dr.is_jit_v(leaf):
+            plan.append(None)
+            continue
+
+        shape = None
+        value = dr.detach(leaf)
+        if dr.is_tensor_v(value):
+            shape = value.shape
+            value = value.array
+        elif dr.depth_v(value) != 1:
+            raise TypeError("drjit.to_host_many(): nested arrays (e.g., "
+                            "'Array3f') are not supported, pass their "
+                            "components instead!")
+
+        backend = dr.backend_v(value)
+        UInt32 = dr.uint32_array_t(type(value))
+        n = dr.width(value)
+
+        if index is not None:
+            i = index + n if index < 0 else index
+            if i < 0 or i >= n:
+                raise IndexError(f"drjit.to_host_many(): entry {index} is out "
+                                 f"of bounds (the array is of size {n}).")
+            value = dr.gather(type(value), value, UInt32(i))
+            n = 1
+
+        words, tag = _to_words(value, UInt32)
+        offset = offsets.get(backend, 0)
+        parts.setdefault(backend, []).extend(
+            (w, offset + k * n) for k, w in enumerate(words))
+        offsets[backend] = offset + len(words) * n
+        plan.append((backend, offset, n, tag, dr.type_v(value), shape))
+
+    # Pack the requested entries into one staging buffer per backend
+    buffers = {}
+    for backend, words in parts.items():
+        UInt32 = type(words[0][0])
+        buffer = dr.empty(UInt32, offsets[backend])
+        for w, offset in words:
+            dr.scatter(buffer, w, dr.arange(UInt32, offset, offset + dr.width(w)))
+        buffers[backend] = buffer
+
+    # Evaluate jointly, then copy each buffer to the host
+    dr.eval(*buffers.values())
+    host = {backend: b.numpy() for backend, b in buffers.items()}
+
+    result = []
+    for leaf, p in zip(leaves, plan):
+        if p is None:
+            result.append(leaf)
+            continue
+
+        backend, offset, n, tag, vt, shape = p
+        words = host[backend]
+        if tag == 'u64':
+            lo = words[offset:offset + n].astype(np.uint64)
+            hi = words[offset + n:offset + 2 * n].astype(np.uint64)
+            value = ((hi << np.uint64(32)) | lo).view(_numpy_dtype(vt))
+        elif tag == 'bool':
+            value = words[offset:offset + n] != 0
+        else:
+            value = words[offset:offset + n].view(tag)
+            value = value.astype(_numpy_dtype(vt), copy=False)
+
+        if index is not None:
+            result.append(value[0].item())
+        elif shape is not None:
+            result.append(value.reshape(shape))
+        else:
+            result.append(value)
+
+    return rebuild(result)
@@ -1,5 +1,5 @@
 import drjit as dr
-from typing import Dict, TypeVar, Tuple, Literal, Protocol, cast
+from typing import Dict, TypeVar, Tuple, Literal, Protocol, Optional, cast
 
 ArrayT = TypeVar("ArrayT", bound=dr.ArrayBase)
 
@@ -13,6 +13,65 @@ def _compute_strides(shape: Tuple[int, ...]) -> Tuple[int, ...]:
     return tuple(strides)
 
 
+def _strided_offset(
+    index: dr.AnyArray,
+    shape: Tuple[int, ...],
+    strides: Tuple[int, ...],
+    offset: Optional[dr.AnyArray] = None,
+) -> dr.AnyArray:
+    """
+    Decompose the C-style linear ``index`` into positions along the axes of
+    ``shape``, and return their dot product with ``strides`` (plus ``offset``).
+    """
+    Index = type(index)
+    if offset is None:
+        offset = dr.zeros(Index, dr.width(index))
+
+    for i in reversed(range(len(shape))):
+        if i > 0:
+            next_index = index // shape[i]
+            pos = index - next_index * shape[i]
+        else:
+            next_index, pos = None, index
+        offset = dr.fma(pos, strides[i], offset)
+        index = next_index
+
+    return offset
+
+
+def block_reduce_pairwise(
+    op: dr.ReduceOp, value: ArrayT, block_size: int, fanout: int = 32
+) -> ArrayT:
+    """
+    Reduce contiguous blocks of size ``block_size`` using a tree of evaluated
+    block reductions with ``fanout`` inputs per node. This is an implementation
+    detail of ``mode="pairwise"``.
+
+    The rounding error of a floating point sum then grows with the depth of the
+    tree rather than with the number of reduced elements, while the data stays
+    at its original precision. Blocks are zero-padded to a multiple of
+    ``fanout`` by a masked gather that folds into the reduction kernel. Each
+    level is a differentiable :py:func:`drjit.block_reduce()`, hence the
+    gradient matches that of a regular reduction.
+    """
+    Value = type(value)
+    Index = dr.uint32_array_t(Value)
+    blocks = dr.width(value) // block_size
+
+    while block_size > fanout:
+        padded = -(-block_size // fanout) * fanout
+        if padded != block_size:
+            index = dr.arange(Index, blocks * padded)
+            row = index // padded
+            col = index - row * padded
+            value = dr.gather(Value, value, dr.fma(row, block_size, col),
+                              col < block_size)
+        value = dr.block_reduce(op, value, fanout, "evaluated")
+        block_size = padded // fanout
+
+    return dr.block_reduce(op, value, block_size, "evaluated")
+
+
 class BinaryOp(Protocol):
     """Type signature of an array-valued binary reduction"""
     def __call__(self, arg0: ArrayT, arg1: ArrayT, /) -> ArrayT:
@@ -62,7 +121,7 @@ def tensor_reduce(
     op: dr.ReduceOp,
     value: ArrayT,
     axis: Tuple[int, ...],
-    mode: Literal["symbolic", "evaluated", None],
+    mode: Literal["symbolic", "evaluated", "pairwise", None],
 ) -> ArrayT:
     """
     This function uses the operation ``op`` to reduce the tensor ``value``
@@ -75,7 +134,16 @@ def tensor_reduce(
        :py:func:`drjit.block_reduce` with the same ``mode`` parameter, which is
        potentially more efficient.
 
-    2. ``mode="evaluated"``: Evaluate the input tensor, then gather and reduce
+    2. If the reduced axes aren't contiguous (e.g., when reducing over
+       leading axes or over several separate axes), and ``mode`` isn't
+       ``"symbolic"``, it gathers the input in a permuted order that places
+       the reduced elements of each output entry next to each other and then
+       performs a single segmented :py:func:`drjit.block_reduce`. This
+       handles any combination of axes in one pass without intermediate
+       tensors. On the CUDA backend, this strategy requires the number of
+       reduced elements per output entry to be a power of two.
+
+    3. ``mode="evaluated"``: Evaluate the input tensor, then gather and reduce
        within a symbolic loop to compute the elements of the output tensor.
 
        **Caveats**: can be slow when the reduced tensor is small, in which case
@@ -83,7 +151,7 @@ def tensor_reduce(
        This strategy requires evaluating the input array, which is potentially
        costly in terms of CPU/GPU memory.
 
-    3. ``mode="symbolic"``: Issue atomic scatter-reductions to populate the
+    4. ``mode="symbolic"``: Issue atomic scatter-reductions to populate the
        output tensor. Since explicit evaluation and storage are not required,
        this mode is preferable when the input tensor is very large (e.g., when
        it would not fit into memory).
@@ -92,6 +160,10 @@ def tensor_reduce(
        error, and reductions to just a few elements can be subject to
        *contention*. See :py:func:`drjit.scatter_reduce` for a discussion of
        both points).
+
+    5. ``mode="pairwise"``: Like strategy 1 or 2, but floating point sums use
+       a tree of block reductions (see :py:func:`block_reduce_pairwise`).
+       Other reductions behave as in ``mode="evaluated"``.
     """
     Tensor = type(value)
     Value = dr.array_t(value)
@@ -131,10 +203,17 @@ def tensor_reduce(
     block_size = dr.prod(block_shape)
     in_array = value.array
 
+    # Pairwise summation only changes the result of floating point sums
+    pairwise = False
+
     if mode == "symbolic":
         symbolic = True
     elif mode == "evaluated":
         symbolic = False
+    elif mode == "pairwise":
+        symbolic = False
+        pairwise = op is dr.ReduceOp.Add and dr.is_float_v(Value)
+        mode = "evaluated"
     elif mode is None:
         state = in_array.state
 
@@ -159,12 +238,15 @@ def tensor_reduce(
             symbolic = not is_evaluated and is_big_array
     else:
         raise RuntimeError(
-            'tensor_reduce(): \'mode\' must be "symbolic", "evaluated", or None.'
+            'tensor_reduce(): \'mode\' must be "symbolic", "evaluated", '
+            '"pairwise", or None.'
         )
 
     if in_size == out_size:
         # No-op
         out_array = in_array
+    elif pairwise and len(block_strides) == 1 and block_strides[0] == 1:
+        out_array = block_reduce_pairwise(op, in_array, block_size)
     elif len(block_strides) == 1 and block_strides[0] == 1 and \
         (dr.backend_v(in_array) is not dr.JitBackend.CUDA or
          block_size & (block_size - 1) == 0):
@@ -175,6 +257,25 @@ def tensor_reduce(
         # The requested reduction is also doable via dr.reduce() in 1D, which
         # is going to be more optimized than the other strategies in this file.
         out_array = dr.reduce(op, in_array, 0, mode)
+    elif pairwise or (not symbolic and \
+        (dr.backend_v(in_array) is not dr.JitBackend.CUDA or
+         block_size & (block_size - 1) == 0)):
+        # Fused multi-axis reduction: gather the input in an order that places
+        # the reduced elements of each output entry next to each other, then
+        # perform a single segmented dr.block_reduce(). The gather is symbolic
+        # and folds into the reduction kernel.
+        index = dr.arange(Index, in_size)
+        outer = index // block_size
+        inner = index - outer * block_size
+
+        offset = _strided_offset(inner, block_shape, block_strides,
+                                 _strided_offset(outer, out_shape, out_strides_i))
+
+        gathered = dr.gather(Value, in_array, offset)
+        if pairwise:
+            out_array = block_reduce_pairwise(op, gathered, block_size)
+        else:
+            out_array = dr.block_reduce(op, gathered, block_size, mode)
     elif symbolic:
         index = dr.arange(Index, in_size)
         offset = dr.zeros(Index, in_size)
@@ -346,3 +447,190 @@ def prefix_reduce(
 
     return result
 
+
+def _segment_bounds(offsets: dr.AnyArray) -> Tuple[dr.AnyArray, dr.AnyArray]:
+    """Return the start and end index of every segment of a CSR offset array"""
+    Index = type(offsets)
+    n = dr.width(offsets) - 1
+    if n < 0:
+        raise RuntimeError("'offsets' must contain at least one entry.")
+    i = dr.arange(Index, n)
+    return dr.gather(Index, offsets, i), dr.gather(Index, offsets, i + 1)
+
+def _segment_broadcast(value: ArrayT, offsets: dr.AnyArray, size: int) -> ArrayT:
+    """Copy the per-segment value ``value[i]`` to all elements of segment ``i``"""
+    result = dr.zeros(type(value), size)
+    start, end = _segment_bounds(offsets)
+
+    def body(k, end, value):
+        dr.scatter(result, value, k)
+        return k + 1, end, value
+
+    dr.while_loop(
+        state=(start, end, value),
+        cond=lambda k, end, value: k < end,
+        body=body
+    )
+
+    return result
+
+def _segment_offsets(name: str, value: ArrayT, offsets) -> dr.AnyArray:
+    if not dr.is_dynamic_v(value) or dr.depth_v(value) != 1:
+        raise TypeError(f"drjit.{name}(): 'value' must be a flat (1D) dynamically sized Dr.Jit array!")
+    Index = dr.uint32_array_t(type(value))
+    if type(offsets) is not Index:
+        offsets = Index(offsets)
+    return offsets
+
+class SegmentedRedOp(dr.CustomOp):
+    def eval(self, op: dr.ReduceOp, value: ArrayT, offsets: dr.AnyArray) -> ArrayT:
+        self.offsets = offsets
+        self.size = dr.width(value)
+        return segmented_reduce(op, value, offsets)
+
+    def forward(self):
+        grad_out = segmented_reduce(dr.ReduceOp.Add, self.grad_in('value'), self.offsets)
+        self.set_grad_out(grad_out)
+
+    def backward(self):
+        grad_in = _segment_broadcast(self.grad_out(), self.offsets, self.size)
+        self.set_grad_in('value', grad_in)
+
+def segmented_reduce(op: dr.ReduceOp, value: ArrayT, offsets: dr.AnyArray) -> ArrayT:
+    offsets = _segment_offsets("segmented_reduce", value, offsets)
+
+    if dr.grad_enabled(value):
+        if op != dr.ReduceOp.Add:
+            raise RuntimeError("drjit.segmented_reduce(): for now, differentiation support has only been implemented for add-reductions");
+        return dr.custom(SegmentedRedOp, op, value, offsets)
+
+    Value = type(value)
+    red_op = _reduce_ops[op]
+    start, end = _segment_bounds(offsets)
+
+    # One lane per segment walks over its entries. This is deterministic and
+    # avoids contended atomics, regardless of how the segment sizes vary.
+    return dr.while_loop(
+        state=(start, end, dr.detail.reduce_identity(Value, op)),
+        cond=lambda k, end, accum: k < end,
+        body=lambda k, end, accum: (
+            k + 1, end, red_op(accum, dr.gather(Value, value, k))
+        )
+    )[2]
+
+class SegmentedPrefixRedOp(dr.CustomOp):
+    def eval(self, op: dr.ReduceOp, value: ArrayT, offsets: dr.AnyArray, exclusive: bool, reverse: bool) -> ArrayT:
+        self.op = op
+        self.offsets = offsets
+        self.exclusive = exclusive
+        self.reverse = reverse
+
+        return segmented_prefix_reduce(op, value, offsets, exclusive, reverse)
+
+    def forward(self):
+        grad_out = segmented_prefix_reduce(
+            self.op, self.grad_in('value'), self.offsets,
+            self.exclusive, self.reverse
+        )
+        self.set_grad_out(grad_out)
+
+    def backward(self):
+        grad_in = segmented_prefix_reduce(
+            self.op, self.grad_out(), self.offsets,
+            self.exclusive, not self.reverse
+        )
+        self.set_grad_in('value', grad_in)
+
+def segmented_prefix_reduce(
+    op: dr.ReduceOp,
+    value: ArrayT,
+    offsets: dr.AnyArray,
+    exclusive: bool,
+    reverse: bool
+) -> ArrayT:
+    offsets = _segment_offsets("segmented_prefix_reduce", value, offsets)
+
+    if dr.grad_enabled(value):
+        if op != dr.ReduceOp.Add:
+            raise RuntimeError("drjit.segmented_prefix_reduce(): for now, differentiation support has only been implemented for add-reductions");
+        return dr.custom(SegmentedPrefixRedOp, op, value, offsets, exclusive, reverse)
+
+    Value = type(value)
+    Index = type(offsets)
+    red_op = _reduce_ops[op]
+    start, end = _segment_bounds(offsets)
+
+    # Entries outside of all segments are set to the identity element
+    result = dr.detail.reduce_identity(Value, op, dr.width(value))
+
+    if reverse:
+        offset, step = end - 1, Index(0xFFFFFFFF)
+    else:
+        offset, step = start, Index(1)
+
+    def reduce_body(index, count, offset, accum):
+        value_k = dr.gather(Value, value, offset)
+
+        if not exclusive:
+            accum = red_op(accum, value_k)
+
+        dr.scatter(result, accum, offset)
+
+        if exclusive:
+            accum = red_op(accum, value_k)
+
+        return index + 1, count, offset + step, accum
+
+    dr.while_loop(
+        state=(Index(0), end - start, offset, dr.detail.reduce_identity(Value, op)),
+        cond=lambda index, count, offset, accum: index < count,
+        body=reduce_body
+    )
+
+    return result
+
+def reduce_many(ops, arrays, mode: Optional[str] = None) -> Tuple[dr.ArrayBase, ...]:
+    arrays = tuple(arrays)
+    if isinstance(ops, dr.ReduceOp):
+        ops = (ops,) * len(arrays)
+    else:
+        ops = tuple(ops)
+        if len(ops) != len(arrays):
+            raise RuntimeError("drjit.reduce_many(): 'ops' and 'arrays' must "
+                               f"have the same length (got {len(ops)} and "
+                               f"{len(arrays)})!")
+
+    if mode not in (None, 'symbolic', 'evaluated'):
+        raise RuntimeError("drjit.reduce_many(): 'mode' must be \"symbolic\", "
+                           "\"evaluated\", or None.")
+
+    modes = []
+    for op, value in zip(ops, arrays):
+        tp = type(value)
+        if not dr.is_jit_v(tp) or (dr.depth_v(tp) != 1 and not dr.is_tensor_v(tp)):
+            raise TypeError("drjit.reduce_many(): inputs must be flat JIT "
+                            f"arrays or tensors (got '{tp.__name__}')!")
+
+        mode_i = mode
+        if mode_i is None:
+            array_tp = dr.array_t(tp) if dr.is_tensor_v(tp) else tp
+            symbolic = dr.detail.can_scatter_reduce(array_tp, op) and \
+                (op == dr.ReduceOp.Add or not dr.grad_enabled(value))
+            mode_i = 'symbolic' if symbolic else 'evaluated'
+        modes.append(mode_i)
+
+    # Symbolic reductions only record an atomic scatter into a result with
+    # one entry. They are issued first so that the next evaluation compiles
+    # all of them into one kernel (per distinct input size), even if it is
+    # triggered by one of the remaining evaluated reductions.
+    result = [None] * len(arrays)
+    for pass_mode in ('symbolic', 'evaluated'):
+        for i, (op, value) in enumerate(zip(ops, arrays)):
+            if modes[i] == pass_mode:
+                result[i] = dr.reduce(op, value, None, pass_mode)
+
+    result = tuple(result)
+    if mode is None:
+        dr.eval(result)
+
+    return result
@@ -0,0 +1,127 @@
+import drjit as dr
+import math
+from typing import Callable, Dict, List, Sequence, Tuple
+
+
+def _sinc(x: float) -> float:
+    if x == 0:
+        return 1.0
+    x *= math.pi
+    return math.sin(x) / x
+
+
+def _mitchell(x: float, b: float = 1.0 / 3.0, c: float = 1.0 / 3.0) -> float:
+    x = abs(x)
+    x2, x3 = x * x, x * x * x
+    if x < 1:
+        return ((12 - 9 * b - 6 * c) * x3 + (-18 + 12 * b + 6 * c) * x2 +
+                (6 - 2 * b)) / 6
+    elif x < 2:
+        return ((-b - 6 * c) * x3 + (6 * b + 30 * c) * x2 +
+                (-12 * b - 48 * c) * x + (8 * b + 24 * c)) / 6
+    return 0.0
+
+
+# Reconstruction filters: name -> (radius, evaluation routine)
+_filters: Dict[str, Tuple[float, Callable[[float], float]]] = {
+    'box': (0.5, lambda x: 1.0 if -0.5 <= x < 0.5 else 0.0),
+    'tent': (1.0, lambda x: max(0.0, 1.0 - abs(x))),
+    'lanczos': (3.0, lambda x: _sinc(x) * _sinc(x / 3) if abs(x) < 3 else 0.0),
+    'mitchell': (2.0, _mitchell),
+}
+
+
+def _weights(src: int, dst: int, filter: str) -> Tuple[int, List[List[int]], List[List[float]]]:
+    """
+    Precompute the taps of a 1D resampling operation from ``src`` to ``dst``
+    samples. Returns the number of taps along with tap-major lists of source
+    indices and normalized weights (one entry per output sample). Out-of-range
+    source positions are clamped to the boundary.
+    """
+    radius, func = _filters[filter]
+    scale = src / dst
+
+    # Widen the filter when downsampling to avoid aliasing
+    fscale = max(scale, 1.0)
+    r = radius * fscale
+    taps = max(int(math.ceil(2 * r)), 1) + 1
+
+    index = [[0] * dst for _ in range(taps)]
+    weight = [[0.0] * dst for _ in range(taps)]
+
+    for o in range(dst):
+        center = (o + 0.5) * scale - 0.5
+        start = int(math.floor(center - r)) + 1
+        total = 0.0
+        for t in range(taps):
+            j = start + t
+            w = func((j - center) / fscale)
+            index[t][o] = min(max(j, 0), src - 1)
+            weight[t][o] = w
+            total += w
+
+        for t in range(taps):
+            weight[t][o] /= total
+
+    return taps, index, weight
+
+
+def _resample_axis(value: dr.ArrayBase, shape: Tuple[int, ...], axis: int,
+                   size: int, filter: str) -> dr.ArrayBase:
+    """
+    Resample axis ``axis`` of the flat C-ordered tensor storage ``value`` with
+    shape ``shape`` to ``size`` samples.
+    """
+    Float = type(value)
+    UInt32 = dr.uint32_array_t(Float)
+    FloatD = dr.detached_t(Float)
+
+    src = shape[axis]
+    inner = math.prod(shape[axis + 1:])
+    outer = math.prod(shape[:axis])
+    taps, index, weight = _weights(src, size, filter)
+
+    k = dr.arange(UInt32, outer * size * inner)
+    i_inner = k % inner
+    o = (k // inner) % size
+    base = (k // (inner * size)) * (src * inner) + i_inner
+
+    result = dr.zeros(Float, outer * size * inner)
+    for t in range(taps):
+        w = dr.gather(FloatD, FloatD(weight[t]), o)
+        j = dr.gather(UInt32, UInt32(index[t]), o)
+        result = dr.fma(dr.gather(Float, value, base + j * inner), w, result)
+
+    return result
+
+
+def resample(source: dr.ArrayBase, shape: Sequence[int], filter: str) -> dr.ArrayBase:
+    if not dr.is_tensor_v(source) or not dr.is_float_v(source):
+        raise TypeError("drjit.resample(): 'source' must be a floating point tensor!")
+
+    if filter not in _filters:
+        raise RuntimeError("drjit.resample(): 'filter' must equal \"box\", "
+                           "\"tent\", \"lanczos\", or \"mitchell\"!")
+
+    src_shape = source.shape
+    shape = tuple(shape)
+    if len(shape) > len(src_shape):
+        raise TypeError("drjit.resample(): invalid shape size!")
+    shape = shape + tuple(src_shape[len(shape):])
+
+    for s in shape:
+        if type(s) is not int or s < 1:
+            raise TypeError("drjit.resample(): target shape must contain positive integer values!")
+
+    value = source.array
+    cur = tuple(src_shape)
+    for axis, size in enumerate(shape):
+        if size == cur[axis]:
+            continue
+
+        # The next pass gathers from this one, which evaluates it. This
+        # yields one kernel per resampled axis.
+        value = _resample_axis(value, cur, axis, size, filter)
+        cur = cur[:axis] + (size,) + cur[axis + 1:]
+
+    return type(source)(value, cur)
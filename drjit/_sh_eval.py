@@ -754,3 +754,132 @@ def sh_eval_9(d, r) -> None:
     tmp_c = -0.74890095185318839
     r[99] = tmp_c * c0
     r[81] = tmp_c * s0
+
+def _sh_diag(m: int) -> float:
+    # Normalized associated Legendre function of degree and order 'm'
+    # (without the sin(theta)^m factor), including the Condon-Shortley
+    # phase and the sqrt(2) factor of the m != 0 real basis functions
+    from math import sqrt
+    y = 0.28209479177387814
+    for k in range(1, m + 1):
+        y *= -sqrt((2 * k + 1) / (2 * k))
+    return y * sqrt(2) if m > 0 else y
+
+def sh_eval_n(d, order: int, r) -> None:
+    # Arbitrary-order evaluation via the recurrence of the normalized
+    # associated Legendre polynomials along the degree 'l'
+    from drjit import fma
+    from math import sqrt
+    x, y, z = d
+    Float = type(x)
+    c = s = None
+
+    for m in range(order + 1):
+        if m == 1:
+            c, s = x, y
+        elif m > 1:
+            c, s = fma(x, c, -(y * s)), fma(x, s, y * c)
+
+        def emit(l, v):
+            if m == 0:
+                r[l * (l + 1)] = v
+            else:
+                r[l * (l + 1) + m] = v * c
+                r[l * (l + 1) - m] = v * s
+
+        p2 = _sh_diag(m)
+        emit(m, Float(p2))
+        if m == order:
+            continue
+
+        p1 = z * (sqrt(2 * m + 3) * p2)
+        emit(m + 1, p1)
+
+        for l in range(m + 2, order + 1):
+            l2, m2 = l * l, m * m
+            a = sqrt((4 * l2 - 1) / (l2 - m2))
+            b = sqrt((2 * l + 1) * ((l - 1)**2 - m2) / ((2 * l - 3) * (l2 - m2)))
+            p = fma(z * a, p1, p2 * -b)
+            emit(l, p)
+            p2, p1 = p1, p
+
+def sh_rotate(R, coeffs: list) -> list:
+    # Band rotation matrices via the recurrence of Ivanic and Ruedenberg
+    from drjit import fma
+    from math import sqrt
+
+    n = len(coeffs)
+    order = int(round(sqrt(n))) - 1
+    if (order + 1) ** 2 != n:
+        raise RuntimeError("sh_rotate(): the number of coefficients must "
+                           "be a square number!")
+
+    result = [coeffs[0]]
+    if order == 0:
+        return result
+
+    # Band 1 in the (y, z, x) order of the basis, with the signs of the
+    # Condon-Shortley phase
+    r1 = [[ R[1][1], -R[1][2],  R[1][0]],
+          [-R[2][1],  R[2][2], -R[2][0]],
+          [ R[0][1], -R[0][2],  R[0][0]]]
+
+    def apply(band, c):
+        size = len(band)
+        for i in range(size):
+            acc = c[0] * band[i][0]
+            for j in range(1, size):
+                acc += c[j] * band[i][j]
+            result.append(acc)
+
+    apply(r1, coeffs[1:4])
+    prev = r1
+
+    for l in range(2, order + 1):
+        def P(i, a, b):
+            rp = lambda i, j: prev[i + l - 1][j + l - 1]
+            if b == l:
+                return fma(r1[i + 1][2], rp(a, l - 1), -(r1[i + 1][0] * rp(a, -l + 1)))
+            elif b == -l:
+                return fma(r1[i + 1][2], rp(a, -l + 1), r1[i + 1][0] * rp(a, l - 1))
+            else:
+                return r1[i + 1][1] * rp(a, b)
+
+        band = []
+        for m in range(-l, l + 1):
+            row = []
+            d0, am = m == 0, abs(m)
+            for n in range(-l, l + 1):
+                denom = 2 * l * (2 * l - 1) if abs(n) == l else (l + n) * (l - n)
+                u = sqrt((l + m) * (l - m) / denom)
+                v = 0.5 * sqrt((1 + d0) * (l + am - 1) * (l + am) / denom) * (1 - 2 * d0)
+                w = -0.5 * sqrt((l - am - 1) * (l - am) / denom) * (1 - d0)
+
+                value = 0
+                if u != 0:
+                    value = P(0, m, n) * u
+                if v != 0:
+                    if m == 0:
+                        tv = P(1, 1, n) + P(-1, -1, n)
+                    elif m == 1:
+                        tv = P(1, 0, n) * sqrt(2)
+                    elif m == -1:
+                        tv = P(-1, 0, n) * sqrt(2)
+                    elif m > 0:
+                        tv = P(1, m - 1, n) - P(-1, -m + 1, n)
+                    else:
+                        tv = P(1, m + 1, n) + P(-1, -m - 1, n)
+                    value = tv * v + value
+                if w != 0:
+                    if m > 0:
+                        tw = P(1, m + 1, n) + P(-1, -m - 1, n)
+                    else:
+                        tw = P(1, m - 1, n) - P(-1, -m + 1, n)
+                    value = tw * w + value
+                row.append(value)
+            band.append(row)
+
+        apply(band, coeffs[l * l:(l + 1) ** 2])
+        prev = band
+
+    return result
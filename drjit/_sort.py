@@ -0,0 +1,203 @@
+import drjit as dr
+from typing import List, TypeVar
+
+ArrayT = TypeVar("ArrayT", bound=dr.ArrayBase)
+
+
+def _key_words(name: str, value: dr.ArrayBase) -> List[dr.ArrayBase]:
+    """
+    Map an array of keys onto a sequence of 32-bit unsigned integer arrays
+    (least significant word first) whose lexicographic unsigned order matches
+    the order of the original keys.
+    """
+    if not dr.is_dynamic_v(value) or dr.depth_v(value) != 1 or dr.is_tensor_v(value):
+        raise TypeError(f"drjit.{name}(): 'value' must be a flat (1D) dynamically sized Dr.Jit array!")
+
+    vt = dr.type_v(value)
+    UInt32 = dr.uint32_array_t(type(value))
+
+    if vt == dr.VarType.UInt32:
+        return [value]
+    elif vt == dr.VarType.Int32:
+        return [dr.reinterpret_array(UInt32, value) ^ 0x80000000]
+    elif vt == dr.VarType.Float32:
+        # Flip all bits of negative values and the sign bit of positive ones
+        bits = dr.reinterpret_array(UInt32, value)
+        return [bits ^ dr.select(bits >= 0x80000000, UInt32(0xFFFFFFFF), UInt32(0x80000000))]
+
+    UInt64 = dr.uint64_array_t(type(value))
+
+    if vt == dr.VarType.UInt64:
+        bits = value
+    elif vt == dr.VarType.Int64:
+        bits = dr.reinterpret_array(UInt64, value) ^ 0x8000000000000000
+    elif vt == dr.VarType.Float64:
+        bits = dr.reinterpret_array(UInt64, value)
+        bits ^= dr.select(bits >= 0x8000000000000000,
+                          UInt64(0xFFFFFFFFFFFFFFFF), UInt64(0x8000000000000000))
+    else:
+        raise TypeError(f"drjit.{name}(): unsupported key type \"{vt}\"!")
+
+    return [UInt32(bits), UInt32(bits >> 32)]
+
+
+def argsort(value: ArrayT, reverse: bool = False) -> dr.AnyArray:
+    """
+    Stable least significant digit radix sort that processes one bit per pass
+    via a *split* operation: an exclusive prefix sum over the keys with a zero
+    bit provides the target position of these keys, and the remaining ones
+    are placed after them in their original order.
+    """
+    words = _key_words("argsort", value)
+    UInt32 = type(words[0])
+    n = dr.width(value)
+
+    perm = dr.arange(UInt32, n)
+    if n <= 1:
+        return perm
+
+    index = dr.arange(UInt32, n)
+
+    for word in words:
+        if reverse:
+            word = ~word
+
+        for bit in range(32):
+            key = dr.gather(UInt32, word, perm)
+            zero = UInt32(((key >> bit) & 1) == 0)
+
+            # Target position of the keys with a zero/one bit
+            pos_zero = dr.prefix_sum(zero)
+            pos_one = dr.sum(zero) + index - pos_zero
+
+            perm_new = dr.empty(UInt32, n)
+            dr.scatter(perm_new, perm, dr.select(zero == 1, pos_zero, pos_one))
+            perm = perm_new
+
+    return perm
+
+
+def histogram(keys: dr.AnyArray, n_bins: int, weights=None) -> dr.ArrayBase:
+    if not dr.is_dynamic_v(keys) or dr.depth_v(keys) != 1 or not dr.is_integral_v(keys):
+        raise TypeError("drjit.histogram(): 'keys' must be a flat (1D) dynamically sized integer array!")
+
+    UInt32 = dr.uint32_array_t(type(keys))
+    keys = UInt32(keys)
+
+    if weights is None:
+        result, value = dr.zeros(UInt32, n_bins), UInt32(1)
+    else:
+        result, value = dr.zeros(type(weights), n_bins), weights
+
+    # Privatize the bins to avoid contended atomics: the LLVM backend keeps a
+    # separate copy per core when the histogram is small, while the CUDA
+    # backend pre-reduces updates targeting the same bin within each warp.
+    if dr.backend_v(keys) is dr.JitBackend.LLVM and n_bins <= 4096:
+        mode = dr.ReduceMode.Expand
+    else:
+        mode = dr.ReduceMode.Local
+
+    dr.scatter_reduce(dr.ReduceOp.Add, result, value, keys,
+                      active=keys < n_bins, mode=mode)
+    return result
+
+
+def run_length_encode(value: ArrayT):
+    if not dr.is_dynamic_v(value) or dr.depth_v(value) != 1 or dr.is_tensor_v(value):
+        raise TypeError("drjit.run_length_encode(): 'value' must be a flat (1D) dynamically sized Dr.Jit array!")
+
+    Value = type(value)
+    UInt32 = dr.uint32_array_t(Value)
+    n = dr.width(value)
+    if n == 0:
+        return Value(), UInt32()
+
+    # Mark the first entry of every run, then compact the run starts
+    index = dr.arange(UInt32, n)
+    prev = dr.gather(Value, value, index - 1, index > 0)
+    start = dr.compress((index == 0) | (value != prev))
+
+    m = dr.width(start)
+    j = dr.arange(UInt32, m)
+    end = dr.select(j + 1 < m, dr.gather(UInt32, start, j + 1, j + 1 < m), UInt32(n))
+
+    return dr.gather(Value, value, start), end - start
+
+
+def unique(value: ArrayT, return_counts: bool = False):
+    values, counts = run_length_encode(dr.gather(type(value), value, argsort(value)))
+    return (values, counts) if return_counts else values
+
+
+def _check_sorted(name: str, value: ArrayT) -> None:
+    if not dr.is_jit_v(value) or dr.depth_v(value) != 1 or dr.is_tensor_v(value):
+        raise TypeError(f"drjit.{name}(): 'sorted_array' must be a flat (1D) JIT-compiled Dr.Jit array!")
+
+
+def eytzinger(value: ArrayT) -> ArrayT:
+    _check_sorted("eytzinger", value)
+
+    Value = type(value)
+    UInt32 = dr.uint32_array_t(Value)
+    n = dr.width(value)
+    if n == 0:
+        return Value()
+
+    # Pad the implicit tree to a perfect binary tree of height 'h'. Node 'k'
+    # (1-based) at depth 'd' with offset 'p' within its level has in-order rank
+    # (2p + 1) * 2^(h-1-d) - 1. Entry 0 is unused. Padded nodes (rank >= n) are
+    # skipped by the search, their value here is arbitrary.
+    h = n.bit_length()
+    k = dr.maximum(dr.arange(UInt32, 1 << h), 1)
+    d = dr.log2i(k)
+    p = k - (UInt32(1) << d)
+    rank = ((2 * p + 1) << (h - 1 - d)) - 1
+
+    return dr.gather(Value, dr.detach(value), dr.minimum(rank, n - 1))
+
+
+def searchsorted(sorted_array: ArrayT, values, side: str, layout) -> dr.AnyArray:
+    _check_sorted("searchsorted", sorted_array)
+    if side not in ("left", "right"):
+        raise RuntimeError("drjit.searchsorted(): 'side' must equal \"left\" or \"right\"!")
+
+    Value = type(sorted_array)
+    UInt32 = dr.uint32_array_t(Value)
+    n = dr.width(sorted_array)
+    x = dr.detach(values) if isinstance(values, Value) else Value(values)
+
+    if n == 0:
+        return dr.zeros(UInt32, dr.width(x))
+
+    h = n.bit_length()
+    if layout is not None:
+        if type(layout) is not Value or dr.width(layout) != 1 << h:
+            raise RuntimeError("drjit.searchsorted(): 'layout' must be the output "
+                               "of drjit.eytzinger() for 'sorted_array'!")
+        data = dr.detach(layout)
+    else:
+        data = dr.detach(sorted_array)
+
+    right = side == "right"
+
+    # Branchless descent through the implicit perfect binary tree of height
+    # 'h' over 'sorted_array'. Going right at depth 'd' skips 'step = 2^(h-1-d)'
+    # entries (the left subtree and the node). The Eytzinger layout stores the
+    # nodes of the top levels next to each other so that all lanes share them.
+    def body(r, k, step):
+        node = r + step - 1
+        valid = node < n
+        pivot = dr.gather(Value, data, k if layout is not None else node, valid)
+        go_right = valid & ((pivot <= x) if right else (pivot < x))
+        r = dr.select(go_right, r + step, r)
+        k = 2 * k + UInt32(go_right)
+        return r, k, step >> 1
+
+    m = dr.width(x)
+    return dr.while_loop(
+        state=(dr.zeros(UInt32, m), dr.full(UInt32, 1, m),
+               dr.full(UInt32, 1 << (h - 1), m)),
+        cond=lambda r, k, step: step > 0,
+        body=body,
+        labels=("r", "k", "step")
+    )[0]
@@ -0,0 +1,139 @@
+import drjit as dr
+from typing import Any, Callable, List, Optional, Tuple
+
+from ._reduce import _reduce_ops
+
+
+def _flatten(tree: Any) -> Tuple[List[Any], Callable[[List[Any]], Any]]:
+    """
+    Flatten a (tuple/list/dict-based) PyTree into a list of leaves and
+    return it along with a function that rebuilds the tree from new leaves
+    """
+    if isinstance(tree, (tuple, list)):
+        parts = [_flatten(v) for v in tree]
+    elif isinstance(tree, dict):
+        parts = [_flatten(v) for v in tree.values()]
+    else:
+        return [tree], lambda leaves: leaves[0]
+
+    leaves, counts = [], []
+    for l, _ in parts:
+        leaves.extend(l)
+        counts.append(len(l))
+
+    def rebuild(values: List[Any]) -> Any:
+        result, offset = [], 0
+        for (_, r), n in zip(parts, counts):
+            result.append(r(values[offset:offset + n]))
+            offset += n
+        if isinstance(tree, dict):
+            return dict(zip(tree.keys(), result))
+        return type(tree)(result)
+
+    return leaves, rebuild
+
+
+def _length(value: Any) -> Optional[int]:
+    """Return the size of the leading dimension of ``value`` (if any)"""
+    if dr.is_tensor_v(value):
+        return value.shape[0] if value.ndim > 0 else None
+    elif dr.is_dynamic_v(value):
+        return dr.width(value)
+    elif hasattr(value, "shape") and hasattr(value, "__getitem__"):
+        return value.shape[0] if len(value.shape) > 0 else None
+    return None
+
+
+def _chunk(value: Any, start: int, end: int) -> Any:
+    """Extract the entries ``[start, end)`` along the leading dimension"""
+    if dr.is_tensor_v(value):
+        return value[start:end] if value.ndim > 0 else value
+    elif dr.is_dynamic_v(value):
+        tp = index_tp = type(value)
+        while dr.depth_v(index_tp) > 1:
+            index_tp = dr.value_t(index_tp)
+        index_tp = dr.uint32_array_t(index_tp)
+        return dr.gather(tp, value, dr.arange(index_tp, start, end))
+    elif _length(value) is not None:
+        return value[start:end]
+    return value
+
+
+def stream(
+    func: Callable,
+    inputs: Any,
+    chunk_size: int,
+    reduce: Any = None,
+) -> Any:
+    import numpy as np
+
+    if chunk_size <= 0:
+        raise RuntimeError("drjit.stream(): 'chunk_size' must be positive.")
+
+    in_leaves, in_rebuild = _flatten(inputs)
+    sizes = set(n for n in map(_length, in_leaves) if n is not None)
+    if len(sizes) != 1:
+        raise RuntimeError(
+            "drjit.stream(): 'inputs' must contain arrays with a consistent "
+            f"leading dimension (got sizes {sorted(sizes)}).")
+    size = sizes.pop()
+    if size == 0:
+        raise RuntimeError("drjit.stream(): 'inputs' must not be empty.")
+
+    ops: Optional[List[Any]] = None
+    accum: List[Any] = []
+    parts: List[List[Any]] = []
+    pending: Optional[List[Any]] = None
+    out_rebuild = None
+    axes: List[int] = []
+
+    def to_host(values: List[Any]):
+        for i, v in enumerate(values):
+            if ops[i] is None:
+                parts[i].append(v.numpy() if dr.is_array_v(v) else np.asarray(v))
+                # Nested arrays (e.g. Array3f) store their entries along the last axis
+                if dr.is_array_v(v) and not dr.is_tensor_v(v) and dr.depth_v(v) > 1:
+                    axes[i] = -1
+
+    for start in range(0, size, chunk_size):
+        end = min(start + chunk_size, size)
+
+        out = func(in_rebuild([_chunk(v, start, end) for v in in_leaves]))
+        out_leaves, out_rebuild = _flatten(out)
+
+        if ops is None:
+            if reduce is None or isinstance(reduce, dr.ReduceOp):
+                ops = [reduce] * len(out_leaves)
+            else:
+                ops, _ = _flatten(reduce)
+                if len(ops) != len(out_leaves):
+                    raise RuntimeError(
+                        "drjit.stream(): the structure of 'reduce' does not "
+                        "match the output of 'func'.")
+            accum = [None] * len(out_leaves)
+            parts = [[] for _ in out_leaves]
+            axes = [0] * len(out_leaves)
+
+        # Outputs with a reduction are accumulated on the device
+        for i, v in enumerate(out_leaves):
+            if ops[i] is not None:
+                accum[i] = v if accum[i] is None else _reduce_ops[ops[i]](accum[i], v)
+
+        # Launch the chunk. On the CUDA backend, this returns before the
+        # computation has finished, and the host-side work of the next
+        # iteration (slicing, tracing, uploads) overlaps with it.
+        dr.schedule([v for v, op in zip(out_leaves, ops) if op is None], accum)
+        dr.eval()
+
+        # Move the per-element outputs of the previous chunk to the host
+        # once this one has been launched (double buffering)
+        if pending is not None:
+            to_host(pending)
+        pending = out_leaves
+
+    to_host(pending)
+
+    return out_rebuild([
+        accum[i] if ops[i] is not None else np.concatenate(parts[i], axis=axes[i])
+        for i in range(len(ops))
+    ])
@@ -0,0 +1,68 @@
+import drjit as dr
+import os
+from typing import Any, Dict, List, Optional
+
+
+def _attribute(key: str, value: Any) -> Dict[str, Any]:
+    """Convert a key-value pair into an OTLP attribute"""
+    if isinstance(value, bool):
+        v = {"boolValue": value}
+    elif isinstance(value, int):
+        # 64-bit integers are encoded as strings in OTLP/JSON
+        v = {"intValue": str(value)}
+    elif isinstance(value, float):
+        v = {"doubleValue": value}
+    else:
+        v = {"stringValue": str(value)}
+    return {"key": key, "value": v}
+
+
+def trace_export(spans: List[Dict[str, Any]], filename: Optional[str] = None,
+                 service_name: str = "drjit") -> str:
+    import json
+
+    trace_id = os.urandom(16).hex()
+    span_ids = [os.urandom(8).hex() for _ in spans]
+
+    result = []
+    for i, s in enumerate(spans):
+        attributes = [
+            _attribute("code.filepath", s["file"]),
+            _attribute("code.lineno", s["line"]),
+            _attribute("thread.id", s["thread"]),
+            _attribute("drjit.category", s["category"]),
+        ]
+        for k in ("size", "cache_hit"):
+            if k in s:
+                attributes.append(_attribute("drjit." + k, s[k]))
+
+        span = {
+            "traceId": trace_id,
+            "spanId": span_ids[i],
+            "name": s["name"],
+            "kind": 1, # SPAN_KIND_INTERNAL
+            "startTimeUnixNano": str(s["start"]),
+            "endTimeUnixNano": str(s["end"]),
+            "attributes": attributes,
+        }
+        if s["parent"] is not None:
+            span["parentSpanId"] = span_ids[s["parent"]]
+        result.append(span)
+
+    doc = {
+        "resourceSpans": [{
+            "resource": {
+                "attributes": [_attribute("service.name", service_name)]
+            },
+            "scopeSpans": [{
+                "scope": {"name": "drjit", "version": dr.__version__},
+                "spans": result,
+            }],
+        }]
+    }
+
+    output = json.dumps(doc)
+    if filename is not None:
+        with open(filename, "w") as f:
+            f.write(output)
+    return output
@@ -0,0 +1,239 @@
+import drjit as dr
+from typing import Tuple, Optional, Sequence, Any
+
+
+def _compute_strides(shape: Tuple[int, ...]) -> Tuple[int, ...]:
+    """Turn a shape tuple into a C-style strides tuple"""
+    val, ndim = 1, len(shape)
+    strides = [0] * ndim
+    for i in reversed(range(ndim)):
+        strides[i] = val
+        val *= shape[i]
+    return tuple(strides)
+
+
+def _prod(shape: Sequence[int]) -> int:
+    result = 1
+    for n in shape:
+        result *= n
+    return result
+
+
+class TensorView:
+    """
+    Lazily strided view of a Dr.Jit tensor. See :py:func:`drjit.view()` for
+    details.
+    """
+
+    __slots__ = ("source", "shape", "strides", "offset")
+
+    def __init__(
+        self,
+        source: Any,
+        shape: Optional[Tuple[int, ...]] = None,
+        strides: Optional[Tuple[int, ...]] = None,
+        offset: int = 0,
+    ):
+        if isinstance(source, TensorView):
+            source = source.tensor()
+        if not dr.is_tensor_v(source):
+            raise TypeError("TensorView(): 'source' must be a Dr.Jit tensor.")
+
+        if shape is None:
+            shape = source.shape
+        if strides is None:
+            strides = _compute_strides(shape)
+        if len(strides) != len(shape):
+            raise RuntimeError("TensorView(): 'shape' and 'strides' must "
+                               "have the same length.")
+
+        self.source = source
+        self.shape = tuple(shape)
+        self.strides = tuple(strides)
+        self.offset = offset
+
+    @property
+    def ndim(self) -> int:
+        return len(self.shape)
+
+    def __len__(self) -> int:
+        return self.shape[0]
+
+    def __repr__(self) -> str:
+        return (f"TensorView(shape={self.shape}, strides={self.strides}, "
+                f"offset={self.offset})")
+
+    @property
+    def is_contiguous(self) -> bool:
+        """
+        Does the view reference a C-style contiguous block of the source?
+        Axes of size one are ignored since their stride is irrelevant.
+        """
+        expected = _compute_strides(self.shape)
+        return all(
+            n == 1 or s == e for n, s, e in zip(self.shape, self.strides, expected)
+        )
+
+    def __getitem__(self, key) -> "TensorView":
+        if not isinstance(key, tuple):
+            key = (key,)
+
+        # Slicing with index arrays cannot be expressed as a strided
+        # view and requires a gather from the materialized tensor
+        if any(dr.is_array_v(k) for k in key):
+            return TensorView(self.tensor()[key])
+
+        n_real = sum(1 for k in key if k is not None and k is not Ellipsis)
+        if n_real > self.ndim:
+            raise IndexError("TensorView.__getitem__(): too many indices.")
+
+        shape, strides = [], []
+        offset, axis = self.offset, 0
+
+        for k in key:
+            if k is None:
+                shape.append(1)
+                strides.append(0)
+            elif k is Ellipsis:
+                for _ in range(self.ndim - n_real):
+                    shape.append(self.shape[axis])
+                    strides.append(self.strides[axis])
+                    axis += 1
+                n_real = self.ndim
+            elif isinstance(k, int):
+                size = self.shape[axis]
+                i = k + size if k < 0 else k
+                if i < 0 or i >= size:
+                    raise IndexError(
+                        f"TensorView.__getitem__(): index {k} is out of "
+                        f"bounds for axis {axis} with size {size}.")
+                offset += i * self.strides[axis]
+                axis += 1
+            elif isinstance(k, slice):
+                start, stop, step = k.indices(self.shape[axis])
+                shape.append(len(range(start, stop, step)))
+                strides.append(self.strides[axis] * step)
+                offset += start * self.strides[axis]
+                axis += 1
+            else:
+                raise TypeError("TensorView.__getitem__(): unsupported "
+                                f"index type '{type(k).__name__}'.")
+
+        # Implicit ellipsis at the end
+        while axis < self.ndim:
+            shape.append(self.shape[axis])
+            strides.append(self.strides[axis])
+            axis += 1
+
+        return TensorView(self.source, tuple(shape), tuple(strides), offset)
+
+    def transpose(self, *axes) -> "TensorView":
+        """
+        Permute the axes of the view without moving any data. Without
+        arguments, the order of all axes is reversed.
+        """
+        if len(axes) == 1 and isinstance(axes[0], (tuple, list)):
+            axes = tuple(axes[0])
+        if not axes:
+            axes = tuple(reversed(range(self.ndim)))
+        if sorted(axes) != list(range(self.ndim)):
+            raise RuntimeError("TensorView.transpose(): 'axes' must be a "
+                               "permutation of the tensor dimensions.")
+        return TensorView(
+            self.source,
+            tuple(self.shape[i] for i in axes),
+            tuple(self.strides[i] for i in axes),
+            self.offset,
+        )
+
+    @property
+    def T(self) -> "TensorView":
+        return self.transpose()
+
+    def reshape(self, shape: Sequence[int]) -> "TensorView":
+        """
+        Reshape the view. This only requires a copy when the view isn't
+        contiguous; the result is otherwise a view of the same source.
+        """
+        shape = tuple(shape)
+        size = _prod(self.shape)
+        if -1 in shape:
+            rest = -_prod(shape)
+            shape = tuple(size // rest if n == -1 else n for n in shape)
+        if _prod(shape) != size:
+            raise RuntimeError(
+                f"TensorView.reshape(): cannot reshape a view of shape "
+                f"{self.shape} into shape {shape}.")
+
+        if self.is_contiguous:
+            return TensorView(self.source, shape, None, self.offset)
+        else:
+            return TensorView(self.tensor(), shape)
+
+    def index(self) -> Any:
+        """
+        Return the flat source index of each element of the view in C-style
+        order. The view's offset and strides are folded into a single affine
+        expression per axis.
+        """
+        # Signed arithmetic, since slices with a negative step flip strides
+        Index = dr.int32_array_t(dr.array_t(self.source))
+        size = _prod(self.shape)
+        index = dr.arange(Index, size)
+        result = Index(self.offset)
+
+        for n, stride in zip(reversed(self.shape), reversed(self.strides)):
+            if n == 1:
+                continue
+            next_index = index // n
+            if stride != 0:
+                result = dr.fma(index - next_index * n, stride, result)
+            index = next_index
+
+        if dr.width(result) != size:
+            result = dr.zeros(Index, size) + result
+
+        return dr.uint32_array_t(Index)(result)
+
+    def tensor(self) -> Any:
+        """
+        Materialize the view into a tensor. This is free when the view covers
+        the entire source in its original layout and otherwise costs a single
+        gather, regardless of how many slicing and transposition steps
+        produced the view.
+        """
+        Tensor = type(self.source)
+        if self.shape == self.source.shape and self.offset == 0 and \
+           self.is_contiguous:
+            return self.source
+
+        Value = dr.array_t(self.source)
+        if self.is_contiguous and len(self.shape) > 0 and \
+           _prod(self.shape) == _prod(self.source.shape):
+            return Tensor(self.source.array, self.shape)
+
+        return Tensor(
+            dr.gather(Value, self.source.array, self.index()), self.shape
+        )
+
+    @property
+    def array(self) -> Any:
+        return self.tensor().array
+
+    def numpy(self) -> Any:
+        return self.tensor().numpy()
+
+    def torch(self) -> Any:
+        return self.tensor().torch()
+
+    def jax(self) -> Any:
+        return self.tensor().jax()
+
+    def tf(self) -> Any:
+        return self.tensor().tf()
+
+    def __dlpack__(self, *args, **kwargs) -> Any:
+        return self.tensor().__dlpack__(*args, **kwargs)
+
+    def __dlpack_device__(self) -> Any:
+        return self.tensor().__dlpack_device__()
@@ -8,6 +8,8 @@ from typing import (
     Optional,
     Tuple,
     List,
+    Set,
+    Dict,
     TypeVar,
     Callable,
     Union,
@@ -234,6 +236,9 @@ class _SyntaxVisitor(ast.NodeTransformer):
             "label",
             "mode",
             "max_iterations",
+            "unroll",
+            "checkpoint",
+            "ad_mode",
             "strict",
             "compress",
         ]
@@ -487,11 +492,133 @@ class _SyntaxVisitor(ast.NodeTransformer):
             comment_end,
         ]
 
+    def modified_vars(self, node: ast.AST) -> Tuple[Set[str], Dict[str, int]]:
+        """
+        Return the set of variables that are potentially modified within
+        ``node`` along with the number of direct assignments to each of them.
+
+        Besides assignments, this conservatively includes variables whose
+        attributes/items are assigned, and variables that are passed to (or
+        whose methods are invoked by) a function call.
+        """
+
+        def base_name(n: ast.AST) -> Optional[str]:
+            while isinstance(n, (ast.Attribute, ast.Subscript, ast.Starred)):
+                n = n.value
+            return n.id if isinstance(n, ast.Name) else None
+
+        modified, store_count = set(), {}
+        for n in ast.walk(node):
+            if isinstance(n, ast.Name) and not isinstance(n.ctx, ast.Load):
+                modified.add(n.id)
+                store_count[n.id] = store_count.get(n.id, 0) + 1
+            elif isinstance(n, (ast.Attribute, ast.Subscript)) and \
+                 not isinstance(n.ctx, ast.Load):
+                modified.add(base_name(n))
+            elif isinstance(n, ast.Call):
+                for arg in (n.func, *n.args, *(k.value for k in n.keywords)):
+                    modified.add(base_name(arg))
+            elif isinstance(n, (ast.Global, ast.Nonlocal)):
+                modified.update(n.names)
+
+        return modified, store_count
+
+    def hoist_invariants(self, node: ast.While) -> List[ast.stmt]:
+        """
+        Remove loop-invariant assignments from the body of a ``while`` loop
+        and return them so that they can be placed before the loop.
+
+        This avoids recomputing them in each iteration (evaluated mode), keeps
+        them out of the recorded loop body (symbolic mode), and often shrinks
+        the loop state. The analysis is conservative: it only considers
+        top-level assignments ``name = expr``, where
+
+        - ``expr`` consists of constants, variable/attribute/item reads, and
+          arithmetic or comparison operators that cannot raise for numeric
+          inputs (in particular, no function calls or divisions),
+
+        - no variable read by ``expr`` is assigned, has its attributes/items
+          assigned, or is passed to a function call anywhere in the loop,
+
+        - ``name`` is not defined before the loop, assigned exactly once within
+          it, and not read before this assignment within an iteration.
+        """
+        _, hints = self.extract_hints(node.test)
+        mode = hints.get("mode", None)
+        if isinstance(mode, ast.Constant) and mode.value == "scalar":
+            return []
+
+        modified, store_count = self.modified_vars(node)
+
+        # Variables defined before the loop
+        defined = set(self.var_w)
+        for w in self.par_w:
+            defined |= w
+
+        safe_ops = (ast.Add, ast.Sub, ast.Mult, ast.MatMult, ast.BitAnd,
+                    ast.BitOr, ast.BitXor, ast.USub, ast.UAdd, ast.Invert,
+                    ast.Not, ast.Eq, ast.NotEq, ast.Lt, ast.LtE, ast.Gt,
+                    ast.GtE)
+
+        def is_pure(e: ast.AST) -> bool:
+            for n in ast.walk(e):
+                if isinstance(n, ast.Name):
+                    if n.id in modified:
+                        return False
+                elif isinstance(n, ast.Subscript):
+                    if not isinstance(n.slice, ast.Constant):
+                        return False
+                elif not isinstance(n, (ast.Constant, ast.Attribute, ast.BinOp,
+                                        ast.UnaryOp, ast.Compare, ast.Load,
+                                        *safe_ops)):
+                    return False
+            return True
+
+        # Names read within an iteration so far (the test is evaluated first)
+        read = {n.id for n in ast.walk(node.test) if isinstance(n, ast.Name)}
+
+        hoisted, body = [], []
+        for stmt in node.body:
+            if isinstance(stmt, ast.Assign) and \
+               len(stmt.targets) == 1 and \
+               isinstance(stmt.targets[0], ast.Name):
+                name = stmt.targets[0].id
+                if store_count.get(name, 0) == 1 and name not in defined and \
+                   name not in read and is_pure(stmt.value):
+                    hoisted.append(stmt)
+                    # Later statements may depend on the hoisted variable
+                    modified.discard(name)
+                    continue
+
+            body.append(stmt)
+            read |= {n.id for n in ast.walk(stmt) if isinstance(n, ast.Name)}
+
+        if not hoisted or not body:
+            return []
+
+        node.body = body
+        return hoisted
+
     def visit_While(self, node: ast.While):
+        hoisted = [self.visit(n) for n in self.hoist_invariants(node)]
+        modified, _ = self.modified_vars(node)
+
         (node, state, _, hints, is_scalar) = self.rewrite_and_track(node)
         if is_scalar:
             return node
 
+        # Variables that the loop only reads don't need to be loop-carried.
+        # The generated functions access them as implicit inputs, which
+        # shrinks the state traversed at every loop callback. Compressed
+        # evaluated loops shrink their state, hence they must carry it all.
+        compress = hints.get("compress", None)
+        if compress is None or (isinstance(compress, ast.Constant) and \
+                                compress.value is False):
+            include = set(hints.get("include", ()))
+            reduced = [k for k in state if k in modified or k in include]
+            if reduced:
+                state = reduced
+
         # 1. Names of generated functions
         loop_name = "_loop"
         cond_name = loop_name + "_cond"
@@ -604,6 +731,7 @@ class _SyntaxVisitor(ast.NodeTransformer):
 
         return [
             comment_start,
+            *hoisted,
             cond_func,
             body_func,
             comment_mid,
@@ -731,6 +859,25 @@ def syntax(
     number information so that debugging works and exeptions/error messages are
     tied to the right locations in the corresponding *untransformed* function.
 
+    The transformation also moves simple loop-invariant assignments (e.g.,
+    ``scale = a * b + 1`` where neither ``a`` nor ``b`` change within the
+    loop) in front of the generated :py:func:`drjit.while_loop` call. This
+    avoids recomputing them in each iteration of an evaluated loop and keeps
+    them out of symbolic loop bodies. Only assignments to variables that are
+    first defined within the loop, and whose right hand side consists of
+    variable reads and basic arithmetic (no function calls or divisions),
+    are moved.
+
+    Variables that a loop only reads (i.e., that are never assigned, have
+    their attributes or items assigned, or are passed to a function call)
+    are not made part of the loop state. The generated functions instead
+    access them as implicit inputs, which reduces the amount of state that
+    :py:func:`drjit.while_loop` must traverse and track. This does not apply
+    to loops that specify the ``compress`` hint, since loop state compression
+    must also shrink read-only variables. When enabling compression globally
+    via :py:attr:`drjit.JitFlag.CompressLoops`, you may need to add such
+    variables to the loop state using the ``include`` hint.
+
     Note that this decorator can only be used when the code to be transformed
     is part of a function. It cannot be applied to top-level statements on the
     Python REPL, or in a Jupyter notebook cell (unless that cell defines a
@@ -891,8 +1038,11 @@ def hint(
     arg: T,
     /,
     *,
-    mode: Literal["scalar", "evaluated", "symbolic", None] = None,
+    mode: Literal["scalar", "evaluated", "symbolic", "auto", None] = None,
     max_iterations: Optional[int] = None,
+    unroll: Optional[int] = None,
+    checkpoint: Optional[int] = None,
+    ad_mode: Literal["fwd_fused", None] = None,
     label: Optional[str] = None,
     include: Optional[List[object]] = None,
     exclude: Optional[List[object]] = None,
@@ -951,6 +1101,9 @@ def hint(
          :py:attr:`drjit.JitFlag.SymbolicLoops`, :py:func:`drjit.if_stmt`, and
          :py:attr:`drjit.JitFlag.SymbolicConditionals` for details.
 
+       - ``mode='auto'`` is only supported by :py:func:`drjit.if_stmt`. It
+         inspects the condition at runtime and picks a strategy per call.
+
     2. The optional ``strict=False`` reduces the strictness of variable
        consistency checks.
 
@@ -1000,6 +1153,13 @@ def hint(
        hint. Otherwise, reverse-mode differentiation of loops will fail with an
        error message.
 
+       Relatedly, ``unroll`` specifies how many copies of the loop body a
+       symbolic loop should record per iteration, and ``checkpoint``
+       specifies a checkpoint interval for reverse-mode differentiation of
+       symbolic loops. ``ad_mode="fwd_fused"`` computes forward-mode
+       derivatives along with the loop. See the documentation of
+       :py:func:`drjit.while_loop` for details.
+
     4. ``label`` provovides a descriptive label.
 
        Dr.Jit will include this label as a comment in the generated
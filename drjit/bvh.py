@@ -0,0 +1,440 @@
+import drjit as dr
+from typing import Callable, TypeVar, Literal, Tuple, Optional
+
+ArrayNfT  = TypeVar("ArrayNfT", bound=dr.AnyArray)
+FloatT    = TypeVar("FloatT", bound=dr.AnyArray)
+UInt32T   = TypeVar("UInt32T", bound=dr.AnyArray)
+BoolT     = TypeVar("BoolT", bound=dr.AnyArray)
+StateT    = TypeVar("StateT")
+
+
+def _spread_bits(v: UInt32T, dim: int) -> UInt32T:
+    """
+    Insert ``dim - 1`` zero bits between consecutive bits of the low
+    ``32 // dim`` bits of ``v``. This is an implementation detail of
+    ``morton_encode()`` defined below.
+    """
+    if dim == 2:
+        v &= 0x0000FFFF
+        v = (v | (v << 8)) & 0x00FF00FF
+        v = (v | (v << 4)) & 0x0F0F0F0F
+        v = (v | (v << 2)) & 0x33333333
+        v = (v | (v << 1)) & 0x55555555
+    elif dim == 3:
+        v &= 0x000003FF
+        v = (v * 0x00010001) & 0xFF0000FF
+        v = (v * 0x00000101) & 0x0F00F00F
+        v = (v * 0x00000011) & 0xC30C30C3
+        v = (v * 0x00000005) & 0x49249249
+    else:
+        raise RuntimeError("drjit.bvh: only 2D and 3D points are supported.")
+    return v
+
+
+def morton_encode(p: ArrayNfT, bbox_min: ArrayNfT, bbox_max: ArrayNfT) -> dr.AnyArray:
+    """
+    Compute 32-bit Morton (Z-order curve) codes of 2D or 3D points.
+
+    The points are first quantized to a regular grid with ``2**16`` (2D) or
+    ``2**10`` (3D) cells per axis that covers the box (``bbox_min``,
+    ``bbox_max``). Following the convention of ``morton_encode()`` in
+    ``include/drjit/morton.h``, the bits of the ``i``-th coordinate are placed
+    at positions ``i``, ``i + dim``, ``i + 2*dim``, etc.
+
+    Args:
+        p (ArrayNfT): The points to be encoded.
+
+        bbox_min (ArrayNfT): The minimum of the quantization bounds.
+
+        bbox_max (ArrayNfT): The maximum of the quantization bounds.
+
+    Returns:
+        UInt32T: The Morton codes of the input points.
+    """
+    ArrayNf = type(p)
+    UInt32 = dr.uint32_array_t(dr.value_t(ArrayNf))
+    dim = len(p)
+    res = 1 << (32 // dim)
+
+    extent = dr.maximum(bbox_max - bbox_min, 1e-20)
+    q = dr.clip((p - bbox_min) * (res / extent), 0, res - 1)
+
+    code = UInt32(0)
+    for i in range(dim):
+        code |= _spread_bits(UInt32(q[i]), dim) << i
+    return code
+
+
+class BVH:
+    r"""
+    Linear bounding volume hierarchy (LBVH) over a set of 2D or 3D points.
+
+    The constructor builds the hierarchy entirely on the device following the
+    parallel construction of `Tero Karras, "Maximizing Parallelism in the
+    Construction of BVHs, Octrees, and k-d Trees", HPG 2012
+    <https://research.nvidia.com/publication/2012-06_maximizing-parallelism-construction-bvhs-octrees-and-k-d-trees>`__:
+
+    1. The points are mapped to Morton codes (:py:func:`morton_encode`) and
+       sorted using :py:func:`drjit.argsort`.
+
+    2. Every one of the ``n - 1`` internal nodes determines the range of
+       sorted points it covers and the split position within it by two binary
+       searches over the common prefix lengths of neighboring codes. All
+       nodes are processed by a single kernel.
+
+    3. Bounding boxes are propagated from the leaves to the root. Every pass
+       finalizes the nodes whose children are done, hence the number of
+       passes equals the height of the tree.
+
+    Internal nodes have indices ``0`` to ``n - 2`` (the root is node ``0``),
+    and leaves have indices ``n - 1`` to ``2*n - 2``. The leaf with index
+    ``n - 1 + k`` references the point ``perm[k]``.
+
+    All arrays are evaluated at the end of the construction, which means that
+    the query functions :py:func:`nearest` and :py:func:`radius_query` can be
+    called within symbolic loops, conditionals, and calls.
+
+    Args:
+        points (ArrayNfT): The input points (e.g., of type
+          :py:class:`drjit.cuda.Array3f`).
+    """
+
+    def __init__(self, points: ArrayNfT):
+        ArrayNf = type(points)
+        Float = dr.value_t(ArrayNf)
+        UInt32 = dr.uint32_array_t(Float)
+        Int32 = dr.int32_array_t(Float)
+        Bool = dr.mask_t(Float)
+
+        if not dr.is_jit_v(ArrayNf) or dr.depth_v(ArrayNf) != 2 or \
+           len(points) not in (2, 3):
+            raise TypeError("drjit.bvh.BVH(): 'points' must be a Jit-compiled "
+                            "2D or 3D array type (e.g., Array3f).")
+
+        n = dr.width(points)
+        if n == 0:
+            raise RuntimeError("drjit.bvh.BVH(): 'points' must not be empty.")
+
+        # 1. Sort the points along the Morton curve
+        bbox_min = ArrayNf([dr.min(v) for v in points])
+        bbox_max = ArrayNf([dr.max(v) for v in points])
+        codes = morton_encode(points, bbox_min, bbox_max)
+        perm = dr.argsort(codes)
+        codes = dr.gather(UInt32, codes, perm)
+        dr.eval(codes, perm)
+
+        n_inner = n - 1
+        left = right = UInt32()
+        bbox_min = bbox_max = dr.gather(ArrayNf, points, perm)
+        depth = 0
+
+        if n_inner > 0:
+            # 2. Hierarchy construction
+            i = dr.arange(Int32, n_inner)
+            key_i = dr.gather(UInt32, codes, UInt32(i))
+
+            def delta(j: Int32) -> Int32:
+                # Length of the common prefix of the keys 'i' and 'j' (or -1
+                # when 'j' is out of bounds). Duplicate keys are disambiguated
+                # by their index.
+                valid = (j >= 0) & (j < n)
+                ju = UInt32(dr.select(valid, j, 0))
+                x = key_i ^ dr.gather(UInt32, codes, ju, valid)
+                d = dr.select(x == 0, 32 + dr.lzcnt(UInt32(i) ^ ju), dr.lzcnt(x))
+                return dr.select(valid, Int32(d), -1)
+
+            steps = []
+            t = 1
+            while t < n:
+                steps.append(t)
+                t *= 2
+            steps.reverse()
+
+            # Direction of the range covered by node 'i'
+            d = dr.select(delta(i + 1) > delta(i - 1), Int32(1), Int32(-1))
+            delta_min = delta(i - d)
+
+            # Range length (greedy descent over powers of two)
+            length = Int32(0)
+            for t in steps:
+                length = dr.select(delta(i + (length + t) * d) > delta_min,
+                                   length + t, length)
+            j = i + length * d
+            delta_node = delta(j)
+
+            # Split position
+            split = Int32(0)
+            for t in steps:
+                split = dr.select(delta(i + (split + t) * d) > delta_node,
+                                  split + t, split)
+            gamma = i + split * d + dr.minimum(d, 0)
+
+            # Children that coincide with the range bounds are leaves
+            left = UInt32(dr.select(dr.minimum(i, j) == gamma,
+                                    gamma + n_inner, gamma))
+            right = UInt32(dr.select(dr.maximum(i, j) == gamma + 1,
+                                     gamma + 1 + n_inner, gamma + 1))
+            dr.eval(left, right)
+
+            # 3. Bottom-up bounding box propagation
+            nodes = dr.arange(UInt32, n_inner)
+            leaves = dr.arange(UInt32, n) + n_inner
+            sorted_points = bbox_min
+            bbox_min = dr.zeros(ArrayNf, n_inner + n)
+            bbox_max = dr.zeros(ArrayNf, n_inner + n)
+            dr.scatter(bbox_min, sorted_points, leaves)
+            dr.scatter(bbox_max, sorted_points, leaves)
+            done = dr.zeros(Bool, n_inner)
+
+            def is_done(c: UInt32) -> Bool:
+                return (c >= n_inner) | dr.gather(Bool, done, c, c < n_inner)
+
+            while True:
+                ready = ~done & is_done(left) & is_done(right)
+                box_min = dr.minimum(dr.gather(ArrayNf, bbox_min, left, ready),
+                                     dr.gather(ArrayNf, bbox_min, right, ready))
+                box_max = dr.maximum(dr.gather(ArrayNf, bbox_max, left, ready),
+                                     dr.gather(ArrayNf, bbox_max, right, ready))
+                dr.eval(ready, box_min, box_max)
+
+                dr.scatter(bbox_min, box_min, nodes, ready)
+                dr.scatter(bbox_max, box_max, nodes, ready)
+                done = done | ready
+                dr.eval(bbox_min, bbox_max, done)
+                depth += 1
+
+                if dr.all(done):
+                    break
+
+        self.points = points
+        self.perm = perm
+        self.left = left
+        self.right = right
+        self.bbox_min = bbox_min
+        self.bbox_max = bbox_max
+        self.size = n
+        self.depth = depth
+
+        dr.make_opaque(self.points, self.perm, self.left, self.right,
+                       self.bbox_min, self.bbox_max)
+
+    def __repr__(self) -> str:
+        return f"BVH(size={self.size}, depth={self.depth})"
+
+    def _box_dist2(self, node: UInt32T, p: ArrayNfT, active: BoolT) -> FloatT:
+        """Squared distance from ``p`` to the bounding box of ``node``"""
+        ArrayNf = type(self.points)
+        b_min = dr.gather(ArrayNf, self.bbox_min, node, active)
+        b_max = dr.gather(ArrayNf, self.bbox_max, node, active)
+        return dr.squared_norm(dr.maximum(dr.maximum(b_min - p, p - b_max), 0))
+
+
+def nearest(
+    bvh: BVH,
+    p: ArrayNfT,
+    max_dist: object = None,
+    active: object = None,
+    mode: Literal["scalar", "symbolic", "evaluated", None] = None,
+) -> Tuple[UInt32T, FloatT]:
+    """
+    Find the nearest neighbor of every query point.
+
+    The traversal visits the children of each node in the order of their
+    distance from the query and skips subtrees whose bounding box lies
+    farther than the closest point found so far. Pending subtrees are kept in
+    a per-thread stack (:py:func:`drjit.alloc_local`) sized by the height of
+    the hierarchy.
+
+    Args:
+        bvh (BVH): The hierarchy to be queried.
+
+        p (ArrayNfT): The query points.
+
+        max_dist (FloatT | None): Optional upper bound on the distance of the
+          returned neighbor.
+
+        active (BoolT | None): An optional mask to disable queries.
+
+        mode: (str | None): Forwarded to the ``mode`` parameter of
+          :py:func:`drjit.while_loop`.
+
+    Returns:
+        tuple[UInt32T, FloatT]: The index of the nearest point (or
+        ``0xFFFFFFFF`` when no point within ``max_dist`` exists) and its
+        distance.
+    """
+    ArrayNf = type(bvh.points)
+    Float = dr.value_t(ArrayNf)
+    UInt32 = dr.uint32_array_t(Float)
+    Bool = dr.mask_t(Float)
+
+    n_inner = bvh.size - 1
+    if active is None:
+        active = Bool(True)
+    best_d2 = Float(dr.inf) if max_dist is None else Float(max_dist) ** 2
+    stack = dr.alloc_local(UInt32, bvh.depth + 1)
+
+    def body_fn(active, node, sp, best_d2, best_idx, stack):
+        # Leaves: compare against the stored point
+        is_leaf = node >= n_inner
+        leaf = active & is_leaf
+        pid = dr.gather(UInt32, bvh.perm, node - n_inner, leaf)
+        d2 = dr.squared_norm(dr.gather(ArrayNf, bvh.points, pid, leaf) - p)
+        closer = leaf & (d2 < best_d2)
+        best_d2 = dr.select(closer, d2, best_d2)
+        best_idx = dr.select(closer, pid, best_idx)
+
+        # Internal nodes: descend into the nearer child; defer the other one
+        inner = active & ~is_leaf
+        c0 = dr.gather(UInt32, bvh.left, node, inner)
+        c1 = dr.gather(UInt32, bvh.right, node, inner)
+        d0 = bvh._box_dist2(c0, p, inner)
+        d1 = bvh._box_dist2(c1, p, inner)
+        swap = d1 < d0
+        near, far = dr.select(swap, c1, c0), dr.select(swap, c0, c1)
+        visit_near = inner & (dr.minimum(d0, d1) < best_d2)
+        visit_far = inner & (dr.maximum(d0, d1) < best_d2)
+
+        stack.write(far, sp, visit_far)
+        sp = dr.select(visit_far, sp + 1, sp)
+        node = dr.select(visit_near, near, node)
+
+        # Otherwise, continue with the most recently deferred subtree
+        pop = active & ~visit_near
+        has_next = pop & (sp > 0)
+        sp = dr.select(has_next, sp - 1, sp)
+        node = dr.select(has_next, stack.read(sp, has_next), node)
+        active &= ~pop | has_next
+
+        return active, node, sp, best_d2, best_idx, stack
+
+    result = dr.while_loop(
+        state=(Bool(active), UInt32(0), UInt32(0), best_d2,
+               UInt32(0xFFFFFFFF), stack),
+        body=body_fn,
+        cond=lambda *args: args[0],
+        mode=mode,
+        labels=("active", "node", "sp", "best_d2", "best_idx", "stack")
+    )
+
+    return result[4], dr.sqrt(result[3])
+
+
+def radius_query(
+    bvh: BVH,
+    p: ArrayNfT,
+    radius: object,
+    func: Callable[[StateT, UInt32T, FloatT, BoolT], Tuple[StateT, BoolT]],
+    state: StateT,
+    active: object = None,
+    mode: Literal["scalar", "symbolic", "evaluated", None] = None,
+) -> StateT:
+    r"""
+    Enumerate the points within a given distance of every query point.
+
+    The function traverses the hierarchy and invokes a callback for every
+    point ``i`` with ``|points[i] - p| <= radius``, in no particular order.
+    The following snippet counts the neighbors of each query.
+
+    .. code-block:: python
+
+       from drjit.cuda import Array3f, UInt32, Bool
+       from drjit.bvh import BVH, radius_query
+
+       bvh = BVH(points)
+
+       def count_fn(count: UInt32, index: UInt32, dist2: Float,
+                    active: Bool) -> tuple[UInt32, Bool]:
+           return dr.select(active, count + 1, count), Bool(True)
+
+       counts = radius_query(bvh, queries, 0.1, count_fn, UInt32(0))
+
+    Args:
+        bvh (BVH): The hierarchy to be queried.
+
+        p (ArrayNfT): The query points.
+
+        radius (FloatT): The search radius.
+
+        func (Callable[[StateT, UInt32T, FloatT, BoolT], tuple[StateT, BoolT]]):
+          a callback that will be invoked with the following four positional
+          arguments:
+
+          1. ``arg0: StateT``: An arbitrary state value.
+
+          2. ``arg1: UInt32T``: The index of the point.
+
+          3. ``arg2: FloatT``: The squared distance between the point and
+             the query.
+
+          4. ``arg3: BoolT``: A boolean array specifying which elements are
+             active. The callback must not modify the state of other
+             elements.
+
+          The callback should then return a tuple of type ``tuple[StateT,
+          BoolT]`` containing an updated state value and a boolean array that
+          can be used to stop the query prematurely for some or all elements
+          (by returning ``False``).
+
+        state (StateT): an arbitrary *initial* state that will be passed
+          to the callback.
+
+        active (BoolT | None): An optional mask to disable queries.
+
+        mode: (str | None): Forwarded to the ``mode`` parameter of
+          :py:func:`drjit.while_loop`.
+
+    Returns:
+        StateT: The final state value of the callback upon termination.
+    """
+    ArrayNf = type(bvh.points)
+    Float = dr.value_t(ArrayNf)
+    UInt32 = dr.uint32_array_t(Float)
+    Bool = dr.mask_t(Float)
+
+    n_inner = bvh.size - 1
+    if active is None:
+        active = Bool(True)
+    r2 = Float(radius) ** 2
+    stack = dr.alloc_local(UInt32, bvh.depth + 1)
+
+    # The root may already be out of reach
+    active = Bool(active) & (bvh._box_dist2(UInt32(0), p, Bool(active)) <= r2)
+
+    def body_fn(active, state, node, sp, stack):
+        is_leaf = node >= n_inner
+
+        # Leaves: invoke the callback for points within the radius
+        leaf = active & is_leaf
+        pid = dr.gather(UInt32, bvh.perm, node - n_inner, leaf)
+        d2 = dr.squared_norm(dr.gather(ArrayNf, bvh.points, pid, leaf) - p)
+        state, cont = func(state, pid, d2, leaf & (d2 <= r2))
+
+        # Internal nodes: visit all children that overlap the query
+        inner = active & ~is_leaf
+        c0 = dr.gather(UInt32, bvh.left, node, inner)
+        c1 = dr.gather(UInt32, bvh.right, node, inner)
+        visit_0 = inner & (bvh._box_dist2(c0, p, inner) <= r2)
+        visit_1 = inner & (bvh._box_dist2(c1, p, inner) <= r2)
+
+        push = visit_0 & visit_1
+        stack.write(c1, sp, push)
+        sp = dr.select(push, sp + 1, sp)
+        node = dr.select(visit_0, c0, dr.select(visit_1, c1, node))
+
+        # Otherwise, continue with the most recently deferred subtree
+        pop = active & ~(visit_0 | visit_1)
+        has_next = pop & (sp > 0)
+        sp = dr.select(has_next, sp - 1, sp)
+        node = dr.select(has_next, stack.read(sp, has_next), node)
+        active &= (~pop | has_next) & (~leaf | cont)
+
+        return active, state, node, sp, stack
+
+    return dr.while_loop(
+        state=(active, state, UInt32(0), UInt32(0), stack),
+        body=body_fn,
+        cond=lambda *args: args[0],
+        mode=mode,
+        labels=("active", "state", "node", "sp", "stack")
+    )[1]
@@ -21,7 +21,9 @@ def dda(
     state: StateT,
     active: BoolT,
     mode: Literal["scalar", "symbolic", "evaluated", None] = None,
-    max_iterations: Optional[int] = None
+    max_iterations: Optional[int] = None,
+    occupancy: Optional[dr.AnyArray] = None,
+    batch: int = 1
 ) -> StateT:
     r"""
     N-dimensional digital differential analyzer (DDA).
@@ -126,6 +128,26 @@ def dda(
           for reverse-mode differentiation. Forwarded to the ``max_iterations``
           parameter of :py:func:`drjit.while_loop`.
 
+        occupancy (TensorXuT | None): An optional coarse occupancy grid to
+          skip over empty space. Each entry of this integer tensor covers a
+          block of ``ceil(grid_res / occupancy.shape)`` cells (a *macro cell*)
+          and specifies whether any of them is occupied (nonzero) or not
+          (zero). The shape uses the same ZYX convention as ``grid_res``. When
+          the ray enters an empty macro cell, the traversal jumps to its exit
+          point in a single step without invoking ``func`` for the enclosed
+          cells. A typical source is :py:func:`SparseTexture3f.occupancy()
+          <drjit.auto.SparseTexture3f.occupancy>` or a downsampled version of
+          the volume.
+
+        batch (int): The number of cell visits (or macro cell jumps) performed
+          per iteration of the underlying loop. Values greater than ``1``
+          amortize the overheads of the loop in the generated kernel at the
+          cost of a larger loop body. In this case, ``func`` may also be
+          invoked after an element has finished its traversal, and it must
+          then leave the state of elements whose ``active`` argument is
+          ``False`` unchanged. The :py:func:`integrate` callbacks satisfy
+          this requirement.
+
     Returns:
         StateT: The function returns the final state value of the callback upon
         termination.
@@ -209,7 +231,10 @@ def dda(
     dt_v = dr.select(ray_d >= 0, dr.fma(-p0, rcp_d, rcp_d), -p0 * rcp_d)
     dt_v[inf_t] = dr.inf
 
-    def body_fn(
+    if batch < 1:
+        raise RuntimeError("dda(): 'batch' must be positive.")
+
+    def step(
         active: BoolT, state: StateT, dt_v: ArrayNfT, p0: ArrayNfT, pi: ArrayNiT, t_rem: Any,
     ) -> Tuple[BoolT, StateT, ArrayNfT, ArrayNfT, ArrayNiT, Any]:
         # Select the smallest step. It's possible that dt == 0 when starting
@@ -234,6 +259,87 @@ def dda(
 
         return active, state, dt_v, p1, pi, t_rem
 
+    skip = None
+    if occupancy is not None:
+        occ_shape = occupancy.shape
+        if len(occ_shape) != len(ray_o):
+            raise RuntimeError("dda(): 'occupancy' must have the same number "
+                               "of dimensions as the grid.")
+        occ_data = occupancy.array
+        UInt32 = type(occ_data)
+        occ_res = ArrayNi(reversed(occ_shape))
+        macro_size = (ArrayNi(grid_res) + occ_res - 1) // occ_res
+        macro_size_f = ArrayNf(macro_size)
+
+        def skip(
+            active: BoolT, dt_v: ArrayNfT, p0: ArrayNfT, pi: ArrayNiT, t_rem: Any,
+        ) -> Tuple[BoolT, BoolT, ArrayNfT, ArrayNfT, ArrayNiT, Any]:
+            # Look up the macro cell containing the current cell (ZYX order)
+            macro = pi // macro_size
+            flat = UInt32(macro[-1])
+            for i in range(1, len(occ_shape)):
+                flat = dr.fma(flat, occ_shape[i], UInt32(macro[-1 - i]))
+            empty = active & (dr.gather(UInt32, occ_data, flat, active) == 0)
+
+            # Distance to the exit of the macro cell
+            lo = ArrayNf(macro) * macro_size_f
+            hi = lo + macro_size_f
+            x = ArrayNf(pi) + p0
+            dt_v2 = dr.select(ray_d >= 0, (hi - x) * rcp_d, (lo - x) * rcp_d)
+            dt_v2[inf_t] = dr.inf
+            dt = dr.minimum(dr.min(dt_v2), t_rem)
+            mask = dt_v2 == dt
+
+            # Cell and fractional position after the jump
+            x = dr.fma(ray_d, dt, x)
+            macro_lo = macro * macro_size
+            pi2 = dr.clip(ArrayNi(dr.floor(x)), macro_lo, macro_lo + macro_size - 1)
+            pi2[mask] = dr.select(ray_d >= 0, ArrayNi(hi), ArrayNi(lo) - 1)
+            p1 = x - ArrayNf(pi2)
+            p1[mask] = dr.select(ray_d >= 0, Float(0), Float(1))
+            dt_v2 = dr.select(ray_d >= 0, dr.fma(-p1, rcp_d, rcp_d), -p1 * rcp_d)
+            dt_v2[inf_t] = dr.inf
+            t_rem2 = t_rem - dt
+
+            active_2 = dr.all((pi2 >= 0) & (pi2 < ArrayNi(grid_res))) & (t_rem2 > 0)
+
+            return (
+                empty,
+                dr.select(empty, active_2, active),
+                dr.select(empty, dt_v2, dt_v),
+                dr.select(empty, p1, p0),
+                dr.select(empty, pi2, pi),
+                dr.select(empty, t_rem2, t_rem)
+            )
+
+    is_jit = dr.is_jit_v(Float)
+
+    def body_fn(
+        active: BoolT, state: StateT, dt_v: ArrayNfT, p0: ArrayNfT, pi: ArrayNiT, t_rem: Any,
+    ) -> Tuple[BoolT, StateT, ArrayNfT, ArrayNfT, ArrayNiT, Any]:
+        for k in range(batch):
+            # Elements that are done can stop early in scalar mode
+            if k > 0 and not is_jit and not active:
+                break
+
+            if skip is None:
+                active, state, dt_v, p0, pi, t_rem = \
+                    step(active, state, dt_v, p0, pi, t_rem)
+                continue
+
+            # Jump over an empty macro cell, or visit the current cell
+            jumped, active, dt_v, p0, pi, t_rem = skip(active, dt_v, p0, pi, t_rem)
+            active_2, state, dt_v_2, p0_2, pi_2, t_rem_2 = \
+                step(dr.select(jumped, Bool(False), active), state, dt_v, p0, pi, t_rem)
+
+            active = dr.select(jumped, active, active_2)
+            dt_v = dr.select(jumped, dt_v, dt_v_2)
+            p0 = dr.select(jumped, p0, p0_2)
+            pi = dr.select(jumped, pi, pi_2)
+            t_rem = dr.select(jumped, t_rem, t_rem_2)
+
+        return active, state, dt_v, p0, pi, t_rem
+
     return dr.while_loop(
         state=(active, state, dt_v, p0, pi, t_max),
         body=body_fn,
@@ -244,6 +350,50 @@ def dda(
     )[1]
 
 
+def skip_empty(
+    func: Callable[[StateT, ArrayNuT, ArrayNfT, ArrayNfT, BoolT], Tuple[StateT, BoolT]],
+    occupancy: dr.AnyArray
+) -> Callable[[StateT, ArrayNuT, ArrayNfT, ArrayNfT, BoolT], Tuple[StateT, BoolT]]:
+    r"""
+    Wrap a :py:func:`dda` callback so that it is inactive in empty cells.
+
+    The ``occupancy`` tensor specifies a nonzero value for every occupied cell
+    of the grid traversed by the DDA, using the same ZYX convention as
+    ``vol.shape`` in :py:func:`integrate`. A typical source is
+    :py:func:`SparseTexture3f.occupancy() <drjit.auto.SparseTexture3f.occupancy>`,
+    in which case the DDA traverses the brick grid and the callback only
+    performs work in non-empty bricks.
+
+    Args:
+        func (Callable): The callback to be wrapped (see :py:func:`dda`).
+
+        occupancy (TensorXuT): The occupancy tensor.
+
+    Returns:
+        Callable: A callback that invokes ``func`` with an ``active`` mask that
+        excludes empty cells.
+
+    .. note::
+
+       The wrapped callback is still invoked for every traversed cell. To jump
+       over empty regions without visiting their cells, pass a (coarser)
+       occupancy grid via the ``occupancy`` parameter of :py:func:`dda`.
+    """
+
+    shape = occupancy.shape
+    data = occupancy.array
+
+    def wrapper(state, index, p_a, p_b, active):
+        UInt32 = type(data)
+        flat = UInt32(index[0])
+        for i in range(1, len(shape)):
+            flat = dr.fma(flat, shape[i], UInt32(index[i]))
+        occupied = dr.gather(UInt32, data, flat, active) != 0
+        return func(state, index, p_a, p_b, active & occupied)
+
+    return wrapper
+
+
 def _int_cell_2d(
     state: Tuple[FloatT, ArrayNuT, FloatT],
     index: ArrayNuT,
@@ -340,6 +490,8 @@ def integrate(
     vol: dr.AnyArray,
     active: object = None,
     mode: Literal["scalar", "symbolic", "evaluated", None] = None,
+    occupancy: Optional[dr.AnyArray] = None,
+    batch: int = 1,
 ) -> FloatT:
     """
     Compute an analytic definite integral of a bi- or trilinear interpolant.
@@ -356,6 +508,11 @@ def integrate(
 
     The operation provides an efficient forward and backward derivative.
 
+    The ``occupancy`` and ``batch`` parameters are forwarded to
+    :py:func:`dda`. Since the grid has ``vol.shape - 1`` cells, a macro cell
+    may only be marked as empty if all grid values at its corners and within
+    it are zero.
+
     .. note::
 
        Just like the Dr.Jit texture interface, the implementation uses the
@@ -420,6 +577,8 @@ def integrate(
         active=active,
         state=state,
         mode=mode,
+        occupancy=occupancy,
+        batch=batch,
         # This loop admits a simple reverse-mode derivative since it only adds
         # up values without having complex differentiable interdependences.
         max_iterations=-1
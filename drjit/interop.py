@@ -91,6 +91,10 @@ def from_drjit(value, target, enable_grad = False, /):
 
     value_tp = []
 
+    # Evaluate all Dr.Jit arrays at once, which avoids a separate kernel
+    # launch and synchronization for each converted leaf
+    dr.eval(value)
+
     def fn(h, /):
         tp = type(h)
         value_tp.append(tp)
@@ -252,9 +256,9 @@ def _flatten(a, flat, desc, /):
         for v in a.values():
             _flatten(v, flat, desc)
     else:
-        desc = getattr(tp, 'DRJIT_STRUCT', None)
-        if type(desc) is dict:
-            for k in desc:
+        fields = getattr(tp, 'DRJIT_STRUCT', None)
+        if type(fields) is dict:
+            for k in fields:
                 _flatten(getattr(a, k), flat, desc)
         else:
             flat.append(a)
@@ -270,10 +274,10 @@ def _unflatten(flat, desc, /):
         keys = desc.pop()
         return { k : _unflatten(flat, desc) for k in keys }
     else:
-        desc = getattr(tp, 'DRJIT_STRUCT', None)
-        if type(desc) is dict:
+        fields = getattr(tp, 'DRJIT_STRUCT', None)
+        if type(fields) is dict:
             result = tp()
-            for k in desc:
+            for k in fields:
                 setattr(result, k, _unflatten(flat, desc))
             return result
         else:
@@ -304,8 +308,19 @@ class WrapADOp(dr.CustomOp):
         self.target = target
         self.func = func
 
-        # Evaluate the function using another array programming framework
-        self.out = func(*self.args, **self.kwargs)
+        # Evaluate the function using another array programming framework.
+        # For JAX, linearize it at the same time when derivatives may be
+        # requested so that backward() doesn't need to evaluate it again.
+        self.vjp_fun = None
+        if target == 'jax' and dr.grad_enabled(args, kwargs):
+            import jax
+
+            def wrapper(args, kwargs):
+                return func(*args, **kwargs)
+
+            self.out, self.vjp_fun = jax.vjp(wrapper, self.args, self.kwargs)
+        else:
+            self.out = func(*self.args, **self.kwargs)
 
         # Convert the out PyTree to Dr.Jit
         return to_drjit(self.out, target)
@@ -354,12 +369,14 @@ class WrapADOp(dr.CustomOp):
             grad_args = pytorch_grad(self.args)
             grad_kwargs = pytorch_grad(self.kwargs)
         elif target == 'jax':
-            import jax
+            vjp_fun = self.vjp_fun
+            if vjp_fun is None:
+                import jax
 
-            def wrapper(args, kwargs):
-                return self.func(*args, **kwargs)
+                def wrapper(args, kwargs):
+                    return self.func(*args, **kwargs)
 
-            primals, vjp_fun = jax.vjp(wrapper, self.args, self.kwargs)
+                _, vjp_fun = jax.vjp(wrapper, self.args, self.kwargs)
             grad_args, grad_kwargs = vjp_fun(grad_out)
         else:
             raise RuntimeError('WrapADOp.backward(): unsupported framework!')
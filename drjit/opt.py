@@ -0,0 +1,384 @@
+import drjit as dr
+from typing import Any, Dict, Iterator, Optional, Tuple, Mapping
+
+
+def _float_t(tp: type) -> type:
+    """
+    Return the detached 1D floating point array type underlying the parameter
+    type ``tp``. Optimizers use it to create opaque scalars (learning rates,
+    bias corrections) whose values can change without triggering a
+    recompilation of the update kernel.
+    """
+    if dr.is_tensor_v(tp):
+        tp = dr.array_t(tp)
+    while dr.depth_v(tp) > 1:
+        tp = dr.value_t(tp)
+    return dr.detached_t(tp)
+
+
+class Optimizer:
+    """
+    Base class of optimizers that update a set of differentiable parameters.
+
+    An optimizer stores parameters in a dictionary-like interface. Assigning a
+    Dr.Jit array or tensor to a key makes a detached copy and enables gradient
+    tracking on it. Following a call to :py:func:`drjit.backward()`, the method
+    :py:meth:`step()` computes the updates of *all* parameters along with their
+    internal state (e.g., moment estimates), and then evaluates everything
+    at once. Parameters of the same size are thereby updated by a single fused
+    kernel, and the number of kernel launches does not grow with the number
+    of parameters.
+
+    The gradients are consumed by the update: :py:meth:`step()` clears them
+    (see :py:func:`drjit.clear_grad()`) so that their memory can be released as
+    soon as the update kernel has run. Retrieve the new parameter values via
+    ``opt[key]`` before recording the next iteration.
+
+    .. code-block:: python
+
+       import drjit.opt
+
+       opt = dr.opt.Adam(lr=1e-2)
+       opt['x'] = Float(1, 2, 3)
+
+       for i in range(100):
+           loss = dr.sum(dr.square(opt['x'] - target))
+           dr.backward(loss)
+           opt.step()
+    """
+
+    def __init__(self, lr: float, params: Optional[Mapping[str, Any]] = None):
+        if lr < 0:
+            raise RuntimeError("drjit.opt.Optimizer(): 'lr' must be >= 0!")
+        self.lr = lr
+        self.params: Dict[str, Any] = {}
+        self.state: Dict[str, Any] = {}
+
+        if params is not None:
+            for key, value in params.items():
+                self[key] = value
+
+    def __setitem__(self, key: str, value: Any) -> None:
+        tp = type(value)
+        if not dr.is_jit_v(tp) or not dr.is_float_v(tp) or not dr.is_diff_v(tp):
+            raise TypeError(
+                "drjit.opt.Optimizer.__setitem__(): parameters must be "
+                "differentiable floating point Dr.Jit arrays or tensors "
+                f"(got '{tp.__name__}')!")
+
+        value = dr.detach(value)
+        dr.enable_grad(value)
+
+        prev = self.params.get(key)
+        if prev is None or type(prev) is not tp or dr.shape(prev) != dr.shape(value):
+            self.state.pop(key, None)
+
+        self.params[key] = value
+
+    def __getitem__(self, key: str) -> Any:
+        return self.params[key]
+
+    def __delitem__(self, key: str) -> None:
+        del self.params[key]
+        self.state.pop(key, None)
+
+    def __contains__(self, key: str) -> bool:
+        return key in self.params
+
+    def __len__(self) -> int:
+        return len(self.params)
+
+    def __iter__(self) -> Iterator[str]:
+        return iter(self.params)
+
+    def keys(self):
+        return self.params.keys()
+
+    def items(self):
+        return self.params.items()
+
+    def reset(self, key: Optional[str] = None) -> None:
+        """
+        Discard the internal state (e.g., moment estimates) of the parameter
+        ``key``, or of all parameters when no key is specified.
+        """
+        if key is None:
+            self.state.clear()
+        else:
+            self.state.pop(key, None)
+
+    def step(self) -> None:
+        """
+        Update all parameters using their current gradients and evaluate the
+        new parameter values and optimizer state using a single call to
+        :py:func:`drjit.eval()`.
+        """
+        updated = []
+
+        for key, p in self.params.items():
+            g = dr.grad(p)
+            dr.clear_grad(p)
+
+            tp = type(p)
+            p = dr.detach(p)
+            if dr.is_tensor_v(tp):
+                shape = p.shape
+                p_new, state = self._update(key, p.array, g.array,
+                                            self.state.get(key))
+                p_new = tp(p_new, shape)
+            else:
+                p_new, state = self._update(key, p, g, self.state.get(key))
+
+            self.state[key] = state
+            updated.append((key, p_new))
+
+        dr.schedule(updated, self.state)
+        dr.eval()
+
+        for key, p_new in updated:
+            dr.enable_grad(p_new)
+            self.params[key] = p_new
+
+    def _update(self, key: str, p: Any, g: Any, state: Any) -> Tuple[Any, Any]:
+        """
+        Compute the (unevaluated) update of the parameter ``key`` with value
+        ``p`` and gradient ``g`` given the current ``state`` (or ``None``).
+        Returns the new parameter value and state.
+        """
+        raise NotImplementedError("drjit.opt.Optimizer._update(): "
+                                  "must be implemented by subclasses!")
+
+    def __repr__(self) -> str:
+        return (f"{type(self).__name__}[lr={self.lr}, "
+                f"params={list(self.params.keys())}]")
+
+
+class SGD(Optimizer):
+    """
+    Stochastic gradient descent optimizer with optional (Nesterov) momentum.
+
+    Without momentum, the update of a parameter :math:`p` with gradient
+    :math:`g` is :math:`p \\leftarrow p - \\eta\\, g`. Otherwise, the optimizer
+    maintains a velocity :math:`v \\leftarrow \\mu\\, v + g` per parameter and
+    updates :math:`p \\leftarrow p - \\eta\\, v` (or :math:`p \\leftarrow p -
+    \\eta\\, (g + \\mu\\, v)` with Nesterov momentum).
+
+    Args:
+        lr (float): The learning rate :math:`\\eta`.
+
+        momentum (float): The momentum factor :math:`\\mu`. The default of
+          ``0`` disables momentum.
+
+        nesterov (bool): Use Nesterov momentum?
+
+        params (Mapping[str, object] | None): Optional initial parameters.
+    """
+
+    def __init__(self, lr: float, momentum: float = 0.0,
+                 nesterov: bool = False,
+                 params: Optional[Mapping[str, Any]] = None):
+        if momentum < 0:
+            raise RuntimeError("drjit.opt.SGD(): 'momentum' must be >= 0!")
+        if nesterov and momentum == 0:
+            raise RuntimeError("drjit.opt.SGD(): Nesterov momentum requires "
+                               "a nonzero 'momentum' value!")
+        self.momentum = momentum
+        self.nesterov = nesterov
+        super().__init__(lr, params)
+
+    def _update(self, key, p, g, state):
+        lr = dr.opaque(_float_t(type(p)), self.lr)
+
+        if self.momentum == 0:
+            return dr.fma(g, -lr, p), None
+
+        v = g if state is None else dr.fma(state, self.momentum, g)
+        step = dr.fma(v, self.momentum, g) if self.nesterov else v
+        return dr.fma(step, -lr, p), v
+
+
+class Adam(Optimizer):
+    """
+    Adam optimizer (Kingma and Ba, 2014).
+
+    The optimizer maintains exponential moving averages of the gradient
+    :math:`g` and of its square, and updates each parameter as follows:
+
+    .. math::
+
+       m &\\leftarrow \\beta_1\\, m + (1 - \\beta_1)\\, g\\\\
+       v &\\leftarrow \\beta_2\\, v + (1 - \\beta_2)\\, g^2\\\\
+       p &\\leftarrow p - \\eta\\, \\frac{\\sqrt{1 - \\beta_2^t}}{1 - \\beta_1^t}
+            \\frac{m}{\\sqrt{v} + \\varepsilon}
+
+    The bias correction factor depending on the step count :math:`t` is passed
+    to the update kernel as an opaque value, which means that all iterations
+    reuse the same compiled kernel.
+
+    Args:
+        lr (float): The learning rate :math:`\\eta`.
+
+        beta_1 (float): Decay rate of the first moment estimate.
+
+        beta_2 (float): Decay rate of the second moment estimate.
+
+        epsilon (float): Small constant that avoids a division by zero.
+
+        params (Mapping[str, object] | None): Optional initial parameters.
+    """
+
+    def __init__(self, lr: float, beta_1: float = 0.9, beta_2: float = 0.999,
+                 epsilon: float = 1e-8,
+                 params: Optional[Mapping[str, Any]] = None):
+        if not 0 <= beta_1 < 1 or not 0 <= beta_2 < 1:
+            raise RuntimeError("drjit.opt.Adam(): 'beta_1' and 'beta_2' must "
+                               "be in the interval [0, 1)!")
+        self.beta_1 = beta_1
+        self.beta_2 = beta_2
+        self.epsilon = epsilon
+        super().__init__(lr, params)
+
+    def _update(self, key, p, g, state):
+        if state is None:
+            t, m, v = 0, dr.zeros(type(p), dr.shape(p)), dr.zeros(type(p), dr.shape(p))
+        else:
+            t, m, v = state
+
+        t += 1
+        b1, b2 = self.beta_1, self.beta_2
+        lr_t = dr.opaque(_float_t(type(p)),
+                         self.lr * (1 - b2 ** t) ** 0.5 / (1 - b1 ** t))
+
+        m = dr.fma(m, b1, g * (1 - b1))
+        v = dr.fma(v, b2, dr.square(g) * (1 - b2))
+        p = p - lr_t * m / (dr.sqrt(v) + self.epsilon)
+        return p, (t, m, v)
+
+
+class ParameterPack:
+    """
+    Contiguous storage for many small differentiable parameters.
+
+    Optimizing thousands of small parameters (material scalars, transforms,
+    etc.) as separate AD leaves produces as many gradient arrays, and all
+    code that consumes them (e.g., an optimizer step) launches a kernel per
+    parameter size. A parameter pack instead stores all parameters within a
+    single flat array :py:attr:`data`. The method :py:meth:`unpack()` returns
+    differentiable views that gather their entries from this buffer, hence
+    their gradients all accumulate into the gradient of :py:attr:`data`.
+
+    .. code-block:: python
+
+       pack = dr.opt.ParameterPack({'albedo': Array3f(.5), 'roughness': Float(.1)})
+       opt = dr.opt.Adam(lr=1e-2)
+       opt['scene'] = pack.data
+
+       for i in range(100):
+           p = pack.unpack(opt['scene'])
+           loss = render_loss(p['albedo'], p['roughness'])
+           dr.backward(loss)
+           opt.step()
+
+    Parameters must be differentiable JIT-compiled floating point arrays or
+    tensors that share the same backend and precision. Nested arrays like
+    ``Array3f`` are stored using :py:func:`drjit.ravel()`.
+
+    Args:
+        params (Mapping[str, object]): The parameters to be packed.
+    """
+
+    __slots__ = ("data", "_layout", "_size")
+
+    def __init__(self, params: Mapping[str, Any]):
+        Float: Optional[type] = None
+        layout: Dict[str, Tuple[type, int, int, Optional[Tuple[int, ...]]]] = {}
+        flat = []
+        offset = 0
+
+        for key, value in params.items():
+            tp = type(value)
+            if not dr.is_jit_v(tp) or not dr.is_float_v(tp) or not dr.is_diff_v(tp):
+                raise TypeError(
+                    "drjit.opt.ParameterPack(): parameters must be "
+                    "differentiable floating point Dr.Jit arrays or tensors "
+                    f"(got '{tp.__name__}' for parameter '{key}')!")
+
+            value = dr.detach(value)
+            if dr.is_tensor_v(tp):
+                shape, value = value.shape, value.array
+            else:
+                shape, value = None, dr.ravel(value)
+
+            if Float is None:
+                Float = type(value)
+            elif type(value) is not Float:
+                raise TypeError(
+                    "drjit.opt.ParameterPack(): all parameters must have the "
+                    f"same backend and precision (parameter '{key}' is "
+                    f"stored as '{type(value).__name__}' instead of "
+                    f"'{Float.__name__}')!")
+
+            size = dr.width(value)
+            layout[key] = (tp, offset, size, shape)
+            flat.append((value, offset))
+            offset += size
+
+        if Float is None or offset == 0:
+            raise RuntimeError("drjit.opt.ParameterPack(): 'params' must "
+                               "contain at least one non-empty parameter!")
+
+        UInt32 = dr.uint32_array_t(Float)
+        data = dr.empty(Float, offset)
+        for value, start in flat:
+            dr.scatter(data, value, dr.arange(UInt32, start, start + dr.width(value)))
+        dr.eval(data)
+        dr.enable_grad(data)
+
+        self.data = data
+        self._layout = layout
+        self._size = offset
+
+    def unpack(self, data: Optional[Any] = None) -> Dict[str, Any]:
+        """
+        Return a dictionary with differentiable views of all parameters.
+
+        The views are gathered from ``data`` (or from :py:attr:`data` if not
+        specified), which must be a flat array with the same layout, e.g.,
+        the updated version of :py:attr:`data` returned by an optimizer.
+        """
+        if data is None:
+            data = self.data
+        elif dr.width(data) != len(self):
+            raise RuntimeError(
+                "drjit.opt.ParameterPack.unpack(): 'data' has an incompatible "
+                f"size ({dr.width(data)} vs {len(self)})!")
+
+        return {key: self._view(data, key) for key in self._layout}
+
+    def __getitem__(self, key: str) -> Any:
+        return self._view(self.data, key)
+
+    def _view(self, data: Any, key: str) -> Any:
+        tp, offset, size, shape = self._layout[key]
+        Float = type(data)
+        UInt32 = dr.uint32_array_t(Float)
+        value = dr.gather(Float, data, dr.arange(UInt32, offset, offset + size))
+        if shape is not None:
+            return tp(value, shape)
+        elif dr.depth_v(tp) > 1:
+            return dr.unravel(tp, value)
+        return value
+
+    def __contains__(self, key: str) -> bool:
+        return key in self._layout
+
+    def __len__(self) -> int:
+        """Return the total number of scalar entries of the pack"""
+        return self._size
+
+    def keys(self):
+        return self._layout.keys()
+
+    def __repr__(self) -> str:
+        return (f"ParameterPack[size={len(self)}, "
+                f"params={list(self._layout.keys())}]")
@@ -877,6 +877,70 @@ template <typename Value_, bool IsMask_, typename Derived_> struct ArrayBaseT {
             scatter_reduce(target, source.entry(i), fmadd(index, (uint32_t) N, (uint32_t) i), mask, op, mode);
     }
 
+    template <typename Mask>
+    size_t compress_store_(void *ptr, const Mask &mask) const {
+        DRJIT_CHKSCALAR("compress_store_");
+
+        size_t size = derived().size(), count = 0;
+        if constexpr (Derived::Size == Dynamic) {
+            if (mask.size() != size)
+                drjit_fail("compress_store_() : incompatible input sizes "
+                           "(%zu and %zu)", size, mask.size());
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            if (mask.entry(i))
+                ((Value *) ptr)[count++] = derived().entry(i);
+        }
+
+        return count;
+    }
+
+    template <typename Mask>
+    static Derived expand_load_(const void *ptr, const Mask &mask) {
+        DRJIT_CHKSCALAR("expand_load_");
+
+        size_t size = mask.size(), count = 0;
+        Derived result = drjit::zeros<Derived>(size);
+
+        for (size_t i = 0; i < size; ++i) {
+            if (mask.entry(i))
+                result.entry(i) = ((const Value *) ptr)[count++];
+        }
+
+        return result;
+    }
+
+    Derived fmaddsub_(const Derived &b, const Derived &c) const {
+        DRJIT_CHKSCALAR("fmaddsub_");
+
+        size_t size = derived().size();
+        Derived result = drjit::zeros<Derived>(size);
+
+        for (size_t i = 0; i < size; ++i) {
+            const Value &ci = c.entry(i);
+            result.entry(i) =
+                fmadd(derived().entry(i), b.entry(i), (i & 1) ? ci : -ci);
+        }
+
+        return result;
+    }
+
+    Derived complex_mul_(const Derived &b) const {
+        DRJIT_CHKSCALAR("complex_mul_");
+
+        size_t size = derived().size();
+        Derived result = drjit::zeros<Derived>(size);
+
+        for (size_t i = 0; i + 1 < size; i += 2) {
+            const Value &ar = derived().entry(i), &ai = derived().entry(i + 1),
+                        &br = b.entry(i), &bi = b.entry(i + 1);
+            result.entry(i)     = fmsub(ar, br, ai * bi);
+            result.entry(i + 1) = fmadd(ar, bi, ai * br);
+        }
+
+        return result;
+    }
 
     Derived block_reduce_(ReduceOp op, size_t block_size, int symbolic) const {
         Derived value;
@@ -44,17 +44,45 @@ namespace detail {
     template <typename Type, size_t Size>
     using vectorize_t = vectorize<Type, Size * sizeof(Type)>;
 
+    /// Analogous to 'vectorize' for half precision packets (indexed by size)
+    template <typename Type, size_t Size, typename = int> struct vectorize_half {
+        using Parent = vectorize_half<Type, detail::lpow2(Size)>;
+        static constexpr bool recurse = Parent::recurse || Parent::self;
+        static constexpr bool self = false;
+    };
+
+    template <typename Type> struct vectorize_half<Type, 1> {
+        static constexpr bool recurse = false;
+        static constexpr bool self = false;
+    };
+
+    template <typename Type> struct vectorize_half<Type, 0> {
+        static constexpr bool recurse = false;
+        static constexpr bool self = false;
+    };
+
+    template <typename Type, size_t Size>
+    constexpr bool vectorizable_half_v =
+        std::is_same_v<Type, half> && vectorize_half<Type, Size>::self;
+
+    template <typename Type, size_t Size>
+    constexpr bool recursive_half_v = std::is_same_v<Type, half> && Size >= 8 &&
+                                      vectorize_half<Type, Size>::recurse;
+
     template <typename Type, size_t Size>
     using enable_if_generic =
         enable_if_t<Size != 0 &&
                     !(vectorizable_type_v<Type> &&
                       (vectorize_t<Type, Size>::self ||
-                       (Size >= 4 && vectorize_t<Type, Size>::recurse)))>;
+                       (Size >= 4 && vectorize_t<Type, Size>::recurse))) &&
+                    !vectorizable_half_v<Type, Size> &&
+                    !recursive_half_v<Type, Size>>;
 
     template <typename Type, size_t Size>
     using enable_if_recursive =
-        enable_if_t<vectorizable_type_v<Type> && (Size >= 4) &&
-                    vectorize_t<Type, Size>::recurse>;
+        enable_if_t<(vectorizable_type_v<Type> && (Size >= 4) &&
+                     vectorize_t<Type, Size>::recurse) ||
+                    recursive_half_v<Type, Size>>;
 };
 
 /**
@@ -973,6 +973,118 @@ template <typename T> DRJIT_INLINE void store(void *ptr, const T &value) {
         *static_cast<T *>(ptr) = value;
 }
 
+NAMESPACE_BEGIN(detail)
+
+/// Largest record (in words) that is accessed using a single packet operation
+static constexpr size_t MaxRecordPacket = 16;
+
+/// Visit the flat JIT arrays of a record (DRJIT_STRUCT, static array) in order
+template <typename T, typename Func> void record_traverse(T &value, Func &&func) {
+    if constexpr (is_drjit_struct_v<T>) {
+        traverse_1(fields(value), [&func](auto &x) { record_traverse(x, func); });
+    } else if constexpr (depth_v<T> > 1) {
+        static_assert(size_v<T> != Dynamic,
+                      "Records cannot contain dynamically sized arrays!");
+        for (size_t i = 0; i < size_v<T>; ++i)
+            record_traverse(value.entry(i), func);
+    } else {
+        static_assert(is_jit_v<T> && depth_v<T> == 1,
+                      "Records may only contain JIT arrays!");
+        func(value);
+    }
+}
+
+/// Gather 'n' consecutive words per record, using a packet gather if possible
+template <size_t N, typename Source, typename Index, typename Mask>
+void gather_record_words(size_t n, const Source &source, const Index &index,
+                         const Mask &mask, ReduceMode mode, Source *out) {
+    if constexpr (N <= MaxRecordPacket) {
+        if (n != N)
+            return gather_record_words<N + 1>(n, source, index, mask, mode, out);
+        Array<Source, N> tmp =
+            Source::template gather_packet_<N>(source, index, mask, mode);
+        for (size_t i = 0; i < N; ++i)
+            out[i] = std::move(tmp.entry(i));
+    } else {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = Source::template gather_<>(
+                source, index * uint32_t(n) + uint32_t(i), mask, mode);
+    }
+}
+
+/// Scatter 'n' consecutive words per record, using a packet scatter if possible
+template <size_t N, typename Target, typename Index, typename Mask>
+void scatter_record_words(size_t n, Target &target, const Target *in,
+                          const Index &index, const Mask &mask, ReduceMode mode) {
+    if constexpr (N <= MaxRecordPacket) {
+        if (n != N)
+            return scatter_record_words<N + 1>(n, target, in, index, mask, mode);
+        Array<Target, N> tmp;
+        for (size_t i = 0; i < N; ++i)
+            tmp.entry(i) = in[i];
+        Target::template scatter_packet_<N>(target, tmp, index, mask, mode);
+    } else {
+        for (size_t i = 0; i < n; ++i)
+            in[i].scatter_(target, index * uint32_t(n) + uint32_t(i), mask, mode);
+    }
+}
+
+/**
+ * \brief Gather an array-of-structures record from a flat buffer
+ *
+ * The fields of ``Target`` (a DRJIT_STRUCT that may contain further structures
+ * and static arrays) are stored as consecutive words of ``source``, whose
+ * scalar type must have the same size as the scalar type of every field.
+ * Records of up to \ref MaxRecordPacket words are fetched with a single
+ * packet gather, after which words are reinterpreted as the field types.
+ */
+template <typename Target, typename Source, typename Index, typename Mask>
+Target gather_record(const Source &source, const Index &index,
+                     const Mask &mask, ReduceMode mode) {
+    Target result;
+    size_t n = 0;
+    record_traverse(result, [&n](auto &) { n++; });
+
+    vector<Source> words(n);
+    if (n == 1)
+        words[0] = Source::template gather_<>(source, index, mask, mode);
+    else
+        gather_record_words<2>(n, source, index, mask, mode, words.data());
+
+    size_t i = 0;
+    record_traverse(result, [&words, &i](auto &x) {
+        using T = std::decay_t<decltype(x)>;
+        static_assert(sizeof(scalar_t<T>) == sizeof(scalar_t<Source>),
+                      "gather(): record fields must match the word size of "
+                      "the source array!");
+        x = reinterpret_array<T>(words[i++]);
+    });
+
+    return result;
+}
+
+/// Scatter an array-of-structures record into a flat buffer (see \ref gather_record())
+template <typename Target, typename Value, typename Index, typename Mask>
+void scatter_record(Target &target, const Value &value, const Index &index,
+                    const Mask &mask, ReduceMode mode) {
+    vector<Target> words;
+    record_traverse(const_cast<Value &>(value), [&words](auto &x) {
+        using T = std::decay_t<decltype(x)>;
+        static_assert(sizeof(scalar_t<T>) == sizeof(scalar_t<Target>),
+                      "scatter(): record fields must match the word size of "
+                      "the target array!");
+        words.push_back(reinterpret_array<Target>(x));
+    });
+
+    size_t n = words.size();
+    if (n == 1)
+        words[0].scatter_(target, index, mask, mode);
+    else
+        scatter_record_words<2>(n, target, words.data(), index, mask, mode);
+}
+
+NAMESPACE_END(detail)
+
 template <typename Target, typename Source, typename Index, typename Mask = mask_t<Index>>
 Target gather(Source &&source, const Index &index, const Mask &mask_ = true,
               ReduceMode mode = ReduceMode::Auto) {
@@ -1035,8 +1147,14 @@ Target gather(Source &&source, const Index &index, const Mask &mask_ = true,
             // Case 2.2: gather<Vector3fC>(const FloatC & / const void *, ...)
             return value_t<Target>::template gather_packet_<Target::Size>(source, index, mask, mode);
         }
+    } else if constexpr (is_drjit_struct_v<Target> && is_jit_v<Source> &&
+                         depth_v<Source> == 1) {
+        /// Case 3.0: gather<MyStruct>(const UInt32C &, ...) (array of structures)
+        return detail::gather_record<Target>(
+            source, uint32_array_t<std::decay_t<Source>>(index),
+            mask_t<std::decay_t<Source>>(mask), mode);
     } else if constexpr (is_drjit_struct_v<Target>) {
-        /// Case 3: gather<MyStruct>(const MyStruct &, ...)
+        /// Case 3.1: gather<MyStruct>(const MyStruct &, ...)
         static_assert(is_drjit_struct_v<Source>,
                       "Source must also be a custom data structure!");
         Target result;
@@ -1061,6 +1179,60 @@ Target gather(Source &&source, const Index &index, const Mask &mask_ = true,
     (void) mode;
 }
 
+/**
+ * \brief Prefetch the memory that <tt>gather<Target>(source, index, mask)</tt>
+ * would access
+ *
+ * This function issues one software prefetch per active lane. It can be used
+ * to pipeline random-access lookups into large tables (e.g., BVH nodes or hash
+ * grids) by requesting the data of the next iteration ahead of time.
+ * ``Level`` specifies the targeted cache level (1-3), and ``Write`` indicates
+ * that the memory will subsequently be written.
+ *
+ * The operation is a no-op for JIT-compiled arrays, whose kernels are
+ * generated and scheduled by the Dr.Jit compiler.
+ */
+template <typename Target, bool Write = false, int Level = 2, typename Source,
+          typename Index, typename Mask = mask_t<Index>>
+void prefetch(const Source &source, const Index &index, const Mask &mask_ = true) {
+    if constexpr (is_jit_v<Source> || is_jit_v<Index>) {
+        DRJIT_MARK_USED(source);
+        DRJIT_MARK_USED(index);
+        DRJIT_MARK_USED(mask_);
+    } else if constexpr (depth_v<Source> > 1) {
+        // Case 1: prefetch<Vector3fP>(const Vector3fX&, ...)
+        using Index2 = plain_t<replace_scalar_t<Target, scalar_t<Index>>>;
+        Index2 index2(index);
+        mask_t<Index2> mask2(mask_);
+        for (size_t i = 0; i < source.size(); ++i)
+            prefetch<value_t<Target>, Write, Level>(
+                source.entry(i), index2.entry(i), mask2.entry(i));
+    } else {
+        // Case 2: prefetch<FloatP>(const float * / const FloatX&, ...)
+        const uint8_t *ptr;
+        if constexpr (is_array_v<Source>)
+            ptr = (const uint8_t *) source.data();
+        else
+            ptr = (const uint8_t *) source;
+
+        // Size of a record (gathers of nested arrays access an array of structures)
+        constexpr size_t Stride = sizeof(scalar_t<Target>) *
+            ((depth_v<Target> > depth_v<Index>) ? size_v<Target> : 1);
+
+        if constexpr (is_array_v<Index>) {
+            mask_t<plain_t<Index>> mask = mask_;
+            for (size_t i = 0; i < index.size(); ++i) {
+                if (mask.entry(i))
+                    detail::prefetch_<Write, Level>(
+                        ptr + Stride * (size_t) index.entry(i));
+            }
+        } else {
+            if (mask_)
+                detail::prefetch_<Write, Level>(ptr + Stride * (size_t) index);
+        }
+    }
+}
+
 template <typename Target, typename Value, typename Index, typename Mask = mask_t<Index>>
 void scatter(Target &target, const Value &value, const Index &index,
              const Mask &mask_ = true, ReduceMode mode = ReduceMode::Auto) {
@@ -1096,6 +1268,11 @@ void scatter(Target &target, const Value &value, const Index &index,
             Target::template scatter_packet_<Value::Size>(
                 target, value, uint32_array_t<Target>(index), mask, mode);
         }
+    } else if constexpr (is_drjit_struct_v<Value> && is_jit_v<Target> &&
+                         depth_v<Target> == 1) {
+        // Array of structures: scatter(UInt32C&, const MyStruct &...)
+        detail::scatter_record(target, value, uint32_array_t<Target>(index),
+                               mask_t<Target>(mask), mode);
     } else if constexpr (is_drjit_struct_v<Value>) {
         static_assert(is_drjit_struct_v<Target>,
                       "Target must also be a custom data structure!");
@@ -1119,6 +1296,47 @@ void scatter(Target &target, const Value &value, const Index &index,
     }
 }
 
+/**
+ * \brief Store the active entries of \c value consecutively at \c ptr
+ *
+ * Returns the number of written entries. This is the building block of stream
+ * compaction loops over packet types (e.g., to retain the active lanes of a
+ * <tt>Packet&lt;float, 16&gt;</tt>).
+ */
+template <typename Array, typename Mask>
+size_t compress_store(void *ptr, const Array &value, const Mask &mask) {
+    static_assert(is_array_v<Array> && depth_v<Array> == 1 && !is_jit_v<Array>,
+                  "compress_store(): requires a flat CPU array!");
+    return value.compress_store_(ptr, mask_t<Array>(mask));
+}
+
+/**
+ * \brief Inverse of \ref compress_store(): fill the active entries of the
+ * result with consecutive values read from \c ptr
+ *
+ * Inactive entries are set to zero.
+ */
+template <typename Array, typename Mask>
+Array expand_load(const void *ptr, const Mask &mask) {
+    static_assert(is_array_v<Array> && depth_v<Array> == 1 && !is_jit_v<Array>,
+                  "expand_load(): requires a flat CPU array!");
+    return Array::expand_load_(ptr, mask_t<Array>(mask));
+}
+
+/**
+ * \brief Fused multiply-add with alternating sign: computes <tt>a*b - c</tt>
+ * in even and <tt>a*b + c</tt> in odd entries
+ *
+ * This maps onto the \c fmaddsub/addsub instructions on x86 and is a building
+ * block of complex arithmetic on interleaved (real, imaginary) layouts.
+ */
+template <typename Array>
+Array fmaddsub(const Array &a, const Array &b, const Array &c) {
+    static_assert(is_array_v<Array> && depth_v<Array> == 1 && !is_jit_v<Array>,
+                  "fmaddsub(): requires a flat CPU array!");
+    return a.derived().fmaddsub_(b.derived(), c.derived());
+}
+
 template <typename Index>
 Index scatter_inc(Index &target, const Index &index, const mask_t<Index> &value = true) {
     static_assert(is_jit_v<Index> && std::is_same_v<scalar_t<Index>, uint32_t> && depth_v<Index> == 1);
@@ -1300,9 +1518,15 @@ template <typename Array> Array reverse(const Array &value) {
 //! @{ \name Forward declarations of math functions
 // -----------------------------------------------------------------------
 
-template <typename T, bool = true> T sin(const T &a);
-template <typename T, bool = true> T cos(const T &a);
-template <typename T, bool = true> std::pair<T, T> sincos(const T &a);
+/* The second template parameter of these functions ('Native') enables the
+   array-specific implementation where available (e.g. a JIT intrinsic). The
+   third parameter of 'sin', 'cos', 'sincos', 'exp', 'exp2', 'log', and 'log2'
+   ('Fast') selects lower-degree single precision approximations with a
+   maximum relative error of about 1e-5 (see drjit/math.h). */
+
+template <typename T, bool = true, bool = false> T sin(const T &a);
+template <typename T, bool = true, bool = false> T cos(const T &a);
+template <typename T, bool = true, bool = false> std::pair<T, T> sincos(const T &a);
 template <typename T, bool = true> T csc(const T &a);
 template <typename T, bool = true> T sec(const T &a);
 template <typename T, bool = true> T tan(const T &a);
@@ -1314,10 +1538,10 @@ template <typename T1, typename T2, bool = true> expr_t<T1, T2> atan2(const T1 &
 
 template <typename T, bool = true> std::pair<T, T> frexp(const T &a);
 template <typename T1, typename T2, bool = true> expr_t<T1, T2> ldexp(const T1 &a, const T2 &b);
-template <typename T, bool = true> T exp(const T &a);
-template <typename T, bool = true> T exp2(const T &a);
-template <typename T, bool = true> T log(const T &a);
-template <typename T, bool = true> T log2(const T &a);
+template <typename T, bool = true, bool = false> T exp(const T &a);
+template <typename T, bool = true, bool = false> T exp2(const T &a);
+template <typename T, bool = true, bool = false> T log(const T &a);
+template <typename T, bool = true, bool = false> T log2(const T &a);
 template <typename T1, typename T2> expr_t<T1, T2> pow(const T1 &a, const T2 &b);
 
 template <typename T, bool = true> T sinh(const T &a);
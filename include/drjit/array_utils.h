@@ -232,6 +232,20 @@ template <typename T> DRJIT_INLINE T popcnt_(T v) {
 #endif
 }
 
+/// Issue a software prefetch of the cache line containing 'ptr'
+template <bool Write, int Level> DRJIT_INLINE void prefetch_(const void *ptr) {
+    static_assert(Level >= 1 && Level <= 3,
+                  "prefetch(): 'Level' must equal 1, 2, or 3!");
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch((const char *) ptr, Level == 1 ? _MM_HINT_T0 :
+                                    (Level == 2 ? _MM_HINT_T1 : _MM_HINT_T2));
+#elif defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr, Write ? 1 : 0, 4 - Level);
+#else
+    (void) ptr;
+#endif
+}
+
 template <typename T> DRJIT_INLINE T lzcnt_(T v) {
 #if defined(_MSC_VER)
     unsigned long result;
@@ -53,6 +53,22 @@ enum class ADFlag : uint32_t {
     /// Don't fail when the input to a ``dr::forward`` or ``backward`` operation
     /// is not a differentiable array.
     AllowNoGrad = 8,
+
+    /// Process edges in topological levels and merge the gradient
+    /// contributions to each variable using a balanced sum in a fixed order.
+    LevelSchedule = 16,
+
+    /// Cache the edge ordering of this traversal and reuse it when a graph
+    /// with the same structure is traversed again.
+    CachePlan = 32,
+
+    /// Keep the gradients that gathers propagate into input variables in a
+    /// sparse (offset, value) form until they are needed.
+    SparseGrad = 64,
+
+    /// Skip reverse-mode edges whose gradients only reach variables that
+    /// can no longer be read.
+    PruneDead = 128
 };
 
 constexpr uint32_t operator |(ADFlag f1, ADFlag f2)   { return (uint32_t) f1 | (uint32_t) f2; }
@@ -1037,8 +1053,7 @@ struct index64_vector : drjit::vector<uint64_t> {
     ~index64_vector() { release(); }
 
     void release() {
-        for (size_t i = 0; i < size(); ++i)
-            ad_var_dec_ref(operator[](i));
+        ad_var_dec_ref_n(size(), data());
         Base::clear();
     }
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <drjit/math.h>
+#include <cmath>
 
 NAMESPACE_BEGIN(drjit)
 
@@ -89,4 +90,107 @@ template <typename Value> Value srgb_to_linear(const Value &x) {
     return r * x;
 }
 
+NAMESPACE_BEGIN(detail)
+
+/// Lazily initialized table of linear values for all 8/16 bit sRGB inputs
+template <typename Scalar, size_t Bits> struct srgb_lut {
+    static constexpr size_t Size = size_t(1) << Bits;
+    Scalar data[Size];
+
+    srgb_lut() {
+        for (size_t i = 0; i < Size; ++i) {
+            double x = (double) i / (double) (Size - 1);
+            data[i] = (Scalar) (x <= 0.04045 ? x / 12.92
+                                             : std::pow((x + 0.055) / 1.055, 2.4));
+        }
+    }
+
+    static const Scalar *get() {
+        static const srgb_lut lut;
+        return lut.data;
+    }
+};
+
+/// Look up the entries 'index' (32 bit integers) of an sRGB table
+template <typename Float, size_t Bits, typename Index>
+Float srgb_lut_gather(const Index &index) {
+    using Scalar = scalar_t<Float>;
+    using Table = srgb_lut<Scalar, Bits>;
+
+    if constexpr (is_jit_v<Float>)
+        return gather<Float>(load<Float>(Table::get(), Table::Size), index);
+    else
+        return gather<Float>(Table::get(), index);
+}
+
+NAMESPACE_END(detail)
+
+/**
+ * \brief Convert quantized (8 or 16 bit unsigned integer) sRGB values to
+ * linear floating point values
+ *
+ * Quantized inputs only take 256 or 65536 distinct values, hence this
+ * function looks them up in a precomputed table instead of evaluating
+ * \ref srgb_to_linear(). On the JIT backends, the table is uploaded by every
+ * call (1 or 256 KiB in single precision).
+ */
+template <typename Float, typename Value> Float quantized_srgb_to_linear(const Value &x) {
+    using Int = scalar_t<Value>;
+    static_assert(std::is_same_v<Int, uint8_t> || std::is_same_v<Int, uint16_t>,
+                  "quantized_srgb_to_linear(): input must be an 8 or 16 bit "
+                  "unsigned integer (array)!");
+
+    return detail::srgb_lut_gather<Float, sizeof(Int) * 8>(
+        uint32_array_t<Float>(x));
+}
+
+/// Convert linear values to quantized (8 or 16 bit unsigned integer) sRGB values
+template <typename Value, typename Float> Value linear_to_quantized_srgb(const Float &x) {
+    using Int = scalar_t<Value>;
+    static_assert(std::is_same_v<Int, uint8_t> || std::is_same_v<Int, uint16_t>,
+                  "linear_to_quantized_srgb(): output must be an 8 or 16 bit "
+                  "unsigned integer (array)!");
+    using Scalar = scalar_t<Float>;
+    constexpr Scalar Max = Scalar((1 << (sizeof(Int) * 8)) - 1);
+
+    Float y = linear_to_srgb(clip(x, Scalar(0), Scalar(1)));
+    return Value(uint32_array_t<Float>(fmadd(y, Max, Scalar(.5))));
+}
+
+/**
+ * \brief Unpack RGBA8 pixels (one per 32 bit word, red in the least
+ * significant byte) into linear floating point values
+ *
+ * The color channels are converted from sRGB using a table lookup, while the
+ * alpha channel is stored linearly. Packet arrays thereby decode several
+ * pixels at once with shifts, masks, and table gathers.
+ */
+template <typename Float, typename UInt32>
+Array<Float, 4> rgba8_to_linear(const UInt32 &packed) {
+    using Scalar = scalar_t<Float>;
+    uint32_array_t<Float> p(packed);
+
+    return Array<Float, 4>(
+        detail::srgb_lut_gather<Float, 8>(p & 0xFFu),
+        detail::srgb_lut_gather<Float, 8>(sr<8>(p) & 0xFFu),
+        detail::srgb_lut_gather<Float, 8>(sr<16>(p) & 0xFFu),
+        Float(sr<24>(p)) * Scalar(1.0 / 255.0));
+}
+
+/// Pack linear floating point RGBA values into RGBA8 pixels (see \ref rgba8_to_linear())
+template <typename Float>
+uint32_array_t<Float> linear_to_rgba8(const Array<Float, 4> &value) {
+    using Scalar = scalar_t<Float>;
+    using UInt32 = uint32_array_t<Float>;
+
+    auto quantize = [](const Float &x) {
+        return UInt32(fmadd(clip(x, Scalar(0), Scalar(1)), Scalar(255), Scalar(.5)));
+    };
+
+    return quantize(linear_to_srgb(value.x())) |
+           sl<8>(quantize(linear_to_srgb(value.y()))) |
+           sl<16>(quantize(linear_to_srgb(value.z()))) |
+           sl<24>(quantize(value.w()));
+}
+
 NAMESPACE_END(drjit)
@@ -80,10 +80,15 @@ template <typename T> Complex<T> conj(const Complex<T> &z) {
 template <typename T0, typename T1>
 Complex<expr_t<T0, T1>> operator*(const Complex<T0> &z0,
                                   const Complex<T1> &z1) {
-    return {
-        fmsub(z0.x(), z1.x(), z0.y()*z1.y()),
-        fmadd(z0.x(), z1.y(), z0.y()*z1.x())
-    };
+    if constexpr (std::is_same_v<T0, T1> && Complex<T0>::IsPacked) {
+        // (re, im) pair stored in a single SIMD register
+        return z0.complex_mul_(z1);
+    } else {
+        return {
+            fmsub(z0.x(), z1.x(), z0.y()*z1.y()),
+            fmadd(z0.x(), z1.y(), z0.y()*z1.x())
+        };
+    }
 }
 
 template <typename T0, typename T1, typename T2>
@@ -276,4 +281,90 @@ Complex<T> atanh(const Complex<T> &z) {
     return log((1.f + z) / (1.f - z)) * .5f;
 }
 
+// -----------------------------------------------------------------------
+//! @{ \name Complex arithmetic on interleaved (real, imaginary) layouts
+// -----------------------------------------------------------------------
+
+/*
+   The functions below operate on flat CPU arrays (e.g. ``Packet<float, 16>``)
+   that store a sequence of complex numbers as interleaved (real, imaginary)
+   pairs, which is the natural memory layout of FFT-style workloads. They map
+   onto fmaddsub/addsub (x86) and FCMLA (ARMv8.3) instructions when available.
+*/
+
+NAMESPACE_BEGIN(detail)
+
+template <typename T, size_t... Is>
+DRJIT_INLINE T interleaved_conj_sign(std::index_sequence<Is...>) {
+    return T(scalar_t<T>((Is & 1) ? -1 : 1)...);
+}
+
+template <typename T, size_t... Is>
+DRJIT_INLINE T interleaved_swap(const T &a, std::index_sequence<Is...>) {
+    return shuffle<(Is ^ 1)...>(a);
+}
+
+/// Split into real and imaginary parts, and the inverse of this operation
+template <typename T, size_t... Is>
+DRJIT_INLINE auto deinterleave(const T &a, std::index_sequence<Is...>) {
+    constexpr size_t N = sizeof...(Is);
+    T t = shuffle<((Is < N / 2) ? 2 * Is : 2 * (Is - N / 2) + 1)...>(a);
+    return std::make_pair(low(t), high(t));
+}
+
+template <typename T, typename H, size_t... Is>
+DRJIT_INLINE T interleave(const H &re, const H &im, std::index_sequence<Is...>) {
+    constexpr size_t N = sizeof...(Is);
+    return shuffle<((Is & 1) ? (Is / 2 + N / 2) : Is / 2)...>(T(concat(re, im)));
+}
+
+template <typename T> using enable_if_interleaved_t =
+    enable_if_t<is_array_v<T> && !is_complex_v<T> && depth_v<T> == 1 &&
+                !is_jit_v<T> && T::Size != Dynamic && T::Size % 2 == 0>;
+
+NAMESPACE_END(detail)
+
+/// Product of the interleaved complex numbers stored in \c a and \c b
+template <typename T, detail::enable_if_interleaved_t<T> = 0>
+DRJIT_INLINE T complex_mul(const T &a, const T &b) {
+    return a.derived().complex_mul_(b.derived());
+}
+
+/// Complex conjugate of the interleaved complex numbers stored in \c a
+template <typename T, detail::enable_if_interleaved_t<T> = 0>
+DRJIT_INLINE T complex_conj(const T &a) {
+    return a * detail::interleaved_conj_sign<T>(std::make_index_sequence<T::Size>());
+}
+
+/// Quotient of the interleaved complex numbers stored in \c a and \c b
+template <typename T, detail::enable_if_interleaved_t<T> = 0>
+T complex_div(const T &a, const T &b) {
+    using Index = std::make_index_sequence<T::Size>;
+    T sq = b * b,
+      norm = sq + detail::interleaved_swap(sq, Index());
+    return complex_mul(a, complex_conj(b)) / norm;
+}
+
+/// Exponential of the interleaved complex numbers stored in \c a
+template <typename T, detail::enable_if_interleaved_t<T> = 0>
+T complex_exp(const T &a) {
+    using Index = std::make_index_sequence<T::Size>;
+    auto [re, im] = detail::deinterleave(a, Index());
+    auto exp_r = exp(re);
+    auto [s, c] = sincos(im);
+    return detail::interleave<T>(exp_r * c, exp_r * s, Index());
+}
+
+/// Natural logarithm of the interleaved complex numbers stored in \c a
+template <typename T, detail::enable_if_interleaved_t<T> = 0>
+T complex_log(const T &a) {
+    using Index = std::make_index_sequence<T::Size>;
+    auto [re, im] = detail::deinterleave(a, Index());
+    return detail::interleave<T>(.5f * log(fmadd(re, re, im * im)),
+                                 atan2(im, re), Index());
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
 NAMESPACE_END(drjit)
@@ -158,6 +158,34 @@ public:
     CustomOp(const Input_ &...in)
         : m_inputs(detail::ad_scan(*this, Inputs(in...), true)) { }
 
+protected:
+    /*
+     * The following accessors are intended for use within the forward() and
+     * backward() callbacks. They only read or accumulate gradients and never
+     * evaluate them. The derivative arithmetic of the callbacks is therefore
+     * recorded symbolically like that of builtin operations, and it is fused
+     * with neighboring gradient computations into the kernels launched at the
+     * end of the AD traversal.
+     */
+
+    /// Return the gradient of the 'Index'-th input argument (forward mode)
+    template <size_t Index = 0> auto grad_in() const {
+        return grad<false>(drjit::get<Index>(m_inputs));
+    }
+
+    /// Accumulate a gradient into the 'Index'-th input argument (backward mode)
+    template <size_t Index = 0, typename T> void set_grad_in(const T &value) {
+        accum_grad(drjit::get<Index>(m_inputs), value);
+    }
+
+    /// Return the gradient of the output (backward mode)
+    detached_t<Output> grad_out() const { return grad<false>(m_output); }
+
+    /// Accumulate a gradient into the output (forward mode)
+    template <typename T> void set_grad_out(const T &value) {
+        accum_grad(m_output, value);
+    }
+
 private:
     Inputs m_inputs;
     Output m_output;
@@ -174,7 +202,7 @@ typename Op::Output custom(const Inputs &...inputs) {
     // on previous computation. That dependence is reintroduced later below.
     detail::new_grad(output);
 
-    op->m_output = detail::ad_scan(op, output, false);
+    op->m_output = detail::ad_scan(*op, output, false);
 
     // Tie the operation into the AD graph, or detach if unsuccessful
     if (!ad_custom_op(op.get()))
@@ -15,9 +15,107 @@
 
 #include <drjit/array.h>
 #include <limits>
+#include <new>
 
 NAMESPACE_BEGIN(drjit)
 
+/**
+ * \brief Interface of custom allocators for the heap storage of
+ * \ref DynamicArray instances
+ *
+ * Install an allocator using \ref scoped_dynamic_allocator.
+ */
+struct DynamicAllocator {
+    virtual void *allocate(size_t size, size_t align) = 0;
+    virtual void deallocate(void *ptr, size_t size, size_t align) = 0;
+    virtual ~DynamicAllocator() = default;
+};
+
+NAMESPACE_BEGIN(detail)
+/// Allocator used by DynamicArray instances created by the current thread
+inline DynamicAllocator *&dynamic_allocator() {
+    static thread_local DynamicAllocator *value = nullptr;
+    return value;
+}
+NAMESPACE_END(detail)
+
+/**
+ * \brief Route the heap allocations of \ref DynamicArray instances created
+ * by the current thread through \c alloc while this object is alive
+ *
+ * Each array remembers the allocator that provided its storage, and the
+ * allocator must outlive it. Passing \c nullptr reverts to the global
+ * <tt>operator new</tt>.
+ */
+struct scoped_dynamic_allocator {
+    scoped_dynamic_allocator(DynamicAllocator *alloc)
+        : m_backup(detail::dynamic_allocator()) {
+        detail::dynamic_allocator() = alloc;
+    }
+
+    ~scoped_dynamic_allocator() { detail::dynamic_allocator() = m_backup; }
+
+    scoped_dynamic_allocator(const scoped_dynamic_allocator &) = delete;
+    scoped_dynamic_allocator &operator=(const scoped_dynamic_allocator &) = delete;
+
+private:
+    DynamicAllocator *m_backup;
+};
+
+/**
+ * \brief Arena allocator that carves allocations out of large chunks
+ *
+ * Deallocation is a no-op, and the chunks are only released when the arena
+ * is destroyed. This is useful for code that creates many small temporary
+ * arrays, such as scene preprocessing.
+ */
+struct DynamicArena : DynamicAllocator {
+    DynamicArena(size_t chunk_size = 65536) : m_chunk_size(chunk_size) { }
+    DynamicArena(const DynamicArena &) = delete;
+    DynamicArena &operator=(const DynamicArena &) = delete;
+
+    ~DynamicArena() { release(); }
+
+    void *allocate(size_t size, size_t align) override {
+        uintptr_t ptr = (m_pos + align - 1) & ~(uintptr_t) (align - 1);
+
+        if (!m_chunk || ptr + size > m_end) {
+            size_t chunk_size = size + align + sizeof(Chunk);
+            if (chunk_size < m_chunk_size)
+                chunk_size = m_chunk_size;
+            Chunk *chunk = (Chunk *) malloc(chunk_size);
+            if (!chunk)
+                throw std::bad_alloc();
+            chunk->next = m_chunk;
+            m_chunk = chunk;
+            m_pos = (uintptr_t) (chunk + 1);
+            m_end = (uintptr_t) chunk + chunk_size;
+            ptr = (m_pos + align - 1) & ~(uintptr_t) (align - 1);
+        }
+
+        m_pos = ptr + size;
+        return (void *) ptr;
+    }
+
+    void deallocate(void *, size_t, size_t) override { }
+
+    /// Release all chunks. Arrays allocated by the arena become invalid.
+    void release() {
+        while (m_chunk) {
+            Chunk *next = m_chunk->next;
+            free(m_chunk);
+            m_chunk = next;
+        }
+        m_pos = m_end = 0;
+    }
+
+private:
+    struct alignas(std::max_align_t) Chunk { Chunk *next; };
+    Chunk *m_chunk = nullptr;
+    uintptr_t m_pos = 0, m_end = 0;
+    size_t m_chunk_size;
+};
+
 template <typename Value_>
 struct DynamicArray
     : ArrayBaseT<Value_, is_mask_v<Value_>, DynamicArray<Value_>> {
@@ -34,6 +132,10 @@ struct DynamicArray
     static constexpr bool IsDynamic = true;
     static constexpr bool IsVector = true;
 
+    /// Number of entries that are stored inline without a heap allocation
+    static constexpr size_t InlineSize =
+        sizeof(Value) <= 16 ? 16 / sizeof(Value) : 0;
+
     using ArrayType = DynamicArray<array_t<Value>>;
     using MaskType  = DynamicArray<mask_t<Value>>;
     template <typename T> using ReplaceValue = DynamicArray<T>;
@@ -43,20 +145,13 @@ struct DynamicArray
 
     DynamicArray() = default;
 
-    DynamicArray(const DynamicArray &a) : m_size(a.m_size) {
-        if (!empty()) {
-            m_data = new Value[m_size];
-            for (size_t i = 0; i < m_size; ++i)
-                m_data[i] = a.m_data[i];
-        }
+    DynamicArray(const DynamicArray &a) {
+        init_(a.m_size);
+        for (size_t i = 0; i < m_size; ++i)
+            m_data[i] = a.m_data[i];
     }
 
-    DynamicArray(DynamicArray &&a)
-        : m_data(a.m_data), m_size(a.m_size), m_free(a.m_free) {
-        a.m_size = 0;
-        a.m_data = nullptr;
-        a.m_free = true;
-    }
+    DynamicArray(DynamicArray &&a) noexcept { steal_(a); }
 
     template <typename Value2, bool IsMask2, typename Derived2>
     DynamicArray(const ArrayBaseT<Value2, IsMask2, Derived2> &v) {
@@ -98,27 +193,22 @@ struct DynamicArray
             m_data[i] = std::move(data[i]);
     }
 
-    ~DynamicArray() {
-        if (m_free)
-            delete[] m_data;
-    }
+    ~DynamicArray() { release_(); }
 
     DynamicArray &operator=(const DynamicArray &a) {
-        Value* new_data = new Value[a.m_size];
-        for (size_t i = 0; i < a.m_size; ++i)
-            new_data[i] = a.m_data[i];
-        if (m_free)
-            delete[] m_data;
-        m_size = a.m_size;
-        m_data = new_data;
-        m_free = true;
+        if (this != &a) {
+            init_(a.m_size);
+            for (size_t i = 0; i < m_size; ++i)
+                m_data[i] = a.m_data[i];
+        }
         return *this;
     }
 
-    DynamicArray &operator=(DynamicArray &&a) {
-        std::swap(a.m_data, m_data);
-        std::swap(a.m_free, m_free);
-        std::swap(a.m_size, m_size);
+    DynamicArray &operator=(DynamicArray &&a) noexcept {
+        if (this != &a) {
+            release_();
+            steal_(a);
+        }
         return *this;
     }
 
@@ -213,15 +303,18 @@ struct DynamicArray
         if constexpr (!IsMask) {
             drjit_fail("Unsupported argument type!");
         } else {
+            size_t count = 0;
+            for (size_t i = 0; i < m_size; ++i)
+                count += m_data[i] ? 1 : 0;
+
             DynamicArray<uint32_t> result;
-            result.init_(m_size);
+            result.init_(count);
 
             size_t accum = 0;
             for (size_t i = 0; i < m_size; ++i) {
                 if (m_data[i])
                     result.m_data[accum++] = (uint32_t) i;
             }
-            result.m_size = accum;
             return result;
         }
     }
@@ -399,12 +492,25 @@ struct DynamicArray
         }
     }
 
+    /// Discard the contents and allocate storage for 'size' entries
     void init_(size_t size) {
+        release_();
         if (size == 0)
             return;
-        m_data = new Value[size];
+
+        if (size <= InlineSize) {
+            m_data = (Value *) m_inline;
+        } else {
+            m_alloc = detail::dynamic_allocator();
+            size_t bytes = size * sizeof(Value);
+            m_data = (Value *) (m_alloc
+                ? m_alloc->allocate(bytes, alignof(Value))
+                : ::operator new(bytes, std::align_val_t(alignof(Value))));
+        }
+
+        for (size_t i = 0; i < size; ++i)
+            new (m_data + i) Value;
         m_size = size;
-        m_free = true;
     }
 
     static auto counter(size_t size) {
@@ -419,9 +525,54 @@ struct DynamicArray
     Value *data() { return m_data; }
 
 protected:
+    bool is_inline_() const { return m_data == (const Value *) m_inline; }
+
+    void release_() {
+        if (!m_data)
+            return;
+
+        for (size_t i = 0; i < m_size; ++i)
+            m_data[i].~Value();
+
+        if (!is_inline_()) {
+            if (m_alloc)
+                m_alloc->deallocate(m_data, m_size * sizeof(Value), alignof(Value));
+            else
+                ::operator delete(m_data, std::align_val_t(alignof(Value)));
+        }
+
+        m_data = nullptr;
+        m_size = 0;
+        m_alloc = nullptr;
+    }
+
+    /// Take over the contents of 'a' (assumes that this array is empty)
+    void steal_(DynamicArray &a) {
+        if (a.is_inline_()) {
+            // Inline storage cannot be transferred, move the entries instead
+            m_data = (Value *) m_inline;
+            m_size = a.m_size;
+            for (size_t i = 0; i < m_size; ++i)
+                new (m_data + i) Value(std::move(a.m_data[i]));
+            a.release_();
+        } else {
+            m_data = a.m_data;
+            m_size = a.m_size;
+            m_alloc = a.m_alloc;
+            a.m_data = nullptr;
+            a.m_size = 0;
+            a.m_alloc = nullptr;
+        }
+    }
+
     Value *m_data = nullptr;
     size_t m_size = 0;
-    bool m_free = true;
+
+    /// Allocator that provided the heap storage (\c nullptr: operator new)
+    DynamicAllocator *m_alloc = nullptr;
+
+    /// Inline storage for arrays with up to \ref InlineSize entries
+    alignas(InlineSize ? alignof(Value) : 1) unsigned char m_inline[InlineSize ? InlineSize * sizeof(Value) : 1];
 };
 
 NAMESPACE_END(drjit)
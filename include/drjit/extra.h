@@ -116,6 +116,17 @@ extern DRJIT_EXTRA_EXPORT uint64_t ad_var_new(uint32_t index);
 /// Return the gradient value associated with a particular variable
 extern DRJIT_EXTRA_EXPORT uint32_t ad_grad(uint64_t index, bool null_ok = false);
 
+/**
+ * \brief Return the sparse gradient of a variable (see ``ADFlag::SparseGrad``)
+ *
+ * Appends (offset, value, mask) triples of JIT variable indices to \c out
+ * (the caller must release their references). The dense gradient equals a
+ * scatter-addition of all values at the associated offsets. Nothing is
+ * appended when the variable does not have a sparse gradient.
+ */
+extern DRJIT_EXTRA_EXPORT void ad_grad_sparse(uint64_t index,
+                                              drjit::vector<uint32_t> &out);
+
 /// Check if gradient tracking is enabled for the given variable
 extern DRJIT_EXTRA_EXPORT int ad_grad_enabled(uint64_t index);
 
@@ -131,6 +142,17 @@ extern DRJIT_EXTRA_EXPORT void ad_accum_grad(uint64_t index, uint32_t value);
 /// Clear the gradient of a given variable
 extern DRJIT_EXTRA_EXPORT void ad_clear_grad(uint64_t index);
 
+/**
+ * \brief Set the type used to store the gradient of a given variable
+ *
+ * Gradient contributions are accumulated using the wider of the primal and
+ * storage type and then converted to the storage type. The gradient is
+ * converted back to the primal type when it is propagated or queried via
+ * \ref ad_grad(). Specify ``VarType::Void`` to revert to the primal type.
+ */
+extern DRJIT_EXTRA_EXPORT void ad_var_set_grad_type(uint64_t index,
+                                                    VarType type);
+
 /// Increase the reference count of the given AD variable
 extern DRJIT_EXTRA_EXPORT uint64_t ad_var_inc_ref_impl(uint64_t) JIT_NOEXCEPT;
 
@@ -145,6 +167,29 @@ extern DRJIT_EXTRA_EXPORT uint64_t ad_var_copy_ref_impl(uint64_t) JIT_NOEXCEPT;
 /// Decrease the reference count of the given AD variable
 extern DRJIT_EXTRA_EXPORT void ad_var_dec_ref_impl(uint64_t) JIT_NOEXCEPT;
 
+/**
+ * \brief Batched variant of \ref ad_var_new()
+ *
+ * Creates AD variables for the ``n`` JIT variable indices in ``in`` and
+ * writes the resulting combined indices to ``out``. This is equivalent to
+ * calling \ref ad_var_new() on every entry but only acquires the AD lock once.
+ */
+extern DRJIT_EXTRA_EXPORT void ad_var_new_n(size_t n, const uint32_t *in,
+                                            uint64_t *out);
+
+/// Batched variant of \ref ad_var_inc_ref() operating on ``n`` indices
+extern DRJIT_EXTRA_EXPORT void ad_var_inc_ref_n(size_t n,
+                                                const uint64_t *indices) JIT_NOEXCEPT;
+
+/**
+ * \brief Batched variant of \ref ad_var_dec_ref() operating on ``n`` indices
+ *
+ * The AD lock is acquired at most once, and only if one of the variables
+ * requires it (e.g., because its reference count reaches zero).
+ */
+extern DRJIT_EXTRA_EXPORT void ad_var_dec_ref_n(size_t n,
+                                                const uint64_t *indices) JIT_NOEXCEPT;
+
 /// Perform a horizontal reduction
 extern DRJIT_EXTRA_EXPORT uint64_t ad_var_reduce(JitBackend, VarType,
                                                  JIT_ENUM ReduceOp, uint64_t);
@@ -210,6 +255,18 @@ extern DRJIT_EXTRA_EXPORT const char *ad_var_label(uint64_t index);
 /// Return a list of variables that are registered with the AD computation grpah
 extern DRJIT_EXTRA_EXPORT const char *ad_var_whos();
 
+/**
+ * \brief Report the memory held by the AD layer
+ *
+ * Invokes ``callback`` for each registered AD variable that references an
+ * evaluated gradient or evaluated edge weights (attributed to the target of
+ * the edge) along with the variable label (or an empty string).
+ */
+extern DRJIT_EXTRA_EXPORT void
+ad_var_memory(void (*callback)(void *payload, const char *label,
+                               size_t grad_bytes, size_t edge_bytes),
+              void *payload);
+
 /// Return GraphViz markup describing registered variables and their connectivity
 extern DRJIT_EXTRA_EXPORT const char *ad_var_graphviz();
 
@@ -337,6 +394,60 @@ ad_call(JitBackend backend, const char *domain, int symbolic, size_t callable_co
         void *payload, ad_call_func callback, ad_call_cleanup cleanup,
         bool ad);
 
+/**
+ * \brief Query/set whether evaluated calls reuse their bucket partition
+ *
+ * When enabled, \ref ad_call() remembers the masked instance index arrays of
+ * recent evaluated calls. Subsequent calls with the same index, mask, and
+ * mask stack reuse them, which in turn lets ``jit_var_call_reduce()`` return
+ * its previously computed buckets instead of launching another sorting
+ * kernel. Getters furthermore reuse the per-instance buffer of a previous
+ * call as long as the instances return the same literals and variables. The
+ * caches hold references to these arrays until they are disabled.
+ */
+extern DRJIT_EXTRA_EXPORT int ad_call_cache();
+extern DRJIT_EXTRA_EXPORT void ad_set_call_cache(int value);
+
+/**
+ * \brief Query/set the maximum number of callables that symbolic calls inline
+ *
+ * Symbolic calls that target at most this many callables are not compiled
+ * into an indirect call. Instead, \ref ad_call() invokes every callable on
+ * all lanes (with a mask that restricts side effects to the lanes targeting
+ * it) and merges the return values using a chain of ``select()``
+ * operations. This is beneficial when the callables are tiny, e.g., getters
+ * or constant returns. The default value of ``0`` disables this feature.
+ */
+extern DRJIT_EXTRA_EXPORT uint32_t ad_call_inline();
+extern DRJIT_EXTRA_EXPORT void ad_set_call_inline(uint32_t value);
+
+/**
+ * \brief Query/set whether symbolic calls with a literal index are inlined
+ *
+ * When all lanes of a symbolic call target the same instance (i.e., the
+ * instance index is a literal), \ref ad_call() can directly invoke that
+ * callable instead of compiling an indirect call. This typically happens
+ * when a callable itself performs a call on a member of its instance (e.g., a
+ * material evaluating its texture). The inner callable then becomes part of
+ * each outer callable, which avoids a second level of dispatch. Disabled by
+ * default.
+ */
+extern DRJIT_EXTRA_EXPORT int ad_call_flatten();
+extern DRJIT_EXTRA_EXPORT void ad_set_call_flatten(int value);
+
+/**
+ * \brief Query/set the size below which evaluated calls batch their targets
+ *
+ * An evaluated call normally launches one kernel per callable that is
+ * referenced by at least one entry. When many callables are only targeted by
+ * a handful of entries, these tiny kernels are dominated by launch overheads.
+ * If at least two targets have fewer than this many entries, \ref ad_call()
+ * gathers all of their entries and processes them using a single symbolic
+ * call. The default value of ``0`` disables this feature.
+ */
+extern DRJIT_EXTRA_EXPORT uint32_t ad_call_reduce_batch();
+extern DRJIT_EXTRA_EXPORT void ad_set_call_reduce_batch(uint32_t value);
+
 // Callbacks used by \ref ad_loop() below. See the interface for details
 typedef void (*ad_loop_read)(void *payload, drjit::vector<uint64_t> &);
 typedef void (*ad_loop_write)(void *payload, const drjit::vector<uint64_t> &, bool restart);
@@ -366,6 +477,26 @@ typedef void (*ad_loop_delete)(void *payload);
  *     operation, \c 0 to use a simpler masking-based implementation, and \c -1
  *     to select the mode automatically.
  *
+ * \param unroll
+ *     Number of copies of the loop body recorded per iteration of a symbolic
+ *     loop. Copies after the first one re-evaluate the loop condition and
+ *     mask the body accordingly. Evaluated loops ignore this parameter. Must
+ *     be at least \c 1.
+ *
+ * \param checkpoint
+ *     When nonzero, reverse-mode differentiation of a symbolic loop stores the
+ *     loop state every \c checkpoint iterations and recomputes the remaining
+ *     iterations from the nearest checkpoint. Ignored when \c inverse_cb is
+ *     specified.
+ *
+ * \param fwd_fused
+ *     When set to \c true and the inputs of a differentiable symbolic loop
+ *     already carry tangents, record a single loop that computes both the
+ *     primal state and the forward-mode derivatives. A subsequent forward
+ *     AD traversal then reuses these tangents instead of running the loop a
+ *     second time (unless the input gradients were changed in the meantime).
+ *     Evaluated loops ignore this parameter.
+ *
  * \param name
  *     A descriptive name used in debug message / GraphViz visualizations
  *
@@ -389,6 +520,13 @@ typedef void (*ad_loop_delete)(void *payload);
  * \param body_cb
  *     Callback routine that executes one iteration of the loop body.
  *
+ * \param inverse_cb
+ *     Optional callback routine that undoes one iteration of the loop body
+ *     (i.e., it maps the state following an iteration back to the state
+ *     preceding it). When specified, reverse-mode differentiation of a
+ *     symbolic loop reconstructs earlier states using this function instead
+ *     of storing them ("path replay").
+ *
  * \param delete_cb
  *     A cleanup routine that deletes storage associated with \c payload.
  *
@@ -405,12 +543,54 @@ typedef void (*ad_loop_delete)(void *payload);
  * already been destroyed.
  */
 extern DRJIT_EXTRA_EXPORT bool ad_loop(JitBackend backend, int symbolic, int compress,
-                                       long long max_iterations,
-                                       const char *name, void *payload,
-                                       ad_loop_read read_cb, ad_loop_write write_cb,
-                                       ad_loop_cond cond_cb, ad_loop_body body_cb,
+                                       long long max_iterations, int unroll,
+                                       int checkpoint, bool fwd_fused,
+                                       const char *name,
+                                       void *payload, ad_loop_read read_cb,
+                                       ad_loop_write write_cb, ad_loop_cond cond_cb,
+                                       ad_loop_body body_cb, ad_loop_body inverse_cb,
                                        ad_loop_delete delete_cb, bool ad);
 
+/**
+ * \brief Query/set the occupancy below which evaluated loops compress
+ *
+ * An evaluated loop with state compression (``compress=true``) normally
+ * gathers the remaining active entries of every loop state variable after
+ * each iteration. When this ratio is below ``1``, it only does so once the
+ * fraction of active entries drops below the ratio, and otherwise masks the
+ * finished entries like an uncompressed evaluated loop. The default value of
+ * ``1`` compresses after every iteration.
+ */
+extern DRJIT_EXTRA_EXPORT float ad_loop_compress_ratio();
+extern DRJIT_EXTRA_EXPORT void ad_set_loop_compress_ratio(float value);
+
+/**
+ * \brief Query/set the interval between termination checks of evaluated loops
+ *
+ * An evaluated loop (without state compression) checks whether any entries
+ * remain active after every iteration, which requires a device->host
+ * synchronization. With an interval of ``k > 1``, it only checks every ``k``
+ * iterations and otherwise keeps launching iterations asynchronously. Once
+ * all entries have finished, these speculative iterations are fully masked.
+ * The default value of ``1`` checks after every iteration.
+ */
+extern DRJIT_EXTRA_EXPORT uint32_t ad_loop_check_interval();
+extern DRJIT_EXTRA_EXPORT void ad_set_loop_check_interval(uint32_t value);
+
+/**
+ * \brief Query/set the number of iterations per kernel launch of evaluated loops
+ *
+ * An evaluated loop normally invokes the loop body callback and launches a
+ * kernel in every iteration. When this value exceeds ``1``, each step of the
+ * evaluated loop instead records the body once into a nested symbolic loop
+ * that performs up to this many iterations. This amortizes the cost of
+ * tracing the body, e.g., when a Python loop body runs on small arrays.
+ * Derivatives of these nested loops follow the rules of symbolic loops. The
+ * default value of ``1`` disables this feature.
+ */
+extern DRJIT_EXTRA_EXPORT uint32_t ad_loop_batch();
+extern DRJIT_EXTRA_EXPORT void ad_set_loop_batch(uint32_t value);
+
 // Callbacks used by \ref ad_cond() below. See the interface for details
 typedef void (*ad_cond_body)(void *payload, bool value,
                              const drjit::vector<uint64_t> &args_i,
@@ -482,6 +662,121 @@ extern DRJIT_EXTRA_EXPORT uint64_t ad_var_map_get(uint64_t index);
 extern DRJIT_EXTRA_EXPORT int ad_leak_warnings();
 extern DRJIT_EXTRA_EXPORT void ad_set_leak_warnings(int value);
 
+/**
+ * \brief Query/set the policy for reusing unused AD variable and edge slots
+ *
+ * By default, the AD layer recycles the most recently freed slot, which takes
+ * constant time. When sorted reuse is enabled, it instead always picks the
+ * unused slot with the smallest index, which takes logarithmic time but keeps
+ * the AD graph data structures more compact.
+ */
+extern DRJIT_EXTRA_EXPORT int ad_sorted_reuse();
+extern DRJIT_EXTRA_EXPORT void ad_set_sorted_reuse(int value);
+
+/**
+ * \brief Query/set the memory budget of AD graph traversals in bytes
+ *
+ * When nonzero, \ref ad_traverse() keeps a running estimate of the size of
+ * unevaluated gradient arithmetic and evaluates all pending gradients once it
+ * exceeds the budget. Combined with ``ADFlag::ClearEdges``, this bounds the
+ * peak memory usage of large AD traversals. The default (zero) disables this.
+ */
+extern DRJIT_EXTRA_EXPORT size_t ad_traverse_budget();
+extern DRJIT_EXTRA_EXPORT void ad_set_traverse_budget(size_t value);
+
+/**
+ * \brief Query/set the number of edges per chunk of AD graph traversals
+ *
+ * When nonzero, \ref ad_traverse() evaluates all pending gradients after
+ * processing this many edges. Since kernel launches are asynchronous, the
+ * device then processes earlier chunks while the host is still traversing
+ * the rest of the graph. The default (zero) disables this.
+ */
+extern DRJIT_EXTRA_EXPORT size_t ad_traverse_chunk();
+extern DRJIT_EXTRA_EXPORT void ad_set_traverse_chunk(size_t value);
+
+/// Counters describing the state and activity of the AD layer
+struct ADStats {
+    /// Number of AD variables and edges that are currently in use
+    size_t variables;
+    size_t edges;
+
+    /// Number of calls to \ref ad_traverse() that processed at least one edge
+    uint64_t traversals;
+
+    /// Number of edges visited by \ref ad_traverse()
+    uint64_t edges_traversed;
+
+    /// Subset of 'edges_traversed' with a special handler (gathers, scatters, ..)
+    uint64_t edges_special;
+
+    /// Subset of 'edges_special' that are part of a custom operation
+    uint64_t edges_custom;
+
+    /// Edges postponed until the end of a ``dr.isolate_grad()`` scope
+    uint64_t edges_postponed;
+
+    /// Edges that were skipped, since their source had no gradient
+    uint64_t edges_skipped;
+
+    /// Time (in milliseconds) spent in \ref ad_traverse() holding the AD lock
+    double traverse_time;
+};
+
+/**
+ * \brief Query the counters of the AD layer and optionally reset them
+ *
+ * The counters are updated while the AD layer is locked anyways, hence they
+ * are always enabled. Resetting leaves the 'variables' and 'edges' fields
+ * unaffected, since they describe the current size of the AD graph.
+ */
+extern DRJIT_EXTRA_EXPORT void ad_stats(ADStats *out, int reset);
+
+/**
+ * \brief Query/set the contention threshold of reverse-mode gathers
+ *
+ * When a gather without an explicitly specified reduction mode reads from a
+ * source array with at least ``value`` times more lanes than the source has
+ * elements, its reverse-mode derivative uses ``ReduceMode::Local`` to
+ * pre-reduce the atomic scatter-addition. A value of zero disables this.
+ */
+extern DRJIT_EXTRA_EXPORT uint32_t ad_local_reduce_ratio();
+extern DRJIT_EXTRA_EXPORT void ad_set_local_reduce_ratio(uint32_t value);
+
+/**
+ * \brief Query/set whether gather adjoints are accumulated reproducibly
+ *
+ * When enabled, the reverse-mode derivatives of (packet) gathers accumulate
+ * into 64-bit fixed-point integers, which produces bit-for-bit identical
+ * gradients across runs at the cost of an extra reduction and host
+ * synchronization per scatter.
+ */
+extern DRJIT_EXTRA_EXPORT bool ad_deterministic();
+extern DRJIT_EXTRA_EXPORT void ad_set_deterministic(bool value);
+
+/**
+ * \brief Query/set whether gather adjoints use Kahan-compensated atomics
+ *
+ * When enabled, the reverse-mode derivatives of single and double precision
+ * gathers accumulate via \ref jit_var_scatter_add_kahan() into a temporary
+ * pair of buffers that are added once the scatter is complete.
+ */
+extern DRJIT_EXTRA_EXPORT bool ad_kahan();
+extern DRJIT_EXTRA_EXPORT void ad_set_kahan(bool value);
+
+/**
+ * \brief Query/set whether transcendental functions trade accuracy for speed
+ *
+ * When enabled, \ref jit_var_sin(), \ref jit_var_cos(), \ref
+ * jit_var_sincos(), \ref jit_var_exp(), \ref jit_var_exp2(), \ref
+ * jit_var_log(), and \ref jit_var_log2() evaluate lower-degree polynomial
+ * fits in half and single precision (max. relative error of about 1e-5 instead
+ * of 1e-7). CUDA hardware intrinsics and double precision operations are
+ * unaffected. The setting applies to operations traced after the change.
+ */
+extern DRJIT_EXTRA_EXPORT bool ad_math_fast_approx();
+extern DRJIT_EXTRA_EXPORT void ad_set_math_fast_approx(bool value);
+
 #if defined(__GNUC__)
 DRJIT_INLINE uint64_t ad_var_inc_ref(uint64_t index) JIT_NOEXCEPT {
     /* If 'index' is known at compile time, it can only be zero, in
@@ -117,6 +117,9 @@
 #  if defined(__AVX512VPOPCNTDQ__)
 #    define DRJIT_X86_AVX512VPOPCNTDQ 1
 #  endif
+#  if defined(__AVX512FP16__) && defined(DRJIT_X86_AVX512)
+#    define DRJIT_X86_AVX512FP16 1
+#  endif
 #endif
 
 # if !defined(DRJIT_DISABLE_VECTORIZATION)
@@ -144,9 +147,17 @@
 #  if defined(__ARM_NEON)
 #    define DRJIT_ARM_NEON 1
 #  endif
+#  if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+      __ARM_FEATURE_SVE_BITS >= 256
+#    define DRJIT_ARM_SVE 1
+#    define DRJIT_SVE_BITS __ARM_FEATURE_SVE_BITS
+#  endif
 #  if defined(__ARM_FEATURE_FMA)
 #    define DRJIT_ARM_FMA 1
 #  endif
+#  if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(__aarch64__)
+#    define DRJIT_ARM_FP16 1
+#  endif
 #endif
 
 // Fix missing/inconsistent preprocessor flags
@@ -159,6 +170,9 @@
 #if defined(DRJIT_X86_AVX) && !defined(DRJIT_X86_SSE42)
 #  define DRJIT_X86_SSE42 1
 #endif
+#if defined(DRJIT_X86_F16C) && !defined(DRJIT_X86_AVX)
+#  undef DRJIT_X86_F16C
+#endif
 
 #if defined(_MSC_VER)
   #if defined(DRJIT_X86_AVX2) && !defined(DRJIT_X86_F16C)
@@ -190,6 +204,8 @@ NAMESPACE_BEGIN(drjit)
 /// Maximum hardware-supported packet size in bytes
 #if defined(DRJIT_X86_AVX512)
     static constexpr size_t DefaultSize = 16;
+#elif defined(DRJIT_ARM_SVE)
+    static constexpr size_t DefaultSize = DRJIT_SVE_BITS / 32;
 #elif defined(DRJIT_X86_AVX)
     static constexpr size_t DefaultSize = 8;
 #elif defined(DRJIT_X86_SSE42) || defined(DRJIT_ARM_NEON)
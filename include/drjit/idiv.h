@@ -212,6 +212,66 @@ struct divisor<T, enable_if_t<std::is_signed_v<T>>> {
     }
 } DRJIT_PACK;
 
+/**
+ * \brief Fast division of JIT arrays by a runtime-constant divisor
+ *
+ * \ref divisor computes its magic numbers on the host and therefore requires
+ * the divisor to be known when the computation is traced. This variant instead
+ * takes a single-element JIT array (e.g., an opaque image width or grid
+ * resolution). The multiplier and shift amounts are computed when the object
+ * is constructed and then stored as opaque variables. Every division traced
+ * afterwards compiles to a \ref mulhi(), a subtraction, an addition, and two
+ * shifts per lane instead of a hardware integer division. The method follows
+ * Granlund and Montgomery, "Division by invariant integers using
+ * multiplication" (1994).
+ *
+ * Only unsigned 32-bit arrays are supported, and the divisor must be nonzero.
+ */
+template <typename UInt32> struct fast_divisor {
+    static_assert(is_jit_v<UInt32> && depth_v<UInt32> == 1 &&
+                      std::is_same_v<scalar_t<UInt32>, uint32_t>,
+                  "fast_divisor: requires a flat unsigned 32-bit JIT array!");
+    using UInt64 = uint64_array_t<UInt32>;
+
+    UInt32 div;
+    UInt32 multiplier;
+    UInt32 shift_1, shift_2;
+
+    fast_divisor() = default;
+
+    fast_divisor(const UInt32 &div) : div(div) {
+        if (div.size() != 1)
+            drjit_fail("fast_divisor(): the divisor must be a single-element array!");
+
+        // l = ceil(log2(div)), multiplier = 2^32 * (2^l - div) / div + 1
+        UInt32 l = 32u - lzcnt(div - 1u);
+        UInt64 d = UInt64(div);
+        multiplier = UInt32(sl<32>((UInt64(1) << UInt64(l)) - d) / d + 1u);
+        shift_1 = minimum(l, 1u);
+        shift_2 = maximum(l, 1u) - 1u;
+
+        make_opaque(multiplier, shift_1, shift_2);
+    }
+
+    UInt32 operator()(const UInt32 &value) const {
+        UInt32 t = mulhi(value, multiplier);
+        return (t + ((value - t) >> shift_1)) >> shift_2;
+    }
+};
+
+template <typename Value> DRJIT_INLINE Value idiv(const Value &a, const fast_divisor<Value> &div) {
+    return div(a);
+}
+
+template <typename Value> DRJIT_INLINE Value imod(const Value &a, const fast_divisor<Value> &div) {
+    return a - div(a) * div.div;
+}
+
+template <typename Value> DRJIT_INLINE std::pair<Value, Value> idivmod(const Value &a, const fast_divisor<Value> &div) {
+    Value d = div(a);
+    return { d, a - d * div.div };
+}
+
 template <typename Value> DRJIT_INLINE Value idiv(const Value &a, const divisor<scalar_t<Value>> &div) {
     static_assert(std::is_integral_v<scalar_t<Value>>, "idiv(): requires integral operands!");
     return div(a);
@@ -72,7 +72,55 @@ Value horner(const Value &x, Ts... ts) {
 // -----------------------------------------------------------------------
 
 namespace detail {
-    template <bool Sin, bool Cos, typename Value>
+    /**
+     * Cody-Waite range reduction shared by sin(), cos(), sincos(), tan(), and
+     * cot(). Given the absolute value 'xa' of the argument, it returns the
+     * even octant index 'j', the reduced argument 'y' in [-pi/4, pi/4], and
+     * its square 'z' (NaN when 'xa' is infinite).
+     *
+     * All of these functions issue exactly the same sequence of operations,
+     * which lets the JIT's local value numbering evaluate the reduction only
+     * once when several of them are applied to the same argument.
+     */
+    template <typename Value> struct TrigReduction {
+        int_array_t<Value> j;
+        Value y, z;
+    };
+
+    template <typename Value>
+    DRJIT_INLINE TrigReduction<Value> trig_reduce(const Value &xa) {
+        using Scalar = scalar_t<Value>;
+        constexpr bool Single = std::is_same_v<Scalar, float>;
+        using IntArray = int_array_t<Value>;
+        using Int = scalar_t<IntArray>;
+
+        // Scale by 4/Pi and get the integer part
+        IntArray j = IntArray(xa * Scalar(1.2732395447351626862));
+
+        // Map zeros to origin; if (j & 1) j += 1
+        j = (j + Int(1)) & Int(~1u);
+
+        // Cast back to a floating point value
+        Value y = Value(j);
+
+        // Extended precision modular arithmetic
+        if constexpr (Single) {
+            y = xa - y * Scalar(0.78515625)
+                   - y * Scalar(2.4187564849853515625e-4)
+                   - y * Scalar(3.77489497744594108e-8);
+        } else {
+            y = xa - y * Scalar(7.85398125648498535156e-1)
+                   - y * Scalar(3.77489470793079817668e-8)
+                   - y * Scalar(2.69515142907905952645e-15);
+        }
+
+        Value z = square(y);
+        z = detail::or_(z, xa == Infinity<Value>);
+
+        return { j, y, z };
+    }
+
+    template <bool Sin, bool Cos, bool Fast = false, typename Value>
     DRJIT_INLINE void sincos(const Value &x, Value *s_out, Value *c_out) {
         using Scalar = scalar_t<Value>;
         constexpr bool Single = std::is_same_v<Scalar, float>;
@@ -111,15 +159,7 @@ namespace detail {
         */
 
         Value xa = abs(x);
-
-        // Scale by 4/Pi and get the integer part
-        IntArray j = IntArray(xa * Scalar(1.2732395447351626862));
-
-        // Map zeros to origin; if (j & 1) j += 1
-        j = (j + Int(1)) & Int(~1u);
-
-        // Cast back to a floating point value
-        Value y = Value(j);
+        auto [j, y, z] = trig_reduce(xa);
 
         // Determine sign of result
         Value sign_sin, sign_cos;
@@ -134,21 +174,17 @@ namespace detail {
         DRJIT_MARK_USED(sign_sin);
         DRJIT_MARK_USED(sign_cos);
 
-        // Extended precision modular arithmetic
-        if constexpr (Single) {
-            y = xa - y * Scalar(0.78515625)
-                   - y * Scalar(2.4187564849853515625e-4)
-                   - y * Scalar(3.77489497744594108e-8);
-        } else {
-            y = xa - y * Scalar(7.85398125648498535156e-1)
-                   - y * Scalar(3.77489470793079817668e-8)
-                   - y * Scalar(2.69515142907905952645e-15);
-        }
+        Value s, c;
 
-        Value z = square(y), s, c;
-        z = detail::or_(z, xa == Infinity<Value>);
+        if constexpr (Single && Fast) {
+            /* Lower-degree fits (max. rel. err. 6.3e-6, or 75 ULPs, in
+               [-pi, pi]; avg. 7.5 ULPs) */
+            s = estrin(z, -1.6665720545e-1,
+                           8.2115189442e-3) * z;
 
-        if constexpr (Single) {
+            c = estrin(z,  4.1665487048e-2,
+                          -1.3736555009e-3) * z;
+        } else if constexpr (Single) {
             s = estrin(z, -1.6666654611e-1,
                            8.3321608736e-3,
                           -1.9515295891e-4) * z;
@@ -208,29 +244,7 @@ namespace detail {
         */
 
         Value xa = abs(x);
-
-        // Scale by 4/Pi and get the integer part
-        IntArray j = IntArray(xa * Scalar(1.2732395447351626862));
-
-        // Map zeros to origin; if (j & 1) j += 1
-        j = (j + Int(1)) & Int(~1u);
-
-        // Cast back to a floating point value
-        Value y = Value(j);
-
-        // Extended precision modular arithmetic
-        if constexpr (Single) {
-            y = xa - y * Scalar(0.78515625)
-                   - y * Scalar(2.4187564849853515625e-4)
-                   - y * Scalar(3.77489497744594108e-8);
-        } else {
-            y = xa - y * Scalar(7.85398125648498535156e-1)
-                   - y * Scalar(3.77489470793079817668e-8)
-                   - y * Scalar(2.69515142907905952645e-15);
-        }
-
-        Value z = y * y;
-        z = detail::or_(z, xa == Infinity<Scalar>);
+        auto [j, y, z] = trig_reduce(xa);
 
         Value r;
         if constexpr (Single) {
@@ -304,38 +318,38 @@ namespace detail {
     DRJIT_DETECTOR(erf)
 }
 
-template <typename Value, bool Native> Value sin(const Value &x) {
+template <typename Value, bool Native, bool Fast> Value sin(const Value &x) {
     if constexpr (is_detected_v<detail::has_sin, Value> && Native) {
         return x.sin_();
     } else if constexpr (is_half_v<Value>) {
-        return (Value) sin(float32_array_t<Value>(x));
+        return (Value) sin<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         Value result;
-        detail::sincos<true, false>(x, &result, (Value *) nullptr);
+        detail::sincos<true, false, Fast>(x, &result, (Value *) nullptr);
         return result;
     }
 }
 
-template <typename Value, bool Native> Value cos(const Value &x) {
+template <typename Value, bool Native, bool Fast> Value cos(const Value &x) {
     if constexpr (is_detected_v<detail::has_cos, Value> && Native) {
         return x.cos_();
     } else if constexpr (is_half_v<Value>) {
-        return (Value) cos(float32_array_t<Value>(x));
+        return (Value) cos<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         Value result;
-        detail::sincos<false, true>(x, (Value *) nullptr, &result);
+        detail::sincos<false, true, Fast>(x, (Value *) nullptr, &result);
         return result;
     }
 }
 
-template <typename Value, bool Native> std::pair<Value, Value> sincos(const Value &x) {
+template <typename Value, bool Native, bool Fast> std::pair<Value, Value> sincos(const Value &x) {
     if constexpr (is_detected_v<detail::has_sincos, Value> && Native) {
         return x.sincos_();
     } else if constexpr (is_half_v<Value>) {
-        return sincos(float32_array_t<Value>(x));
+        return sincos<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         Value result_s, result_c;
-        detail::sincos<true, true>(x, &result_s, &result_c);
+        detail::sincos<true, true, Fast>(x, &result_s, &result_c);
         return { result_s, result_c };
     }
 }
@@ -687,11 +701,11 @@ template <typename Value, bool Native> std::pair<Value, Value> frexp(const Value
 #  pragma warning(pop)
 #endif
 
-template <typename Value, bool Native> Value exp(const Value &x) {
+template <typename Value, bool Native, bool Fast> Value exp(const Value &x) {
     if constexpr (is_detected_v<detail::has_exp, Value> && Native) {
         return x.exp_();
     } else if constexpr (is_half_v<Value>) {
-        return (Value) exp(float32_array_t<Value>(x));
+        return (Value) exp<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         /* Exponential function approximation based on CEPHES
 
@@ -733,7 +747,12 @@ template <typename Value, bool Native> Value exp(const Value &x) {
 
         Value z = square(y);
 
-        if constexpr (Single) {
+        if constexpr (Single && Fast) {
+            // Lower-degree fit (max. rel. err. 4.8e-7, or 6 ULPs)
+            z = estrin(y, 4.9999750249e-1, 1.6666774184e-1,
+                          4.1833594076e-2, 8.3412658234e-3);
+            z = fmadd(z, square(y), y + Scalar(1));
+        } else if constexpr (Single) {
             z = estrin(y, 5.0000001201e-1, 1.6666665459e-1,
                           4.1665795894e-2, 8.3334519073e-3,
                           1.3981999507e-3, 1.9875691500e-4);
@@ -760,11 +779,11 @@ template <typename Value, bool Native> Value exp(const Value &x) {
     }
 }
 
-template <typename Value, bool Native> Value exp2(const Value &x) {
+template <typename Value, bool Native, bool Fast> Value exp2(const Value &x) {
     if constexpr (is_detected_v<detail::has_exp2, Value> && Native) {
         return x.exp2_();
     } else if constexpr (is_half_v<Value>) {
-        return (Value) exp2(float32_array_t<Value>(x));
+        return (Value) exp2<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         /* Base-2 exponential function approximation based on CEPHES
 
@@ -801,9 +820,15 @@ template <typename Value, bool Native> Value exp2(const Value &x) {
             masked(n, gth) += 1.f;
             masked(y, gth) -= 1.f;
 
-            z = estrin(y, 6.931472028550421e-1, 2.402264791363012e-1,
-                          5.550332471162809e-2, 9.618437357674640e-3,
-                          1.339887440266574e-3, 1.535336188319500e-4);
+            if constexpr (Fast) {
+                // Lower-degree fit (max. rel. err. 6.2e-6, or 74 ULPs)
+                z = estrin(y, 6.9313685778e-1, 2.4023252162e-1,
+                              5.5837288261e-2, 9.6181107767e-3);
+            } else {
+                z = estrin(y, 6.931472028550421e-1, 2.402264791363012e-1,
+                              5.550332471162809e-2, 9.618437357674640e-3,
+                              1.339887440266574e-3, 1.535336188319500e-4);
+            }
             z = fmadd(y, z, 1.f);
         } else {
             // Separate into integer and fractional parts
@@ -830,11 +855,11 @@ template <typename Value, bool Native> Value exp2(const Value &x) {
     }
 }
 
-template <typename Value, bool Native> Value log(const Value &x) {
+template <typename Value, bool Native, bool Fast> Value log(const Value &x) {
     if constexpr (is_detected_v<detail::has_log, Value> && Native) {
         return x.log_();
     } else if constexpr (is_half_v<Value>) {
-        return (Value) log(float32_array_t<Value>(x));
+        return (Value) log<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         /* Logarithm function approximation based on CEPHES
 
@@ -868,7 +893,12 @@ template <typename Value, bool Native> Value log(const Value &x) {
 
         // Logarithm using log(1+x) = x - .5x**2 + x**3 P(x)
         Value y;
-        if constexpr (Single) {
+        if constexpr (Single && Fast) {
+            // Lower-degree fit (max. rel. err. 5.8e-6, or 67 ULPs; avg. 0.7 ULPs)
+            y = estrin(xm, 3.3330609344e-1, -2.4961078260e-1,
+                           2.0241413243e-1, -1.8203865098e-1,
+                           1.2444187966e-1);
+        } else if constexpr (Single) {
             y = estrin(xm, 3.3333331174e-1, -2.4999993993e-1,
                            2.0000714765e-1, -1.6668057665e-1,
                            1.4249322787e-1, -1.2420140846e-1,
@@ -909,11 +939,11 @@ template <typename Value, bool Native> Value log(const Value &x) {
     }
 }
 
-template <typename Value, bool Native> Value log2(const Value &x) {
+template <typename Value, bool Native, bool Fast> Value log2(const Value &x) {
     if constexpr (is_detected_v<detail::has_log2, Value> && Native) {
         return x.log2_();
     } else if constexpr (is_half_v<Value>) {
-        return (Value) log2(float32_array_t<Value>(x));
+        return (Value) log2<float32_array_t<Value>, true, Fast>(float32_array_t<Value>(x));
     } else {
         /* Logarithm function approximation based on CEPHES
 
@@ -947,7 +977,12 @@ template <typename Value, bool Native> Value log2(const Value &x) {
 
         // Logarithm using log(1+x) = x - .5x**2 + x**3 P(x)
         Value y;
-        if constexpr (Single) {
+        if constexpr (Single && Fast) {
+            // Lower-degree fit (max. rel. err. 5.8e-6, or 67 ULPs; avg. 0.7 ULPs)
+            y = estrin(xm, 3.3330609344e-1, -2.4961078260e-1,
+                           2.0241413243e-1, -1.8203865098e-1,
+                           1.2444187966e-1);
+        } else if constexpr (Single) {
             y = estrin(xm, 3.3333331174e-1, -2.4999993993e-1,
                            2.0000714765e-1, -1.6668057665e-1,
                            1.4249322787e-1, -1.2420140846e-1,
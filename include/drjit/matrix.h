@@ -14,6 +14,7 @@
 #pragma once
 
 #include <drjit/packet.h>
+#include <tuple>
 
 #if defined(_MSC_VER)
 #  pragma warning(push)
@@ -520,6 +521,282 @@ polar_decomp(const Matrix<T, Size> &A, size_t it = 10) {
     return { Q, transpose(Q) * A };
 }
 
+// =======================================================================
+//! @{ \name Small dense linear solvers
+//!
+//! These routines are unrolled for the static matrix size and vectorize
+//! over the lanes of the matrix entries. Data-dependent decisions (pivoting,
+//! sorting) are expressed using masked selects, and all steps are
+//! differentiable.
+// =======================================================================
+
+NAMESPACE_BEGIN(detail)
+
+/// Replace zero-valued divisors by one to keep derivatives finite in lanes whose result is discarded
+template <typename T> DRJIT_INLINE T safe_divisor(const T &v) {
+    return select(v == 0, T(1), v);
+}
+
+/// Jacobi rotation (c, s) that annihilates the off-diagonal entry of [[a_pp, a_pq], [a_pq, a_qq]]
+template <typename T>
+DRJIT_INLINE std::pair<T, T> jacobi_rotation(const T &a_pp, const T &a_qq, const T &a_pq) {
+    T theta = (a_qq - a_pp) * (.5f * rcp(safe_divisor(a_pq))),
+      t = copysign(T(1), theta) * rcp(abs(theta) + sqrt(fmadd(theta, theta, T(1))));
+    t = select(a_pq == 0, T(0), t);
+    T c = rsqrt(fmadd(t, t, T(1)));
+    return { c, t * c };
+}
+
+template <typename T, size_t Size>
+DRJIT_INLINE void jacobi_rotate_cols(Matrix<T, Size> &m, size_t p, size_t q,
+                                     const T &c, const T &s) {
+    for (size_t k = 0; k < Size; ++k) {
+        T m_p = m(k, p), m_q = m(k, q);
+        m(k, p) = fmsub(c, m_p, s * m_q);
+        m(k, q) = fmadd(s, m_p, c * m_q);
+    }
+}
+
+template <typename T, size_t Size>
+DRJIT_INLINE void jacobi_rotate_rows(Matrix<T, Size> &m, size_t p, size_t q,
+                                     const T &c, const T &s) {
+    for (size_t k = 0; k < Size; ++k) {
+        T m_p = m(p, k), m_q = m(q, k);
+        m(p, k) = fmsub(c, m_p, s * m_q);
+        m(q, k) = fmadd(s, m_p, c * m_q);
+    }
+}
+
+/// Sort 'values' and permute the columns of 'm0' and 'm1' (if given) accordingly
+template <typename T, size_t Size>
+void sort_columns(Array<T, Size> &values, bool descending, Matrix<T, Size> &m0,
+                  Matrix<T, Size> *m1 = nullptr) {
+    // Odd-even transposition sort
+    for (size_t it = 0; it < Size; ++it) {
+        for (size_t i = it % 2; i + 1 < Size; i += 2) {
+            T a = values.entry(i), b = values.entry(i + 1);
+            auto swap = descending ? (a < b) : (a > b);
+            values.entry(i) = select(swap, b, a);
+            values.entry(i + 1) = select(swap, a, b);
+
+            for (Matrix<T, Size> *m : { &m0, m1 }) {
+                if (!m)
+                    continue;
+                for (size_t k = 0; k < Size; ++k) {
+                    T u = (*m)(k, i), v = (*m)(k, i + 1);
+                    (*m)(k, i) = select(swap, v, u);
+                    (*m)(k, i + 1) = select(swap, u, v);
+                }
+            }
+        }
+    }
+}
+
+NAMESPACE_END(detail)
+
+/// Cholesky factorization ``A = L L^T`` of a symmetric positive definite matrix
+template <typename T, size_t Size>
+Matrix<T, Size> cholesky(const Matrix<T, Size> &A) {
+    Matrix<T, Size> L = zeros<Matrix<T, Size>>();
+
+    for (size_t j = 0; j < Size; ++j) {
+        T acc = A(j, j);
+        for (size_t k = 0; k < j; ++k)
+            acc = fnmadd(L(j, k), L(j, k), acc);
+        L(j, j) = sqrt(acc);
+        T inv = rcp(L(j, j));
+
+        for (size_t i = j + 1; i < Size; ++i) {
+            acc = A(i, j);
+            for (size_t k = 0; k < j; ++k)
+                acc = fnmadd(L(i, k), L(j, k), acc);
+            L(i, j) = acc * inv;
+        }
+    }
+
+    return L;
+}
+
+/// Solve ``A x = b`` given the Cholesky factor ``L`` of ``A``
+template <typename T, size_t Size>
+Array<T, Size> cholesky_solve(const Matrix<T, Size> &L, const Array<T, Size> &b) {
+    Array<T, Size> y, x;
+
+    for (size_t i = 0; i < Size; ++i) {
+        T acc = b.entry(i);
+        for (size_t k = 0; k < i; ++k)
+            acc = fnmadd(L(i, k), y.entry(k), acc);
+        y.entry(i) = acc * rcp(L(i, i));
+    }
+
+    for (size_t i = Size; i-- > 0; ) {
+        T acc = y.entry(i);
+        for (size_t k = i + 1; k < Size; ++k)
+            acc = fnmadd(L(k, i), x.entry(k), acc);
+        x.entry(i) = acc * rcp(L(i, i));
+    }
+
+    return x;
+}
+
+/**
+ * \brief LU factorization with partial pivoting
+ *
+ * Returns the packed factors (``L`` with an implicit unit diagonal below the
+ * diagonal, ``U`` on and above it) and the row permutation ``perm``, so that
+ * row ``i`` of ``L U`` equals row ``perm[i]`` of ``A``.
+ */
+template <typename T, size_t Size>
+std::pair<Matrix<T, Size>, Array<uint32_array_t<T>, Size>>
+lu(const Matrix<T, Size> &A) {
+    using UInt32 = uint32_array_t<T>;
+    Matrix<T, Size> M = A;
+    Array<UInt32, Size> perm;
+    for (size_t i = 0; i < Size; ++i)
+        perm.entry(i) = UInt32((uint32_t) i);
+
+    for (size_t k = 0; k < Size; ++k) {
+        // Find the largest entry within column 'k'
+        UInt32 piv = UInt32((uint32_t) k);
+        T best = abs(M(k, k));
+        for (size_t i = k + 1; i < Size; ++i) {
+            T value = abs(M(i, k));
+            auto bigger = value > best;
+            best = select(bigger, value, best);
+            piv = select(bigger, UInt32((uint32_t) i), piv);
+        }
+
+        // Swap rows 'k' and 'piv'
+        for (size_t i = k + 1; i < Size; ++i) {
+            auto swap = piv == (uint32_t) i;
+            for (size_t j = 0; j < Size; ++j) {
+                T a = M(k, j), b = M(i, j);
+                M(k, j) = select(swap, b, a);
+                M(i, j) = select(swap, a, b);
+            }
+            UInt32 a = perm.entry(k), b = perm.entry(i);
+            perm.entry(k) = select(swap, b, a);
+            perm.entry(i) = select(swap, a, b);
+        }
+
+        // Eliminate the entries below the pivot
+        T inv = rcp(M(k, k));
+        for (size_t i = k + 1; i < Size; ++i) {
+            M(i, k) *= inv;
+            for (size_t j = k + 1; j < Size; ++j)
+                M(i, j) = fnmadd(M(i, k), M(k, j), M(i, j));
+        }
+    }
+
+    return { M, perm };
+}
+
+/// Solve ``A x = b`` given the output of \ref lu()
+template <typename T, size_t Size>
+Array<T, Size> lu_solve(const Matrix<T, Size> &LU,
+                        const Array<uint32_array_t<T>, Size> &perm,
+                        const Array<T, Size> &b) {
+    Array<T, Size> y, x;
+
+    // Apply the row permutation, then solve the unit lower triangular system
+    for (size_t i = 0; i < Size; ++i) {
+        T acc = b.entry(0);
+        for (size_t j = 1; j < Size; ++j)
+            acc = select(perm.entry(i) == (uint32_t) j, b.entry(j), acc);
+        for (size_t k = 0; k < i; ++k)
+            acc = fnmadd(LU(i, k), y.entry(k), acc);
+        y.entry(i) = acc;
+    }
+
+    for (size_t i = Size; i-- > 0; ) {
+        T acc = y.entry(i);
+        for (size_t k = i + 1; k < Size; ++k)
+            acc = fnmadd(LU(i, k), x.entry(k), acc);
+        x.entry(i) = acc * rcp(LU(i, i));
+    }
+
+    return x;
+}
+
+/**
+ * \brief Eigendecomposition ``A = V diag(w) V^T`` of a symmetric matrix
+ *
+ * Uses a fixed number of sweeps of the cyclic Jacobi method, which converges
+ * quadratically. Returns the eigenvalues in ascending order along with the
+ * matrix of associated eigenvectors (stored as columns).
+ */
+template <typename T, size_t Size>
+std::pair<Array<T, Size>, Matrix<T, Size>> eigh(const Matrix<T, Size> &A,
+                                                size_t sweeps = 8) {
+    Matrix<T, Size> M = A, V = identity<Matrix<T, Size>>();
+
+    for (size_t it = 0; it < sweeps; ++it) {
+        for (size_t p = 0; p + 1 < Size; ++p) {
+            for (size_t q = p + 1; q < Size; ++q) {
+                auto [c, s] = detail::jacobi_rotation(M(p, p), M(q, q), M(p, q));
+                detail::jacobi_rotate_cols(M, p, q, c, s);
+                detail::jacobi_rotate_rows(M, p, q, c, s);
+                detail::jacobi_rotate_cols(V, p, q, c, s);
+            }
+        }
+    }
+
+    Array<T, Size> w = diag(M);
+    detail::sort_columns(w, false, V);
+    return { w, V };
+}
+
+/**
+ * \brief Singular value decomposition ``A = U diag(sigma) V^T``
+ *
+ * Uses a fixed number of sweeps of the one-sided Jacobi method (Hestenes),
+ * which orthogonalizes the columns of ``A`` by plane rotations that are also
+ * accumulated into ``V``. Returns ``U``, the singular values in descending
+ * order, and ``V``.
+ */
+template <typename T, size_t Size>
+std::tuple<Matrix<T, Size>, Array<T, Size>, Matrix<T, Size>>
+svd(const Matrix<T, Size> &A, size_t sweeps = 8) {
+    Matrix<T, Size> U = A, V = identity<Matrix<T, Size>>();
+
+    for (size_t it = 0; it < sweeps; ++it) {
+        for (size_t p = 0; p + 1 < Size; ++p) {
+            for (size_t q = p + 1; q < Size; ++q) {
+                T a_pp = U(0, p) * U(0, p), a_qq = U(0, q) * U(0, q),
+                  a_pq = U(0, p) * U(0, q);
+                for (size_t k = 1; k < Size; ++k) {
+                    a_pp = fmadd(U(k, p), U(k, p), a_pp);
+                    a_qq = fmadd(U(k, q), U(k, q), a_qq);
+                    a_pq = fmadd(U(k, p), U(k, q), a_pq);
+                }
+                auto [c, s] = detail::jacobi_rotation(a_pp, a_qq, a_pq);
+                detail::jacobi_rotate_cols(U, p, q, c, s);
+                detail::jacobi_rotate_cols(V, p, q, c, s);
+            }
+        }
+    }
+
+    // The singular values are the column norms
+    Array<T, Size> sigma;
+    for (size_t j = 0; j < Size; ++j) {
+        T acc = U(0, j) * U(0, j);
+        for (size_t k = 1; k < Size; ++k)
+            acc = fmadd(U(k, j), U(k, j), acc);
+        sigma.entry(j) = sqrt(acc);
+
+        T inv = select(sigma.entry(j) == 0, T(0),
+                       rcp(detail::safe_divisor(sigma.entry(j))));
+        for (size_t k = 0; k < Size; ++k)
+            U(k, j) *= inv;
+    }
+
+    detail::sort_columns(sigma, true, U, &V);
+    return { U, sigma, V };
+}
+
+//! @}
+// =======================================================================
+
 template <typename T> using entry_t = typename T::Entry;
 
 NAMESPACE_END(drjit)
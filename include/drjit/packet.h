@@ -40,6 +40,10 @@
 #  include <drjit/packet_neon.h>
 #endif
 
+#if defined(DRJIT_ARM_SVE)
+#  include <drjit/packet_sve.h>
+#endif
+
 NAMESPACE_BEGIN(drjit)
 
 template <typename Value_, size_t Size_>
@@ -80,6 +84,130 @@ struct PacketMask : MaskBase<Value_, Size_, PacketMask<Value_, Size_>> {
     DRJIT_ARRAY_IMPORT(PacketMask, Base)
 };
 
+// -----------------------------------------------------------------------
+//! @{ \name Conversion between array-of-structures and packet layouts
+// -----------------------------------------------------------------------
+
+NAMESPACE_BEGIN(detail)
+
+constexpr size_t aos_gcd(size_t a, size_t b) { return b == 0 ? a : aos_gcd(b, a % b); }
+
+/// Index 'j' of the record whose component 'c' is stored in lane 'l' modulo 'N'
+template <size_t C, size_t N> constexpr size_t aos_record(size_t c, size_t l) {
+    for (size_t j = 0; j < N; ++j) {
+        if ((C * j + c) % N == l)
+            return j;
+    }
+    return 0;
+}
+
+/// Lanes of component 'c' that are read from (or written to) packet 'k'
+template <typename Packet, size_t C, size_t c, size_t k, bool Blended, size_t... Js>
+DRJIT_INLINE mask_t<Packet> aos_mask(std::index_sequence<Js...>) {
+    using Value = value_t<Packet>;
+    constexpr size_t N = sizeof...(Js);
+    return Packet(Value((C * (Blended ? aos_record<C, N>(c, Js) : Js) + c) / N == k)...) !=
+           Value(0);
+}
+
+template <size_t C, size_t c, typename Packet, size_t... Js, size_t... Ks>
+DRJIT_INLINE Packet aos_load_component(const Packet *in, std::index_sequence<Js...> js,
+                                       std::index_sequence<Ks...>) {
+    constexpr size_t N = sizeof...(Js);
+    Packet result = in[0];
+
+    if constexpr (aos_gcd(C, N) == 1) {
+        // Each lane is needed by exactly one output lane: blend, then permute once
+        ((result = select(aos_mask<Packet, C, c, Ks, true>(js), in[Ks], result)), ...);
+        return shuffle<((C * Js + c) % N)...>(result);
+    } else {
+        ((result = select(aos_mask<Packet, C, c, Ks, false>(js),
+                          shuffle<((C * Js + c) % N)...>(in[Ks]), result)), ...);
+        return result;
+    }
+}
+
+/// Move lane 'j' of component 'c' to the lane it occupies in the AoS layout
+template <size_t C, size_t c, typename Packet, size_t... Js>
+DRJIT_INLINE Packet aos_store_permute(const Packet &p, std::index_sequence<Js...>) {
+    return shuffle<aos_record<C, sizeof...(Js)>(c, Js)...>(p);
+}
+
+/// Lanes of packet 'k' that hold component 'c'
+template <typename Packet, size_t C, size_t k, size_t c, size_t... Js>
+DRJIT_INLINE mask_t<Packet> aos_store_mask(std::index_sequence<Js...>) {
+    using Value = value_t<Packet>;
+    return Packet(Value((sizeof...(Js) * k + Js) % C == c)...) != Value(0);
+}
+
+template <size_t C, size_t k, typename Packet, size_t... Js, size_t... Cs>
+DRJIT_INLINE Packet aos_store_packet(const Packet *in, std::index_sequence<Js...> js,
+                                     std::index_sequence<Cs...>) {
+    constexpr size_t N = sizeof...(Js);
+    Packet result = in[0];
+
+    // 'in' was permuted beforehand when C and N are coprime (see store_aos())
+    if constexpr (aos_gcd(C, N) == 1)
+        ((result = select(aos_store_mask<Packet, C, k, Cs>(js), in[Cs], result)), ...);
+    else
+        ((result = select(aos_store_mask<Packet, C, k, Cs>(js),
+                          shuffle<((N * k + Js) / C)...>(in[Cs]), result)), ...);
+
+    return result;
+}
+
+template <typename T, size_t... Ks>
+DRJIT_INLINE T load_aos(const void *ptr, std::index_sequence<Ks...> ks) {
+    using Packet = value_t<T>;
+    constexpr size_t N = Packet::Size;
+    Packet in[] = { load<Packet>((const scalar_t<T> *) ptr + Ks * N)... };
+    return T(aos_load_component<sizeof...(Ks), Ks>(
+        in, std::make_index_sequence<N>(), ks)...);
+}
+
+template <typename T, size_t... Ks>
+DRJIT_INLINE void store_aos(void *ptr, const T &value, std::index_sequence<Ks...> ks) {
+    using Packet = value_t<T>;
+    constexpr size_t C = sizeof...(Ks), N = Packet::Size;
+    using Js = std::make_index_sequence<N>;
+    Packet in[C];
+
+    if constexpr (aos_gcd(C, N) == 1)
+        ((in[Ks] = aos_store_permute<C, Ks>(value.entry(Ks), Js())), ...);
+    else
+        ((in[Ks] = value.entry(Ks)), ...);
+
+    (store((scalar_t<T> *) ptr + Ks * N, aos_store_packet<C, Ks>(in, Js(), ks)), ...);
+}
+
+NAMESPACE_END(detail)
+
+/**
+ * \brief Load ``N`` interleaved records of ``C`` components each (e.g.,
+ * ``xyzxyz..``) and return them as ``C`` packets of size ``N``.
+ *
+ * ``T`` must be a nested array such as ``Array<Packet<float, 8>, 3>``. The
+ * data is fetched using ``C`` contiguous packet loads followed by in-register
+ * blends and shuffles, which is considerably cheaper than a strided gather.
+ */
+template <typename T> DRJIT_INLINE T load_aos(const void *ptr) {
+    static_assert(depth_v<T> == 2 && size_v<T> != Dynamic &&
+                      size_v<value_t<T>> != Dynamic,
+                  "load_aos(): expected a nested static array!");
+    return detail::load_aos<T>(ptr, std::make_index_sequence<size_v<T>>());
+}
+
+/// Inverse of \ref load_aos(): store ``C`` packets as ``N`` interleaved records
+template <typename T> DRJIT_INLINE void store_aos(void *ptr, const T &value) {
+    static_assert(depth_v<T> == 2 && size_v<T> != Dynamic &&
+                      size_v<value_t<T>> != Dynamic,
+                  "store_aos(): expected a nested static array!");
+    detail::store_aos(ptr, value, std::make_index_sequence<size_v<T>>());
+}
+
+//! @}
+// -----------------------------------------------------------------------
+
 #if defined(DRJIT_X86_SSE42)
 /// Flush denormalized numbers to zero
 inline void set_flush_denormals(bool value) {
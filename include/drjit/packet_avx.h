@@ -40,10 +40,9 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
     //! @{ \name Type converting constructors
     // -----------------------------------------------------------------------
 
-// #if defined(DRJIT_X86_F16C)
-//     DRJIT_CONVERT(half)
-//         : m(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i *) a.derived().data()))) { }
-// #endif
+#if defined(DRJIT_X86_F16C)
+    DRJIT_CONVERT(half) : m(detail::cvtph_ps(a.derived().m)) { }
+#endif
 
     DRJIT_CONVERT(float) : m(a.derived().m) { }
 
@@ -103,6 +102,19 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
 
     DRJIT_REINTERPRET(float) : m(a.derived().m) { }
 
+#if defined(DRJIT_X86_F16C) && !defined(DRJIT_X86_AVX512)
+#  if defined(DRJIT_X86_AVX2)
+    DRJIT_REINTERPRET_MASK(half)
+        : m(_mm256_castsi256_ps(_mm256_cvtepi16_epi32(a.derived().m))) { }
+#  else
+    DRJIT_REINTERPRET_MASK(half)
+        : m(detail::concat(
+              _mm_castsi128_ps(_mm_cvtepi16_epi32(a.derived().m)),
+              _mm_castsi128_ps(_mm_cvtepi16_epi32(
+                  _mm_unpackhi_epi64(a.derived().m, a.derived().m))))) { }
+#  endif
+#endif
+
 #if defined(DRJIT_X86_AVX2)
     DRJIT_REINTERPRET(int32_t) : m(_mm256_castsi256_ps(a.derived().m)) { }
     DRJIT_REINTERPRET(uint32_t) : m(_mm256_castsi256_ps(a.derived().m)) { }
@@ -286,6 +298,22 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
         #endif
     }
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        #if defined(DRJIT_X86_FMA)
+            return _mm256_fmaddsub_ps(m, b.m, c.m);
+        #else
+            return _mm256_addsub_ps(_mm256_mul_ps(m, b.m), c.m);
+        #endif
+    }
+
+    /// Product of interleaved complex numbers (re0, im0, re1, im1, ..)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        __m256 b_re = _mm256_moveldup_ps(b.m),
+               b_im = _mm256_movehdup_ps(b.m),
+               a_sw = _mm256_permute_ps(m, _MM_SHUFFLE(2, 3, 0, 1));
+        return Derived(m).fmaddsub_(Derived(b_re), Derived(_mm256_mul_ps(a_sw, b_im)));
+    }
+
 #if defined(DRJIT_X86_AVX512)
     DRJIT_INLINE Derived ldexp_(Ref arg) const { return _mm256_scalef_ps(m, arg.m); }
 
@@ -437,6 +465,37 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
     }
 #endif
 
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        #if defined(DRJIT_X86_AVX512)
+            _mm256_mask_compressstoreu_ps(ptr, mask.k, m);
+            return (size_t) _mm_popcnt_u32((unsigned int) mask.k);
+        #elif defined(DRJIT_X86_AVX2)
+            unsigned int k = (unsigned int) _mm256_movemask_ps(mask.m);
+            size_t count = (size_t) _mm_popcnt_u32(k);
+            _mm256_maskstore_ps((float *) ptr, detail::prefix_mask(count),
+                                _mm256_permutevar8x32_ps(m, detail::compress_perm<false>(k)));
+            return count;
+        #else
+            return Base::compress_store_(ptr, mask);
+        #endif
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        #if defined(DRJIT_X86_AVX512)
+            return _mm256_maskz_expandloadu_ps(mask.k, ptr);
+        #elif defined(DRJIT_X86_AVX2)
+            unsigned int k = (unsigned int) _mm256_movemask_ps(mask.m);
+            __m256 value = _mm256_maskload_ps(
+                (const float *) ptr, detail::prefix_mask((size_t) _mm_popcnt_u32(k)));
+            return _mm256_and_ps(
+                _mm256_permutevar8x32_ps(value, detail::compress_perm<true>(k)), mask.m);
+        #else
+            return Base::expand_load_(ptr, mask);
+        #endif
+    }
+
     //! @}
     // -----------------------------------------------------------------------
 } DRJIT_MAY_ALIAS;
@@ -464,12 +523,12 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
     //! @{ \name Type converting constructors
     // -----------------------------------------------------------------------
 
-// #if defined(DRJIT_X86_F16C)
-//     DRJIT_CONVERT(half) {
-//         m = _mm256_cvtps_pd(
-//             _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *) a.derived().data())));
-//     }
-// #endif
+#if defined(DRJIT_X86_F16C)
+    DRJIT_CONVERT(half) {
+        m = _mm256_cvtps_pd(
+            _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *) a.derived().data())));
+    }
+#endif
 
     DRJIT_CONVERT(float) : m(_mm256_cvtps_pd(a.derived().m)) { }
     DRJIT_CONVERT(int32_t) : m(_mm256_cvtepi32_pd(a.derived().m)) { }
@@ -665,6 +724,22 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
     DRJIT_INLINE Derived fnmsub_  (Ref b, Ref c) const { return _mm256_fnmsub_pd  (m, b.m, c.m); }
 #endif
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        #if defined(DRJIT_X86_FMA)
+            return _mm256_fmaddsub_pd(m, b.m, c.m);
+        #else
+            return _mm256_addsub_pd(_mm256_mul_pd(m, b.m), c.m);
+        #endif
+    }
+
+    /// Product of interleaved complex numbers (re0, im0, re1, im1)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        __m256d b_re = _mm256_movedup_pd(b.m),
+                b_im = _mm256_permute_pd(b.m, 0xF),
+                a_sw = _mm256_permute_pd(m, 0x5);
+        return Derived(m).fmaddsub_(Derived(b_re), Derived(_mm256_mul_pd(a_sw, b_im)));
+    }
+
 #if defined(DRJIT_X86_AVX2)
     template <int I0, int I1, int I2, int I3>
     DRJIT_INLINE Derived shuffle_() const {
@@ -903,6 +978,349 @@ template <bool IsMask_, typename Derived_> struct alignas(32)
     // -----------------------------------------------------------------------
 } DRJIT_MAY_ALIAS;
 
+#if defined(DRJIT_X86_F16C)
+DRJIT_PACKET_DECLARE_HALF(8)
+
+/**
+ * \brief Partial overload of StaticArrayImpl for half precision values
+ *
+ * The packet stores its entries in half precision. Arithmetic operations are
+ * native on processors with AVX512-FP16. Otherwise, the F16C extension is used
+ * to convert the operands to single precision, and the result is rounded back
+ * to half precision. For the basic arithmetic operations and square roots,
+ * this produces exactly the same (correctly rounded) result.
+ */
+template <bool IsMask_, typename Derived_> struct alignas(16)
+    StaticArrayImpl<half, 8, IsMask_, Derived_>
+  : StaticArrayBase<half, 8, IsMask_, Derived_> {
+
+    DRJIT_PACKET_TYPE(half, 8, __m128i)
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Value constructors
+    // -----------------------------------------------------------------------
+
+    template <typename T, enable_if_scalar_t<T> = 0>
+    DRJIT_INLINE StaticArrayImpl(T value)
+        : m(_mm_set1_epi16(memcpy_cast<int16_t>((Value) value))) { }
+
+    DRJIT_INLINE StaticArrayImpl(Value v0, Value v1, Value v2, Value v3,
+                                 Value v4, Value v5, Value v6, Value v7)
+        : m(_mm_setr_epi16(
+              memcpy_cast<int16_t>(v0), memcpy_cast<int16_t>(v1),
+              memcpy_cast<int16_t>(v2), memcpy_cast<int16_t>(v3),
+              memcpy_cast<int16_t>(v4), memcpy_cast<int16_t>(v5),
+              memcpy_cast<int16_t>(v6), memcpy_cast<int16_t>(v7))) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Type converting constructors
+    // -----------------------------------------------------------------------
+
+    DRJIT_CONVERT(half) : m(a.derived().m) { }
+    DRJIT_CONVERT(float) : m(detail::cvtps_ph(a.derived().m)) { }
+
+#if defined(DRJIT_X86_AVX512)
+    DRJIT_CONVERT(double)
+        : m(detail::cvtps_ph(_mm512_cvtpd_ps(a.derived().m))) { }
+#else
+    DRJIT_CONVERT(double)
+        : m(detail::cvtps_ph(detail::concat(_mm256_cvtpd_ps(low(a).m),
+                                            _mm256_cvtpd_ps(high(a).m)))) { }
+#endif
+
+#if defined(DRJIT_X86_AVX2)
+    DRJIT_CONVERT(int32_t)
+        : m(detail::cvtps_ph(_mm256_cvtepi32_ps(a.derived().m))) { }
+#endif
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Reinterpreting constructors, mask converters
+    // -----------------------------------------------------------------------
+
+    DRJIT_REINTERPRET(half) : m(a.derived().m) { }
+
+    DRJIT_REINTERPRET(int16_t)
+        : m(_mm_loadu_si128((const __m128i *) a.derived().data())) { }
+    DRJIT_REINTERPRET(uint16_t)
+        : m(_mm_loadu_si128((const __m128i *) a.derived().data())) { }
+
+    DRJIT_REINTERPRET_MASK(bool) {
+        uint64_t ival;
+        memcpy(&ival, a.derived().data(), 8);
+        m = _mm_cvtepi8_epi16(_mm_cmpgt_epi8(
+            detail::mm_cvtsi64_si128((long long) ival), _mm_setzero_si128()));
+    }
+
+#if !defined(DRJIT_X86_AVX512)
+    DRJIT_REINTERPRET_MASK(float) {
+        __m256i mi = _mm256_castps_si256(a.derived().m);
+        m = _mm_packs_epi32(_mm256_castsi256_si128(mi),
+                            _mm256_extractf128_si256(mi, 1));
+    }
+#endif
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Converting from/to half size vectors
+    // -----------------------------------------------------------------------
+
+    StaticArrayImpl(const Array1 &a1, const Array2 &a2)
+        : StaticArrayImpl(a1.entry(0), a1.entry(1), a1.entry(2), a1.entry(3),
+                          a2.entry(0), a2.entry(1), a2.entry(2), a2.entry(3)) { }
+
+    DRJIT_INLINE Array1 low_()  const { return Array1(entry(0), entry(1), entry(2), entry(3)); }
+    DRJIT_INLINE Array2 high_() const { return Array2(entry(4), entry(5), entry(6), entry(7)); }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Vertical operations
+    // -----------------------------------------------------------------------
+
+#if defined(DRJIT_X86_AVX512FP16)
+    #define DRJIT_HALF_OP(name, op, a, b)                                    \
+        DRJIT_INLINE Derived name##_(Ref arg) const {                        \
+            return _mm_castph_si128(                                         \
+                _mm_##op##_ph(_mm_castsi128_ph(a), _mm_castsi128_ph(b)));    \
+        }
+#else
+    #define DRJIT_HALF_OP(name, op, a, b)                                    \
+        DRJIT_INLINE Derived name##_(Ref arg) const {                        \
+            return detail::cvtps_ph(                                         \
+                _mm256_##op##_ps(detail::cvtph_ps(a), detail::cvtph_ps(b))); \
+        }
+#endif
+
+    DRJIT_HALF_OP(add, add, m, arg.m)
+    DRJIT_HALF_OP(sub, sub, m, arg.m)
+    DRJIT_HALF_OP(mul, mul, m, arg.m)
+    DRJIT_HALF_OP(div, div, m, arg.m)
+    DRJIT_HALF_OP(minimum, min, arg.m, m)
+    DRJIT_HALF_OP(maximum, max, arg.m, m)
+
+    #undef DRJIT_HALF_OP
+
+    DRJIT_INLINE Derived not_() const {
+        #if defined(DRJIT_X86_AVX512)
+            return _mm_ternarylogic_epi32(m, m, m, 0b01010101);
+        #else
+            return _mm_xor_si128(m, _mm_set1_epi32(-1));
+        #endif
+    }
+
+    DRJIT_INLINE Derived neg_() const {
+        return _mm_xor_si128(m, _mm_set1_epi16((int16_t) 0x8000));
+    }
+
+    DRJIT_INLINE Derived abs_() const {
+        return _mm_and_si128(m, _mm_set1_epi16((int16_t) 0x7FFF));
+    }
+
+    /// Return the bit pattern of a mask or a regular array
+    template <typename T> static DRJIT_INLINE __m128i bits_(const T &a) {
+        #if defined(DRJIT_X86_AVX512)
+            if constexpr (is_mask_v<T>)
+                return _mm_movm_epi16(a.k);
+            else
+        #endif
+        return a.m;
+    }
+
+    template <typename T> DRJIT_INLINE Derived or_(const T &a) const {
+        return _mm_or_si128(m, bits_(a));
+    }
+
+    template <typename T> DRJIT_INLINE Derived and_(const T &a) const {
+        return _mm_and_si128(m, bits_(a));
+    }
+
+    template <typename T> DRJIT_INLINE Derived andnot_(const T &a) const {
+        return _mm_andnot_si128(bits_(a), m);
+    }
+
+    template <typename T> DRJIT_INLINE Derived xor_(const T &a) const {
+        return _mm_xor_si128(m, bits_(a));
+    }
+
+    #if defined(DRJIT_X86_AVX512FP16)
+        #define DRJIT_COMP(NAME)                                             \
+            mask_t<Derived>::from_k(_mm_cmp_ph_mask(                         \
+                _mm_castsi128_ph(m), _mm_castsi128_ph(a.m), _CMP_##NAME))
+    #elif defined(DRJIT_X86_AVX512)
+        #define DRJIT_COMP(NAME)                                             \
+            mask_t<Derived>::from_k(_mm256_cmp_ps_mask(                      \
+                detail::cvtph_ps(m), detail::cvtph_ps(a.m), _CMP_##NAME))
+    #else
+        #define DRJIT_COMP(NAME)                                             \
+            mask_t<Derived>(pack_mask_(_mm256_cmp_ps(                        \
+                detail::cvtph_ps(m), detail::cvtph_ps(a.m), _CMP_##NAME)))
+    #endif
+
+    /// Convert a single precision comparison result into a 16 bit mask
+    static DRJIT_INLINE __m128i pack_mask_(__m256 m) {
+        __m256i mi = _mm256_castps_si256(m);
+        return _mm_packs_epi32(_mm256_castsi256_si128(mi),
+                               _mm256_extractf128_si256(mi, 1));
+    }
+
+    DRJIT_INLINE auto lt_ (Ref a) const { return DRJIT_COMP(LT_OQ);  }
+    DRJIT_INLINE auto gt_ (Ref a) const { return DRJIT_COMP(GT_OQ);  }
+    DRJIT_INLINE auto le_ (Ref a) const { return DRJIT_COMP(LE_OQ);  }
+    DRJIT_INLINE auto ge_ (Ref a) const { return DRJIT_COMP(GE_OQ);  }
+
+    DRJIT_INLINE auto eq_ (Ref a) const {
+        if constexpr (IsMask_)
+            return mask_t<Derived>(_mm_cmpeq_epi16(m, a.m));
+        else
+            return DRJIT_COMP(EQ_OQ);
+    }
+
+    DRJIT_INLINE auto neq_(Ref a) const {
+        if constexpr (IsMask_)
+            return mask_t<Derived>(_mm_xor_si128(_mm_cmpeq_epi16(m, a.m),
+                                                 _mm_set1_epi32(-1)));
+        else
+            return DRJIT_COMP(NEQ_UQ);
+    }
+
+    #undef DRJIT_COMP
+
+#if defined(DRJIT_X86_AVX512FP16)
+    #define DRJIT_HALF_UNARY(name, expr_ph, expr_ps)                         \
+        DRJIT_INLINE Derived name##_() const {                               \
+            __m128h x = _mm_castsi128_ph(m);                                 \
+            return _mm_castph_si128(expr_ph);                                \
+        }
+#else
+    #define DRJIT_HALF_UNARY(name, expr_ph, expr_ps)                         \
+        DRJIT_INLINE Derived name##_() const {                               \
+            __m256 x = detail::cvtph_ps(m);                                  \
+            return detail::cvtps_ph(expr_ps);                                \
+        }
+#endif
+
+    DRJIT_HALF_UNARY(sqrt, _mm_sqrt_ph(x), _mm256_sqrt_ps(x))
+    DRJIT_HALF_UNARY(floor,
+        _mm_roundscale_ph(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC),
+        _mm256_round_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+    DRJIT_HALF_UNARY(ceil,
+        _mm_roundscale_ph(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC),
+        _mm256_round_ps(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+    DRJIT_HALF_UNARY(round,
+        _mm_roundscale_ph(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+        _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+    DRJIT_HALF_UNARY(trunc,
+        _mm_roundscale_ph(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC),
+        _mm256_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+
+    // Single precision division/square roots are exact after rounding
+    DRJIT_HALF_UNARY(rcp, _mm_div_ph(_mm_set1_ph((_Float16) 1.f), x),
+                          _mm256_div_ps(_mm256_set1_ps(1.f), x))
+    DRJIT_HALF_UNARY(rsqrt,
+        _mm_div_ph(_mm_set1_ph((_Float16) 1.f), _mm_sqrt_ph(x)),
+        _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(x)))
+
+    #undef DRJIT_HALF_UNARY
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived select_(const Mask &m, Ref t, Ref f) {
+        #if !defined(DRJIT_X86_AVX512)
+            return _mm_blendv_epi8(f.m, t.m, m.m);
+        #else
+            return _mm_mask_blend_epi16(m.k, f.m, t.m);
+        #endif
+    }
+
+#if defined(DRJIT_X86_AVX512FP16)
+    #define DRJIT_HALF_FMA(name)                                             \
+        DRJIT_INLINE Derived name##_(Ref b, Ref c) const {                   \
+            return _mm_castph_si128(_mm_##name##_ph(_mm_castsi128_ph(m),     \
+                _mm_castsi128_ph(b.m), _mm_castsi128_ph(c.m)));              \
+        }
+#elif defined(DRJIT_X86_FMA)
+    #define DRJIT_HALF_FMA(name)                                             \
+        DRJIT_INLINE Derived name##_(Ref b, Ref c) const {                   \
+            return detail::cvtps_ph(_mm256_##name##_ps(detail::cvtph_ps(m),  \
+                detail::cvtph_ps(b.m), detail::cvtph_ps(c.m)));              \
+        }
+#endif
+
+#if defined(DRJIT_HALF_FMA)
+    DRJIT_HALF_FMA(fmadd)
+    DRJIT_HALF_FMA(fmsub)
+    DRJIT_HALF_FMA(fnmadd)
+    DRJIT_HALF_FMA(fnmsub)
+    #undef DRJIT_HALF_FMA
+#endif
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Horizontal operations
+    // -----------------------------------------------------------------------
+
+    /// Horizontal reductions accumulate in single precision
+    using Float32 = Array<float, 8>;
+
+    DRJIT_INLINE Value sum_()  const { return Value(sum(Float32(detail::cvtph_ps(m)))); }
+    DRJIT_INLINE Value prod_() const { return Value(prod(Float32(detail::cvtph_ps(m)))); }
+    DRJIT_INLINE Value min_()  const { return Value(min(Float32(detail::cvtph_ps(m)))); }
+    DRJIT_INLINE Value max_()  const { return Value(max(Float32(detail::cvtph_ps(m)))); }
+
+    DRJIT_INLINE Value dot_(Ref a) const {
+        return Value(sum(Float32(_mm256_mul_ps(detail::cvtph_ps(m),
+                                               detail::cvtph_ps(a.m)))));
+    }
+
+    DRJIT_INLINE uint32_t bitmask_() const {
+        return (uint32_t) _mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128()));
+    }
+
+    DRJIT_INLINE bool all_() const { return bitmask_() == 0xFF; }
+    DRJIT_INLINE bool any_() const { return bitmask_() != 0; }
+    DRJIT_INLINE size_t count_() const { return (size_t) _mm_popcnt_u32(bitmask_()); }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Initialization, loading/writing data
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE void store_aligned_(void *ptr) const {
+        _mm_store_si128((__m128i *) DRJIT_ASSUME_ALIGNED(ptr, 16), m);
+    }
+
+    DRJIT_INLINE void store_(void *ptr) const {
+        _mm_storeu_si128((__m128i *) ptr, m);
+    }
+
+    static DRJIT_INLINE Derived load_aligned_(const void *ptr, size_t) {
+        return _mm_load_si128((const __m128i *) DRJIT_ASSUME_ALIGNED(ptr, 16));
+    }
+
+    static DRJIT_INLINE Derived load_(const void *ptr, size_t) {
+        return _mm_loadu_si128((const __m128i *) ptr);
+    }
+
+    static DRJIT_INLINE Derived empty_(size_t) { return _mm_undefined_si128(); }
+    static DRJIT_INLINE Derived zero_(size_t) { return _mm_setzero_si128(); }
+
+    //! @}
+    // -----------------------------------------------------------------------
+} DRJIT_MAY_ALIAS;
+#endif
+
 #if defined(DRJIT_X86_AVX512)
 template <typename Derived_>
 DRJIT_DECLARE_KMASK(float, 8, Derived_, int)
@@ -910,6 +1328,10 @@ template <typename Derived_>
 DRJIT_DECLARE_KMASK(double, 4, Derived_, int)
 template <typename Derived_>
 DRJIT_DECLARE_KMASK(double, 3, Derived_, int)
+#  if defined(DRJIT_X86_F16C)
+template <typename Derived_>
+DRJIT_DECLARE_KMASK(half, 8, Derived_, int)
+#  endif
 #endif
 
 NAMESPACE_END(drjit)
@@ -429,6 +429,33 @@ template <typename Value_, bool IsMask_, typename Derived_> struct alignas(32)
         #endif
     }
 
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        #if defined(DRJIT_X86_AVX512)
+            _mm256_mask_compressstoreu_epi32(ptr, mask.k, m);
+            return (size_t) _mm_popcnt_u32((unsigned int) mask.k);
+        #else
+            unsigned int k = (unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(mask.m));
+            size_t count = (size_t) _mm_popcnt_u32(k);
+            _mm256_maskstore_epi32((int *) ptr, detail::prefix_mask(count),
+                                   _mm256_permutevar8x32_epi32(m, detail::compress_perm<false>(k)));
+            return count;
+        #endif
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        #if defined(DRJIT_X86_AVX512)
+            return _mm256_maskz_expandloadu_epi32(mask.k, ptr);
+        #else
+            unsigned int k = (unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(mask.m));
+            __m256i value = _mm256_maskload_epi32(
+                (const int *) ptr, detail::prefix_mask((size_t) _mm_popcnt_u32(k)));
+            return _mm256_and_si256(
+                _mm256_permutevar8x32_epi32(value, detail::compress_perm<true>(k)), mask.m);
+        #endif
+    }
+
 
     //! @}
     // -----------------------------------------------------------------------
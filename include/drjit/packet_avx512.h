@@ -43,8 +43,9 @@ template <bool IsMask_, typename Derived_> struct alignas(64)
     //! @{ \name Type converting constructors
     // -----------------------------------------------------------------------
 
-    // DRJIT_CONVERT(half)
-    //     : m(_mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *) a.derived().data()))) { }
+#if defined(DRJIT_X86_F16C)
+    DRJIT_CONVERT(half) : m(detail::cvtph_ps(a.derived().m)) { }
+#endif
 
     DRJIT_CONVERT(float) : m(a.derived().m) { }
 
@@ -190,6 +191,15 @@ template <bool IsMask_, typename Derived_> struct alignas(64)
     DRJIT_INLINE Derived fmsub_   (Ref b, Ref c) const { return _mm512_fmsub_ps   (m, b.m, c.m); }
     DRJIT_INLINE Derived fnmadd_  (Ref b, Ref c) const { return _mm512_fnmadd_ps  (m, b.m, c.m); }
     DRJIT_INLINE Derived fnmsub_  (Ref b, Ref c) const { return _mm512_fnmsub_ps  (m, b.m, c.m); }
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const { return _mm512_fmaddsub_ps(m, b.m, c.m); }
+
+    /// Product of interleaved complex numbers (re0, im0, re1, im1, ..)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        __m512 b_re = _mm512_moveldup_ps(b.m),
+               b_im = _mm512_movehdup_ps(b.m),
+               a_sw = _mm512_permute_ps(m, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm512_fmaddsub_ps(m, b_re, _mm512_mul_ps(a_sw, b_im));
+    }
 
     template <typename Mask>
     static DRJIT_INLINE Derived select_(const Mask &m, Ref t, Ref f) {
@@ -294,6 +304,41 @@ template <bool IsMask_, typename Derived_> struct alignas(64)
         }
     }
 
+    template <typename Target, typename Index, typename Mask>
+    DRJIT_INLINE void scatter_reduce_(Target &&target, const Index &index, const Mask &mask,
+                                      ReduceOp op, ReduceMode mode) const {
+        if constexpr (std::is_pointer_v<std::decay_t<Target>> && sizeof(scalar_t<Index>) == 4) {
+            auto reduce = [&](auto combine) {
+                __m512 value = m;
+                if (mode != ReduceMode::NoConflicts)
+                    value = detail::reduce_conflicts(index.m, mask.k, value, combine);
+                __m512 prev = gather_(target, index, mask, mode).m;
+                _mm512_mask_i32scatter_ps(target, mask.k, index.m, combine(prev, value), 4);
+            };
+
+            switch (op) {
+                case ReduceOp::Add: reduce([](__m512 a, __m512 b) { return _mm512_add_ps(a, b); }); return;
+                case ReduceOp::Mul: reduce([](__m512 a, __m512 b) { return _mm512_mul_ps(a, b); }); return;
+                case ReduceOp::Min: reduce([](__m512 a, __m512 b) { return _mm512_min_ps(a, b); }); return;
+                case ReduceOp::Max: reduce([](__m512 a, __m512 b) { return _mm512_max_ps(a, b); }); return;
+                default: break;
+            }
+        }
+
+        Base::scatter_reduce_(target, index, mask, op, mode);
+    }
+
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        _mm512_mask_compressstoreu_ps(ptr, mask.k, m);
+        return (size_t) _mm_popcnt_u32((unsigned int) mask.k);
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        return _mm512_maskz_expandloadu_ps(mask.k, ptr);
+    }
+
     //! @}
     // -----------------------------------------------------------------------
 } DRJIT_MAY_ALIAS;
@@ -320,9 +365,10 @@ template <bool IsMask_, typename Derived_> struct alignas(64)
     //! @{ \name Type converting constructors
     // -----------------------------------------------------------------------
 
-    // DRJIT_CONVERT(half)
-    //     : m(_mm512_cvtps_pd(
-    //           _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *) a.derived().data())))) { }
+#if defined(DRJIT_X86_F16C)
+    DRJIT_CONVERT(half)
+        : m(_mm512_cvtps_pd(detail::cvtph_ps(a.derived().m))) { }
+#endif
 
     DRJIT_CONVERT(float) : m(_mm512_cvtps_pd(a.derived().m)) { }
 
@@ -457,6 +503,15 @@ template <bool IsMask_, typename Derived_> struct alignas(64)
     DRJIT_INLINE Derived fmsub_   (Ref b, Ref c) const { return _mm512_fmsub_pd   (m, b.m, c.m); }
     DRJIT_INLINE Derived fnmadd_  (Ref b, Ref c) const { return _mm512_fnmadd_pd  (m, b.m, c.m); }
     DRJIT_INLINE Derived fnmsub_  (Ref b, Ref c) const { return _mm512_fnmsub_pd  (m, b.m, c.m); }
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const { return _mm512_fmaddsub_pd(m, b.m, c.m); }
+
+    /// Product of interleaved complex numbers (re0, im0, re1, im1, ..)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        __m512d b_re = _mm512_movedup_pd(b.m),
+                b_im = _mm512_permute_pd(b.m, 0xFF),
+                a_sw = _mm512_permute_pd(m, 0x55);
+        return _mm512_fmaddsub_pd(m, b_re, _mm512_mul_pd(a_sw, b_im));
+    }
 
     template <typename Mask>
     static DRJIT_INLINE Derived select_(const Mask &m, Ref t, Ref f) {
@@ -560,6 +615,47 @@ template <bool IsMask_, typename Derived_> struct alignas(64)
             _mm512_mask_i64scatter_pd(ptr, mask.k, index.m, m, 8);
     }
 
+    template <typename Target, typename Index, typename Mask>
+    DRJIT_INLINE void scatter_reduce_(Target &&target, const Index &index, const Mask &mask,
+                                      ReduceOp op, ReduceMode mode) const {
+        if constexpr (std::is_pointer_v<std::decay_t<Target>>) {
+            auto reduce = [&](auto combine) {
+                __m512d value = m;
+                if (mode != ReduceMode::NoConflicts) {
+                    __m512i index64;
+                    if constexpr (sizeof(scalar_t<Index>) == 4)
+                        index64 = _mm512_cvtepu32_epi64(index.m);
+                    else
+                        index64 = index.m;
+                    value = detail::reduce_conflicts(index64, mask.k, value, combine);
+                }
+                Derived result = combine(gather_(target, index, mask, mode).m, value);
+                result.scatter_(target, index, mask, mode);
+            };
+
+            switch (op) {
+                case ReduceOp::Add: reduce([](__m512d a, __m512d b) { return _mm512_add_pd(a, b); }); return;
+                case ReduceOp::Mul: reduce([](__m512d a, __m512d b) { return _mm512_mul_pd(a, b); }); return;
+                case ReduceOp::Min: reduce([](__m512d a, __m512d b) { return _mm512_min_pd(a, b); }); return;
+                case ReduceOp::Max: reduce([](__m512d a, __m512d b) { return _mm512_max_pd(a, b); }); return;
+                default: break;
+            }
+        }
+
+        Base::scatter_reduce_(target, index, mask, op, mode);
+    }
+
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        _mm512_mask_compressstoreu_pd(ptr, mask.k, m);
+        return (size_t) _mm_popcnt_u32((unsigned int) mask.k);
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        return _mm512_maskz_expandloadu_pd(mask.k, ptr);
+    }
+
     //! @}
     // -----------------------------------------------------------------------
 } DRJIT_MAY_ALIAS;
@@ -817,6 +913,53 @@ template <typename Value_, bool IsMask_, typename Derived_> struct alignas(64)
         }
     }
 
+    template <typename Target, typename Index, typename Mask>
+    DRJIT_INLINE void scatter_reduce_(Target &&target, const Index &index, const Mask &mask,
+                                      ReduceOp op, ReduceMode mode) const {
+        if constexpr (std::is_pointer_v<std::decay_t<Target>> && sizeof(scalar_t<Index>) == 4) {
+            auto reduce = [&](auto combine) {
+                __m512i value = m;
+                if (mode != ReduceMode::NoConflicts)
+                    value = detail::reduce_conflicts(index.m, mask.k, value, combine);
+                __m512i prev = gather_(target, index, mask, mode).m;
+                _mm512_mask_i32scatter_epi32(target, mask.k, index.m, combine(prev, value), 4);
+            };
+
+            switch (op) {
+                case ReduceOp::Add: reduce([](__m512i a, __m512i b) { return _mm512_add_epi32(a, b); }); return;
+                case ReduceOp::Mul: reduce([](__m512i a, __m512i b) { return _mm512_mullo_epi32(a, b); }); return;
+                case ReduceOp::And: reduce([](__m512i a, __m512i b) { return _mm512_and_si512(a, b); }); return;
+                case ReduceOp::Or:  reduce([](__m512i a, __m512i b) { return _mm512_or_si512(a, b); }); return;
+                case ReduceOp::Min:
+                    if constexpr (std::is_signed_v<Value>)
+                        reduce([](__m512i a, __m512i b) { return _mm512_min_epi32(a, b); });
+                    else
+                        reduce([](__m512i a, __m512i b) { return _mm512_min_epu32(a, b); });
+                    return;
+                case ReduceOp::Max:
+                    if constexpr (std::is_signed_v<Value>)
+                        reduce([](__m512i a, __m512i b) { return _mm512_max_epi32(a, b); });
+                    else
+                        reduce([](__m512i a, __m512i b) { return _mm512_max_epu32(a, b); });
+                    return;
+                default: break;
+            }
+        }
+
+        Base::scatter_reduce_(target, index, mask, op, mode);
+    }
+
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        _mm512_mask_compressstoreu_epi32(ptr, mask.k, m);
+        return (size_t) _mm_popcnt_u32((unsigned int) mask.k);
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        return _mm512_maskz_expandloadu_epi32(mask.k, ptr);
+    }
+
     template <typename Mask>
     DRJIT_INLINE Value extract_(const Mask &mask) const {
         return (Value) _mm_cvtsi128_si32(_mm512_castsi512_si128(_mm512_maskz_compress_epi32(mask.k, m)));
@@ -1085,6 +1228,59 @@ template <typename Value_, bool IsMask_, typename Derived_> struct alignas(64)
             _mm512_mask_i64scatter_epi64(ptr, mask.k, index.m, m, 8);
     }
 
+    template <typename Target, typename Index, typename Mask>
+    DRJIT_INLINE void scatter_reduce_(Target &&target, const Index &index, const Mask &mask,
+                                      ReduceOp op, ReduceMode mode) const {
+        if constexpr (std::is_pointer_v<std::decay_t<Target>>) {
+            auto reduce = [&](auto combine) {
+                __m512i value = m;
+                if (mode != ReduceMode::NoConflicts) {
+                    __m512i index64;
+                    if constexpr (sizeof(scalar_t<Index>) == 4)
+                        index64 = _mm512_cvtepu32_epi64(index.m);
+                    else
+                        index64 = index.m;
+                    value = detail::reduce_conflicts(index64, mask.k, value, combine);
+                }
+                Derived result = combine(gather_(target, index, mask, mode).m, value);
+                result.scatter_(target, index, mask, mode);
+            };
+
+            switch (op) {
+                case ReduceOp::Add: reduce([](__m512i a, __m512i b) { return _mm512_add_epi64(a, b); }); return;
+                case ReduceOp::Mul: reduce([](__m512i a, __m512i b) { return _mm512_mullo_epi64(a, b); }); return;
+                case ReduceOp::And: reduce([](__m512i a, __m512i b) { return _mm512_and_si512(a, b); }); return;
+                case ReduceOp::Or:  reduce([](__m512i a, __m512i b) { return _mm512_or_si512(a, b); }); return;
+                case ReduceOp::Min:
+                    if constexpr (std::is_signed_v<Value>)
+                        reduce([](__m512i a, __m512i b) { return _mm512_min_epi64(a, b); });
+                    else
+                        reduce([](__m512i a, __m512i b) { return _mm512_min_epu64(a, b); });
+                    return;
+                case ReduceOp::Max:
+                    if constexpr (std::is_signed_v<Value>)
+                        reduce([](__m512i a, __m512i b) { return _mm512_max_epi64(a, b); });
+                    else
+                        reduce([](__m512i a, __m512i b) { return _mm512_max_epu64(a, b); });
+                    return;
+                default: break;
+            }
+        }
+
+        Base::scatter_reduce_(target, index, mask, op, mode);
+    }
+
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        _mm512_mask_compressstoreu_epi64(ptr, mask.k, m);
+        return (size_t) _mm_popcnt_u32((unsigned int) mask.k);
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        return _mm512_maskz_expandloadu_epi64(mask.k, ptr);
+    }
+
     template <typename Mask>
     DRJIT_INLINE Value extract_(const Mask &mask) const {
         return (Value) _mm_cvtsi128_si64(_mm512_castsi512_si128(_mm512_maskz_compress_epi64(mask.k, m)));
@@ -1094,6 +1290,270 @@ template <typename Value_, bool IsMask_, typename Derived_> struct alignas(64)
     // -----------------------------------------------------------------------
 } DRJIT_MAY_ALIAS;
 
+#if defined(DRJIT_X86_F16C)
+DRJIT_PACKET_DECLARE_HALF(16)
+
+/**
+ * \brief Partial overload of StaticArrayImpl for half precision values
+ *
+ * Analogous to the 8-wide AVX version: arithmetic is native on processors
+ * with AVX512-FP16, and otherwise takes place in single precision followed by
+ * rounding.
+ */
+template <bool IsMask_, typename Derived_> struct alignas(32)
+    StaticArrayImpl<half, 16, IsMask_, Derived_>
+  : StaticArrayBase<half, 16, IsMask_, Derived_> {
+
+    DRJIT_PACKET_TYPE(half, 16, __m256i)
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Value constructors
+    // -----------------------------------------------------------------------
+
+    template <typename T, enable_if_scalar_t<T> = 0>
+    DRJIT_INLINE StaticArrayImpl(T value)
+        : m(_mm256_set1_epi16(memcpy_cast<int16_t>((Value) value))) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Type converting constructors
+    // -----------------------------------------------------------------------
+
+    DRJIT_CONVERT(half) : m(a.derived().m) { }
+    DRJIT_CONVERT(float) : m(detail::cvtps_ph(a.derived().m)) { }
+    DRJIT_CONVERT(double)
+        : m(detail::cvtps_ph(detail::concat(_mm512_cvtpd_ps(low(a).m),
+                                            _mm512_cvtpd_ps(high(a).m)))) { }
+    DRJIT_CONVERT(int32_t)
+        : m(detail::cvtps_ph(_mm512_cvtepi32_ps(a.derived().m))) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Reinterpreting constructors
+    // -----------------------------------------------------------------------
+
+    DRJIT_REINTERPRET(half) : m(a.derived().m) { }
+
+    DRJIT_REINTERPRET(int16_t)
+        : m(_mm256_loadu_si256((const __m256i *) a.derived().data())) { }
+    DRJIT_REINTERPRET(uint16_t)
+        : m(_mm256_loadu_si256((const __m256i *) a.derived().data())) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Converting from/to half size vectors
+    // -----------------------------------------------------------------------
+
+    StaticArrayImpl(const Array1 &a1, const Array2 &a2)
+        : m(detail::concat(a1.m, a2.m)) { }
+
+    DRJIT_INLINE Array1 low_()  const { return _mm256_castsi256_si128(m); }
+    DRJIT_INLINE Array2 high_() const { return _mm256_extracti128_si256(m, 1); }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Vertical operations
+    // -----------------------------------------------------------------------
+
+#if defined(DRJIT_X86_AVX512FP16)
+    #define DRJIT_HALF_OP(name, op, a, b)                                    \
+        DRJIT_INLINE Derived name##_(Ref arg) const {                        \
+            return _mm256_castph_si256(_mm256_##op##_ph(                     \
+                _mm256_castsi256_ph(a), _mm256_castsi256_ph(b)));            \
+        }
+#else
+    #define DRJIT_HALF_OP(name, op, a, b)                                    \
+        DRJIT_INLINE Derived name##_(Ref arg) const {                        \
+            return detail::cvtps_ph(                                         \
+                _mm512_##op##_ps(detail::cvtph_ps(a), detail::cvtph_ps(b))); \
+        }
+#endif
+
+    DRJIT_HALF_OP(add, add, m, arg.m)
+    DRJIT_HALF_OP(sub, sub, m, arg.m)
+    DRJIT_HALF_OP(mul, mul, m, arg.m)
+    DRJIT_HALF_OP(div, div, m, arg.m)
+    DRJIT_HALF_OP(minimum, min, arg.m, m)
+    DRJIT_HALF_OP(maximum, max, arg.m, m)
+
+    #undef DRJIT_HALF_OP
+
+    DRJIT_INLINE Derived not_() const {
+        return _mm256_ternarylogic_epi32(m, m, m, 0b01010101);
+    }
+
+    DRJIT_INLINE Derived neg_() const {
+        return _mm256_xor_si256(m, _mm256_set1_epi16((int16_t) 0x8000));
+    }
+
+    DRJIT_INLINE Derived abs_() const {
+        return _mm256_and_si256(m, _mm256_set1_epi16((int16_t) 0x7FFF));
+    }
+
+    /// Return the bit pattern of a mask or a regular array
+    template <typename T> static DRJIT_INLINE __m256i bits_(const T &a) {
+        if constexpr (is_mask_v<T>)
+            return _mm256_movm_epi16(a.k);
+        else
+            return a.m;
+    }
+
+    template <typename T> DRJIT_INLINE Derived or_(const T &a) const {
+        return _mm256_or_si256(m, bits_(a));
+    }
+
+    template <typename T> DRJIT_INLINE Derived and_(const T &a) const {
+        return _mm256_and_si256(m, bits_(a));
+    }
+
+    template <typename T> DRJIT_INLINE Derived andnot_(const T &a) const {
+        return _mm256_andnot_si256(bits_(a), m);
+    }
+
+    template <typename T> DRJIT_INLINE Derived xor_(const T &a) const {
+        return _mm256_xor_si256(m, bits_(a));
+    }
+
+    #if defined(DRJIT_X86_AVX512FP16)
+        #define DRJIT_COMP(NAME)                                             \
+            mask_t<Derived>::from_k(_mm256_cmp_ph_mask(                      \
+                _mm256_castsi256_ph(m), _mm256_castsi256_ph(a.m), _CMP_##NAME))
+    #else
+        #define DRJIT_COMP(NAME)                                             \
+            mask_t<Derived>::from_k(_mm512_cmp_ps_mask(                      \
+                detail::cvtph_ps(m), detail::cvtph_ps(a.m), _CMP_##NAME))
+    #endif
+
+    DRJIT_INLINE auto lt_ (Ref a) const { return DRJIT_COMP(LT_OQ);  }
+    DRJIT_INLINE auto gt_ (Ref a) const { return DRJIT_COMP(GT_OQ);  }
+    DRJIT_INLINE auto le_ (Ref a) const { return DRJIT_COMP(LE_OQ);  }
+    DRJIT_INLINE auto ge_ (Ref a) const { return DRJIT_COMP(GE_OQ);  }
+    DRJIT_INLINE auto eq_ (Ref a) const { return DRJIT_COMP(EQ_OQ);  }
+    DRJIT_INLINE auto neq_(Ref a) const { return DRJIT_COMP(NEQ_UQ); }
+
+    #undef DRJIT_COMP
+
+#if defined(DRJIT_X86_AVX512FP16)
+    #define DRJIT_HALF_UNARY(name, expr_ph, expr_ps)                         \
+        DRJIT_INLINE Derived name##_() const {                               \
+            __m256h x = _mm256_castsi256_ph(m);                              \
+            return _mm256_castph_si256(expr_ph);                             \
+        }
+#else
+    #define DRJIT_HALF_UNARY(name, expr_ph, expr_ps)                         \
+        DRJIT_INLINE Derived name##_() const {                               \
+            __m512 x = detail::cvtph_ps(m);                                  \
+            return detail::cvtps_ph(expr_ps);                                \
+        }
+#endif
+
+    DRJIT_HALF_UNARY(sqrt, _mm256_sqrt_ph(x), _mm512_sqrt_ps(x))
+    DRJIT_HALF_UNARY(floor, _mm256_roundscale_ph(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC),
+                            _mm512_floor_ps(x))
+    DRJIT_HALF_UNARY(ceil, _mm256_roundscale_ph(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC),
+                           _mm512_ceil_ps(x))
+    DRJIT_HALF_UNARY(round,
+        _mm256_roundscale_ph(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+        _mm512_roundscale_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+    DRJIT_HALF_UNARY(trunc,
+        _mm256_roundscale_ph(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC),
+        _mm512_roundscale_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+
+    // Single precision division/square roots are exact after rounding
+    DRJIT_HALF_UNARY(rcp, _mm256_div_ph(_mm256_set1_ph((_Float16) 1.f), x),
+                          _mm512_div_ps(_mm512_set1_ps(1.f), x))
+    DRJIT_HALF_UNARY(rsqrt,
+        _mm256_div_ph(_mm256_set1_ph((_Float16) 1.f), _mm256_sqrt_ph(x)),
+        _mm512_div_ps(_mm512_set1_ps(1.f), _mm512_sqrt_ps(x)))
+
+    #undef DRJIT_HALF_UNARY
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived select_(const Mask &m, Ref t, Ref f) {
+        return _mm256_mask_blend_epi16(m.k, f.m, t.m);
+    }
+
+#if defined(DRJIT_X86_AVX512FP16)
+    #define DRJIT_HALF_FMA(name)                                             \
+        DRJIT_INLINE Derived name##_(Ref b, Ref c) const {                   \
+            return _mm256_castph_si256(_mm256_##name##_ph(                   \
+                _mm256_castsi256_ph(m), _mm256_castsi256_ph(b.m),            \
+                _mm256_castsi256_ph(c.m)));                                  \
+        }
+#else
+    #define DRJIT_HALF_FMA(name)                                             \
+        DRJIT_INLINE Derived name##_(Ref b, Ref c) const {                   \
+            return detail::cvtps_ph(_mm512_##name##_ps(detail::cvtph_ps(m),  \
+                detail::cvtph_ps(b.m), detail::cvtph_ps(c.m)));              \
+        }
+#endif
+
+    DRJIT_HALF_FMA(fmadd)
+    DRJIT_HALF_FMA(fmsub)
+    DRJIT_HALF_FMA(fnmadd)
+    DRJIT_HALF_FMA(fnmsub)
+
+    #undef DRJIT_HALF_FMA
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Horizontal operations
+    // -----------------------------------------------------------------------
+
+    /// Horizontal reductions accumulate in single precision
+    using Float32 = Array<float, 16>;
+
+    DRJIT_INLINE Value sum_()  const { return Value(sum(Float32(detail::cvtph_ps(m)))); }
+    DRJIT_INLINE Value prod_() const { return Value(prod(Float32(detail::cvtph_ps(m)))); }
+    DRJIT_INLINE Value min_()  const { return Value(min(Float32(detail::cvtph_ps(m)))); }
+    DRJIT_INLINE Value max_()  const { return Value(max(Float32(detail::cvtph_ps(m)))); }
+
+    DRJIT_INLINE Value dot_(Ref a) const {
+        return Value(sum(Float32(_mm512_mul_ps(detail::cvtph_ps(m),
+                                               detail::cvtph_ps(a.m)))));
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Initialization, loading/writing data
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE void store_aligned_(void *ptr) const {
+        _mm256_store_si256((__m256i *) DRJIT_ASSUME_ALIGNED(ptr, 32), m);
+    }
+
+    DRJIT_INLINE void store_(void *ptr) const {
+        _mm256_storeu_si256((__m256i *) ptr, m);
+    }
+
+    static DRJIT_INLINE Derived load_aligned_(const void *ptr, size_t) {
+        return _mm256_load_si256((const __m256i *) DRJIT_ASSUME_ALIGNED(ptr, 32));
+    }
+
+    static DRJIT_INLINE Derived load_(const void *ptr, size_t) {
+        return _mm256_loadu_si256((const __m256i *) ptr);
+    }
+
+    static DRJIT_INLINE Derived empty_(size_t) { return _mm256_undefined_si256(); }
+    static DRJIT_INLINE Derived zero_(size_t) { return _mm256_setzero_si256(); }
+
+    //! @}
+    // -----------------------------------------------------------------------
+} DRJIT_MAY_ALIAS;
+#endif
+
 DRJIT_INLINE float ldexp(float a1, float a2) {
     return _mm_cvtss_f32(_mm_scalef_ss(_mm_set_ss(a1), _mm_set_ss(a2)));
 }
@@ -1122,6 +1582,10 @@ template <typename Derived_>
 DRJIT_DECLARE_KMASK(float, 16, Derived_, int)
 template <typename Derived_>
 DRJIT_DECLARE_KMASK(double, 8, Derived_, int)
+#if defined(DRJIT_X86_F16C)
+template <typename Derived_>
+DRJIT_DECLARE_KMASK(half, 16, Derived_, int)
+#endif
 template <typename Value_, typename Derived_>
 DRJIT_DECLARE_KMASK(Value_, 16, Derived_, enable_if_int32_t<Value_>)
 template <typename Value_, typename Derived_>
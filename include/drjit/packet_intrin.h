@@ -91,12 +91,24 @@
     static constexpr bool has_avx512 = false;
 #endif
 
+#if defined(DRJIT_X86_AVX512FP16)
+    static constexpr bool has_avx512fp16 = true;
+#else
+    static constexpr bool has_avx512fp16 = false;
+#endif
+
 #if defined(DRJIT_ARM_NEON)
     static constexpr bool has_neon = true;
 #else
     static constexpr bool has_neon = false;
 #endif
 
+#if defined(DRJIT_ARM_FP16)
+    static constexpr bool has_arm_fp16 = true;
+#else
+    static constexpr bool has_arm_fp16 = false;
+#endif
+
 static constexpr bool has_x86 = has_x86_32 || has_x86_64;
 static constexpr bool has_arm = has_arm_32 || has_arm_64;
 static constexpr bool has_vectorization = has_sse42 || has_neon;
@@ -125,7 +137,24 @@ DRJIT_INLINE __m256i concat(__m128i l, __m128i h) {
 }
 #endif
 
+#if defined(DRJIT_X86_F16C)
+/// Convert half precision packets to single precision and back
+DRJIT_INLINE __m256 cvtph_ps(__m128i a) { return _mm256_cvtph_ps(a); }
+
+DRJIT_INLINE __m128i cvtps_ph(__m256 a) {
+    return _mm256_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+#endif
+
 #if defined(DRJIT_X86_AVX512)
+#if defined(DRJIT_X86_F16C)
+DRJIT_INLINE __m512 cvtph_ps(__m256i a) { return _mm512_cvtph_ps(a); }
+
+DRJIT_INLINE __m256i cvtps_ph(__m512 a) {
+    return _mm512_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+#endif
+
 DRJIT_INLINE __m512 concat(__m256 l, __m256 h) {
     return _mm512_insertf32x8(_mm512_castps256_ps512(l), h, 1);
 }
@@ -253,6 +282,138 @@ template <typename T> DRJIT_INLINE T tzcnt(T v) {
 }
 #endif
 
+/**
+ * \brief Lookup table mapping an N-bit lane mask to the lane permutation of a
+ * compress (``Expand=false``) or expand (``Expand=true``) operation.
+ *
+ * Entry ``k`` packs one 4-bit source lane index per output lane. Used by the
+ * AVX2/NEON backends, which lack native compress/expand instructions.
+ */
+template <size_t N, bool Expand> struct compress_lut {
+    uint32_t perm[1 << N];
+
+    constexpr compress_lut() : perm() {
+        for (uint32_t k = 0; k < (1u << N); ++k) {
+            uint32_t value = 0, j = 0;
+            for (uint32_t i = 0; i < N; ++i) {
+                if (!(k & (1u << i)))
+                    continue;
+                if constexpr (Expand)
+                    value |= j << (4 * i);
+                else
+                    value |= i << (4 * j);
+                j++;
+            }
+            perm[k] = value;
+        }
+    }
+};
+
+template <size_t N, bool Expand>
+inline constexpr compress_lut<N, Expand> compress_lut_v { };
+
+#if defined(DRJIT_X86_AVX2)
+/// Lane indices of a compress/expand permutation for 8-lane packets
+template <bool Expand> DRJIT_INLINE __m256i compress_perm(unsigned int k) {
+    return _mm256_srlv_epi32(
+        _mm256_set1_epi32((int) compress_lut_v<8, Expand>.perm[k]),
+        _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+}
+
+/// Mask selecting the first 'count' lanes of an 8-lane packet
+DRJIT_INLINE __m256i prefix_mask(size_t count) {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32((int) count),
+                              _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+#endif
+
+#if defined(DRJIT_X86_AVX512)
+/// Combine the active lanes ``k`` of ``v`` with the lanes referenced by ``perm``
+template <typename Combine>
+DRJIT_INLINE __m512 combine_prev(__m512 v, __mmask16 k, __m512i perm, Combine c) {
+    return _mm512_mask_mov_ps(v, k, c(v, _mm512_mask_permutexvar_ps(v, k, perm, v)));
+}
+
+template <typename Combine>
+DRJIT_INLINE __m512i combine_prev(__m512i v, __mmask16 k, __m512i perm, Combine c) {
+    return _mm512_mask_mov_epi32(v, k, c(v, _mm512_mask_permutexvar_epi32(v, k, perm, v)));
+}
+
+template <typename Combine>
+DRJIT_INLINE __m512d combine_prev(__m512d v, __mmask8 k, __m512i perm, Combine c) {
+    return _mm512_mask_mov_pd(v, k, c(v, _mm512_mask_permutexvar_pd(v, k, perm, v)));
+}
+
+template <typename Combine>
+DRJIT_INLINE __m512i combine_prev(__m512i v, __mmask8 k, __m512i perm, Combine c) {
+    return _mm512_mask_mov_epi64(v, k, c(v, _mm512_mask_permutexvar_epi64(v, k, perm, v)));
+}
+
+/**
+ * \brief Combine the values of lanes that scatter to the same address
+ *
+ * The AVX512CD conflict detection instruction links every active lane to the
+ * closest preceding active lane with the same index. Pointer jumping along
+ * these chains then computes a running reduction using ``combine``, after
+ * which the last lane of each chain holds the combined value of all lanes
+ * sharing its index. AVX512 scatters to overlapping addresses take effect in
+ * lane order, hence a subsequent gather-combine-scatter sequence is correct
+ * even in the presence of duplicate indices.
+ *
+ * This overload handles 16 lanes with 32 bit indices and values.
+ */
+template <typename Vector, typename Combine>
+DRJIT_INLINE Vector reduce_conflicts(__m512i index, __mmask16 k, Vector value,
+                                     Combine combine) {
+    __m512i conflicts = _mm512_and_si512(_mm512_conflict_epi32(index),
+                                         _mm512_broadcastmw_epi32(k)),
+            perm = _mm512_sub_epi32(_mm512_set1_epi32(31),
+                                    _mm512_lzcnt_epi32(conflicts));
+    __mmask16 todo = _mm512_mask_test_epi32_mask(k, conflicts, conflicts);
+
+    while (todo) {
+        value = combine_prev(value, todo, perm, combine);
+        perm = _mm512_mask_permutexvar_epi32(perm, todo, perm, perm);
+        todo = _mm512_mask_cmpneq_epi32_mask(todo, perm, _mm512_set1_epi32(-1));
+    }
+
+    return value;
+}
+
+/// Combine the values of lanes that scatter to the same address (8 lanes, 64 bit)
+template <typename Vector, typename Combine>
+DRJIT_INLINE Vector reduce_conflicts(__m512i index, __mmask8 k, Vector value,
+                                     Combine combine) {
+    __m512i conflicts = _mm512_and_si512(_mm512_conflict_epi64(index),
+                                         _mm512_broadcastmb_epi64(k)),
+            perm = _mm512_sub_epi64(_mm512_set1_epi64(63),
+                                    _mm512_lzcnt_epi64(conflicts));
+    __mmask8 todo = _mm512_mask_test_epi64_mask(k, conflicts, conflicts);
+
+    while (todo) {
+        value = combine_prev(value, todo, perm, combine);
+        perm = _mm512_mask_permutexvar_epi64(perm, todo, perm, perm);
+        todo = _mm512_mask_cmpneq_epi64_mask(todo, perm, _mm512_set1_epi64(-1));
+    }
+
+    return value;
+}
+#endif
+
+#if defined(DRJIT_ARM_NEON) && defined(DRJIT_ARM_64)
+/// Byte shuffle (for vqtbl1q_u8) of a compress/expand permutation for 4-lane packets
+template <bool Expand> DRJIT_INLINE uint8x16_t compress_perm(uint32x4_t mask) {
+    const uint32x4_t bits = { 1, 2, 4, 8 };
+    const int32x4_t shift = { 0, -4, -8, -12 };
+    uint32_t k = vaddvq_u32(vandq_u32(mask, bits));
+    uint32x4_t lane = vandq_u32(
+        vshlq_u32(vdupq_n_u32(compress_lut_v<4, Expand>.perm[k]), shift),
+        vdupq_n_u32(15));
+    return vreinterpretq_u8_u32(
+        vmlaq_n_u32(vdupq_n_u32(0x03020100u), lane, 0x04040404u));
+}
+#endif
+
 //! @}
 // -----------------------------------------------------------------------
 
@@ -264,6 +425,14 @@ template <typename T> DRJIT_INLINE T tzcnt(T v) {
         };                                                                     \
     }
 
+#define DRJIT_PACKET_DECLARE_HALF(Size)                                        \
+    namespace detail {                                                         \
+        template <typename Type> struct vectorize_half<Type, Size> {           \
+            static constexpr bool recurse = false;                             \
+            static constexpr bool self = true;                                 \
+        };                                                                     \
+    }
+
 #define DRJIT_PACKET_DECLARE_COND(Size, Cond)                                  \
     namespace detail {                                                         \
         template <typename Type> struct vectorize<Type, Size, Cond> {          \
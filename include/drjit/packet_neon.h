@@ -63,7 +63,10 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
     DRJIT_CONVERT(float) : m(a.derived().m) {}
     DRJIT_CONVERT(int32_t) : m(vcvtq_f32_s32(vreinterpretq_s32_u32(a.derived().m))) {}
     DRJIT_CONVERT(uint32_t) : m(vcvtq_f32_u32(a.derived().m)) {}
-    // DRJIT_CONVERT(half) : m(vcvt_f32_f16(vld1_f16((const __fp16 *)a.data()))) {}
+#if defined(DRJIT_ARM_64)
+    DRJIT_CONVERT(half)
+        : m(vcvt_f32_f16(vld1_f16((const float16_t *) a.derived().data()))) {}
+#endif
 #if defined(DRJIT_ARM_64)
     DRJIT_CONVERT(double) : m(vcvtx_high_f32_f64(vcvtx_f32_f64(low(a).m), high(a).m)) {}
 #endif
@@ -148,6 +151,26 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
     DRJIT_INLINE Derived fnmsub_(Ref b, Ref c) const { return vmlsq_f32(vnegq_f32(c.m), m, b.m); }
 #endif
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        const uint32x4_t sign = { 0x80000000u, 0u, 0x80000000u, 0u };
+        return fmadd_(b, vreinterpretq_f32_u32(
+                             veorq_u32(vreinterpretq_u32_f32(c.m), sign)));
+    }
+
+    /// Product of interleaved complex numbers (re0, im0, re1, im1)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        #if defined(__ARM_FEATURE_COMPLEX)
+            return vcmlaq_rot90_f32(vcmlaq_f32(vdupq_n_f32(0.f), m, b.m), m, b.m);
+        #elif defined(DRJIT_ARM_64)
+            float32x4_t b_re = vtrn1q_f32(b.m, b.m),
+                        b_im = vtrn2q_f32(b.m, b.m),
+                        a_sw = vrev64q_f32(m);
+            return fmaddsub_(b_re, vmulq_f32(a_sw, b_im));
+        #else
+            return Base::complex_mul_(b);
+        #endif
+    }
+
     template <typename T> DRJIT_INLINE Derived or_ (const T &a) const { return vreinterpretq_f32_s32(vorrq_s32(vreinterpretq_s32_f32(m), vreinterpretq_s32_f32(a.m))); }
     template <typename T> DRJIT_INLINE Derived and_(const T &a) const { return vreinterpretq_f32_s32(vandq_s32(vreinterpretq_s32_f32(m), vreinterpretq_s32_f32(a.m))); }
     template <typename T> DRJIT_INLINE Derived andnot_(const T &a) const { return vreinterpretq_f32_s32(vbicq_s32(vreinterpretq_s32_f32(m), vreinterpretq_s32_f32(a.m))); }
@@ -327,6 +350,37 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
 
     static DRJIT_INLINE Derived zero_(size_t) { return vdupq_n_f32(0.f); }
 
+#if defined(DRJIT_ARM_64)
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        if constexpr (Derived::Size == 4) {
+            uint32x4_t mask_u = vreinterpretq_u32_f32(mask.m);
+            size_t count = (size_t) vaddvq_u32(vshrq_n_u32(mask_u, 31));
+            uint8x16_t value = vqtbl1q_u8(vreinterpretq_u8_u32(vreinterpretq_u32_f32(m)),
+                                          detail::compress_perm<false>(mask_u));
+            memcpy(ptr, &value, count * sizeof(Value));
+            return count;
+        } else {
+            return Base::compress_store_(ptr, mask);
+        }
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        if constexpr (Derived::Size == 4) {
+            uint32x4_t mask_u = vreinterpretq_u32_f32(mask.m);
+            size_t count = (size_t) vaddvq_u32(vshrq_n_u32(mask_u, 31));
+            uint32x4_t value = vdupq_n_u32(0);
+            memcpy(&value, ptr, count * sizeof(Value));
+            value = vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(value),
+                                         detail::compress_perm<true>(mask_u)));
+            return vreinterpretq_f32_u32(vandq_u32(value, mask_u));
+        } else {
+            return Base::expand_load_(ptr, mask);
+        }
+    }
+#endif
+
     //! @}
     // -----------------------------------------------------------------------
 } DRJIT_MAY_ALIAS;
@@ -428,6 +482,24 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
     DRJIT_INLINE Derived fnmsub_(Ref b, Ref c) const { return vmlsq_f64(vnegq_f64(c.m), m, b.m); }
 #endif
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        const uint64x2_t sign = { 0x8000000000000000ull, 0ull };
+        return fmadd_(b, vreinterpretq_f64_u64(
+                             veorq_u64(vreinterpretq_u64_f64(c.m), sign)));
+    }
+
+    /// Product of interleaved complex numbers (re, im)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        #if defined(__ARM_FEATURE_COMPLEX)
+            return vcmlaq_rot90_f64(vcmlaq_f64(vdupq_n_f64(0.0), m, b.m), m, b.m);
+        #else
+            float64x2_t b_re = vdupq_laneq_f64(b.m, 0),
+                        b_im = vdupq_laneq_f64(b.m, 1),
+                        a_sw = vextq_f64(m, m, 1);
+            return fmaddsub_(b_re, vmulq_f64(a_sw, b_im));
+        #endif
+    }
+
     template <typename T> DRJIT_INLINE Derived or_ (const T &a) const { return vreinterpretq_f64_s64(vorrq_s64(vreinterpretq_s64_f64(m), vreinterpretq_s64_f64(a.m))); }
     template <typename T> DRJIT_INLINE Derived and_(const T &a) const { return vreinterpretq_f64_s64(vandq_s64(vreinterpretq_s64_f64(m), vreinterpretq_s64_f64(a.m))); }
     template <typename T> DRJIT_INLINE Derived andnot_(const T &a) const { return vreinterpretq_f64_s64(vbicq_s64(vreinterpretq_s64_f64(m), vreinterpretq_s64_f64(a.m))); }
@@ -882,6 +954,37 @@ template <typename Value_, bool IsMask_, typename Derived_> struct alignas(16)
 
     static DRJIT_INLINE Derived zero_(size_t) { return vdupq_n_u32(0); }
 
+#if defined(DRJIT_ARM_64)
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        if constexpr (Derived::Size == 4) {
+            uint32x4_t mask_u = mask.m;
+            size_t count = (size_t) vaddvq_u32(vshrq_n_u32(mask_u, 31));
+            uint8x16_t value = vqtbl1q_u8(vreinterpretq_u8_u32(m),
+                                          detail::compress_perm<false>(mask_u));
+            memcpy(ptr, &value, count * sizeof(Value));
+            return count;
+        } else {
+            return Base::compress_store_(ptr, mask);
+        }
+    }
+
+    template <typename Mask>
+    static DRJIT_INLINE Derived expand_load_(const void *ptr, const Mask &mask) {
+        if constexpr (Derived::Size == 4) {
+            uint32x4_t mask_u = mask.m;
+            size_t count = (size_t) vaddvq_u32(vshrq_n_u32(mask_u, 31));
+            uint32x4_t value = vdupq_n_u32(0);
+            memcpy(&value, ptr, count * sizeof(Value));
+            value = vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(value),
+                                         detail::compress_perm<true>(mask_u)));
+            return vandq_u32(value, mask_u);
+        } else {
+            return Base::expand_load_(ptr, mask);
+        }
+    }
+#endif
+
     //! @}
     // -----------------------------------------------------------------------
 };
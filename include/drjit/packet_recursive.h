@@ -126,6 +126,20 @@ struct StaticArrayImpl<Value_, Size_, IsMask_, Derived_,
         return Derived(fnmsub(a1, b.a1, c.a1), fnmsub(a2, b.a2, c.a2));
     }
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        if constexpr (Size1 % 2 == 0)
+            return Derived(fmaddsub(a1, b.a1, c.a1), fmaddsub(a2, b.a2, c.a2));
+        else
+            return Base::fmaddsub_(b, c);
+    }
+
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        if constexpr (Size1 % 2 == 0)
+            return Derived(a1.complex_mul_(b.a1), a2.complex_mul_(b.a2));
+        else
+            return Base::complex_mul_(b);
+    }
+
     template <typename T> DRJIT_INLINE Derived or_(const T &a) const {
         return Derived(a1 | low(a), a2 | high(a));
     }
@@ -40,11 +40,11 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
     //! @{ \name Type converting constructors
     // -----------------------------------------------------------------------
 
-// #if defined(DRJIT_X86_F16C)
-    // DRJIT_CONVERT(half) {
-    //     m = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *) a.derived().data()));
-    // }
-// #endif
+#if defined(DRJIT_X86_F16C)
+    DRJIT_CONVERT(half) {
+        m = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *) a.derived().data()));
+    }
+#endif
 
     DRJIT_CONVERT(float) : m(a.derived().m) { }
     DRJIT_CONVERT(int32_t) : m(_mm_cvtepi32_ps(a.derived().m)) { }
@@ -271,6 +271,22 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
         #endif
     }
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        #if defined(DRJIT_X86_FMA)
+            return _mm_fmaddsub_ps(m, b.m, c.m);
+        #else
+            return _mm_addsub_ps(_mm_mul_ps(m, b.m), c.m);
+        #endif
+    }
+
+    /// Product of interleaved complex numbers (re0, im0, re1, im1)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        __m128 b_re = _mm_moveldup_ps(b.m),
+               b_im = _mm_movehdup_ps(b.m),
+               a_sw = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1));
+        return Derived(m).fmaddsub_(Derived(b_re), Derived(_mm_mul_ps(a_sw, b_im)));
+    }
+
 #if defined(DRJIT_X86_AVX512)
     DRJIT_INLINE Derived ldexp_(Ref arg) const { return _mm_scalef_ps(m, arg.m); }
 
@@ -1070,6 +1086,22 @@ template <bool IsMask_, typename Derived_> struct alignas(16)
         return DRJIT_SHUFFLE_PD(m, (I1 << 1) | I0);
     }
 
+    DRJIT_INLINE Derived fmaddsub_(Ref b, Ref c) const {
+        #if defined(DRJIT_X86_FMA)
+            return _mm_fmaddsub_pd(m, b.m, c.m);
+        #else
+            return _mm_addsub_pd(_mm_mul_pd(m, b.m), c.m);
+        #endif
+    }
+
+    /// Product of interleaved complex numbers (re, im)
+    DRJIT_INLINE Derived complex_mul_(Ref b) const {
+        __m128d b_re = _mm_movedup_pd(b.m),
+                b_im = _mm_unpackhi_pd(b.m, b.m),
+                a_sw = DRJIT_SHUFFLE_PD(m, 1);
+        return Derived(m).fmaddsub_(Derived(b_re), Derived(_mm_mul_pd(a_sw, b_im)));
+    }
+
 #if defined(DRJIT_X86_AVX512)
     DRJIT_INLINE Derived ldexp_(Ref arg) const { return _mm_scalef_pd(m, arg.m); }
 
@@ -0,0 +1,588 @@
+/*
+    drjit/packet_sve.h -- Packet arrays, ARM SVE specialization
+
+    Dr.Jit is a C++ template library for efficient vectorization and
+    differentiation of numerical kernels on modern processor architectures.
+
+    Copyright (c) 2021 Wenzel Jakob <wenzel.jakob@epfl.ch>
+
+    All rights reserved. Use of this source code is governed by a BSD-style
+    license that can be found in the LICENSE file.
+
+    SVE registers are "sizeless" and cannot be stored in a class. This file
+    therefore requires a fixed vector length chosen at compile time (e.g.,
+    -msve-vector-bits=256 for Neoverse V1/Graviton3), which makes the
+    'arm_sve_vector_bits' attribute available.
+
+    Masks use the same lane format as the SSE/AVX/NEON backends (all bits of a
+    lane set or cleared). Operations that support predication convert them into
+    an 'svbool_t' predicate using a single compare instruction.
+*/
+
+#pragma once
+
+#include <arm_sve.h>
+
+NAMESPACE_BEGIN(drjit)
+DRJIT_PACKET_DECLARE(DRJIT_SVE_BITS / 8)
+
+NAMESPACE_BEGIN(detail)
+typedef svfloat32_t sve_f32 __attribute__((arm_sve_vector_bits(DRJIT_SVE_BITS)));
+typedef svuint32_t  sve_u32 __attribute__((arm_sve_vector_bits(DRJIT_SVE_BITS)));
+
+/// Convert a predicate into a lane mask
+DRJIT_INLINE svuint32_t sve_mask(svbool_t p) {
+    return svdup_n_u32_z(p, 0xFFFFFFFFu);
+}
+
+/// Convert a lane mask into a predicate
+DRJIT_INLINE svbool_t sve_pred(svuint32_t m) {
+    return svcmpne_n_u32(svptrue_b32(), m, 0);
+}
+
+DRJIT_INLINE svbool_t sve_pred(svfloat32_t m) {
+    return sve_pred(svreinterpret_u32_f32(m));
+}
+NAMESPACE_END(detail)
+
+/// Partial overload of StaticArrayImpl using ARM SVE intrinsics (single precision)
+template <bool IsMask_, typename Derived_> struct alignas(DRJIT_SVE_BITS / 8)
+    StaticArrayImpl<float, DRJIT_SVE_BITS / 32, IsMask_, Derived_>
+  : StaticArrayBase<float, DRJIT_SVE_BITS / 32, IsMask_, Derived_> {
+
+    DRJIT_PACKET_TYPE(float, DRJIT_SVE_BITS / 32, detail::sve_f32)
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Value constructors
+    // -----------------------------------------------------------------------
+
+    template <typename T, enable_if_scalar_t<T> = 0>
+    DRJIT_INLINE StaticArrayImpl(T value) : m(svdup_n_f32((float) value)) { }
+
+    template <typename... Ts, detail::enable_if_components_t<Size, Ts...> = 0>
+    DRJIT_INLINE StaticArrayImpl(Ts... ts) {
+        Value data[] = { (Value) ts... };
+        m = svld1_f32(svptrue_b32(), data);
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Type converting constructors
+    // -----------------------------------------------------------------------
+
+    DRJIT_CONVERT(float) : m(a.derived().m) { }
+    DRJIT_CONVERT(int32_t)
+        : m(svcvt_f32_s32_x(svptrue_b32(), svreinterpret_s32_u32(a.derived().m))) { }
+    DRJIT_CONVERT(uint32_t) : m(svcvt_f32_u32_x(svptrue_b32(), a.derived().m)) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Reinterpreting constructors, mask converters
+    // -----------------------------------------------------------------------
+
+    DRJIT_REINTERPRET(float) : m(a.derived().m) { }
+    DRJIT_REINTERPRET(int32_t) : m(svreinterpret_f32_u32(a.derived().m)) { }
+    DRJIT_REINTERPRET(uint32_t) : m(svreinterpret_f32_u32(a.derived().m)) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Converting from/to half size vectors
+    // -----------------------------------------------------------------------
+
+    StaticArrayImpl(const Array1 &a1, const Array2 &a2) {
+        memcpy(data(), a1.data(), sizeof(Value) * Array1::Size);
+        memcpy(data() + Array1::Size, a2.data(), sizeof(Value) * Array2::Size);
+    }
+
+    DRJIT_INLINE Array1 low_() const {
+        Array1 result;
+        memcpy(result.data(), data(), sizeof(Value) * Array1::Size);
+        return result;
+    }
+
+    DRJIT_INLINE Array2 high_() const {
+        Array2 result;
+        memcpy(result.data(), data() + Array1::Size, sizeof(Value) * Array2::Size);
+        return result;
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Vertical operations
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE Derived add_(Ref a) const { return svadd_f32_x(svptrue_b32(), m, a.m); }
+    DRJIT_INLINE Derived sub_(Ref a) const { return svsub_f32_x(svptrue_b32(), m, a.m); }
+    DRJIT_INLINE Derived mul_(Ref a) const { return svmul_f32_x(svptrue_b32(), m, a.m); }
+    DRJIT_INLINE Derived div_(Ref a) const { return svdiv_f32_x(svptrue_b32(), m, a.m); }
+
+    DRJIT_INLINE Derived fmadd_(Ref b, Ref c) const { return svmla_f32_x(svptrue_b32(), c.m, m, b.m); }
+    DRJIT_INLINE Derived fnmadd_(Ref b, Ref c) const { return svmls_f32_x(svptrue_b32(), c.m, m, b.m); }
+    DRJIT_INLINE Derived fmsub_(Ref b, Ref c) const { return svnmls_f32_x(svptrue_b32(), c.m, m, b.m); }
+    DRJIT_INLINE Derived fnmsub_(Ref b, Ref c) const { return svnmla_f32_x(svptrue_b32(), c.m, m, b.m); }
+
+#define DRJIT_SVE_BITOP(name, op)                                              \
+    template <typename T> DRJIT_INLINE Derived name(const T &a) const {        \
+        return svreinterpret_f32_u32(op(svptrue_b32(),                         \
+                                        svreinterpret_u32_f32(m),              \
+                                        svreinterpret_u32_f32(a.m)));          \
+    }
+
+    DRJIT_SVE_BITOP(or_, svorr_u32_x)
+    DRJIT_SVE_BITOP(and_, svand_u32_x)
+    DRJIT_SVE_BITOP(andnot_, svbic_u32_x)
+    DRJIT_SVE_BITOP(xor_, sveor_u32_x)
+
+#undef DRJIT_SVE_BITOP
+
+#define DRJIT_SVE_CMP(name, op)                                                \
+    DRJIT_INLINE auto name(Ref a) const {                                      \
+        return mask_t<Derived>(svreinterpret_f32_u32(                          \
+            detail::sve_mask(op(svptrue_b32(), m, a.m))));                     \
+    }
+
+    DRJIT_SVE_CMP(lt_, svcmplt_f32)
+    DRJIT_SVE_CMP(gt_, svcmpgt_f32)
+    DRJIT_SVE_CMP(le_, svcmple_f32)
+    DRJIT_SVE_CMP(ge_, svcmpge_f32)
+
+#undef DRJIT_SVE_CMP
+
+    DRJIT_INLINE auto eq_(Ref a) const {
+        svbool_t p;
+        if constexpr (!IsMask_)
+            p = svcmpeq_f32(svptrue_b32(), m, a.m);
+        else
+            p = svcmpeq_u32(svptrue_b32(), svreinterpret_u32_f32(m),
+                            svreinterpret_u32_f32(a.m));
+        return mask_t<Derived>(svreinterpret_f32_u32(detail::sve_mask(p)));
+    }
+
+    DRJIT_INLINE auto neq_(Ref a) const {
+        svbool_t p;
+        if constexpr (!IsMask_)
+            p = svcmpne_f32(svptrue_b32(), m, a.m);
+        else
+            p = svcmpne_u32(svptrue_b32(), svreinterpret_u32_f32(m),
+                            svreinterpret_u32_f32(a.m));
+        return mask_t<Derived>(svreinterpret_f32_u32(detail::sve_mask(p)));
+    }
+
+    DRJIT_INLINE Derived abs_() const { return svabs_f32_x(svptrue_b32(), m); }
+    DRJIT_INLINE Derived neg_() const { return svneg_f32_x(svptrue_b32(), m); }
+    DRJIT_INLINE Derived not_() const {
+        return svreinterpret_f32_u32(svnot_u32_x(svptrue_b32(), svreinterpret_u32_f32(m)));
+    }
+
+    DRJIT_INLINE Derived minimum_(Ref b) const { return svmin_f32_x(svptrue_b32(), b.m, m); }
+    DRJIT_INLINE Derived maximum_(Ref b) const { return svmax_f32_x(svptrue_b32(), b.m, m); }
+
+    DRJIT_INLINE Derived round_() const { return svrintn_f32_x(svptrue_b32(), m); }
+    DRJIT_INLINE Derived floor_() const { return svrintm_f32_x(svptrue_b32(), m); }
+    DRJIT_INLINE Derived ceil_()  const { return svrintp_f32_x(svptrue_b32(), m); }
+    DRJIT_INLINE Derived trunc_() const { return svrintz_f32_x(svptrue_b32(), m); }
+
+    DRJIT_INLINE Derived sqrt_() const { return svsqrt_f32_x(svptrue_b32(), m); }
+
+    DRJIT_INLINE Derived rcp_() const {
+        const svbool_t pg = svptrue_b32();
+        svfloat32_t r = svrecpe_f32(m);
+        r = svmul_f32_x(pg, r, svrecps_f32(r, m));
+        r = svmul_f32_x(pg, r, svrecps_f32(r, m));
+        return r;
+    }
+
+    DRJIT_INLINE Derived rsqrt_() const {
+        const svbool_t pg = svptrue_b32();
+        svfloat32_t r = svrsqrte_f32(m);
+        r = svmul_f32_x(pg, r, svrsqrts_f32(svmul_f32_x(pg, r, r), m));
+        r = svmul_f32_x(pg, r, svrsqrts_f32(svmul_f32_x(pg, r, r), m));
+        return r;
+    }
+
+    template <typename Mask_>
+    static DRJIT_INLINE Derived select_(const Mask_ &m, Ref t, Ref f) {
+        return svsel_f32(detail::sve_pred(m.m), t.m, f.m);
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Horizontal operations
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE Value hsum_() const { return svaddv_f32(svptrue_b32(), m); }
+    DRJIT_INLINE Value hmin_() const { return svminv_f32(svptrue_b32(), m); }
+    DRJIT_INLINE Value hmax_() const { return svmaxv_f32(svptrue_b32(), m); }
+
+    DRJIT_INLINE bool all_() const {
+        return !svptest_any(svptrue_b32(),
+                            svnot_b_z(svptrue_b32(), detail::sve_pred(m)));
+    }
+
+    DRJIT_INLINE bool any_() const {
+        return svptest_any(svptrue_b32(), detail::sve_pred(m));
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Initialization, loading/writing data
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE void store_aligned_(void *ptr) const {
+        svst1_f32(svptrue_b32(), (Value *) DRJIT_ASSUME_ALIGNED(ptr, DRJIT_SVE_BITS / 8), m);
+    }
+
+    DRJIT_INLINE void store_(void *ptr) const {
+        svst1_f32(svptrue_b32(), (Value *) ptr, m);
+    }
+
+    static DRJIT_INLINE Derived load_aligned_(const void *ptr, size_t) {
+        return svld1_f32(svptrue_b32(), (const Value *) DRJIT_ASSUME_ALIGNED(ptr, DRJIT_SVE_BITS / 8));
+    }
+
+    static DRJIT_INLINE Derived load_(const void *ptr, size_t) {
+        return svld1_f32(svptrue_b32(), (const Value *) ptr);
+    }
+
+    static DRJIT_INLINE Derived empty_(size_t) { return svundef_f32(); }
+    static DRJIT_INLINE Derived zero_(size_t) { return svdup_n_f32(0.f); }
+
+    template <typename Index, typename Mask>
+    static DRJIT_INLINE Derived gather_(const void *ptr, const Index &index,
+                                        const Mask &mask, ReduceMode mode) {
+        if constexpr (sizeof(scalar_t<Index>) == 4)
+            return svld1_gather_u32index_f32(detail::sve_pred(mask.m),
+                                             (const Value *) ptr, index.m);
+        else
+            return Base::gather_(ptr, index, mask, mode);
+    }
+
+    template <typename Index, typename Mask>
+    DRJIT_INLINE void scatter_(void *ptr, const Index &index, const Mask &mask,
+                               ReduceMode mode) const {
+        if constexpr (sizeof(scalar_t<Index>) == 4)
+            svst1_scatter_u32index_f32(detail::sve_pred(mask.m), (Value *) ptr,
+                                       index.m, m);
+        else
+            Base::scatter_(ptr, index, mask, mode);
+    }
+
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        svbool_t p = detail::sve_pred(mask.m);
+        uint64_t count = svcntp_b32(svptrue_b32(), p);
+        svst1_f32(svwhilelt_b32_u64(0, count), (Value *) ptr, svcompact_f32(p, m));
+        return (size_t) count;
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+} DRJIT_MAY_ALIAS;
+
+/// Partial overload of StaticArrayImpl using ARM SVE intrinsics (32-bit integers)
+template <typename Value_, bool IsMask_, typename Derived_> struct alignas(DRJIT_SVE_BITS / 8)
+    StaticArrayImpl<Value_, DRJIT_SVE_BITS / 32, IsMask_, Derived_, enable_if_int32_t<Value_>>
+  : StaticArrayBase<Value_, DRJIT_SVE_BITS / 32, IsMask_, Derived_> {
+
+    DRJIT_PACKET_TYPE(Value_, DRJIT_SVE_BITS / 32, detail::sve_u32)
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Value constructors
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE StaticArrayImpl(Value value) : m(svdup_n_u32((uint32_t) value)) { }
+
+    template <typename... Ts, detail::enable_if_components_t<Size, Ts...> = 0>
+    DRJIT_INLINE StaticArrayImpl(Ts... ts) {
+        uint32_t data[] = { (uint32_t) ts... };
+        m = svld1_u32(svptrue_b32(), data);
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Type converting constructors
+    // -----------------------------------------------------------------------
+
+    DRJIT_CONVERT(int32_t) : m(a.derived().m) { }
+    DRJIT_CONVERT(uint32_t) : m(a.derived().m) { }
+    DRJIT_CONVERT(float) : m(std::is_signed_v<Value> ?
+          svreinterpret_u32_s32(svcvt_s32_f32_x(svptrue_b32(), a.derived().m))
+        : svcvt_u32_f32_x(svptrue_b32(), a.derived().m)) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Reinterpreting constructors, mask converters
+    // -----------------------------------------------------------------------
+
+    DRJIT_REINTERPRET(int32_t) : m(a.derived().m) { }
+    DRJIT_REINTERPRET(uint32_t) : m(a.derived().m) { }
+    DRJIT_REINTERPRET(float) : m(svreinterpret_u32_f32(a.derived().m)) { }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Converting from/to half size vectors
+    // -----------------------------------------------------------------------
+
+    StaticArrayImpl(const Array1 &a1, const Array2 &a2) {
+        memcpy(data(), a1.data(), sizeof(Value) * Array1::Size);
+        memcpy(data() + Array1::Size, a2.data(), sizeof(Value) * Array2::Size);
+    }
+
+    DRJIT_INLINE Array1 low_() const {
+        Array1 result;
+        memcpy(result.data(), data(), sizeof(Value) * Array1::Size);
+        return result;
+    }
+
+    DRJIT_INLINE Array2 high_() const {
+        Array2 result;
+        memcpy(result.data(), data() + Array1::Size, sizeof(Value) * Array2::Size);
+        return result;
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Vertical operations
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE Derived add_(Ref a) const { return svadd_u32_x(svptrue_b32(), m, a.m); }
+    DRJIT_INLINE Derived sub_(Ref a) const { return svsub_u32_x(svptrue_b32(), m, a.m); }
+    DRJIT_INLINE Derived mul_(Ref a) const { return svmul_u32_x(svptrue_b32(), m, a.m); }
+
+    DRJIT_INLINE Derived div_(Ref a) const {
+        if constexpr (std::is_signed_v<Value>)
+            return svreinterpret_u32_s32(svdiv_s32_x(svptrue_b32(),
+                svreinterpret_s32_u32(m), svreinterpret_s32_u32(a.m)));
+        else
+            return svdiv_u32_x(svptrue_b32(), m, a.m);
+    }
+
+    template <typename T> DRJIT_INLINE Derived or_ (const T &a) const { return svorr_u32_x(svptrue_b32(), m, a.m); }
+    template <typename T> DRJIT_INLINE Derived and_(const T &a) const { return svand_u32_x(svptrue_b32(), m, a.m); }
+    template <typename T> DRJIT_INLINE Derived andnot_(const T &a) const { return svbic_u32_x(svptrue_b32(), m, a.m); }
+    template <typename T> DRJIT_INLINE Derived xor_(const T &a) const { return sveor_u32_x(svptrue_b32(), m, a.m); }
+
+#define DRJIT_SVE_CMP(name, op)                                                \
+    DRJIT_INLINE auto name(Ref a) const {                                      \
+        svbool_t p;                                                            \
+        if constexpr (std::is_signed_v<Value>)                                 \
+            p = op##_s32(svptrue_b32(), svreinterpret_s32_u32(m),              \
+                         svreinterpret_s32_u32(a.m));                          \
+        else                                                                   \
+            p = op##_u32(svptrue_b32(), m, a.m);                               \
+        return mask_t<Derived>(detail::sve_mask(p));                           \
+    }
+
+    DRJIT_SVE_CMP(lt_, svcmplt)
+    DRJIT_SVE_CMP(gt_, svcmpgt)
+    DRJIT_SVE_CMP(le_, svcmple)
+    DRJIT_SVE_CMP(ge_, svcmpge)
+
+#undef DRJIT_SVE_CMP
+
+    DRJIT_INLINE auto eq_ (Ref a) const {
+        return mask_t<Derived>(detail::sve_mask(svcmpeq_u32(svptrue_b32(), m, a.m)));
+    }
+
+    DRJIT_INLINE auto neq_(Ref a) const {
+        return mask_t<Derived>(detail::sve_mask(svcmpne_u32(svptrue_b32(), m, a.m)));
+    }
+
+    DRJIT_INLINE Derived abs_() const {
+        if constexpr (!std::is_signed_v<Value>)
+            return m;
+        else
+            return svreinterpret_u32_s32(
+                svabs_s32_x(svptrue_b32(), svreinterpret_s32_u32(m)));
+    }
+
+    DRJIT_INLINE Derived neg_() const {
+        return svreinterpret_u32_s32(svneg_s32_x(svptrue_b32(), svreinterpret_s32_u32(m)));
+    }
+
+    DRJIT_INLINE Derived not_() const { return svnot_u32_x(svptrue_b32(), m); }
+
+    DRJIT_INLINE Derived maximum_(Ref b) const {
+        if constexpr (std::is_signed_v<Value>)
+            return svreinterpret_u32_s32(svmax_s32_x(svptrue_b32(),
+                svreinterpret_s32_u32(b.m), svreinterpret_s32_u32(m)));
+        else
+            return svmax_u32_x(svptrue_b32(), b.m, m);
+    }
+
+    DRJIT_INLINE Derived minimum_(Ref b) const {
+        if constexpr (std::is_signed_v<Value>)
+            return svreinterpret_u32_s32(svmin_s32_x(svptrue_b32(),
+                svreinterpret_s32_u32(b.m), svreinterpret_s32_u32(m)));
+        else
+            return svmin_u32_x(svptrue_b32(), b.m, m);
+    }
+
+    template <typename Mask_>
+    static DRJIT_INLINE Derived select_(const Mask_ &m, Ref t, Ref f) {
+        return svsel_u32(detail::sve_pred(m.m), t.m, f.m);
+    }
+
+    template <size_t Imm> DRJIT_INLINE Derived sr_() const {
+        if constexpr (Imm == 0)
+            return derived();
+        else
+            return sr_((size_t) Imm);
+    }
+
+    template <size_t Imm> DRJIT_INLINE Derived sl_() const {
+        if constexpr (Imm == 0)
+            return derived();
+        else
+            return sl_((size_t) Imm);
+    }
+
+    DRJIT_INLINE Derived sr_(size_t k) const {
+        if constexpr (std::is_signed_v<Value>)
+            return svreinterpret_u32_s32(svasr_n_s32_x(
+                svptrue_b32(), svreinterpret_s32_u32(m), (uint32_t) k));
+        else
+            return svlsr_n_u32_x(svptrue_b32(), m, (uint32_t) k);
+    }
+
+    DRJIT_INLINE Derived sl_(size_t k) const {
+        return svlsl_n_u32_x(svptrue_b32(), m, (uint32_t) k);
+    }
+
+    DRJIT_INLINE Derived sr_(Ref a) const {
+        if constexpr (std::is_signed_v<Value>)
+            return svreinterpret_u32_s32(svasr_s32_x(
+                svptrue_b32(), svreinterpret_s32_u32(m), a.m));
+        else
+            return svlsr_u32_x(svptrue_b32(), m, a.m);
+    }
+
+    DRJIT_INLINE Derived sl_(Ref a) const {
+        return svlsl_u32_x(svptrue_b32(), m, a.m);
+    }
+
+    DRJIT_INLINE Derived mulhi_(Ref a) const {
+        if constexpr (std::is_signed_v<Value>)
+            return svreinterpret_u32_s32(svmulh_s32_x(svptrue_b32(),
+                svreinterpret_s32_u32(m), svreinterpret_s32_u32(a.m)));
+        else
+            return svmulh_u32_x(svptrue_b32(), m, a.m);
+    }
+
+    DRJIT_INLINE Derived lzcnt_() const { return svclz_u32_x(svptrue_b32(), m); }
+    DRJIT_INLINE Derived tzcnt_() const {
+        return svclz_u32_x(svptrue_b32(), svrbit_u32_x(svptrue_b32(), m));
+    }
+    DRJIT_INLINE Derived popcnt_() const { return svcnt_u32_x(svptrue_b32(), m); }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Horizontal operations
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE Value hsum_() const { return (Value) svaddv_u32(svptrue_b32(), m); }
+
+    DRJIT_INLINE Value hmin_() const {
+        if constexpr (std::is_signed_v<Value>)
+            return svminv_s32(svptrue_b32(), svreinterpret_s32_u32(m));
+        else
+            return svminv_u32(svptrue_b32(), m);
+    }
+
+    DRJIT_INLINE Value hmax_() const {
+        if constexpr (std::is_signed_v<Value>)
+            return svmaxv_s32(svptrue_b32(), svreinterpret_s32_u32(m));
+        else
+            return svmaxv_u32(svptrue_b32(), m);
+    }
+
+    DRJIT_INLINE bool all_() const {
+        return !svptest_any(svptrue_b32(),
+                            svnot_b_z(svptrue_b32(), detail::sve_pred(m)));
+    }
+
+    DRJIT_INLINE bool any_() const {
+        return svptest_any(svptrue_b32(), detail::sve_pred(m));
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Initialization, loading/writing data
+    // -----------------------------------------------------------------------
+
+    DRJIT_INLINE void store_aligned_(void *ptr) const {
+        svst1_u32(svptrue_b32(), (uint32_t *) DRJIT_ASSUME_ALIGNED(ptr, DRJIT_SVE_BITS / 8), m);
+    }
+
+    DRJIT_INLINE void store_(void *ptr) const {
+        svst1_u32(svptrue_b32(), (uint32_t *) ptr, m);
+    }
+
+    static DRJIT_INLINE Derived load_aligned_(const void *ptr, size_t) {
+        return svld1_u32(svptrue_b32(), (const uint32_t *) DRJIT_ASSUME_ALIGNED(ptr, DRJIT_SVE_BITS / 8));
+    }
+
+    static DRJIT_INLINE Derived load_(const void *ptr, size_t) {
+        return svld1_u32(svptrue_b32(), (const uint32_t *) ptr);
+    }
+
+    static DRJIT_INLINE Derived empty_(size_t) { return svundef_u32(); }
+    static DRJIT_INLINE Derived zero_(size_t) { return svdup_n_u32(0); }
+
+    template <typename Index, typename Mask>
+    static DRJIT_INLINE Derived gather_(const void *ptr, const Index &index,
+                                        const Mask &mask, ReduceMode mode) {
+        if constexpr (sizeof(scalar_t<Index>) == 4)
+            return svld1_gather_u32index_u32(detail::sve_pred(mask.m),
+                                             (const uint32_t *) ptr, index.m);
+        else
+            return Base::gather_(ptr, index, mask, mode);
+    }
+
+    template <typename Index, typename Mask>
+    DRJIT_INLINE void scatter_(void *ptr, const Index &index, const Mask &mask,
+                               ReduceMode mode) const {
+        if constexpr (sizeof(scalar_t<Index>) == 4)
+            svst1_scatter_u32index_u32(detail::sve_pred(mask.m),
+                                       (uint32_t *) ptr, index.m, m);
+        else
+            Base::scatter_(ptr, index, mask, mode);
+    }
+
+    template <typename Mask>
+    DRJIT_INLINE size_t compress_store_(void *ptr, const Mask &mask) const {
+        svbool_t p = detail::sve_pred(mask.m);
+        uint64_t count = svcntp_b32(svptrue_b32(), p);
+        svst1_u32(svwhilelt_b32_u64(0, count), (uint32_t *) ptr, svcompact_u32(p, m));
+        return (size_t) count;
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
+} DRJIT_MAY_ALIAS;
+
+NAMESPACE_END(drjit)
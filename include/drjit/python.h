@@ -555,6 +555,29 @@ template <typename T> void bind_arithmetic(ArrayBinding &b) {
 }
 
 
+/**
+ * Native arithmetic for small static arrays like ``drjit.scalar.Array3f``,
+ * which otherwise process each entry via the Python implementation of the
+ * operation. This is restricted to operations whose result does not depend on
+ * whether the computation happens at the precision of the array or that of a
+ * Python ``float``.
+ */
+template <typename T> void bind_static_arithmetic(ArrayBinding &b) {
+    b[ArrayOp::Abs] = (void *) +[](const T *a, T *b) { new (b) T(abs(*a)); };
+    b[ArrayOp::Neg] = (void *) +[](const T *a, T *b) { new (b) T(-*a); };
+    b[ArrayOp::Add] = (void *) +[](const T *a, const T *b, T *c) { new (c) T(*a + *b); };
+    b[ArrayOp::Sub] = (void *) +[](const T *a, const T *b, T *c) { new (c) T(*a - *b); };
+    b[ArrayOp::Mul] = (void *) +[](const T *a, const T *b, T *c) { new (c) T(*a * *b); };
+
+    b[ArrayOp::Minimum] = (void *) +[](const T *a, const T *b, T *c) {
+        new (c) T(drjit::minimum(*a, *b));
+    };
+
+    b[ArrayOp::Maximum] = (void *) +[](const T *a, const T *b, T *c) {
+        new (c) T(drjit::maximum(*a, *b));
+    };
+}
+
 template <typename T> void bind_cast(ArrayBinding &b) {
     using UInt32  = uint32_array_t<T>;
     using Int32   = int32_array_t<T>;
@@ -913,6 +936,9 @@ nanobind::object bind_array(ArrayBinding &b, nanobind::handle scope = {},
             bind_memop<T>(b);
         }
 
+        if constexpr (T::Depth == 1 && !T::IsDynamic && T::IsFloat && !is_special_v<T>)
+            bind_static_arithmetic<T>(b);
+
         if constexpr (T::Depth == 1 && (T::IsMask || T::IsIntegral))
             bind_bit_invert<T>(b);
     }
@@ -1052,27 +1078,85 @@ template <typename T> void bind_all(ArrayBinding &b) {
     bind_array<Tensor<float64_array_t<T2>>>(b);
 }
 
-// Expose already existing object tree traversal callbacks (T::traverse_1_..) in Python.
+NAMESPACE_BEGIN(detail)
+
+/**
+ * \brief Native traversal callbacks of a type bound via \ref bind_traverse()
+ *
+ * The Python bindings look for a capsule storing this table in the
+ * ``_traverse_1_cb_native`` attribute of a type. When found, operations like
+ * ``dr.eval()``, ``dr.detach()``, and the loop/conditional variable trackers
+ * enumerate the JIT variables of an instance in C++, without calling
+ * into Python for every field.
+ */
+struct TraverseCallbacks {
+    void (*ro)(PyObject *self, void *payload, void (*fn)(void *, uint64_t));
+    void (*rw)(PyObject *self, void *payload, uint64_t (*fn)(void *, uint64_t));
+
+    /// Return a new reference to a copy of 'self', or nullptr when the type
+    /// has reference semantics and should be updated in-place
+    PyObject *(*copy)(PyObject *self);
+};
+
+NAMESPACE_END(detail)
+
+// Expose object tree traversal callbacks of a C++ type in Python. The type
+// must either be a DRJIT_STRUCT, or provide 'traverse_1_cb_ro/rw' methods.
 // This functionality is needed to traverse custom/opaque C++ classes and correctly
 // update their members when they are used in vectorized loops, function calls, etc.
 template <typename T, typename... Args> auto& bind_traverse(nanobind::class_<T, Args...> &cls) {
     namespace nb = nanobind;
     struct Payload { nb::callable c; };
 
+    struct Impl {
+        static void ro(const T *self, void *payload, void (*fn)(void *, uint64_t)) {
+            if constexpr (is_traversable_v<T>)
+                traverse_1_fn_ro(*self, payload, fn);
+            else
+                self->traverse_1_cb_ro(payload, fn);
+        }
+
+        static void rw(T *self, void *payload, uint64_t (*fn)(void *, uint64_t)) {
+            if constexpr (is_traversable_v<T>)
+                traverse_1_fn_rw(*self, payload, fn);
+            else
+                self->traverse_1_cb_rw(payload, fn);
+        }
+    };
+
+    static const detail::TraverseCallbacks callbacks {
+        [](PyObject *self, void *payload, void (*fn)(void *, uint64_t)) {
+            Impl::ro(nb::cast<const T *>(nb::handle(self)), payload, fn);
+        },
+        [](PyObject *self, void *payload, uint64_t (*fn)(void *, uint64_t)) {
+            Impl::rw(nb::cast<T *>(nb::handle(self)), payload, fn);
+        },
+        [](PyObject *self) -> PyObject * {
+            if constexpr (is_traversable_v<T> && std::is_copy_constructible_v<T>)
+                return nb::cast(T(*nb::cast<const T *>(nb::handle(self))),
+                                nb::rv_policy::move).release().ptr();
+            else
+                return nullptr;
+        }
+    };
+
     cls.def("_traverse_1_cb_ro", [](const T *self, nb::callable c) {
         Payload payload{ std::move(c) };
-        self->traverse_1_cb_ro((void *) &payload, [](void *p, uint64_t index) {
+        Impl::ro(self, (void *) &payload, [](void *p, uint64_t index) {
             ((Payload *) p)->c(index);
         });
     });
 
     cls.def("_traverse_1_cb_rw", [](T *self, nb::callable c) {
         Payload payload{ std::move(c) };
-        self->traverse_1_cb_rw((void *) &payload, [](void *p, uint64_t index) {
+        Impl::rw(self, (void *) &payload, [](void *p, uint64_t index) {
             return nb::cast<uint64_t>(((Payload *) p)->c(index));
         });
     });
 
+    cls.attr("_traverse_1_cb_native") =
+        nb::capsule((void *) &callbacks, "drjit.TraverseCallbacks");
+
     return cls;
 }
 
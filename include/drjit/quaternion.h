@@ -215,24 +215,31 @@ template <typename T> Quaternion<T> rsqrt(const Quaternion<T> &z) {
 
 template <typename Matrix, typename T>
 Matrix quat_to_matrix(const Quaternion<T> &q_) {
+    using Vector3 = Array<T, 3>;
     Quaternion<T> q = q_ * SqrtTwo<T>;
 
-    T xx = q.x() * q.x(), yy = q.y() * q.y(), zz = q.z() * q.z(),
-      xy = q.x() * q.y(), xz = q.x() * q.z(), yz = q.y() * q.z(),
-      xw = q.x() * q.w(), yw = q.y() * q.w(), zw = q.z() * q.w();
+    /* Evaluate the products in groups of three so that AoS quaternions
+       (e.g., Quaternion<float>) map onto packet arithmetic and shuffles */
+    Vector3 v = imag(q),
+            sq = v * v,                           // xx, yy, zz
+            cr = v * shuffle<1, 2, 0>(v),         // xy, yz, zx
+            vw = shuffle<2, 0, 1>(v) * real(q),   // zw, xw, yw
+            d  = 1.f - (shuffle<1, 2, 0>(sq) + shuffle<2, 0, 1>(sq)),
+            lo = cr + vw,                         // m10, m21, m02
+            up = cr - vw;                         // m01, m12, m20
 
     if constexpr (Matrix::Size == 4) {
         return Matrix(
-             1.f - (yy + zz), xy - zw, xz + yw, 0.f,
-             xy + zw, 1.f - (xx + zz), yz - xw, 0.f,
-             xz - yw, yz + xw, 1.f - (xx + yy), 0.f,
+             d.x(), up.x(), lo.z(), 0.f,
+             lo.x(), d.y(), up.y(), 0.f,
+             up.z(), lo.y(), d.z(), 0.f,
              0.f, 0.f, 0.f, 1.f
         );
     } else if constexpr (Matrix::Size == 3) {
         return Matrix(
-             1.f - (yy + zz), xy - zw, xz + yw,
-             xy + zw, 1.f - (xx + zz), yz - xw,
-             xz - yw,  yz + xw, 1.f - (xx + yy)
+             d.x(), up.x(), lo.z(),
+             lo.x(), d.y(), up.y(),
+             up.z(), lo.y(), d.z()
         );
     } else {
         static_assert(detail::false_v<Matrix>, "Invalid matrix size!");
@@ -325,19 +332,39 @@ Quaternion<Value> slerp(const Quaternion<Value> &q0,
     using Base = Array<Value, 4>;
 
     Value cos_theta = dot(q0, q1_);
-    Quaternion<Value> q1 = mulsign(Base(q1_), Base(cos_theta));
-    cos_theta = mulsign(cos_theta, cos_theta);
+    Base q1 = mulsign(Base(q1_), Base(cos_theta));
+    cos_theta = minimum(abs(cos_theta), 1.f);
 
-    Value theta = acos(cos_theta);
-    auto [s, c] = sincos(theta * t);
+    /* Interpolate using scalar weights, which avoids selecting between two
+       candidate quaternions. Nearly parallel inputs use normalized linear
+       interpolation instead */
+    Value theta = acos(cos_theta),
+          inv_sin_theta = rsqrt(maximum(fnmadd(cos_theta, cos_theta, 1.f), 1e-12f));
 
-    Quaternion<Value> qperp  = normalize(q1 - q0 * cos_theta);
+    mask_t<Value> linear = cos_theta > 0.9995f;
+    Value w0 = select(linear, 1.f - t, sin((1.f - t) * theta) * inv_sin_theta),
+          w1 = select(linear, t, sin(t * theta) * inv_sin_theta);
 
-    return select(
-        cos_theta > 0.9995f,
-        normalize(q0 * (1.f - t) + q1 * t),
-        q0 * c + qperp * s
-    );
+    Base result = fmadd(Base(q0), w0, q1 * w1);
+    return result * select(linear, rsqrt(squared_norm(result)), 1.f);
+}
+
+/**
+ * \brief Spherical quadrangle interpolation between ``q0`` and ``q1`` with
+ * the inner control points ``s0`` and ``s1``
+ *
+ * Evaluates ``slerp(slerp(q0, q1, t), slerp(s0, s1, t), 2t(1-t))``, which
+ * yields a C^1 continuous rotation curve when the control points are chosen
+ * appropriately (e.g., via ``q_i exp(-(log(q_i^-1 q_{i+1}) + log(q_i^-1 q_{i-1})) / 4)``).
+ */
+template <typename Value>
+Quaternion<Value> squad(const Quaternion<Value> &q0,
+                        const Quaternion<Value> &q1,
+                        const Quaternion<Value> &s0,
+                        const Quaternion<Value> &s1,
+                        const Value &t) {
+    return slerp(slerp(q0, q1, t), slerp(s0, s1, t),
+                 2.f * t * (1.f - t));
 }
 
 template <typename Quat, typename Vector3, enable_if_quaternion_t<Quat> = 0>
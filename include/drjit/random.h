@@ -27,6 +27,12 @@
 #define PCG32_DEFAULT_STREAM 0xda3e39cb94b95bdbULL
 #define PCG32_MULT           0x5851f42d4c957f2dULL
 
+#define PHILOX_DEFAULT_SEED  0x853c49e6748fea9bULL
+#define PHILOX_M0            0xD2511F53u
+#define PHILOX_M1            0xCD9E8D57u
+#define PHILOX_W0            0x9E3779B9u
+#define PHILOX_W1            0xBB67AE85u
+
 NAMESPACE_BEGIN(drjit)
 
 /// PCG32 pseudorandom number generator proposed by Melissa O'Neill
@@ -419,4 +425,330 @@ private:
         : state(state), inc(inc) { }
 };
 
+/**
+ * \brief Philox4x32-10 counter-based pseudorandom number generator proposed
+ * by Salmon et al. ("Parallel random numbers: as easy as 1, 2, 3", SC 2011)
+ *
+ * In contrast to \ref PCG32, every output is a pure function of a 128-bit
+ * counter and a 64-bit key that is evaluated using 10 rounds of 32-bit
+ * multiplications. There is no sequential dependency between successive
+ * outputs, which means that an arbitrary position of the stream can be
+ * accessed in constant time by simply setting \ref counter.
+ *
+ * The 128-bit counter is formed by the per-lane \ref counter (low 64 bits)
+ * and \ref stream (high 64 bits) fields, and \ref key holds the seed.
+ */
+template <typename T> struct Philox4x32 {
+    /* Some convenient type aliases for vectorization */
+    using UInt64     = uint64_array_t<T>;
+    using UInt32     = uint32_array_t<T>;
+    using Float64    = float64_array_t<T>;
+    using Float32    = float32_array_t<T>;
+    using Mask       = mask_t<UInt64>;
+    using UInt32x4   = Array<UInt32, 4>;
+
+    /**
+     * \brief Initialize the pseudorandom number generator
+     *
+     * Lane \c i is assigned the stream <tt>stream + i</tt>, which keeps the
+     * sequences of different lanes disjoint.
+     */
+    Philox4x32(size_t size = 1,
+               const UInt64 &seed = PHILOX_DEFAULT_SEED,
+               const UInt64 &counter = 0,
+               const UInt64 &stream = 0)
+        : counter(counter), key(seed),
+          stream(stream + arange<UInt64>(size)) { }
+
+    /// Evaluate the Philox4x32-10 bijection for a given counter and key
+    static DRJIT_INLINE UInt32x4 philox(const UInt32x4 &ctr, const UInt32 &k0_,
+                                        const UInt32 &k1_) {
+        UInt32 c0 = ctr.x(), c1 = ctr.y(), c2 = ctr.z(), c3 = ctr.w(),
+               k0 = k0_, k1 = k1_;
+
+        for (int i = 0; i < 10; ++i) {
+            if (i > 0) {
+                k0 += PHILOX_W0;
+                k1 += PHILOX_W1;
+            }
+
+            UInt32 hi0 = mulhi(c0, PHILOX_M0), lo0 = c0 * PHILOX_M0,
+                   hi1 = mulhi(c2, PHILOX_M1), lo1 = c2 * PHILOX_M1;
+
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+        }
+
+        return UInt32x4(c0, c1, c2, c3);
+    }
+
+    /// Generate four uniformly distributed unsigned 32-bit random numbers
+    DRJIT_INLINE UInt32x4 next_uint32x4() {
+        UInt32x4 result = eval_block();
+        counter += 1;
+        return result;
+    }
+
+    /// Masked version of \ref next_uint32x4
+    DRJIT_INLINE UInt32x4 next_uint32x4(const Mask &mask) {
+        UInt32x4 result = eval_block();
+        masked(counter, mask) += 1;
+        return result;
+    }
+
+    /**
+     * \brief Generate a uniformly distributed unsigned 32-bit random number
+     *
+     * Each call consumes one counter value. Use \ref next_uint32x4() when
+     * several variates are needed per lane.
+     */
+    DRJIT_INLINE UInt32 next_uint32() { return next_uint32x4().x(); }
+
+    /// Masked version of \ref next_uint32
+    DRJIT_INLINE UInt32 next_uint32(const Mask &mask) {
+        return next_uint32x4(mask).x();
+    }
+
+    /// Generate a uniformly distributed unsigned 64-bit random number
+    DRJIT_INLINE UInt64 next_uint64() {
+        UInt32x4 v = next_uint32x4();
+        return UInt64(v.x()) | sl<32>(UInt64(v.y()));
+    }
+
+    /// Masked version of \ref next_uint64
+    DRJIT_INLINE UInt64 next_uint64(const Mask &mask) {
+        UInt32x4 v = next_uint32x4(mask);
+        return UInt64(v.x()) | sl<32>(UInt64(v.y()));
+    }
+
+    /// Generate a single precision floating point value on the interval [0, 1)
+    DRJIT_INLINE Float32 next_float32() {
+        return reinterpret_array<Float32>(sr<9>(next_uint32()) | 0x3f800000u) - 1.f;
+    }
+
+    /// Masked version of \ref next_float32
+    DRJIT_INLINE Float32 next_float32(const Mask &mask) {
+        return reinterpret_array<Float32>(sr<9>(next_uint32(mask)) | 0x3f800000u) - 1.f;
+    }
+
+    /// Generate a double precision floating point value on the interval [0, 1)
+    DRJIT_INLINE Float64 next_float64() {
+        return reinterpret_array<Float64>(sr<12>(next_uint64()) |
+                                          0x3ff0000000000000ull) - 1.0;
+    }
+
+    /// Masked version of \ref next_float64
+    DRJIT_INLINE Float64 next_float64(const Mask &mask) {
+        return reinterpret_array<Float64>(sr<12>(next_uint64(mask)) |
+                                          0x3ff0000000000000ull) - 1.0;
+    }
+
+    /// Forward \ref next_float call to the correct method based given type size
+    template <typename Value,
+              enable_if_t<std::is_same_v<scalar_t<Value>, float> ||
+                          std::is_same_v<scalar_t<Value>, double>> = 0>
+    DRJIT_INLINE Value next_float() {
+        if constexpr (std::is_same_v<scalar_t<Value>, double>)
+            return next_float64();
+        else
+            return next_float32();
+    }
+
+    /// Forward \ref next_float call to the correct method based given type size (masked version)
+    template <typename Value,
+              enable_if_t<std::is_same_v<scalar_t<Value>, float> ||
+                          std::is_same_v<scalar_t<Value>, double>> = 0>
+    DRJIT_INLINE Value next_float(const Mask &mask) {
+        if constexpr (std::is_same_v<scalar_t<Value>, double>)
+            return next_float64(mask);
+        else
+            return next_float32(mask);
+    }
+
+    /// Equality operator
+    bool operator==(const Philox4x32 &other) const {
+        return counter == other.counter && key == other.key && stream == other.stream;
+    }
+
+    /// Inequality operator
+    bool operator!=(const Philox4x32 &other) const { return !operator==(other); }
+
+    UInt64 counter; // Low 64 bits of the counter, advanced by every call
+    UInt64 key;     // 64-bit key (seed)
+    UInt64 stream;  // High 64 bits of the counter, selects the stream
+
+    DRJIT_STRUCT_NODEF(Philox4x32, counter, key, stream)
+private:
+    DRJIT_INLINE UInt32x4 eval_block() const {
+        return philox(UInt32x4(UInt32(counter), UInt32(sr<32>(counter)),
+                               UInt32(stream), UInt32(sr<32>(stream))),
+                      UInt32(key), UInt32(sr<32>(key)));
+    }
+};
+
+NAMESPACE_BEGIN(detail)
+/// Direction numbers of the Sobol sequence (dimensions 1-3, Joe & Kuo)
+inline constexpr uint32_t sobol_directions[3][32] = {
+    {
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+        0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+        0x80008000, 0xc000c000, 0xa000a000, 0xf000f000, 0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+        0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0, 0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff
+    },
+    {
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x5c000000, 0x8e000000, 0xc5000000,
+        0x68800000, 0x9cc00000, 0xee600000, 0x55900000, 0x80680000, 0xc09c0000, 0x60ee0000, 0x90550000,
+        0xe8808000, 0x5cc0c000, 0x8e606000, 0xc5909000, 0x6868e800, 0x9c9c5c00, 0xeeee8e00, 0x5555c500,
+        0x8000e880, 0xc0005cc0, 0x60008e60, 0x9000c590, 0xe8006868, 0x5c009c9c, 0x8e00eeee, 0xc5005555
+    },
+    {
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0x74000000, 0xa2000000, 0x93000000,
+        0xd8800000, 0x25400000, 0x59e00000, 0xe6d00000, 0x78080000, 0xb40c0000, 0x82020000, 0xc3050000,
+        0x208f8000, 0x51474000, 0xfbea2000, 0x75d93000, 0xa0858800, 0x914e5400, 0xdbe79e00, 0x25db6d00,
+        0x58800080, 0xe54000c0, 0x79e00020, 0xb6d00050, 0x800800f8, 0xc00c0074, 0x200200a2, 0x50050093
+    }
+};
+NAMESPACE_END(detail)
+
+/**
+ * \brief Owen-scrambled Sobol low-discrepancy sampler
+ *
+ * This class implements the shuffled and scrambled Sobol sampler described
+ * in "Practical Hash-based Owen Scrambling" by Brent Burley (JCGT 2020).
+ * Dimensions are handled in blocks of four: within each block, the sample
+ * index is shuffled and the first four dimensions of the Sobol sequence are
+ * evaluated and Owen-scrambled using a hash-based nested uniform
+ * permutation. Higher dimensions are obtained by reseeding, which pads
+ * the sequence with decorrelated 4D blocks.
+ *
+ * Each lane evaluates sample \ref index of the sequence selected by \ref
+ * seed, and all lanes sharing a seed form a single stratified point set.
+ * Successive calls to \ref next_float32() etc. advance to the next
+ * dimension. The direction numbers are compile-time constants, hence
+ * evaluation requires no memory lookups.
+ */
+template <typename T> struct Sobol {
+    /* Some convenient type aliases for vectorization */
+    using UInt32     = uint32_array_t<T>;
+    using Float64    = float64_array_t<T>;
+    using Float32    = float32_array_t<T>;
+    using Mask       = mask_t<UInt32>;
+
+    /**
+     * \brief Initialize the sampler to generate \c size samples in parallel
+     *
+     * Lane \c i evaluates sample <tt>index + i</tt> of the sequence
+     * associated with \c seed.
+     */
+    Sobol(size_t size = 1, const UInt32 &seed = 0, const UInt32 &index = 0)
+        : index(index + arange<UInt32>(size)), seed(seed),
+          dim(zeros<UInt32>(size)) { }
+
+    /// Generate the next dimension as an unsigned 32-bit integer
+    DRJIT_INLINE UInt32 next_uint32() {
+        UInt32 result = sample(index, seed, dim);
+        dim += 1u;
+        return result;
+    }
+
+    /// Masked version of \ref next_uint32
+    DRJIT_INLINE UInt32 next_uint32(const Mask &mask) {
+        UInt32 result = sample(index, seed, dim);
+        masked(dim, mask) += 1u;
+        return result;
+    }
+
+    /// Generate the next dimension as a single precision value on the interval [0, 1)
+    DRJIT_INLINE Float32 next_float32() {
+        return reinterpret_array<Float32>(sr<9>(next_uint32()) | 0x3f800000u) - 1.f;
+    }
+
+    /// Masked version of \ref next_float32
+    DRJIT_INLINE Float32 next_float32(const Mask &mask) {
+        return reinterpret_array<Float32>(sr<9>(next_uint32(mask)) | 0x3f800000u) - 1.f;
+    }
+
+    /// Generate the next dimension as a double precision value on the interval [0, 1)
+    DRJIT_INLINE Float64 next_float64() {
+        return reinterpret_array<Float64>(sl<20>(uint64_array_t<T>(next_uint32())) |
+                                          0x3ff0000000000000ull) - 1.0;
+    }
+
+    /// Masked version of \ref next_float64
+    DRJIT_INLINE Float64 next_float64(const Mask &mask) {
+        return reinterpret_array<Float64>(sl<20>(uint64_array_t<T>(next_uint32(mask))) |
+                                          0x3ff0000000000000ull) - 1.0;
+    }
+
+    /// Forward \ref next_float call to the correct method based given type size
+    template <typename Value,
+              enable_if_t<std::is_same_v<scalar_t<Value>, float> ||
+                          std::is_same_v<scalar_t<Value>, double>> = 0>
+    DRJIT_INLINE Value next_float() {
+        if constexpr (std::is_same_v<scalar_t<Value>, double>)
+            return next_float64();
+        else
+            return next_float32();
+    }
+
+    /// Forward \ref next_float call to the correct method based given type size (masked version)
+    template <typename Value,
+              enable_if_t<std::is_same_v<scalar_t<Value>, float> ||
+                          std::is_same_v<scalar_t<Value>, double>> = 0>
+    DRJIT_INLINE Value next_float(const Mask &mask) {
+        if constexpr (std::is_same_v<scalar_t<Value>, double>)
+            return next_float64(mask);
+        else
+            return next_float32(mask);
+    }
+
+    /// Evaluate dimension \c dim of sample \c index of the sequence \c seed
+    static UInt32 sample(const UInt32 &index, const UInt32 &seed,
+                         const UInt32 &dim) {
+        UInt32 d = dim & 3u,
+               block_seed = hash_combine(seed, sr<2>(dim));
+
+        UInt32 i = nested_uniform_scramble(index, block_seed);
+
+        // Multiply the index by the generator matrix of dimension 'd'
+        UInt32 value = 0;
+        for (uint32_t b = 0; b < 32; ++b) {
+            UInt32 dir = select(d == 1u, UInt32(detail::sobol_directions[0][b]),
+                         select(d == 2u, UInt32(detail::sobol_directions[1][b]),
+                                         UInt32(detail::sobol_directions[2][b])));
+            value ^= dir & (UInt32(0) - ((i >> b) & 1u));
+        }
+        value = select(d == 0u, brev(i), value);
+
+        return nested_uniform_scramble(value, hash_combine(block_seed, d));
+    }
+
+    UInt32 index; // Sample index
+    UInt32 seed;  // Selects the scrambled sequence
+    UInt32 dim;   // Next dimension to be generated
+
+    DRJIT_STRUCT_NODEF(Sobol, index, seed, dim)
+private:
+    static DRJIT_INLINE UInt32 hash_combine(const UInt32 &seed, const UInt32 &v) {
+        return seed ^ (v + sl<6>(seed) + sr<2>(seed));
+    }
+
+    /// Laine-Karras style permutation (Burley's variant)
+    static DRJIT_INLINE UInt32 laine_karras(UInt32 x, const UInt32 &seed) {
+        x ^= x * 0x3d20adeau;
+        x += seed;
+        x *= sr<16>(seed) | 1u;
+        x ^= x * 0x05526c56u;
+        x ^= x * 0x53a22864u;
+        return x;
+    }
+
+    static DRJIT_INLINE UInt32 nested_uniform_scramble(const UInt32 &x,
+                                                       const UInt32 &seed) {
+        return brev(laine_karras(brev(x), seed));
+    }
+};
+
 NAMESPACE_END(drjit)
@@ -17,10 +17,305 @@
 #pragma once
 
 #include <drjit/array.h>
+#include <memory>
 #include <stdexcept>
 
 NAMESPACE_BEGIN(drjit)
 
+NAMESPACE_BEGIN(detail)
+
+/// Square root that can be evaluated within constant expressions
+constexpr double sh_sqrt(double x) {
+    if (x <= 0.0)
+        return 0.0;
+    double r = x > 1.0 ? x : 1.0;
+    while (true) {
+        double r2 = 0.5 * (r + x / r);
+        if (r2 >= r)
+            return r;
+        r = r2;
+    }
+}
+
+/**
+ * Normalized associated Legendre function of degree and order ``m`` (which
+ * is a constant once the factor ``sin(theta)^m`` has been moved to the
+ * azimuthal part). This includes the Condon-Shortley phase and the factor
+ * ``sqrt(2)`` of the real basis functions with ``m != 0``.
+ */
+constexpr double sh_diag(size_t m) {
+    double y = 0.28209479177387814;
+    for (size_t k = 1; k <= m; ++k)
+        y *= -sh_sqrt((2.0 * k + 1.0) / (2.0 * k));
+    return m > 0 ? y * 1.4142135623730951 : y;
+}
+
+/// Coefficients of the three-term recurrence along the degree ``l``
+constexpr double sh_rec_a(size_t l, size_t m) {
+    double l2 = double(l * l), m2 = double(m * m);
+    return sh_sqrt((4.0 * l2 - 1.0) / (l2 - m2));
+}
+
+constexpr double sh_rec_b(size_t l, size_t m) {
+    double l2 = double(l * l), m2 = double(m * m),
+           l1 = double((l - 1) * (l - 1));
+    return sh_sqrt((2.0 * l + 1.0) * (l1 - m2) / ((2.0 * l - 3.0) * (l2 - m2)));
+}
+
+template <size_t Order, size_t M, size_t L, typename Value, typename Emit>
+DRJIT_INLINE void sh_eval_degree(const Value &z, const Value &p1,
+                                 const Value &p2, Emit &emit) {
+    if constexpr (L <= Order) {
+        using Scalar = scalar_t<Value>;
+        constexpr double a = sh_rec_a(L, M), b = -sh_rec_b(L, M);
+        Value p = fmadd(z * Scalar(a), p1, p2 * Scalar(b));
+        emit(L, p);
+        sh_eval_degree<Order, M, L + 1>(z, p, p1, emit);
+    }
+}
+
+template <size_t Order, size_t M, typename Value, typename Func>
+DRJIT_INLINE void sh_eval_order(const Value &x, const Value &y, const Value &z,
+                                Value &c, Value &s, Func &func) {
+    if constexpr (M <= Order) {
+        using Scalar = scalar_t<Value>;
+
+        // Azimuthal part: c + i*s = (x + i*y)^M
+        if constexpr (M > 1) {
+            Value c2 = fmsub(x, c, y * s);
+            s = fmadd(x, s, y * c);
+            c = c2;
+        }
+
+        auto emit = [&](size_t l, const Value &v) {
+            if constexpr (M == 0) {
+                func(l * (l + 1), v);
+            } else {
+                func(l * (l + 1) + M, v * c);
+                func(l * (l + 1) - M, v * s);
+            }
+        };
+
+        constexpr double pmm = sh_diag(M);
+        Value p2 = Value(Scalar(pmm));
+        emit(M, p2);
+
+        if constexpr (M < Order) {
+            Value p1 = z * Scalar(sh_sqrt(2.0 * M + 3.0) * pmm);
+            emit(M + 1, p1);
+            sh_eval_degree<Order, M, M + 2>(z, p1, p2, emit);
+        }
+
+        sh_eval_order<Order, M + 1>(x, y, z, c, s, func);
+    }
+}
+
+/**
+ * Evaluate all basis functions up to the given order and invoke
+ * ``func(index, value)`` for each one of them. The recurrence is fully
+ * unrolled at compile time, and its intermediates are shared between
+ * the basis functions.
+ */
+template <size_t Order, typename Vector3f, typename Func>
+DRJIT_INLINE void sh_eval_all(const Vector3f &d, Func &&func) {
+    static_assert(size_v<Vector3f> == 3, "The parameter 'd' should be a 3D vector.");
+    using Value = value_t<Vector3f>;
+    Value x = d.x(), y = d.y(), z = d.z(), c = x, s = y;
+    sh_eval_order<Order, 0>(x, y, z, c, s, func);
+}
+
+/// Variant of the same recurrence for an order that is only known at runtime
+template <typename Vector3f>
+void sh_eval_rt(const Vector3f &d, size_t order, value_t<Vector3f> *out) {
+    static_assert(size_v<Vector3f> == 3, "The parameter 'd' should be a 3D vector.");
+
+    using Value = value_t<Vector3f>;
+    using Scalar = scalar_t<Value>;
+
+    Value x = d.x(), y = d.y(), z = d.z(), c = x, s = y;
+
+    for (size_t m = 0; m <= order; ++m) {
+        if (m > 1) {
+            Value c2 = fmsub(x, c, y * s);
+            s = fmadd(x, s, y * c);
+            c = c2;
+        }
+
+        auto emit = [&](size_t l, const Value &v) {
+            if (m == 0) {
+                out[l * (l + 1)] = v;
+            } else {
+                out[l * (l + 1) + m] = v * c;
+                out[l * (l + 1) - m] = v * s;
+            }
+        };
+
+        double pmm = sh_diag(m);
+        Value p2 = Value(Scalar(pmm));
+        emit(m, p2);
+        if (m == order)
+            continue;
+
+        Value p1 = z * Scalar(sh_sqrt(2.0 * m + 3.0) * pmm);
+        emit(m + 1, p1);
+
+        for (size_t l = m + 2; l <= order; ++l) {
+            Value p = fmadd(z * Scalar(sh_rec_a(l, m)), p1,
+                            p2 * Scalar(-sh_rec_b(l, m)));
+            emit(l, p);
+            p2 = p1;
+            p1 = p;
+        }
+    }
+}
+
+NAMESPACE_END(detail)
+
+/**
+ * \brief Evaluate the real spherical harmonics basis functions up to order
+ * ``Order`` (which can be arbitrarily high) with respect to the normalized
+ * direction ``d``.
+ *
+ * The function writes ``(Order+1)^2`` values to ``out``. The basis functions
+ * are generated via the recurrence of the normalized associated Legendre
+ * polynomials, which is unrolled at compile time. The result matches that of
+ * the pre-generated ``sh_eval_0()`` to ``sh_eval_9()`` routines.
+ */
+template <size_t Order, typename Vector3f>
+void sh_eval(const Vector3f &d, value_t<Vector3f> *out) {
+    using Value = value_t<Vector3f>;
+    detail::sh_eval_all<Order>(d, [out](size_t i, const Value &v) { out[i] = v; });
+}
+
+/**
+ * \brief Accumulate the projection of ``value`` (associated with direction
+ * ``d``) onto the spherical harmonics basis up to order ``Order``.
+ *
+ * This computes ``out[i] += value * Y_i(d)`` for all ``(Order+1)^2`` basis
+ * functions without storing them in a temporary buffer. Monte Carlo
+ * estimates of the projection coefficients are obtained by calling this
+ * function with sample weights folded into ``value`` and reducing the output
+ * over the samples.
+ */
+template <size_t Order, typename Vector3f, typename Value>
+void sh_project(const Vector3f &d, const Value &value, Value *out) {
+    detail::sh_eval_all<Order>(d, [&](size_t i, const value_t<Vector3f> &v) {
+        out[i] = fmadd(value, v, out[i]);
+    });
+}
+
+/**
+ * \brief Rotate the spherical harmonics coefficients ``in`` up to order
+ * ``Order`` by the 3x3 rotation matrix ``R`` and write them to ``out``.
+ *
+ * The rotated expansion satisfies ``f_out(d) = f_in(R^T d)``. The rotation
+ * matrix of each band is assembled from the previous one via the recurrence
+ * of Ivanic and Ruedenberg ("Rotation Matrices for Real Spherical Harmonics.
+ * Direct Determination by Recursion", J. Phys. Chem. 1996) and immediately
+ * applied to the coefficients of that band. Since the band matrices only
+ * depend on ``R``, evaluating them with a per-lane ``R`` rotates a batch of
+ * expansions at once, and the coefficients (``Value``) can also be
+ * multi-channel types such as colors.
+ */
+template <size_t Order, typename Matrix3, typename Value>
+void sh_rotate(const Matrix3 &R, const Value *in, Value *out) {
+    using Elem = std::decay_t<decltype(R(0, 0))>;
+    using Scalar = scalar_t<Elem>;
+
+    out[0] = in[0];
+
+    if constexpr (Order > 0) {
+        constexpr size_t MaxSize = (2 * Order + 1) * (2 * Order + 1);
+        std::unique_ptr<Elem[]> prev(new Elem[MaxSize]),
+                                cur(new Elem[MaxSize]);
+
+        // Band 1 in the (y, z, x) order of the basis, with the signs of
+        // the Condon-Shortley phase
+        const Elem r1[3][3] = { {  R(1, 1), -R(1, 2),  R(1, 0) },
+                                { -R(2, 1),  R(2, 2), -R(2, 0) },
+                                {  R(0, 1), -R(0, 2),  R(0, 0) } };
+
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j)
+                prev[i * 3 + j] = r1[i][j];
+
+        for (size_t i = 0; i < 3; ++i)
+            out[1 + i] = in[1] * r1[i][0] + in[2] * r1[i][1] + in[3] * r1[i][2];
+
+        for (int l = 2; l <= (int) Order; ++l) {
+            int size = 2 * l + 1, size_prev = 2 * l - 1;
+
+            // Entries of band 1 and band l-1, indexed relative to the center
+            auto r1c = [&](int i, int j) -> const Elem & { return r1[i + 1][j + 1]; };
+            auto rpc = [&](int i, int j) -> const Elem & {
+                return prev[(i + l - 1) * size_prev + (j + l - 1)];
+            };
+
+            auto P = [&](int i, int a, int b) -> Elem {
+                if (b == l)
+                    return fmsub(r1c(i, 1), rpc(a, l - 1), r1c(i, -1) * rpc(a, -l + 1));
+                else if (b == -l)
+                    return fmadd(r1c(i, 1), rpc(a, -l + 1), r1c(i, -1) * rpc(a, l - 1));
+                else
+                    return r1c(i, 0) * rpc(a, b);
+            };
+
+            for (int m = -l; m <= l; ++m) {
+                int am = m < 0 ? -m : m;
+                double d0 = m == 0 ? 1.0 : 0.0, d1 = am == 1 ? 1.0 : 0.0;
+
+                for (int n = -l; n <= l; ++n) {
+                    int an = n < 0 ? -n : n;
+                    double denom = an == l ? 2.0 * l * (2.0 * l - 1.0)
+                                           : double((l + n) * (l - n));
+
+                    double u = detail::sh_sqrt((l + m) * (l - m) / denom),
+                           v = 0.5 * detail::sh_sqrt((1.0 + d0) * (l + am - 1) * (l + am) / denom) * (1.0 - 2.0 * d0),
+                           w = -0.5 * detail::sh_sqrt((l - am - 1) * (l - am) / denom) * (1.0 - d0);
+
+                    Elem value = zeros<Elem>();
+
+                    if (u != 0.0)
+                        value = P(0, m, n) * Scalar(u);
+
+                    if (v != 0.0) {
+                        Elem tv;
+                        if (m == 0)
+                            tv = P(1, 1, n) + P(-1, -1, n);
+                        else if (m > 0)
+                            tv = d1 != 0.0 ? P(1, m - 1, n) * Scalar(detail::sh_sqrt(2.0))
+                                           : P(1, m - 1, n) - P(-1, -m + 1, n);
+                        else
+                            tv = d1 != 0.0 ? P(-1, -m - 1, n) * Scalar(detail::sh_sqrt(2.0))
+                                           : P(1, m + 1, n) + P(-1, -m - 1, n);
+                        value = fmadd(tv, Scalar(v), value);
+                    }
+
+                    if (w != 0.0) {
+                        Elem tw = m > 0 ? P(1, m + 1, n) + P(-1, -m - 1, n)
+                                        : P(1, m - 1, n) - P(-1, -m + 1, n);
+                        value = fmadd(tw, Scalar(w), value);
+                    }
+
+                    cur[(m + l) * size + (n + l)] = value;
+                }
+            }
+
+            // Apply the rotation matrix of this band
+            const Value *in_l = in + l * l;
+            Value *out_l = out + l * l;
+            for (int i = 0; i < size; ++i) {
+                Value acc = in_l[0] * cur[i * size];
+                for (int j = 1; j < size; ++j)
+                    acc += in_l[j] * cur[i * size + j];
+                out_l[i] = acc;
+            }
+
+            std::swap(prev, cur);
+        }
+    }
+}
+
 template <typename Vector3f>
 void sh_eval(const Vector3f &d, size_t order, value_t<Vector3f> *out) {
     switch (order) {
@@ -34,7 +329,7 @@ void sh_eval(const Vector3f &d, size_t order, value_t<Vector3f> *out) {
         case 7: sh_eval_7(d, out); break;
         case 8: sh_eval_8(d, out); break;
         case 9: sh_eval_9(d, out); break;
-        default: throw std::runtime_error("sh_eval(): order too high!");
+        default: detail::sh_eval_rt(d, order, out); break;
     }
 }
 
@@ -16,6 +16,7 @@
 #include <drjit/dynamic.h>
 #include <drjit/idiv.h>
 #include <drjit/jit.h>
+#include <drjit/morton.h>
 #include <drjit/tensor.h>
 
 #pragma once
@@ -41,6 +42,13 @@ enum class CudaTextureFormat : uint32_t {
     Float16 = 1, /// Half precision storage format
 };
 
+/// Block-compressed texture formats
+enum class BlockFormat : uint32_t {
+    BC1 = 0, /// RGB stored using 4 bits per texel (a.k.a. DXT1)
+    BC4 = 1, /// Single channel stored using 4 bits per texel
+    BC5 = 2  /// Two channels stored using 8 bits per texel
+};
+
 template <typename _Storage, size_t Dimension> class Texture {
 public:
     static constexpr bool IsCUDA = is_cuda_v<_Storage>;
@@ -53,6 +61,13 @@ public:
     static constexpr int CudaFormat = HasCudaTexture ? 
         IsHalf ? (int)CudaTextureFormat::Float16 : (int)CudaTextureFormat::Float32 : -1;
 
+    /// LLVM textures store a tiled copy of their texels to improve locality
+    static constexpr bool HasTiledLayout =
+        is_llvm_v<_Storage> && (Dimension == 2 || Dimension == 3);
+
+    /// Base-2 logarithm of the tile resolution along each axis (8x8 or 4x4x4)
+    static constexpr uint32_t TileShift = Dimension == 2 ? 3 : 2;
+
     using Int32 = int32_array_t<_Storage>;
     using UInt32 = uint32_array_t<_Storage>;
     using Storage = std::conditional_t<IsDynamic, _Storage, DynamicArray<_Storage>>;
@@ -69,8 +84,11 @@ public:
      * set_tensor() as much as possible.
      *
      * When \c use_accel is set to \c false on CUDA mode, the texture will not
-     * use the hardware acceleration (allocation and evaluation). In other modes
-     * this argument has no effect.
+     * use the hardware acceleration (allocation and evaluation). On the LLVM
+     * backend, \c use_accel causes 2D and 3D textures to maintain a second
+     * copy of their texels in a tiled layout (8x8 or 4x4x4 tiles with
+     * Morton-ordered texels), which keeps interpolation footprints within a
+     * few cache lines. In other modes this argument has no effect.
      *
      * The \c filter_mode parameter defines the interpolation method to be used
      * in all evaluation routines. By default, the texture is linearly
@@ -127,6 +145,7 @@ public:
         m_size = other.m_size;
         m_shape_opaque = std::move(other.m_shape_opaque);
         m_value = std::move(other.m_value);
+        m_tiled = std::move(other.m_tiled);
         for (size_t i = 0; i < Dimension; ++i)
             m_inv_resolution[i] = std::move(other.m_inv_resolution[i]);
         m_filter_mode = other.m_filter_mode;
@@ -143,6 +162,7 @@ public:
         m_size = other.m_size;
         m_shape_opaque = std::move(other.m_shape_opaque);
         m_value = std::move(other.m_value);
+        m_tiled = std::move(other.m_tiled);
         for (size_t i = 0; i < Dimension; ++i)
             m_inv_resolution[i] = std::move(other.m_inv_resolution[i]);
         m_filter_mode = other.m_filter_mode;
@@ -213,6 +233,7 @@ public:
         }
 
         m_value.array() = value;
+        update_tiled();
     }
 
     /**
@@ -276,6 +297,59 @@ public:
         set_value(tensor.array(), migrate);
     }
 
+    /**
+     * \brief Override a box-shaped sub-region of the texture
+     *
+     * The box starts at texel \c offset and has size \c extent. Both use
+     * the same axis order as the tensor shape. The array \c values stores
+     * the new texels of the box in row-major order, including all channels.
+     *
+     * The update is applied to the (AD-tracked) texture data with a single
+     * scatter, and the texture keeps its migration status. This avoids
+     * assembling and re-uploading a full tensor on the host side when only a
+     * small tile changes.
+     */
+    void update_region(const size_t offset[Dimension],
+                       const size_t extent[Dimension], const Storage &values) {
+        using UInt32S = uint32_array_t<Storage>;
+
+        const size_t channels = m_value.shape(Dimension);
+        size_t count = channels;
+        for (size_t i = 0; i < Dimension; ++i) {
+            if (offset[i] + extent[i] > m_value.shape(i))
+                jit_raise("Texture::update_region(): region is out of bounds!");
+            count *= extent[i];
+        }
+
+        if (values.size() != count)
+            jit_raise("Texture::update_region(): unexpected array size!");
+        if (count == 0)
+            return;
+
+        // Decompose the region-relative index into per-axis coordinates
+        UInt32S idx = arange<UInt32S>(count);
+        auto [texel, ch] = idivmod(idx, divisor<uint32_t>((uint32_t) channels));
+
+        UInt32S coord[Dimension];
+        for (size_t i = Dimension - 1; i > 0; --i) {
+            auto [q, r] = idivmod(texel, divisor<uint32_t>((uint32_t) extent[i]));
+            coord[i] = r;
+            texel = q;
+        }
+        coord[0] = texel;
+
+        UInt32S target = 0;
+        for (size_t i = 0; i < Dimension; ++i)
+            target = fmadd(target, (uint32_t) m_value.shape(i),
+                           coord[i] + (uint32_t) offset[i]);
+        target = fmadd(target, (uint32_t) channels, ch);
+
+        bool migrated = m_migrated;
+        Storage updated = tensor().array(); // Will un-migrate the data if necessary
+        scatter(updated, values, target);
+        set_value(updated, migrated);
+    }
+
     const Storage &value() const { return tensor().array(); }
 
     /**
@@ -374,10 +448,10 @@ public:
             const PosI pos_i = floor2int<PosI>(pos_f);
             const PosI pos_i_w = wrap(pos_i);
 
-            UInt32 idx = index(pos_i_w);
+            UInt32 idx = texel_index(pos_i_w);
 
-            for (uint32_t ch = 0; ch < channels; ++ch)
-                out[ch] = Value(gather<_Storage>(m_value.array(), idx + ch, active));
+            gather_texel<Value>(idx, active,
+                                [&](uint32_t ch, const Value &v) { out[ch] = v; });
         } else {
             using InterpOffset = Array<Int32, ipow(2, Dimension)>;
             using InterpPosI = Array<InterpOffset, Dimension>;
@@ -390,7 +464,7 @@ public:
 
             InterpPosI pos_i_w = interp_positions<PosI, 2>(offset, pos_i);
             pos_i_w = wrap(pos_i_w);
-            InterpIdx idx = index(pos_i_w);
+            InterpIdx idx = texel_index(pos_i_w);
 
             for (uint32_t ch = 0; ch < channels; ++ch)
                 out[ch] = zeros<Value>();
@@ -399,12 +473,10 @@ public:
                 {                                                              \
                     UInt32 index_ = index;                                     \
                     Value weight_ = weight;                                    \
-                    for (uint32_t ch = 0; ch < channels; ++ch)                 \
-                        out[ch] = fmadd(                                       \
-                            Value(gather<_Storage>(                            \
-                                m_value.array(), index_ + ch, active)),        \
-                            weight_,                                           \
-                            out[ch]);                                          \
+                    gather_texel<Value>(                                       \
+                        index_, active, [&](uint32_t ch, const Value &v) {     \
+                            out[ch] = fmadd(v, weight_, out[ch]);              \
+                        });                                                    \
                 }
 
             const PosF w1 = pos_f - pos_i, w0 = 1.f - w1;
@@ -585,12 +657,12 @@ public:
 
         InterpPosI pos_i_w = interp_positions<PosI, 2>(offset, pos_i);
         pos_i_w = wrap(pos_i_w);
-        InterpIdx idx = index(pos_i_w);
+        InterpIdx idx = texel_index(pos_i_w);
 
-        const uint32_t channels = (uint32_t) m_value.shape(Dimension);
         for (size_t i = 0; i < InterpOffset::Size; ++i)
-            for (uint32_t ch = 0; ch < channels; ++ch)
-                out[i][ch] = Value(gather<_Storage>(m_value.array(), idx[i] + ch, active));
+            gather_texel<Value>(
+                idx[i], active,
+                [&](uint32_t ch, const Value &v) { out[i][ch] = v; });
     }
 
     /**
@@ -673,7 +745,7 @@ public:
 
         InterpPosI pos_i_w = interp_positions<PosI, 4>(offset, pos_i);
         pos_i_w = wrap(pos_i_w);
-        InterpIdx idx = index(pos_i_w);
+        InterpIdx idx = texel_index(pos_i_w);
 
         PosF pos_a = pos_f - PosF(pos_i);
 
@@ -697,12 +769,10 @@ public:
             {                                                                  \
                 UInt32 index_ = index;                                         \
                 Value weight_ = weight;                                        \
-                for (uint32_t ch = 0; ch < channels; ++ch)                     \
-                    out[ch] = fmadd(                                           \
-                        Value(gather<_Storage>(                                \
-                            m_value.array(), index_ + ch, active)),            \
-                        weight_,                                               \
-                        out[ch]);                                              \
+                gather_texel<Value>(                                           \
+                    index_, active, [&](uint32_t ch, const Value &v) {         \
+                        out[ch] = fmadd(v, weight_, out[ch]);                  \
+                    });                                                        \
             }
 
         if constexpr (Dimension == 1) {
@@ -879,6 +949,114 @@ public:
         }
     }
 
+    /**
+     * \brief Evaluate a clamped cubic B-Spline interpolant for a coherent
+     * block of \c count query positions
+     *
+     * Queries that originate from a screen tile or a ray march typically
+     * reference a small neighborhood of the texture. This function computes
+     * the bounding box of all 4^Dimension footprints and copies this tile
+     * (with the wrap mode already applied) into a contiguous local buffer
+     * once. All queries are then evaluated from the buffer, which replaces
+     * 4^Dimension wrapped gathers per query with a single pass over the
+     * tile. When the tile would exceed \c max_tile texels, the function falls
+     * back to evaluating the queries one by one.
+     *
+     * The output array \c out must have space for <tt>count * channels</tt>
+     * entries and is written in query-major order. This code path requires
+     * scalar queries on a non-JIT texture. Otherwise, the function simply
+     * forwards each query to \ref eval_cubic().
+     */
+    template <typename Value>
+    void eval_cubic_block(const Array<Value, Dimension> *pos, size_t count,
+                          Value *out, size_t max_tile = 4096) const {
+        const size_t channels = m_value.shape(Dimension);
+
+        if constexpr (IsDynamic || !std::is_scalar_v<Value>) {
+            DRJIT_MARK_USED(max_tile);
+            for (size_t i = 0; i < count; ++i)
+                eval_cubic(pos[i], out + i * channels);
+        } else {
+            using PosF = Array<Value, Dimension>;
+            using PosI = Array<int32_t, Dimension>;
+
+            if (count == 0)
+                return;
+
+            const PosF res_f = PosF(m_shape_opaque);
+
+            // Determine the bounding box of all cubic footprints
+            PosI lo = PosI(INT32_MAX), hi = PosI(INT32_MIN);
+            for (size_t i = 0; i < count; ++i) {
+                PosI p = floor2int<PosI>(fmadd(pos[i], res_f, -.5f)) - 1;
+                lo = minimum(lo, p);
+                hi = maximum(hi, p + 3);
+            }
+
+            PosI extent = hi - lo + 1;
+            size_t texels = 1;
+            for (size_t d = 0; d < Dimension; ++d)
+                texels *= (size_t) extent[d];
+
+            if (texels > max_tile) {
+                for (size_t i = 0; i < count; ++i)
+                    eval_cubic_helper(pos[i], out + i * channels);
+                return;
+            }
+
+            // Load the tile once, resolving the wrap mode for every texel
+            vector<Value> tile(texels * channels);
+            const scalar_t<_Storage> *data = m_value.array().data();
+            for (size_t t = 0; t < texels; ++t) {
+                PosI p;
+                size_t rem = t;
+                for (size_t d = 0; d < Dimension; ++d) {
+                    p[d] = lo[d] + (int32_t) (rem % (size_t) extent[d]);
+                    rem /= (size_t) extent[d];
+                }
+                uint32_t src = index(wrap(p));
+                for (size_t ch = 0; ch < channels; ++ch)
+                    tile[t * channels + ch] = Value(data[src + ch]);
+            }
+
+            // Evaluate all queries from the tile
+            for (size_t i = 0; i < count; ++i) {
+                PosF pos_f = fmadd(pos[i], res_f, -.5f);
+                PosI pos_i = floor2int<PosI>(pos_f);
+                PosF alpha = pos_f - PosF(pos_i);
+                PosI base = pos_i - 1 - lo;
+
+                Value w[Dimension][4];
+                for (size_t d = 0; d < Dimension; ++d) {
+                    Value a = alpha[d], a2 = a * a, a3 = a2 * a;
+                    w[d][0] = (-a3 + 3.f * a2 - 3.f * a + 1.f) * (1.f / 6.f);
+                    w[d][1] = (3.f * a3 - 6.f * a2 + 4.f) * (1.f / 6.f);
+                    w[d][2] = (-3.f * a3 + 3.f * a2 + 3.f * a + 1.f) * (1.f / 6.f);
+                    w[d][3] = a3 * (1.f / 6.f);
+                }
+
+                Value *result = out + i * channels;
+                for (size_t ch = 0; ch < channels; ++ch)
+                    result[ch] = 0.f;
+
+                for (uint32_t tap = 0; tap < ipow(4u, Dimension); ++tap) {
+                    size_t offset = 0, stride = 1;
+                    Value weight = 1.f;
+                    for (size_t d = 0; d < Dimension; ++d) {
+                        uint32_t k = (tap >> (2 * d)) & 3u;
+                        offset += (size_t) (base[d] + (int32_t) k) * stride;
+                        stride *= (size_t) extent[d];
+                        weight *= w[d][k];
+                    }
+
+                    const Value *texel = tile.data() + offset * channels;
+                    for (size_t ch = 0; ch < channels; ++ch)
+                        result[ch] = fmadd(texel[ch], weight, result[ch]);
+                }
+            }
+        }
+    }
+
     /**
      * \brief Evaluate the positional gradient of a cubic B-Spline
      *
@@ -913,7 +1091,7 @@ public:
 
         InterpPosI pos_i_w = interp_positions<PosI, 4>(offset, pos_i);
         pos_i_w = wrap(pos_i_w);
-        InterpIdx idx = index(pos_i_w);
+        InterpIdx idx = texel_index(pos_i_w);
 
         PosF pos_a = pos_f - PosF(pos_i);
 
@@ -950,9 +1128,9 @@ public:
         #define DR_TEX_CUBIC_GATHER(index)                                     \
             {                                                                  \
                 UInt32 index_ = index;                                         \
-                for (uint32_t ch = 0; ch < channels; ++ch)                     \
-                    values[ch] = Value(gather<_Storage>(                       \
-                                    m_value.array(), index_ + ch, active));    \
+                gather_texel<Value>(                                           \
+                    index_, active,                                            \
+                    [&](uint32_t ch, const Value &v) { values[ch] = v; });     \
             }
         #define DR_TEX_CUBIC_ACCUM_VALUE(weight)                               \
             {                                                                  \
@@ -1053,7 +1231,7 @@ public:
 
         InterpPosI pos_i_w = interp_positions<PosI, 4>(offset, pos_i);
         pos_i_w = wrap(pos_i_w);
-        InterpIdx idx = index(pos_i_w);
+        InterpIdx idx = texel_index(pos_i_w);
 
         PosF pos_a = pos_f - PosF(pos_i);
 
@@ -1103,9 +1281,9 @@ public:
         #define DR_TEX_CUBIC_GATHER(index)                                     \
             {                                                                  \
                 UInt32 index_ = index;                                         \
-                for (uint32_t ch = 0; ch < channels; ++ch)                     \
-                    values[ch] = Value(gather<_Storage>(                       \
-                                    m_value.array(), index_ + ch, active));    \
+                gather_texel<Value>(                                           \
+                    index_, active,                                            \
+                    [&](uint32_t ch, const Value &v) { values[ch] = v; });     \
             }
         #define DR_TEX_CUBIC_ACCUM_VALUE(weight)                               \
             {                                                                  \
@@ -1284,9 +1462,74 @@ protected:
                     (int) filter_mode, (int) wrap_mode);
             }
         }
+
+        if (init_tensor)
+            update_tiled();
+    }
+
+    /// Rebuild the tiled copy of the texels (see \ref texel_index())
+    void update_tiled() {
+        if constexpr (HasTiledLayout) {
+            if (!m_use_accel) {
+                m_tiled = Storage();
+                return;
+            }
+
+            constexpr uint32_t TileSize = 1u << TileShift;
+            const uint32_t channels = (uint32_t) m_value.shape(Dimension);
+
+            // Resolution and tile count along each axis (width first)
+            uint32_t res[Dimension], tiles[Dimension];
+            size_t tile_count = 1;
+            for (size_t i = 0; i < Dimension; ++i) {
+                res[i] = (uint32_t) m_value.shape(Dimension - 1 - i);
+                tiles[i] = (res[i] + TileSize - 1) >> TileShift;
+                tile_count *= tiles[i];
+            }
+
+            size_t size = (tile_count << (TileShift * Dimension)) * channels;
+            if (size == 0) {
+                m_tiled = Storage();
+                return;
+            }
+
+            auto [slot, ch] = idivmod(arange<UInt32>(size),
+                                      divisor<uint32_t>(channels));
+
+            Array<UInt32, Dimension> local = morton_decode<Array<UInt32, Dimension>>(
+                slot & (ipow(TileSize, Dimension) - 1));
+            UInt32 tile = sr<TileShift * Dimension>(slot);
+
+            // Padding texels replicate the boundary
+            UInt32 coord[Dimension];
+            for (size_t i = 0; i < Dimension; ++i) {
+                auto [q, r] = idivmod(tile, divisor<uint32_t>(tiles[i]));
+                coord[i] = minimum(fmadd(r, TileSize, local[i]), res[i] - 1);
+                tile = q;
+            }
+
+            UInt32 src = 0;
+            for (size_t i = Dimension; i-- > 0;)
+                src = fmadd(src, res[i], coord[i]);
+
+            m_tiled = gather<Storage>(m_value.array(), fmadd(src, channels, ch));
+            drjit::eval(m_tiled);
+        }
     }
 
 private:
+    /// Packet gather of all 2^Shift channels of a texel (see \ref gather_texel())
+    template <typename Value, uint32_t Shift, typename Mask, typename Func>
+    void gather_texel_packet(const UInt32 &index, const Mask &active,
+                             Func &func) const {
+        using Packet = Array<_Storage, 1u << Shift>;
+
+        // 'index' is a multiple of the channel count, i.e., packet-aligned
+        Packet texel = gather<Packet>(texels(), sr<Shift>(index), active);
+        for (uint32_t ch = 0; ch < Packet::Size; ++ch)
+            func(ch, Value(texel[ch]));
+    }
+
     /// Helper function to reverse the tensor (\ref Texture.m_value) shape
     void reverse_tensor_shape(size_t *output, bool include_channels) const {
         for (size_t i = 0; i < Dimension; ++i)
@@ -1373,11 +1616,88 @@ private:
         return index * channels;
     }
 
+    /**
+     * \brief Compute the index of a texel in the array returned by
+     * \ref texels()
+     *
+     * This equals \ref index() unless the texture uses the tiled layout
+     * (see \ref HasTiledLayout), where the tiles are stored in row-major
+     * order and the texels of each tile follow a Morton curve.
+     */
+    template <typename T>
+    uint32_array_t<value_t<T>> texel_index(const T &pos) const {
+        if constexpr (HasTiledLayout) {
+            if (m_use_accel) {
+                using Index = uint32_array_t<value_t<T>>;
+                using IndexD = Array<Index, Dimension>;
+                constexpr uint32_t TileSize = 1u << TileShift;
+
+                IndexD p = IndexD(pos),
+                       tile = sr<TileShift>(p),
+                       local = p & (TileSize - 1);
+
+                UInt32 tiles_x = sr<TileShift>(m_shape_opaque.x() + (TileSize - 1));
+
+                Index tile_index;
+                if constexpr (Dimension == 2) {
+                    tile_index = fmadd(tile.y(), tiles_x, tile.x());
+                } else {
+                    UInt32 tiles_y = sr<TileShift>(m_shape_opaque.y() + (TileSize - 1));
+                    tile_index = fmadd(fmadd(tile.z(), tiles_y, tile.y()),
+                                       tiles_x, tile.x());
+                }
+
+                uint32_t channels = (uint32_t) m_value.shape(Dimension);
+                return (sl<TileShift * Dimension>(tile_index) |
+                        morton_encode(local)) * channels;
+            }
+        }
+
+        return index(pos);
+    }
+
+    /**
+     * \brief Gather all channels of the texel at \c index (computed by
+     * \ref texel_index()) and invoke <tt>func(channel, value)</tt> for each
+     *
+     * JIT textures with 2, 4, or 8 channels fetch the texel using a single
+     * packet gather instead of one gather per channel.
+     */
+    template <typename Value, typename Mask, typename Func>
+    DRJIT_INLINE void gather_texel(const UInt32 &index, const Mask &active,
+                                   Func &&func) const {
+        const uint32_t channels = (uint32_t) m_value.shape(Dimension);
+
+        if constexpr (is_jit_v<_Storage>) {
+            switch (channels) {
+                case 2: gather_texel_packet<Value, 1>(index, active, func); return;
+                case 4: gather_texel_packet<Value, 2>(index, active, func); return;
+                case 8: gather_texel_packet<Value, 3>(index, active, func); return;
+                default: break;
+            }
+        }
+
+        for (uint32_t ch = 0; ch < channels; ++ch)
+            func(ch, Value(gather<_Storage>(texels(), index + ch, active)));
+    }
+
+    /// Return the texel array addressed by \ref texel_index()
+    const Storage &texels() const {
+        if constexpr (HasTiledLayout) {
+            if (m_use_accel)
+                return m_tiled;
+        }
+        return m_value.array();
+    }
+
 private:
     void *m_handle = nullptr;
     size_t m_size = 0;
     mutable TensorXf m_value;
 
+    /// Tiled copy of \ref m_value used by LLVM textures (see \ref texel_index())
+    Storage m_tiled;
+
     // Stored in this order: width, height, depth
     Array<UInt32, Dimension> m_shape_opaque;
     divisor<int32_t> m_inv_resolution[Dimension] { };
@@ -1388,4 +1708,826 @@ private:
     mutable bool m_migrated = false;
 };
 
+/**
+ * \brief Stack of textures that share a resolution and are sampled together
+ *
+ * Material models frequently sample several textures (albedo, roughness,
+ * normals, ..) at the same position. Evaluating them one by one repeats the
+ * coordinate conversion, wrapping, index and weight computation for every
+ * texture. This class instead packs the channels of all layers into a single
+ * interleaved \ref Texture with <tt>sum(channels)</tt> channels. A single
+ * call to \ref eval() then computes the lookup footprint once and returns all
+ * channels of all layers. On CUDA, the packed texture is created with one
+ * hardware texture lookup per group of four channels that share the same
+ * coordinates, and the fallback path \ref Texture::eval_nonaccel() issues
+ * contiguous gathers per texel.
+ *
+ * All layers must have the same spatial resolution, but they may have
+ * different channel counts. The outputs of layer \c i start at
+ * <tt>channel_offset(i)</tt>.
+ */
+template <typename _Storage, size_t Dimension> class TextureArray {
+public:
+    using Tex = Texture<_Storage, Dimension>;
+    using Storage = typename Tex::Storage;
+    using TensorXf = typename Tex::TensorXf;
+    using UInt32 = uint32_array_t<Storage>;
+
+    /// Default constructor: create an invalid texture array
+    TextureArray() = default;
+
+    /**
+     * \brief Create a texture array from \c count tensors
+     *
+     * The remaining parameters have the same meaning as in the corresponding
+     * \ref Texture constructor.
+     */
+    TextureArray(const TensorXf *layers, size_t count, bool use_accel = true,
+                 bool migrate = true,
+                 FilterMode filter_mode = FilterMode::Linear,
+                 WrapMode wrap_mode = WrapMode::Clamp) {
+        m_texture = Tex(pack(layers, count), use_accel, migrate, filter_mode,
+                        wrap_mode);
+    }
+
+    /// Return the number of layers
+    size_t layer_count() const { return m_channels.size(); }
+
+    /// Return the number of channels of layer \c i
+    size_t channels(size_t i) const { return m_channels[i]; }
+
+    /// Return the index of the first output channel of layer \c i
+    size_t channel_offset(size_t i) const { return m_offsets[i]; }
+
+    /// Return the total number of channels of all layers
+    size_t total_channels() const { return m_texture.shape()[Dimension]; }
+
+    /// Return the underlying packed texture
+    const Tex &texture() const { return m_texture; }
+
+    /**
+     * \brief Replace all layers
+     *
+     * Like \ref Texture::set_tensor(), changing the resolution or number of
+     * channels is supported but more costly on CUDA.
+     */
+    void set_layers(const TensorXf *layers, size_t count, bool migrate = false) {
+        m_texture.set_tensor(pack(layers, count), migrate);
+    }
+
+    /**
+     * \brief Evaluate all layers at the position \c pos
+     *
+     * The array \c out must have space for \ref total_channels() entries.
+     */
+    template <typename Value>
+    void eval(const Array<Value, Dimension> &pos, Value *out,
+              mask_t<Value> active = true) const {
+        m_texture.eval(pos, out, active);
+    }
+
+    /// Evaluate all layers using a clamped cubic B-Spline interpolant
+    template <typename Value>
+    void eval_cubic(const Array<Value, Dimension> &pos, Value *out,
+                    mask_t<Value> active = true,
+                    bool force_nonaccel = false) const {
+        m_texture.eval_cubic(pos, out, active, force_nonaccel);
+    }
+
+    /// Fetch the texels of all layers referenced by a linear lookup
+    template <typename Value>
+    void eval_fetch(const Array<Value, Dimension> &pos,
+                    Array<Value *, 1 << Dimension> &out,
+                    mask_t<Value> active = true) const {
+        m_texture.eval_fetch(pos, out, active);
+    }
+
+private:
+    /// Interleave the channels of all layers into a single tensor
+    TensorXf pack(const TensorXf *layers, size_t count) {
+        if (count == 0)
+            jit_raise("TextureArray::pack(): at least one layer is required!");
+
+        vector<size_t> channels, offsets;
+        size_t shape[Dimension + 1], total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const TensorXf &layer = layers[i];
+            if (layer.ndim() != Dimension + 1)
+                jit_raise("TextureArray::pack(): tensor dimension must equal "
+                          "texture dimension plus one (channels).");
+
+            for (size_t j = 0; j < Dimension; ++j) {
+                if (i == 0)
+                    shape[j] = layer.shape(j);
+                else if (shape[j] != layer.shape(j))
+                    jit_raise("TextureArray::pack(): all layers must have the "
+                              "same resolution!");
+            }
+
+            offsets.push_back(total);
+            channels.push_back(layer.shape(Dimension));
+            total += layer.shape(Dimension);
+        }
+        shape[Dimension] = total;
+        m_channels = channels;
+        m_offsets = offsets;
+
+        if (count == 1)
+            return layers[0];
+
+        size_t texels = 1;
+        for (size_t j = 0; j < Dimension; ++j)
+            texels *= shape[j];
+
+        Storage packed = zeros<Storage>(texels * total);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t n = (uint32_t) channels[i];
+            UInt32 idx = arange<UInt32>(texels * n);
+            auto [texel, ch] = idivmod(idx, divisor<uint32_t>(n));
+            scatter(packed, layers[i].array(),
+                    fmadd(texel, (uint32_t) total, ch + (uint32_t) offsets[i]));
+        }
+
+        return TensorXf(packed, Dimension + 1, shape);
+    }
+
+    Tex m_texture;
+    vector<size_t> m_channels;
+    vector<size_t> m_offsets;
+};
+
+/**
+ * \brief 2D texture that stores its texels in a block-compressed format
+ *
+ * The texture data consists of 4x4 texel blocks encoded in one of the
+ * formats listed in \ref BlockFormat, using the standard (little-endian)
+ * block layout as 32-bit words. Each lookup gathers the relevant block words
+ * and decodes the desired texels in registers, which reduces the memory
+ * footprint by 4-8x compared to a single precision \ref Texture.
+ *
+ * Evaluation is implemented using explicit arithmetic on all backends and
+ * supports the same filter and wrap modes as \ref Texture.
+ */
+template <typename _Storage> class CompressedTexture {
+public:
+    static constexpr bool IsDynamic = is_dynamic_v<_Storage>;
+
+    using Int32 = int32_array_t<_Storage>;
+    using Storage = std::conditional_t<IsDynamic, _Storage, DynamicArray<_Storage>>;
+    using Data = uint32_array_t<Storage>;
+
+    /// Default constructor: create an invalid texture object
+    CompressedTexture() = default;
+
+    /**
+     * \brief Create a compressed texture of resolution \c width x \c height
+     *
+     * The array \c data must contain <tt>words_per_block(format)</tt> words
+     * for each of the <tt>ceil(width/4) * ceil(height/4)</tt> blocks, which
+     * are stored in row-major order.
+     */
+    CompressedTexture(size_t width, size_t height, BlockFormat format,
+                      const Data &data,
+                      FilterMode filter_mode = FilterMode::Linear,
+                      WrapMode wrap_mode = WrapMode::Clamp)
+        : m_format(format), m_filter_mode(filter_mode), m_wrap_mode(wrap_mode) {
+        if (width == 0 || height == 0)
+            jit_raise("CompressedTexture::CompressedTexture(): invalid resolution!");
+
+        m_width = width;
+        m_height = height;
+        m_blocks_x = (width + 3) / 4;
+
+        size_t blocks_y = (height + 3) / 4;
+        if (data.size() != m_blocks_x * blocks_y * words_per_block(format))
+            jit_raise("CompressedTexture::CompressedTexture(): unexpected "
+                      "array size!");
+
+        m_data = data;
+        drjit::eval(m_data);
+
+        m_shape_opaque = Array<UInt32, 2>(opaque<UInt32>((uint32_t) width),
+                                          opaque<UInt32>((uint32_t) height));
+        m_blocks_x_opaque = opaque<UInt32>((uint32_t) m_blocks_x);
+        m_inv_resolution[0] = divisor<int32_t>((int32_t) width);
+        m_inv_resolution[1] = divisor<int32_t>((int32_t) height);
+    }
+
+    /// Return the number of channels produced by a block format
+    static constexpr size_t channels(BlockFormat format) {
+        return format == BlockFormat::BC1 ? 3 : (format == BlockFormat::BC4 ? 1 : 2);
+    }
+
+    /// Return the number of 32-bit words per 4x4 block of a block format
+    static constexpr size_t words_per_block(BlockFormat format) {
+        return format == BlockFormat::BC5 ? 4 : 2;
+    }
+
+    size_t width() const { return m_width; }
+    size_t height() const { return m_height; }
+    size_t channels() const { return channels(m_format); }
+    BlockFormat format() const { return m_format; }
+    FilterMode filter_mode() const { return m_filter_mode; }
+    WrapMode wrap_mode() const { return m_wrap_mode; }
+
+    /// Return the compressed block data
+    const Data &value() const { return m_data; }
+
+    /**
+     * \brief Evaluate the texture at the position \c pos
+     *
+     * The array \c out must have space for \ref channels() entries.
+     */
+    template <typename Value>
+    void eval(const Array<Value, 2> &pos, Value *out,
+              mask_t<Value> active = true) const {
+        using PosF = Array<Value, 2>;
+        using PosI = int32_array_t<PosF>;
+        using Mask = mask_t<Value>;
+
+        if constexpr (!is_array_v<Mask>)
+            active = true;
+
+        const size_t ch_count = channels();
+        const PosF shape = PosF(m_shape_opaque);
+
+        if (m_filter_mode == FilterMode::Nearest) {
+            PosI pos_i = wrap(floor2int<PosI>(pos * shape));
+            fetch(pos_i, out, active);
+            return;
+        }
+
+        const PosF pos_f = fmadd(pos, shape, -.5f);
+        const PosI pos_i = floor2int<PosI>(pos_f);
+        const PosF w1 = pos_f - pos_i, w0 = 1.f - w1;
+
+        Value tmp[3];
+        for (size_t ch = 0; ch < ch_count; ++ch)
+            out[ch] = zeros<Value>();
+
+        for (int i = 0; i < 4; ++i) {
+            PosI offset(i & 1, i >> 1);
+            fetch(wrap(pos_i + offset), tmp, active);
+
+            Value weight = ((i & 1) ? w1.x() : w0.x()) *
+                           ((i >> 1) ? w1.y() : w0.y());
+            for (size_t ch = 0; ch < ch_count; ++ch)
+                out[ch] = fmadd(tmp[ch], weight, out[ch]);
+        }
+    }
+
+    /// Decode the texel at the (already wrapped) integer position \c pos
+    template <typename Value>
+    void fetch(const Array<int32_array_t<Value>, 2> &pos, Value *out,
+               const mask_t<Value> &active) const {
+        using Index = uint32_array_t<Value>;
+
+        Index x = Index(pos.x()), y = Index(pos.y()),
+              words = (uint32_t) words_per_block(m_format),
+              block = fmadd(sr<2>(y), Index(m_blocks_x_opaque), sr<2>(x)) * words,
+              texel = fmadd(y & 3u, 4u, x & 3u);
+
+        Index w0 = gather<Index>(m_data, block, active),
+              w1 = gather<Index>(m_data, block + 1u, active);
+
+        if (m_format == BlockFormat::BC1) {
+            Index c0 = w0 & 0xFFFFu, c1 = sr<16>(w0),
+                  code = (w1 >> (texel * 2u)) & 3u;
+            mask_t<Value> four_color = c0 > c1;
+
+            const uint32_t shift[3] = { 11, 5, 0 }, bits[3] = { 31, 63, 31 };
+            for (int ch = 0; ch < 3; ++ch) {
+                Value scale = 1.f / bits[ch],
+                      e0 = Value((c0 >> shift[ch]) & bits[ch]) * scale,
+                      e1 = Value((c1 >> shift[ch]) & bits[ch]) * scale;
+
+                Value mid = select(four_color,
+                                   select(code == 2u, fmadd(e1 - e0, 1.f / 3.f, e0),
+                                                      fmadd(e1 - e0, 2.f / 3.f, e0)),
+                                   select(code == 2u, .5f * (e0 + e1), Value(0.f)));
+
+                out[ch] = select(code == 0u, e0, select(code == 1u, e1, mid));
+            }
+        } else {
+            out[0] = decode_bc4<Value>(w0, w1, texel);
+
+            if (m_format == BlockFormat::BC5)
+                out[1] = decode_bc4<Value>(
+                    gather<Index>(m_data, block + 2u, active),
+                    gather<Index>(m_data, block + 3u, active), texel);
+        }
+    }
+
+protected:
+    /// Decode texel \c texel of a BC4 block given by the words \c w0, \c w1
+    template <typename Value, typename Index>
+    static Value decode_bc4(const Index &w0, const Index &w1, const Index &texel) {
+        using UInt64 = uint64_array_t<Value>;
+
+        Index u0 = w0 & 0xFFu, u1 = sr<8>(w0) & 0xFFu;
+        UInt64 bits = UInt64(w0) | sl<32>(UInt64(w1));
+        Index code = Index(bits >> UInt64(fmadd(texel, 3u, 16u))) & 7u;
+
+        Value r0 = Value(u0), r1 = Value(u1), k = Value(code) - 1.f;
+
+        Value mid = select(u0 > u1, fmadd(r1 - r0, k * (1.f / 7.f), r0),
+                    select(code == 6u, Value(0.f),
+                    select(code == 7u, Value(255.f),
+                           fmadd(r1 - r0, k * (1.f / 5.f), r0))));
+
+        return select(code == 0u, r0, select(code == 1u, r1, mid)) * (1.f / 255.f);
+    }
+
+    /// Apply the configured wrapping mode to an integer position
+    template <typename T> T wrap(const T &pos) const {
+        Array<Int32, 2> shape = m_shape_opaque;
+        if (m_wrap_mode == WrapMode::Clamp) {
+            return clip(pos, 0, shape - 1);
+        } else {
+            T value_shift_neg = select(pos < 0, pos + 1, pos);
+
+            T div;
+            for (size_t i = 0; i < 2; ++i)
+                div[i] = m_inv_resolution[i](value_shift_neg[i]);
+
+            T mod = pos - div * shape;
+            mod[mod < 0] += T(shape);
+
+            if (m_wrap_mode == WrapMode::Mirror)
+                mod = select(((div & 1) == 0) ^ (pos < 0), mod, shape - 1 - mod);
+
+            return mod;
+        }
+    }
+
+private:
+    using UInt32 = uint32_array_t<_Storage>;
+
+    Data m_data;
+    size_t m_width = 0, m_height = 0, m_blocks_x = 0;
+    BlockFormat m_format = BlockFormat::BC1;
+
+    // Stored in this order: width, height
+    Array<UInt32, 2> m_shape_opaque;
+    UInt32 m_blocks_x_opaque;
+    divisor<int32_t> m_inv_resolution[2] { };
+
+    FilterMode m_filter_mode = FilterMode::Linear;
+    WrapMode m_wrap_mode = WrapMode::Clamp;
+};
+
+/**
+ * \brief Mip-mapped N-D texture
+ *
+ * This class stores a chain of \ref Texture instances with successively
+ * halved resolution, which are generated from a base tensor using a box
+ * filter. Minified lookups select a level of detail (LOD) that matches the
+ * lookup footprint and blend the two nearest levels (trilinear filtering).
+ * This avoids aliasing and keeps the texel accesses of neighboring lanes
+ * close in memory.
+ *
+ * Each level is a regular \ref Texture, hence lookups within a level use
+ * CUDA hardware interpolation when available and \ref
+ * Texture::eval_nonaccel() otherwise.
+ */
+template <typename _Storage, size_t Dimension> class MipTexture {
+public:
+    using Tex = Texture<_Storage, Dimension>;
+    using Storage = typename Tex::Storage;
+    using TensorXf = typename Tex::TensorXf;
+    using UInt32 = uint32_array_t<Storage>;
+
+    /// Maximum number of mip levels (sufficient for resolutions up to 32K)
+    static constexpr size_t MaxLevels = 16;
+
+    /// Default constructor: create an invalid texture object
+    MipTexture() = default;
+
+    /**
+     * \brief Construct a mip-mapped texture from a given tensor
+     *
+     * The coarser levels are generated using a 2^Dimension box filter. When
+     * \c levels is zero, the full chain down to a single texel is created.
+     * The remaining parameters have the same meaning as in the corresponding
+     * \ref Texture constructor and apply to every level.
+     */
+    MipTexture(const TensorXf &tensor, size_t levels = 0, bool use_accel = true,
+               bool migrate = true, FilterMode filter_mode = FilterMode::Linear,
+               WrapMode wrap_mode = WrapMode::Clamp)
+        : m_use_accel(use_accel), m_migrate(migrate), m_filter_mode(filter_mode),
+          m_wrap_mode(wrap_mode) {
+        set_tensor(tensor, levels);
+    }
+
+    /// Return the number of mip levels
+    size_t level_count() const { return m_level_count; }
+
+    /// Return mip level \c i (level 0 has the highest resolution)
+    const Tex &level(size_t i) const { return m_levels[i]; }
+
+    /// Return the shape of the highest resolution level
+    const size_t *shape() const { return m_levels[0].shape(); }
+
+    FilterMode filter_mode() const { return m_filter_mode; }
+    WrapMode wrap_mode() const { return m_wrap_mode; }
+
+    /**
+     * \brief Replace the texture contents and regenerate all levels
+     *
+     * When \c levels is zero, the current number of levels is retained
+     * if the resolution is unchanged, otherwise the full chain is created.
+     */
+    void set_tensor(const TensorXf &tensor, size_t levels = 0) {
+        if (tensor.ndim() != Dimension + 1)
+            jit_raise("MipTexture::set_tensor(): tensor dimension must equal "
+                      "texture dimension plus one (channels).");
+
+        size_t max_levels = 1, res = 1;
+        for (size_t i = 0; i < Dimension; ++i)
+            res = std::max(res, tensor.shape(i));
+        while ((res >>= 1) > 0)
+            max_levels++;
+        max_levels = std::min(max_levels, MaxLevels);
+
+        if (levels == 0)
+            levels = max_levels;
+        else if (levels > max_levels)
+            jit_raise("MipTexture::set_tensor(): at most %zu levels are "
+                      "possible for the given resolution!", max_levels);
+
+        TensorXf value = tensor;
+        for (size_t i = 0; i < levels; ++i) {
+            if (i > 0)
+                value = downsample(value);
+
+            if (i < m_level_count && same_shape(m_levels[i], value))
+                m_levels[i].set_tensor(value, m_migrate);
+            else
+                m_levels[i] = Tex(value, m_use_accel, m_migrate,
+                                  m_filter_mode, m_wrap_mode);
+        }
+
+        for (size_t i = levels; i < m_level_count; ++i)
+            m_levels[i] = Tex();
+
+        m_level_count = levels;
+    }
+
+    /**
+     * \brief Evaluate the texture at the position \c pos and the (fractional)
+     * level of detail \c lod
+     *
+     * The LOD is clamped to the range of available levels, and the two
+     * nearest levels are linearly blended.
+     */
+    template <typename Value>
+    void eval(const Array<Value, Dimension> &pos, const Value &lod, Value *out,
+              mask_t<Value> active = true) const {
+        using Int32 = int32_array_t<Value>;
+
+        const size_t channels = shape()[Dimension];
+        Value lod_c = clip(lod, 0.f, (float) (m_level_count - 1)),
+              base = floor(lod_c),
+              t = lod_c - base;
+        Int32 l0 = Int32(base);
+
+        vector<Value> tmp(channels);
+        for (size_t ch = 0; ch < channels; ++ch)
+            out[ch] = zeros<Value>();
+
+        for (size_t i = 0; i < m_level_count; ++i) {
+            Int32 li = (int32_t) i;
+            Value weight = select(l0 == li, 1.f - t,
+                           select(l0 + 1 == li, t, Value(0.f)));
+            mask_t<Value> active_i = active && (weight > 0.f);
+
+            // Non-JIT backends can skip unreferenced levels outright
+            if constexpr (!is_jit_v<Value>) {
+                if (none(active_i))
+                    continue;
+            }
+
+            m_levels[i].eval(pos, tmp.data(), active_i);
+            for (size_t ch = 0; ch < channels; ++ch)
+                out[ch] = fmadd(select(active_i, tmp[ch], Value(0.f)), weight, out[ch]);
+        }
+    }
+
+    /**
+     * \brief Evaluate the texture with an LOD derived from the screen-space
+     * derivatives \c dx and \c dy of the lookup position
+     *
+     * The LOD is the base-2 logarithm of the longer footprint axis measured
+     * in texels of the highest resolution level.
+     */
+    template <typename Value>
+    void eval_grad(const Array<Value, Dimension> &pos,
+                   const Array<Value, Dimension> &dx,
+                   const Array<Value, Dimension> &dy, Value *out,
+                   mask_t<Value> active = true) const {
+        Array<Value, Dimension> res;
+        for (size_t i = 0; i < Dimension; ++i)
+            res[i] = Value((float) shape()[Dimension - 1 - i]);
+
+        Value len2 = maximum(squared_norm(dx * res), squared_norm(dy * res));
+        Value lod = .5f * log2(maximum(len2, 1.f));
+
+        eval(pos, lod, out, active);
+    }
+
+private:
+    static bool same_shape(const Tex &tex, const TensorXf &value) {
+        for (size_t i = 0; i < Dimension + 1; ++i)
+            if (tex.shape()[i] != value.shape(i))
+                return false;
+        return true;
+    }
+
+    /// Halve the resolution of a texture tensor using a box filter
+    static TensorXf downsample(const TensorXf &value) {
+        size_t shape_in[Dimension + 1], shape_out[Dimension + 1], size = 1;
+        for (size_t i = 0; i < Dimension + 1; ++i) {
+            shape_in[i] = value.shape(i);
+            shape_out[i] = i < Dimension ? std::max(shape_in[i] / 2, (size_t) 1)
+                                         : shape_in[i];
+            size *= shape_out[i];
+        }
+
+        // Decompose the output index into per-axis coordinates
+        UInt32 idx = arange<UInt32>(size), coord[Dimension + 1];
+        for (size_t i = Dimension; i > 0; --i) {
+            auto [q, r] = idivmod(idx, divisor<uint32_t>((uint32_t) shape_out[i]));
+            coord[i] = r;
+            idx = q;
+        }
+        coord[0] = idx;
+
+        Storage result = zeros<Storage>(size);
+        for (uint32_t corner = 0; corner < (1u << Dimension); ++corner) {
+            UInt32 src = 0;
+            for (size_t i = 0; i < Dimension; ++i) {
+                UInt32 c = minimum(coord[i] * 2u + ((corner >> i) & 1u),
+                                   (uint32_t) shape_in[i] - 1u);
+                src = fmadd(src, (uint32_t) shape_in[i], c);
+            }
+            src = fmadd(src, (uint32_t) shape_in[Dimension], coord[Dimension]);
+            result += gather<Storage>(value.array(), src);
+        }
+
+        return TensorXf(result * (1.f / (1u << Dimension)), Dimension + 1,
+                        shape_out);
+    }
+
+    Tex m_levels[MaxLevels];
+    size_t m_level_count = 0;
+    bool m_use_accel = true;
+    bool m_migrate = true;
+    FilterMode m_filter_mode = FilterMode::Linear;
+    WrapMode m_wrap_mode = WrapMode::Clamp;
+};
+
+/**
+ * \brief Sparse 3D texture that stores occupied bricks in a texture atlas
+ *
+ * Volumes that are mostly empty waste memory when stored as a dense \ref
+ * Texture. This class partitions the volume into cubic bricks of
+ * <tt>brick_size^3</tt> voxels and only stores bricks that contain at least
+ * one voxel whose magnitude exceeds a threshold. An indirection grid maps each
+ * brick to its slot within an atlas. The atlas is a regular 3D \ref Texture
+ * (and hence a CUDA texture when available) in which every brick is padded by
+ * an apron of \ref Apron voxels. This enables hardware-accelerated linear
+ * and cubic filtering without any seams between bricks.
+ *
+ * The evaluation routines match those of a dense texture with clamped
+ * wrapping, except that lookups whose entire footprint lies in empty bricks
+ * return zero. Gradients propagate to the dense tensor passed to the
+ * constructor.
+ */
+template <typename _Storage> class SparseTexture3 {
+public:
+    using Tex = Texture<_Storage, 3>;
+    using Storage = typename Tex::Storage;
+    using TensorXf = typename Tex::TensorXf;
+    using UInt32 = uint32_array_t<Storage>;
+    using Int32 = int32_array_t<Storage>;
+    using TensorXu = Tensor<UInt32>;
+
+    /// Number of padding voxels around each brick (sufficient for cubic filtering)
+    static constexpr uint32_t Apron = 2;
+
+    /// Indirection grid entry of empty bricks
+    static constexpr uint32_t Empty = 0xFFFFFFFFu;
+
+    /// Default constructor: create an invalid texture object
+    SparseTexture3() = default;
+
+    /**
+     * \brief Construct a sparse texture from a dense tensor
+     *
+     * Bricks in which the magnitude of all voxels is at most \c threshold are
+     * omitted. The \c use_accel, \c migrate, and \c filter_mode parameters
+     * have the same meaning as in the \ref Texture constructor and apply to
+     * the brick atlas.
+     */
+    SparseTexture3(const TensorXf &tensor, size_t brick_size = 16,
+                   float threshold = 0.f, bool use_accel = true,
+                   bool migrate = true,
+                   FilterMode filter_mode = FilterMode::Linear) {
+        if (tensor.ndim() != 4)
+            jit_raise("SparseTexture3::SparseTexture3(): expected a 4D tensor "
+                      "(3 spatial dimensions and channels).");
+        if (brick_size == 0)
+            jit_raise("SparseTexture3::SparseTexture3(): invalid brick size!");
+
+        const uint32_t B = (uint32_t) brick_size,
+                       C = (uint32_t) tensor.shape(3);
+        uint32_t res[3], nb[3]; // Stored in this order: width, height, depth
+        for (size_t i = 0; i < 3; ++i) {
+            res[i] = (uint32_t) tensor.shape(2 - i);
+            nb[i] = (res[i] + B - 1) / B;
+        }
+
+        // 1. Find bricks containing at least one non-empty voxel
+        uint32_t brick_count = nb[0] * nb[1] * nb[2];
+        UInt32 idx = arange<UInt32>((size_t) res[0] * res[1] * res[2] * C);
+        UInt32 voxel = idiv(idx, divisor<uint32_t>(C));
+        auto [vyz, vx] = idivmod(voxel, divisor<uint32_t>(res[0]));
+        auto [vz, vy] = idivmod(vyz, divisor<uint32_t>(res[1]));
+        UInt32 cell = fmadd(fmadd(vz / B, nb[1], vy / B), nb[0], vx / B);
+
+        UInt32 occupied = zeros<UInt32>(brick_count);
+        scatter(occupied, UInt32(1), cell, abs(tensor.array()) > threshold);
+
+        UInt32 bricks = compress(occupied != 0u);
+        uint32_t slots = (uint32_t) bricks.size();
+
+        UInt32 indirection = full<UInt32>(Empty, brick_count);
+        scatter(indirection, arange<UInt32>(slots), bricks);
+
+        // 2. Copy each occupied brick including its apron into the atlas
+        if (slots == 0)
+            bricks = full<UInt32>(Empty, 1);
+        const uint32_t E = B + 2 * Apron,
+                       atlas_slots = slots ? slots : 1;
+
+        size_t atlas_shape[4] = { (size_t) atlas_slots * E, E, E, C };
+        UInt32 aidx = arange<UInt32>((size_t) atlas_slots * E * E * E * C);
+        auto [t0, ch] = idivmod(aidx, divisor<uint32_t>(C));
+        auto [t1, lx] = idivmod(t0, divisor<uint32_t>(E));
+        auto [t2, ly] = idivmod(t1, divisor<uint32_t>(E));
+        auto [slot, lz] = idivmod(t2, divisor<uint32_t>(E));
+
+        UInt32 brick = gather<UInt32>(bricks, slot);
+        auto [byz, bx] = idivmod(brick, divisor<uint32_t>(nb[0]));
+        auto [bz, by] = idivmod(byz, divisor<uint32_t>(nb[1]));
+
+        auto voxel_coord = [&](const UInt32 &b, const UInt32 &l, uint32_t r) {
+            Int32 v = Int32(fmadd(b, B, l)) - (int32_t) Apron;
+            return UInt32(clip(v, 0, (int32_t) r - 1));
+        };
+
+        UInt32 src = fmadd(fmadd(voxel_coord(bz, lz, res[2]), res[1],
+                                 voxel_coord(by, ly, res[1])), res[0],
+                           voxel_coord(bx, lx, res[0]));
+        Storage atlas = gather<Storage>(tensor.array(), fmadd(src, C, ch),
+                                        slots > 0);
+
+        m_atlas = Tex(TensorXf(atlas, 4, atlas_shape), use_accel, migrate,
+                      filter_mode, WrapMode::Clamp);
+        m_indirection = indirection;
+        m_brick_size = B;
+        m_slots = slots;
+        for (size_t i = 0; i < 3; ++i) {
+            m_bricks[i] = nb[i];
+            m_res_opaque[i] = opaque<UInt32Q>(res[i]);
+        }
+        m_inv_brick = divisor<int32_t>((int32_t) B);
+    }
+
+    /// Return the number of allocated bricks
+    size_t brick_count() const { return m_slots; }
+
+    /// Return the brick atlas
+    const Tex &atlas() const { return m_atlas; }
+
+    /// Return the indirection grid (\ref Empty denotes an empty brick)
+    const UInt32 &indirection() const { return m_indirection; }
+
+    /**
+     * \brief Return a tensor of shape <tt>(bricks_z, bricks_y, bricks_x)</tt>
+     * in which occupied bricks have the value 1 and empty bricks the value 0
+     *
+     * This can be used to skip empty space, e.g., by traversing the brick
+     * grid using a DDA. Note that the brick grid covers
+     * <tt>bricks * brick_size</tt> voxels along each axis, which may slightly
+     * exceed the resolution of the volume.
+     */
+    TensorXu occupancy() const {
+        size_t shape[3] = { m_bricks[2], m_bricks[1], m_bricks[0] };
+        return TensorXu(select(m_indirection != Empty, UInt32(1), UInt32(0)),
+                        3, shape);
+    }
+
+    /// Evaluate the linear (or nearest-neighbor) interpolant
+    template <typename Value>
+    void eval(const Array<Value, 3> &pos, Value *out,
+              mask_t<Value> active = true) const {
+        Array<Value, 3> pos_a = atlas_pos(pos, active);
+        m_atlas.eval(pos_a, out, active);
+        mask_empty(out, active);
+    }
+
+    /// Evaluate a clamped cubic B-Spline interpolant
+    template <typename Value>
+    void eval_cubic(const Array<Value, 3> &pos, Value *out,
+                    mask_t<Value> active = true,
+                    bool force_nonaccel = false) const {
+        Array<Value, 3> pos_a = atlas_pos(pos, active);
+        m_atlas.eval_cubic(pos_a, out, active, force_nonaccel);
+        mask_empty(out, active);
+    }
+
+    /// Fetch the texels that would be referenced by a linear lookup
+    template <typename Value>
+    void eval_fetch(const Array<Value, 3> &pos, Array<Value *, 8> &out,
+                    mask_t<Value> active = true) const {
+        Array<Value, 3> pos_a = atlas_pos(pos, active);
+        m_atlas.eval_fetch(pos_a, out, active);
+        for (size_t i = 0; i < 8; ++i)
+            mask_empty(out[i], active);
+    }
+
+private:
+    using UInt32Q = uint32_array_t<_Storage>;
+
+    /**
+     * \brief Map a position to the atlas and deactivate lanes whose footprint
+     * only overlaps empty bricks
+     *
+     * With an apron of two voxels, the footprint of a linear or cubic lookup
+     * at the continuous voxel position \c p is contained in the padded
+     * brick of voxel <tt>floor(p) + k</tt> for every <tt>k</tt> in
+     * <tt>{0, 1}^3</tt>, hence any occupied brick among those can be used.
+     */
+    template <typename Value>
+    Array<Value, 3> atlas_pos(const Array<Value, 3> &pos,
+                              mask_t<Value> &active) const {
+        using PosF = Array<Value, 3>;
+        using PosI = int32_array_t<PosF>;
+        using Index = uint32_array_t<Value>;
+
+        const PosF res = PosF(m_res_opaque);
+        const PosI res_i = PosI(m_res_opaque);
+
+        // Clamp wrap mode: the apron replicates the boundary voxels
+        PosF p = clip(fmadd(pos, res, -.5f), -.5f, res - .5f);
+        PosI v = floor2int<PosI>(p);
+
+        Index slot = Empty;
+        PosI brick = 0;
+        for (int k = 0; k < 8; ++k) {
+            PosI vk = clip(v + PosI(k & 1, (k >> 1) & 1, k >> 2), 0, res_i - 1), bk;
+            for (size_t i = 0; i < 3; ++i)
+                bk[i] = m_inv_brick(vk[i]);
+
+            Index cell = fmadd(fmadd(Index(bk.z()), (uint32_t) m_bricks[1],
+                                     Index(bk.y())), (uint32_t) m_bricks[0],
+                               Index(bk.x()));
+            mask_t<Value> search = active && (slot == Empty);
+            Index slot_k = gather<Index>(m_indirection, cell, search);
+            mask_t<Value> found = search && (slot_k != Empty);
+            slot = select(found, slot_k, slot);
+            brick = select(found, bk, brick);
+        }
+
+        active &= slot != Empty;
+
+        const float B = (float) m_brick_size, E = B + 2 * Apron;
+        PosF q = p - PosF(brick) * B + (Apron + .5f);
+        q.z() = fmadd(Value(select(active, slot, 0u)), E, q.z());
+
+        return q / PosF(E, E, E * (m_slots ? m_slots : 1));
+    }
+
+    template <typename Value>
+    static void mask_empty(Value *out, const mask_t<Value> &active,
+                           size_t channels) {
+        for (size_t ch = 0; ch < channels; ++ch)
+            out[ch] = select(active, out[ch], Value(0.f));
+    }
+
+    template <typename Value>
+    void mask_empty(Value *out, const mask_t<Value> &active) const {
+        mask_empty(out, active, m_atlas.shape()[3]);
+    }
+
+    Tex m_atlas;
+    UInt32 m_indirection;
+    uint32_t m_brick_size = 0;
+    uint32_t m_slots = 0;
+    size_t m_bricks[3] { };
+    Array<UInt32Q, 3> m_res_opaque;
+    divisor<int32_t> m_inv_brick;
+};
+
 NAMESPACE_END(drjit)
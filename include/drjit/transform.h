@@ -220,4 +220,314 @@ Matrix4 transform_compose_inverse(const Matrix<entry_t<Matrix4>, 3> &s,
     return result;
 }
 
+// =======================================================================
+//! @{ \name Structured affine transformations
+// =======================================================================
+
+/**
+ * \brief 3x4 affine transformation with compile-time known structure
+ *
+ * The transformation maps points via ``p' = L p + t``, where the entries of the
+ * linear part ``L`` are stored in columns 0-2 and the translation ``t`` in
+ * column 3. The bottom row ``[0, 0, 0, 1]`` is implicit.
+ *
+ * The template parameters record which entries are known to equal zero or one:
+ * bit ``4*i + j`` of \c Dynamic_ is set when entry ``(i, j)`` holds an
+ * arbitrary value, otherwise bit ``4*i + j`` of \c Ones_ determines whether it
+ * is one (set) or zero (unset). Composition and application propagate this
+ * structure at compile time and only emit arithmetic for the dynamic entries,
+ * e.g. applying a translation costs 3 additions instead of a 4x4 matrix-vector
+ * product. Storage for constant entries is never accessed.
+ */
+template <typename Value_, uint32_t Dynamic_, uint32_t Ones_ = 0>
+struct Affine {
+    using Value = Value_;
+    using Vector3 = Array<Value, 3>;
+
+    static constexpr uint32_t Dynamic = Dynamic_ & 0xFFFu;
+    static constexpr uint32_t Ones = Ones_ & ~Dynamic_ & 0xFFFu;
+
+    /// Entry classification (0: zero, 1: one, 2: dynamic) including the implicit bottom row
+    static constexpr int kind(size_t i, size_t j) {
+        if (i == 3)
+            return j == 3 ? 1 : 0;
+        uint32_t bit = 1u << (4 * i + j);
+        return (Dynamic & bit) ? 2 : ((Ones & bit) ? 1 : 0);
+    }
+
+    Affine() = default;
+
+    /// Return entry ``(i, j)``, substituting constants for structurally known entries
+    DRJIT_INLINE Value get(size_t i, size_t j) const {
+        int k = kind(i, j);
+        if (k == 2)
+            return m[i][j];
+        return Value(k == 1 ? 1.f : 0.f);
+    }
+
+    DRJIT_INLINE void set(size_t i, size_t j, const Value &value) { m[i][j] = value; }
+
+    /// Value storage (only the dynamic entries are meaningful)
+    Value m[3][4];
+};
+
+/// General 3x4 affine transformation without any known structure
+template <typename Value> using AffineTransform = Affine<Value, 0xFFFu>;
+
+NAMESPACE_BEGIN(detail)
+
+/// Classification of the entries of a structured vector (bit i: dynamic, bit 3: one)
+constexpr int affine_vector_kind(uint32_t dynamic, uint32_t ones, size_t k) {
+    return (dynamic & (1u << k)) ? 2 : ((ones & (1u << k)) ? 1 : 0);
+}
+
+/**
+ * \brief Classify the sum of products ``sum_k a(k) * b(k)`` given the kinds of
+ * the participating factors
+ */
+template <typename KindA, typename KindB>
+constexpr int affine_dot_kind(KindA ka, KindB kb) {
+    int ones = 0, dynamic = 0;
+    for (size_t k = 0; k < 4; ++k) {
+        int a = ka(k), b = kb(k);
+        if (a == 0 || b == 0)
+            continue;
+        else if (a == 1 && b == 1)
+            ones++;
+        else
+            dynamic++;
+    }
+    if (dynamic == 0 && ones == 0)
+        return 0;
+    else if (dynamic == 0 && ones == 1)
+        return 1;
+    return 2;
+}
+
+/**
+ * \brief Evaluate the sum of products ``sum_k a(k) * b(k)`` while skipping
+ * terms that are structurally zero and multiplications by one
+ */
+template <typename Value, typename KindA, typename KindB, typename GetA, typename GetB>
+DRJIT_INLINE Value affine_dot(KindA ka, KindB kb, GetA ga, GetB gb) {
+    Value result;
+    bool initialized = false;
+
+    for (size_t k = 0; k < 4; ++k) {
+        int a = ka(k), b = kb(k);
+        if (a == 0 || b == 0)
+            continue;
+
+        if (a == 1 && b == 1) {
+            result = initialized ? result + Value(1.f) : Value(1.f);
+        } else if (a == 1 || b == 1) {
+            Value v = a == 1 ? gb(k) : ga(k);
+            result = initialized ? result + v : v;
+        } else {
+            result = initialized ? fmadd(ga(k), gb(k), result) : ga(k) * gb(k);
+        }
+        initialized = true;
+    }
+
+    if (!initialized)
+        result = Value(0.f);
+    return result;
+}
+
+/// Compute the structure of the composition ``A * B``
+template <typename A, typename B> constexpr std::pair<uint32_t, uint32_t> affine_compose_kind() {
+    uint32_t dynamic = 0, ones = 0;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            int k = affine_dot_kind([i](size_t k) { return A::kind(i, k); },
+                                    [j](size_t k) { return B::kind(k, j); });
+            if (k == 2)
+                dynamic |= 1u << (4 * i + j);
+            else if (k == 1)
+                ones |= 1u << (4 * i + j);
+        }
+    }
+    return { dynamic, ones };
+}
+
+template <typename A, typename B> using affine_compose_t =
+    Affine<typename A::Value, affine_compose_kind<A, B>().first,
+           affine_compose_kind<A, B>().second>;
+
+template <typename Value, uint32_t Dynamic, uint32_t Ones, typename Vector>
+DRJIT_INLINE Vector affine_apply(const Affine<Value, Dynamic, Ones> &a,
+                                 const Vector &v, bool point) {
+    using T = Affine<Value, Dynamic, Ones>;
+    Vector result;
+    for (size_t i = 0; i < 3; ++i)
+        result.entry(i) = affine_dot<Value>(
+            [i](size_t k) { return T::kind(i, k); },
+            [point](size_t k) { return k == 3 ? (point ? 1 : 0) : 2; },
+            [&a, i](size_t k) { return a.get(i, k); },
+            [&v](size_t k) { return v.entry(k); });
+    return result;
+}
+
+NAMESPACE_END(detail)
+
+/// Compose two structured transformations (``b`` is applied first)
+template <typename Value, uint32_t D1, uint32_t O1, uint32_t D2, uint32_t O2>
+DRJIT_INLINE auto operator*(const Affine<Value, D1, O1> &a,
+                            const Affine<Value, D2, O2> &b) {
+    using A = Affine<Value, D1, O1>;
+    using B = Affine<Value, D2, O2>;
+    using Result = detail::affine_compose_t<A, B>;
+
+    Result result;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            if (Result::kind(i, j) != 2)
+                continue;
+            result.set(i, j, detail::affine_dot<Value>(
+                [i](size_t k) { return A::kind(i, k); },
+                [j](size_t k) { return B::kind(k, j); },
+                [&a, i](size_t k) { return a.get(i, k); },
+                [&b, j](size_t k) { return b.get(k, j); }));
+        }
+    }
+    return result;
+}
+
+/// Apply a structured transformation to a point
+template <typename Value, uint32_t Dynamic, uint32_t Ones>
+DRJIT_INLINE Array<Value, 3> transform_point(const Affine<Value, Dynamic, Ones> &a,
+                                             const Array<Value, 3> &p) {
+    return detail::affine_apply(a, p, true);
+}
+
+/// Apply a structured transformation to a direction vector (ignores the translation)
+template <typename Value, uint32_t Dynamic, uint32_t Ones>
+DRJIT_INLINE Array<Value, 3> transform_vector(const Affine<Value, Dynamic, Ones> &a,
+                                              const Array<Value, 3> &v) {
+    return detail::affine_apply(a, v, false);
+}
+
+/// Translation by the vector ``v``
+template <typename Value>
+Affine<Value, 0x888u, 0x421u> affine_translate(const Array<Value, 3> &v) {
+    Affine<Value, 0x888u, 0x421u> result;
+    for (size_t i = 0; i < 3; ++i)
+        result.set(i, 3, v.entry(i));
+    return result;
+}
+
+/// Non-uniform scale by the vector ``v``
+template <typename Value>
+Affine<Value, 0x421u> affine_scale(const Array<Value, 3> &v) {
+    Affine<Value, 0x421u> result;
+    for (size_t i = 0; i < 3; ++i)
+        result.set(i, i, v.entry(i));
+    return result;
+}
+
+/// Linear transformation given by a 3x3 matrix
+template <typename Value>
+Affine<Value, 0x777u> affine_linear(const Matrix<Value, 3> &m) {
+    Affine<Value, 0x777u> result;
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 3; ++j)
+            result.set(i, j, m(i, j));
+    return result;
+}
+
+/// Rotation around ``axis`` by ``angle`` (in radians)
+template <typename Value>
+Affine<Value, 0x777u> affine_rotate(const Array<Value, 3> &axis,
+                                    const Value &angle) {
+    return affine_linear(Matrix<Value, 3>(rotate<Matrix<Value, 4>>(axis, angle)));
+}
+
+/// Rigid transformation consisting of a rotation (unit quaternion) followed by a translation
+template <typename Value>
+AffineTransform<Value> affine_rigid(const Quaternion<Value> &q,
+                                    const Array<Value, 3> &t) {
+    Matrix<Value, 3> r = quat_to_matrix<Matrix<Value, 3>>(q);
+    AffineTransform<Value> result;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j)
+            result.set(i, j, r(i, j));
+        result.set(i, 3, t.entry(i));
+    }
+    return result;
+}
+
+/// Convert a general 4x4 matrix whose bottom row is ``[0, 0, 0, 1]`` into an \ref AffineTransform
+template <typename Value>
+AffineTransform<Value> affine_from_matrix(const Matrix<Value, 4> &m) {
+    AffineTransform<Value> result;
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 4; ++j)
+            result.set(i, j, m(i, j));
+    return result;
+}
+
+/// Expand a structured transformation into a 4x4 matrix
+template <typename Matrix4, uint32_t Dynamic, uint32_t Ones>
+Matrix4 affine_to_matrix(const Affine<entry_t<Matrix4>, Dynamic, Ones> &a) {
+    static_assert(
+        is_matrix_v<Matrix4> && size_v<Matrix4> == 4,
+        "affine_to_matrix(): template argument must be of type Matrix<T, 4>");
+
+    Matrix4 result = identity<Matrix4>();
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 4; ++j)
+            result(i, j) = a.get(i, j);
+    return result;
+}
+
+/**
+ * \brief Invert a rigid transformation (rotation followed by a translation)
+ *
+ * The linear part is assumed to be orthonormal and is inverted by
+ * transposition, which preserves its structure.
+ */
+template <typename Value, uint32_t Dynamic, uint32_t Ones>
+auto rigid_inverse(const Affine<Value, Dynamic, Ones> &a) {
+    using T = Affine<Value, Dynamic, Ones>;
+
+    // Transpose the 3x3 structure, translation entries depend on all of it
+    constexpr auto structure = []() {
+        uint32_t dynamic = 0, ones = 0;
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                int k = T::kind(j, i);
+                if (k == 2)
+                    dynamic |= 1u << (4 * i + j);
+                else if (k == 1)
+                    ones |= 1u << (4 * i + j);
+            }
+            bool nonzero = false;
+            for (size_t k = 0; k < 3; ++k)
+                nonzero |= T::kind(k, i) != 0 && T::kind(k, 3) != 0;
+            if (nonzero)
+                dynamic |= 1u << (4 * i + 3);
+        }
+        return std::pair<uint32_t, uint32_t>(dynamic, ones);
+    }();
+
+    using Result = Affine<Value, structure.first, structure.second>;
+    Result result;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            if (Result::kind(i, j) == 2)
+                result.set(i, j, a.get(j, i));
+        }
+        if (Result::kind(i, 3) == 2)
+            result.set(i, 3, -detail::affine_dot<Value>(
+                [i](size_t k) { return k == 3 ? 0 : T::kind(k, i); },
+                [](size_t k) { return k == 3 ? 0 : T::kind(k, 3); },
+                [&a, i](size_t k) { return a.get(k, i); },
+                [&a](size_t k) { return a.get(k, 3); }));
+    }
+    return result;
+}
+
+//! @}
+// =======================================================================
+
 NAMESPACE_END(drjit)
@@ -0,0 +1,344 @@
+/*
+    drjit/warp.h -- Warping functions that map uniform samples on the unit
+    square to other domains (disk, sphere, hemisphere, cone, microfacet
+    distributions), along with their inverses and densities
+
+    Dr.Jit is a C++ template library for efficient vectorization and
+    differentiation of numerical kernels on modern processor architectures.
+
+    Copyright (c) 2021 Wenzel Jakob <wenzel.jakob@epfl.ch>
+
+    All rights reserved. Use of this source code is governed by a BSD-style
+    license that can be found in the LICENSE file.
+*/
+
+#pragma once
+
+#include <drjit/math.h>
+
+NAMESPACE_BEGIN(drjit)
+
+// All functions below are branch-free: special cases are handled via
+// select(), which compiles to blend instructions on packet types and to
+// 'select' IR statements on the JIT backends. 'sample' always refers to a
+// point in [0, 1)^2, and each density is expressed with respect to the
+// natural measure of the target domain (area, or solid angle).
+
+// =======================================================================
+//! @{ \name Disk
+// =======================================================================
+
+/// Uniformly sample a point on the unit disk via polar coordinates
+template <typename Value>
+Array<Value, 2> square_to_uniform_disk(const Array<Value, 2> &sample) {
+    Value r = sqrt(sample.y());
+    auto [s, c] = sincos(TwoPi<Value> * sample.x());
+    return { c * r, s * r };
+}
+
+/// Inverse of \ref square_to_uniform_disk()
+template <typename Value>
+Array<Value, 2> uniform_disk_to_square(const Array<Value, 2> &p) {
+    Value phi = atan2(p.y(), p.x()) * InvTwoPi<Value>;
+    return { select(phi < 0.f, phi + 1.f, phi), squared_norm(p) };
+}
+
+/// Density of \ref square_to_uniform_disk() per unit area
+template <typename Value>
+Value square_to_uniform_disk_pdf(const Array<Value, 2> &p) {
+    return select(squared_norm(p) <= 1.f, InvPi<Value>, Value(0.f));
+}
+
+/**
+ * \brief Low-distortion concentric square to disk mapping by Shirley and
+ * Chiu (1997)
+ *
+ * This mapping preserves the stratification of its input better than \ref
+ * square_to_uniform_disk(), and it is the basis of the hemisphere, cone, and
+ * microfacet mappings in this file.
+ */
+template <typename Value>
+Array<Value, 2> square_to_uniform_disk_concentric(const Array<Value, 2> &sample) {
+    using Mask = mask_t<Value>;
+
+    Value x = fmadd(2.f, sample.x(), -1.f),
+          y = fmadd(2.f, sample.y(), -1.f);
+
+    Mask is_zero         = (x == 0.f) && (y == 0.f),
+         quadrant_1_or_3 = abs(x) < abs(y);
+
+    Value r  = select(quadrant_1_or_3, y, x),
+          rp = select(quadrant_1_or_3, x, y);
+
+    Value phi = .25f * Pi<Value> * rp / r;
+    phi = select(quadrant_1_or_3, .5f * Pi<Value> - phi, phi);
+    phi = select(is_zero, Value(0.f), phi);
+
+    auto [s, c] = sincos(phi);
+    return { r * c, r * s };
+}
+
+/// Inverse of \ref square_to_uniform_disk_concentric()
+template <typename Value>
+Array<Value, 2> uniform_disk_to_square_concentric(const Array<Value, 2> &p) {
+    using Mask = mask_t<Value>;
+
+    Mask quadrant_0_or_2 = abs(p.x()) > abs(p.y());
+    Value r_sign = select(quadrant_0_or_2, p.x(), p.y());
+    Value r = mulsign(norm(p), r_sign);
+
+    Value phi = atan2(mulsign(p.y(), r_sign), mulsign(p.x(), r_sign));
+
+    Value t = 4.f / Pi<Value> * phi;
+    t = select(quadrant_0_or_2, t, 2.f - t) * r;
+
+    Value a = select(quadrant_0_or_2, r, t),
+          b = select(quadrant_0_or_2, t, r);
+
+    return { fmadd(a, .5f, .5f), fmadd(b, .5f, .5f) };
+}
+
+/// Density of \ref square_to_uniform_disk_concentric() per unit area
+template <typename Value>
+Value square_to_uniform_disk_concentric_pdf(const Array<Value, 2> &p) {
+    return square_to_uniform_disk_pdf(p);
+}
+
+//! @}
+// =======================================================================
+
+// =======================================================================
+//! @{ \name Sphere and hemisphere
+// =======================================================================
+
+/// Uniformly sample a direction on the unit sphere
+template <typename Value>
+Array<Value, 3> square_to_uniform_sphere(const Array<Value, 2> &sample) {
+    Value z = fmadd(-2.f, sample.y(), 1.f),
+          r = safe_sqrt(fnmadd(z, z, 1.f));
+    auto [s, c] = sincos(TwoPi<Value> * sample.x());
+    return { r * c, r * s, z };
+}
+
+/// Inverse of \ref square_to_uniform_sphere()
+template <typename Value>
+Array<Value, 2> uniform_sphere_to_square(const Array<Value, 3> &v) {
+    Value phi = atan2(v.y(), v.x()) * InvTwoPi<Value>;
+    return { select(phi < 0.f, phi + 1.f, phi), fmadd(v.z(), -.5f, .5f) };
+}
+
+/// Density of \ref square_to_uniform_sphere() per unit solid angle
+template <typename Value>
+Value square_to_uniform_sphere_pdf(const Array<Value, 3> &) {
+    return InvFourPi<Value>;
+}
+
+/// Uniformly sample a direction on the hemisphere around the positive Z axis
+template <typename Value>
+Array<Value, 3> square_to_uniform_hemisphere(const Array<Value, 2> &sample) {
+    // Lift the concentric disk mapping to the hemisphere (area-preserving)
+    Array<Value, 2> p = square_to_uniform_disk_concentric(sample);
+    Value z = 1.f - squared_norm(p);
+    p *= sqrt(z + 1.f);
+    return { p.x(), p.y(), z };
+}
+
+/// Inverse of \ref square_to_uniform_hemisphere()
+template <typename Value>
+Array<Value, 2> uniform_hemisphere_to_square(const Array<Value, 3> &v) {
+    Array<Value, 2> p(v.x(), v.y());
+    return uniform_disk_to_square_concentric(p * rsqrt(v.z() + 1.f));
+}
+
+/// Density of \ref square_to_uniform_hemisphere() per unit solid angle
+template <typename Value>
+Value square_to_uniform_hemisphere_pdf(const Array<Value, 3> &v) {
+    return select(v.z() >= 0.f, InvTwoPi<Value>, Value(0.f));
+}
+
+/// Sample a cosine-weighted direction on the hemisphere around the positive Z axis
+template <typename Value>
+Array<Value, 3> square_to_cosine_hemisphere(const Array<Value, 2> &sample) {
+    // Malley's method: project the concentric disk onto the hemisphere
+    Array<Value, 2> p = square_to_uniform_disk_concentric(sample);
+    Value z = safe_sqrt(1.f - squared_norm(p));
+    return { p.x(), p.y(), z };
+}
+
+/// Inverse of \ref square_to_cosine_hemisphere()
+template <typename Value>
+Array<Value, 2> cosine_hemisphere_to_square(const Array<Value, 3> &v) {
+    return uniform_disk_to_square_concentric(Array<Value, 2>(v.x(), v.y()));
+}
+
+/// Density of \ref square_to_cosine_hemisphere() per unit solid angle
+template <typename Value>
+Value square_to_cosine_hemisphere_pdf(const Array<Value, 3> &v) {
+    return InvPi<Value> * maximum(v.z(), 0.f);
+}
+
+//! @}
+// =======================================================================
+
+// =======================================================================
+//! @{ \name Cone
+// =======================================================================
+
+/**
+ * \brief Uniformly sample a direction within the cone around the positive Z
+ * axis whose opening angle has the cosine \c cos_cutoff
+ */
+template <typename Value, typename Scalar>
+Array<Value, 3> square_to_uniform_cone(const Array<Value, 2> &sample,
+                                       const Scalar &cos_cutoff) {
+    Value one_minus_cos_cutoff = 1.f - Value(cos_cutoff);
+
+    Array<Value, 2> p = square_to_uniform_disk_concentric(sample);
+    Value pn = squared_norm(p);
+    Value z = fmadd(one_minus_cos_cutoff, 1.f - pn, Value(cos_cutoff));
+    p *= safe_sqrt(one_minus_cos_cutoff * fnmadd(one_minus_cos_cutoff, pn, 2.f));
+
+    return { p.x(), p.y(), z };
+}
+
+/// Inverse of \ref square_to_uniform_cone()
+template <typename Value, typename Scalar>
+Array<Value, 2> uniform_cone_to_square(const Array<Value, 3> &v,
+                                       const Scalar &cos_cutoff) {
+    Value one_minus_cos_cutoff = 1.f - Value(cos_cutoff);
+
+    Array<Value, 2> p(v.x(), v.y());
+    Value pn = squared_norm(p);
+    Value scale = safe_sqrt((1.f - v.z()) / (pn * one_minus_cos_cutoff));
+    p *= select(pn > 0.f, scale, Value(0.f));
+
+    return uniform_disk_to_square_concentric(p);
+}
+
+/// Density of \ref square_to_uniform_cone() per unit solid angle
+template <typename Value, typename Scalar>
+Value square_to_uniform_cone_pdf(const Array<Value, 3> &v,
+                                 const Scalar &cos_cutoff) {
+    Value cos_cutoff_v(cos_cutoff);
+    return select(v.z() >= cos_cutoff_v,
+                  InvTwoPi<Value> / (1.f - cos_cutoff_v), Value(0.f));
+}
+
+//! @}
+// =======================================================================
+
+// =======================================================================
+//! @{ \name Microfacet distributions
+// =======================================================================
+
+/*
+   Both distributions below are isotropic with roughness 'alpha' and sample
+   microfacet normals proportionally to D(m) cos(theta_m). Their polar angle
+   is a function of the squared radius of a concentric disk sample, which
+   keeps the mappings continuous and well-stratified.
+*/
+
+NAMESPACE_BEGIN(detail)
+
+/// Place the disk point 'p' with squared norm 'r2' at polar angle cosine 'cos_theta'
+template <typename Value>
+Array<Value, 3> warp_lift_disk(Array<Value, 2> p, const Value &r2,
+                               const Value &cos_theta) {
+    Value sin_theta_2 = fnmadd(cos_theta, cos_theta, 1.f);
+    p *= select(r2 > 0.f, safe_sqrt(sin_theta_2 / r2), Value(0.f));
+    return { p.x(), p.y(), cos_theta };
+}
+
+/// Inverse of \ref warp_lift_disk(): rescale the XY components of 'm' to squared norm 'r2'
+template <typename Value>
+Array<Value, 2> warp_flatten_disk(const Array<Value, 3> &m, const Value &r2) {
+    Array<Value, 2> p(m.x(), m.y());
+    Value pn = squared_norm(p);
+    p *= select(pn > 0.f, safe_sqrt(r2 / pn), Value(0.f));
+    return uniform_disk_to_square_concentric(p);
+}
+
+NAMESPACE_END(detail)
+
+/// Sample a microfacet normal from the Beckmann distribution
+template <typename Value, typename Scalar>
+Array<Value, 3> square_to_beckmann(const Array<Value, 2> &sample,
+                                   const Scalar &alpha) {
+    Array<Value, 2> p = square_to_uniform_disk_concentric(sample);
+    Value r2 = squared_norm(p);
+
+    Value alpha_2 = square(Value(alpha)),
+          tan_theta_m_2 = -alpha_2 * log(1.f - r2),
+          cos_theta_m = rsqrt(1.f + tan_theta_m_2);
+
+    return detail::warp_lift_disk(p, r2, cos_theta_m);
+}
+
+/// Inverse of \ref square_to_beckmann()
+template <typename Value, typename Scalar>
+Array<Value, 2> beckmann_to_square(const Array<Value, 3> &m,
+                                   const Scalar &alpha) {
+    Value alpha_2 = square(Value(alpha)),
+          cos_theta_m_2 = square(m.z()),
+          tan_theta_m_2 = fnmadd(m.z(), m.z(), 1.f) / cos_theta_m_2;
+
+    return detail::warp_flatten_disk(m, 1.f - exp(-tan_theta_m_2 / alpha_2));
+}
+
+/// Density of \ref square_to_beckmann() per unit solid angle
+template <typename Value, typename Scalar>
+Value square_to_beckmann_pdf(const Array<Value, 3> &m, const Scalar &alpha) {
+    Value alpha_2 = square(Value(alpha)),
+          cos_theta_m_2 = square(m.z()),
+          tan_theta_m_2 = fnmadd(m.z(), m.z(), 1.f) / cos_theta_m_2;
+
+    Value result = exp(-tan_theta_m_2 / alpha_2) /
+                   (Pi<Value> * alpha_2 * cos_theta_m_2 * m.z());
+
+    return select(m.z() > 1e-6f, result, Value(0.f));
+}
+
+/// Sample a microfacet normal from the GGX (Trowbridge-Reitz) distribution
+template <typename Value, typename Scalar>
+Array<Value, 3> square_to_ggx(const Array<Value, 2> &sample,
+                              const Scalar &alpha) {
+    Array<Value, 2> p = square_to_uniform_disk_concentric(sample);
+    Value r2 = squared_norm(p);
+
+    // tan^2(theta_m) = alpha^2 r2 / (1 - r2) => cos^2(theta_m) = (1 - r2) / (1 + (alpha^2 - 1) r2)
+    Value alpha_2 = square(Value(alpha)),
+          cos_theta_m = safe_sqrt((1.f - r2) / fmadd(alpha_2 - 1.f, r2, 1.f));
+
+    return detail::warp_lift_disk(p, r2, cos_theta_m);
+}
+
+/// Inverse of \ref square_to_ggx()
+template <typename Value, typename Scalar>
+Array<Value, 2> ggx_to_square(const Array<Value, 3> &m, const Scalar &alpha) {
+    Value alpha_2 = square(Value(alpha)),
+          sin_theta_m_2 = fnmadd(m.z(), m.z(), 1.f),
+          cos_theta_m_2 = square(m.z());
+
+    // r2 = tan^2 / (alpha^2 + tan^2), multiplied through by cos^2(theta_m)
+    return detail::warp_flatten_disk(
+        m, sin_theta_m_2 / fmadd(alpha_2, cos_theta_m_2, sin_theta_m_2));
+}
+
+/// Density of \ref square_to_ggx() per unit solid angle
+template <typename Value, typename Scalar>
+Value square_to_ggx_pdf(const Array<Value, 3> &m, const Scalar &alpha) {
+    Value alpha_2 = square(Value(alpha)),
+          cos_theta_m_2 = square(m.z()),
+          sin_theta_m_2 = fnmadd(m.z(), m.z(), 1.f);
+
+    // D(m) cos(theta_m) = alpha^2 cos(theta_m) / (pi (alpha^2 cos^2 + sin^2)^2)
+    Value denom = fmadd(alpha_2, cos_theta_m_2, sin_theta_m_2);
+    Value result = alpha_2 * m.z() / (Pi<Value> * square(denom));
+
+    return select(m.z() > 0.f, result, Value(0.f));
+}
+
+//! @}
+// =======================================================================
+
+NAMESPACE_END(drjit)
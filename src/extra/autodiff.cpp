@@ -32,6 +32,11 @@
  * scope. The whole system is built to work with essentially no dynamic memory
  * allocation after a warm-up phase.
  *
+ * The shared data structures are protected by ``state.mutex``. Reference count
+ * changes are very frequent and usually cannot cause a variable to be freed.
+ * They therefore bypass the lock whenever possible, which reduces contention
+ * when multiple threads record independent AD graphs.
+ *
  * The implementation on top of drjit-core (a JIT compiler) is noteworthy:
  * derivative propagation performs arithmetic operations that appear
  * instantanous but whose evaluation is actually symbolic and deferred until
@@ -52,8 +57,11 @@
 #include <tsl/robin_set.h>
 #include <tsl/robin_map.h>
 #include <nanobind/intrusive/counter.inl>
-#include <queue>
+#include <algorithm>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 
 namespace dr = drjit;
 
@@ -139,6 +147,13 @@ DRJIT_INLINE JitVar scalar(Index index, double value) {
     return scalar(info.backend, info.type, value);
 }
 
+/// Convert a (possibly invalid) Jit variable to the given type
+static JitVar ad_cast(const JitVar &v, VarType type) {
+    if (!v.valid() || (VarType) jit_var_type(v.index()) == type)
+        return v;
+    return JitVar::steal(jit_var_cast(v.index(), type, 0));
+}
+
 // ==========================================================================
 // Central data structures: edges, variables, global state
 // ==========================================================================
@@ -176,7 +191,7 @@ struct Edge {
     /// Special edge handler
     dr::unique_ptr<Special> special;
 
-    /// Edge weight
+    /// Edge weight (an invalid index denotes a unit weight)
     JitVar weight;
 
     /// Visited flag for DFS traversal
@@ -208,7 +223,10 @@ enum VariableFlags : uint8_t {
     Visited = 1 << 4,
 
     /// Is this variable on an iteration boundary of an evaluated loop?
-    LoopBoundary = 1 << 5
+    LoopBoundary = 1 << 5,
+
+    /// Does this variable have a sparse gradient in 'state.sparse_grads'?
+    SparseGrad = 1 << 6
 };
 
 /**
@@ -224,10 +242,21 @@ enum VariableFlags : uint8_t {
  * the forward or backward direction, is represented using linked lists. The
  * 'next_fwd' and 'next_bwd' fields each provide an entry point into such a
  * linked list of edges (see also \ref Edge).
+ *
+ * The data structure only contains fields accessed during graph construction
+ * and traversal, and it is laid out to occupy 32 bytes (i.e., two variables
+ * per cache line). Rarely accessed information like the descriptive label is
+ * stored separately in ``state.labels``.
  */
 struct Variable {
-    /// Number of references to this AD variable
-    uint32_t ref_count = 0;
+    /**
+     * \brief Number of references to this AD variable
+     *
+     * This field is atomic so that reference count changes that cannot
+     * trigger deallocation can bypass ``state.mutex`` (see \ref
+     * ad_var_inc_ref_impl() and \ref ad_var_dec_ref_impl()).
+     */
+    std::atomic<uint32_t> ref_count { 0 };
 
     /// Link to the first forward edge at this node
     EdgeIndex next_fwd = 0;
@@ -239,13 +268,7 @@ struct Variable {
     JitVar grad;
 
     /// Size of the associated primal variable
-    size_t size = 0;
-
-    /// Descriptive label
-    char *label = nullptr;
-
-    /// Value of the ``state.counter`` field when this variable was created
-    uint64_t counter = 0;
+    uint32_t size = 0;
 
     /// JIT backend associated with this variable
     uint8_t backend = 0;
@@ -256,35 +279,60 @@ struct Variable {
     /// Custom flags (see the 'VariableFlag' enum above)
     uint8_t flags = 0;
 
+    /**
+     * \brief Storage type of the gradient (see \ref ad_var_set_grad_type())
+     *
+     * The default value of zero stores gradients using the primal type.
+     * Otherwise, \ref accum() and \ref mul_accum() add contributions using
+     * the wider of the two types and then convert the result to this one.
+     */
+    uint8_t grad_type = 0;
+
+    /// Value of the ``state.counter`` field when this variable was created
+    uint64_t counter = 0;
+
     Variable() = default;
 
     Variable(const Variable &) = delete;
     Variable &operator=(const Variable &) = delete;
 
     Variable(Variable &&v) noexcept
-        : ref_count(v.ref_count), next_fwd(v.next_fwd), next_bwd(v.next_bwd),
-          grad(std::move(v.grad)), size(v.size), label(v.label),
-          counter(v.counter), backend(v.backend), type(v.type), flags(v.flags) {
-        v.label = nullptr;
-    }
+        : ref_count(v.ref_count.load(std::memory_order_relaxed)),
+          next_fwd(v.next_fwd), next_bwd(v.next_bwd),
+          grad(std::move(v.grad)), size(v.size), backend(v.backend),
+          type(v.type), flags(v.flags), grad_type(v.grad_type),
+          counter(v.counter) { }
 
     Variable &operator=(Variable &&v) noexcept {
-        ref_count = v.ref_count; next_fwd = v.next_fwd;
+        ref_count.store(v.ref_count.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+        next_fwd = v.next_fwd;
         next_bwd = v.next_bwd; grad = std::move(v.grad);
         size = v.size;
-        if (flags & (uint8_t) VariableFlags::FreeLabel)
-            free(label);
-        label = v.label; v.label = nullptr;
-        counter = v.counter;
         backend = v.backend;
         type = v.type;
         flags = v.flags;
+        grad_type = v.grad_type;
+        counter = v.counter;
         return *this;
     }
 
-    ~Variable() {
-        if (flags & (uint8_t) VariableFlags::FreeLabel)
-            free(label);
+    /// Type used to accumulate gradients (the wider of 'type' and 'grad_type')
+    VarType accum_type() const {
+        VarType t1 = (VarType) type, t2 = (VarType) grad_type;
+        return jit_type_size(t2) > jit_type_size(t1) ? t2 : t1;
+    }
+
+    /// Convert the gradient to the primal type before propagating it
+    void load_grad() {
+        if (unlikely(grad_type))
+            grad = ad_cast(grad, (VarType) type);
+    }
+
+    /// Convert the gradient back to its storage type
+    void store_grad() {
+        if (unlikely(grad_type))
+            grad = ad_cast(grad, (VarType) grad_type);
     }
 
     /**
@@ -299,8 +347,27 @@ struct Variable {
      *
      * This is operation is heavily used during AD traversal, hence the
      * implementation considers a few different cases and optimizations.
+     *
+     * An invalid ``v2`` represents a unit edge weight, in which case the
+     * operation reduces to \ref accum().
      */
     void mul_accum(const JitVar &v1, const JitVar &v2, size_t src_size) {
+        if (unlikely(grad_type)) {
+            VarType t = accum_type();
+            grad = ad_cast(grad, t);
+            mul_accum_impl(ad_cast(v1, t), ad_cast(v2, t), src_size);
+            store_grad();
+        } else {
+            mul_accum_impl(v1, v2, src_size);
+        }
+    }
+
+    void mul_accum_impl(const JitVar &v1, const JitVar &v2, size_t src_size) {
+        if (!v2.valid()) {
+            accum_impl(v1, src_size);
+            return;
+        }
+
         JitVar zero = scalar(v1.index(), 0.f), weight;
 
         // Elide the zero check if ``v2`` is known not to be NaN/infinite
@@ -336,6 +403,41 @@ struct Variable {
         }
     }
 
+    /**
+     * \brief Compute the term ``v1*v2`` that \ref mul_accum() would add to
+     * the gradient of this variable, without accumulating it.
+     *
+     * This is used by the level-scheduled traversal mode (see
+     * ``ADFlag::LevelSchedule``), which merges such terms in a separate step.
+     */
+    JitVar mul_term(const JitVar &v1, const JitVar &v2, size_t src_size) const {
+        JitVar v3;
+
+        if (!v2.valid()) {
+            v3 = v1;
+        } else {
+            JitVar zero = scalar(v1.index(), 0.f), weight;
+
+            if (jit_var_is_finite_literal(v2.index()))
+                weight = v2;
+            else
+                weight = dr::select(v1 == zero, zero, v2);
+
+            v3 = v1 * weight;
+        }
+
+        if (size == 1 && src_size != 1) {
+            if (v3.size() == 1) {
+                v3 *= scalar(v1.index(), (double) src_size);
+            } else {
+                ad_assert(v3.size() == src_size, "mul_term(): size mismatch");
+                v3 = dr::sum(v3);
+            }
+        }
+
+        return v3;
+    }
+
     /**
      * \brief Accumulate a gradient 'v' originating from another variable of
      * size 'src_size' into the current variable.
@@ -345,6 +447,17 @@ struct Variable {
      * optimizations.
      */
     void accum(const JitVar& v, size_t src_size) {
+        if (unlikely(grad_type)) {
+            VarType t = accum_type();
+            grad = ad_cast(grad, t);
+            accum_impl(ad_cast(v, t), src_size);
+            store_grad();
+        } else {
+            accum_impl(v, src_size);
+        }
+    }
+
+    void accum_impl(const JitVar& v, size_t src_size) {
         if (size == 1 && src_size != 1) {
             /* When this variable is scalar (size == 1) and the source is
                not (src_size != 1), the gradient must be reduced to a single
@@ -373,20 +486,149 @@ struct Variable {
     }
 };
 
+static_assert(sizeof(Variable) == 32, "Variable: unexpected size!");
+
+/**
+ * \brief Append-only array with stable element addresses
+ *
+ * In contrast to ``std::vector``, growing this array never relocates existing
+ * entries. Storage is split into chunks with geometrically increasing sizes
+ * (``2^LogBaseSize``, ``2^(LogBaseSize+1)``, etc.) so that indexing only
+ * requires a leading zero count. This makes it legal to access an entry whose
+ * lifetime is guaranteed by some other means (e.g., a held reference), while
+ * another thread appends to the array.
+ */
+template <typename T, uint32_t LogBaseSize = 10> struct StableVector {
+    /// Enough chunks to address the full 32-bit index range
+    static constexpr uint32_t ChunkCount = 33 - LogBaseSize;
+
+    StableVector() = default;
+    StableVector(const StableVector &) = delete;
+    StableVector &operator=(const StableVector &) = delete;
+
+    ~StableVector() {
+        for (size_t i = 0; i < m_size; ++i)
+            (*this)[i].~T();
+        for (T *chunk : m_chunks)
+            free(chunk);
+    }
+
+    size_t size() const { return m_size; }
+
+    T &operator[](size_t index) {
+        uint64_t i = (uint64_t) index + (1ull << LogBaseSize);
+        uint32_t hb = (uint32_t) dr::log2i(i);
+        return m_chunks[hb - LogBaseSize][i - (1ull << hb)];
+    }
+
+    T &emplace_back() {
+        uint64_t i = (uint64_t) m_size + (1ull << LogBaseSize);
+        uint32_t hb = (uint32_t) dr::log2i(i);
+        T *&chunk = m_chunks[hb - LogBaseSize];
+
+        if (unlikely(!chunk)) {
+            chunk = (T *) malloc(sizeof(T) << hb);
+            if (!chunk)
+                ad_fail("StableVector::emplace_back(): out of memory!");
+        }
+
+        T *value = new (chunk + (i - (1ull << hb))) T();
+        m_size++;
+        return *value;
+    }
+
+private:
+    T *m_chunks[ChunkCount] { };
+    size_t m_size = 0;
+};
+
+/**
+ * \brief Pool of currently unused variable or edge indices
+ *
+ * The pool either behaves like a stack (last-in, first-out) or like a priority
+ * queue that always returns the smallest unused index. The former requires
+ * O(1) time per operation and reuses recently freed entries that are likely
+ * still cached. The latter requires O(log n) time but keeps the set of used
+ * entries compact. The policy can be selected via \ref ad_set_sorted_reuse().
+ */
+struct IndexPool {
+    bool empty() const { return indices.empty(); }
+    size_t size() const { return indices.size(); }
+
+    void push(uint32_t index) {
+        indices.push_back(index);
+        if (sorted)
+            std::push_heap(indices.begin(), indices.end(),
+                           std::greater<uint32_t>());
+    }
+
+    uint32_t pop() {
+        if (sorted)
+            std::pop_heap(indices.begin(), indices.end(),
+                          std::greater<uint32_t>());
+        uint32_t index = indices.back();
+        indices.pop_back();
+        return index;
+    }
+
+    void set_sorted(bool value) {
+        if (value == sorted)
+            return;
+
+        if (value)
+            std::make_heap(indices.begin(), indices.end(),
+                           std::greater<uint32_t>());
+        else // Continue with the smallest indices after switching to LIFO mode
+            std::sort(indices.begin(), indices.end(), std::greater<uint32_t>());
+
+        sorted = value;
+    }
+
+    std::vector<uint32_t> indices;
+    bool sorted = false;
+};
+
 /// Represents the global state of the AD system
 struct State {
     /// std::mutex protecting the state data structure
     std::mutex mutex;
 
-    /// Hash table mapping variable IDs to variable instances
-    std::vector<Variable> variables;
+    /**
+     * \brief List of all variables (used and unused ones)
+     *
+     * This array never relocates its entries, which is needed by the
+     * lock-free reference counting fast path.
+     */
+    StableVector<Variable> variables;
+
+    /**
+     * \brief Descriptive labels of the entries of 'variables'
+     *
+     * Labels are only needed for debugging and GraphViz output. They are
+     * therefore kept separate from the frequently accessed 'Variable' records
+     * so that graph traversal touches fewer cache lines. The label is owned
+     * (and must be freed) if the 'VariableFlags::FreeLabel' flag is set.
+     */
+    StableVector<char *> labels;
+
+    /**
+     * \brief Epoch stamps of the entries of 'variables'
+     *
+     * A variable whose stamp matches \ref Scope::epoch of the innermost scope
+     * is already part of its 'implicit_in' set. This lets repeated implicit
+     * reads of the same variable in symbolic code skip the hash set lookup.
+     */
+    StableVector<uint32_t> implicit_epoch;
+
+    /// Source of unique \ref Scope::epoch values
+    std::atomic<uint32_t> scope_epoch { 0 };
 
     /// List of all edges (used and unused ones)
     std::vector<Edge> edges;
 
-    /// Sorted list of currently unused edges and vertices
-    std::priority_queue<ADIndex, std::vector<ADIndex>, std::greater<uint32_t>> unused_variables;
-    std::priority_queue<EdgeIndex, std::vector<EdgeIndex>, std::greater<uint32_t>> unused_edges;
+    /// Pools of currently unused edges and vertices
+    IndexPool unused_variables;
+    IndexPool unused_edges;
 
     /// Counter to establish an ordering among variables
     uint64_t counter = 0;
@@ -394,8 +636,55 @@ struct State {
     /// Are memory leak warnings enabled?
     bool leak_warnings = true;
 
+    /**
+     * \brief Memory budget (in bytes) for unevaluated gradients during
+     * ad_traverse(). Zero means that the budget is unlimited.
+     */
+    size_t traverse_budget = 0;
+
+    /**
+     * \brief Number of edges after which ad_traverse() evaluates the
+     * gradients computed so far. Zero means that traversals aren't split.
+     */
+    size_t traverse_chunk = 0;
+
+    /**
+     * \brief Contention threshold for the adjoint of gather operations
+     *
+     * When the number of gathered elements exceeds the size of the source
+     * array by this factor, the reverse-mode derivative uses a locally
+     * pre-reducing scatter (``ReduceMode::Local``). Zero disables this.
+     */
+    uint32_t local_reduce_ratio = 16;
+
+    /// Accumulate gather adjoints in a reproducible manner?
+    bool deterministic = false;
+
+    /// Accumulate gather adjoints using Kahan-compensated atomics?
+    bool kahan = false;
+
+    /// Counters reported by ad_stats()
+    ADStats stats { };
+
+    /// Cached traversal plans, keyed by a hash of their signature
+    tsl::robin_map<uint64_t, TraversalPlan> plans;
+
+    /**
+     * \brief Sparse gradients of input variables (see ``ADFlag::SparseGrad``)
+     *
+     * Each entry stores the deferred adjoint scatters of gathers that read
+     * from the variable, i.e., a copy of the 'Gather' edge and the gradient
+     * of its output. They are scattered into a dense gradient once the
+     * gradient is read or combined with other contributions.
+     */
+    tsl::robin_map<ADIndex,
+                   std::vector<std::pair<dr::unique_ptr<Special>, JitVar>>,
+                   UInt32Hasher> sparse_grads;
+
     State() {
-        variables.resize(1);
+        variables.emplace_back();
+        labels.emplace_back();
+        implicit_epoch.emplace_back();
         edges.resize(1);
     }
 
@@ -413,7 +702,8 @@ struct State {
                     if (variables[i].ref_count == 0)
                         continue;
 
-                    ad_warn(" - variable a%zu (%u references)", i, variables[i].ref_count);
+                    ad_warn(" - variable a%zu (%u references)", i,
+                            variables[i].ref_count.load());
                     if (++count == 10) {
                         ad_warn(" - (skipping the rest)");
                         break;
@@ -432,8 +722,25 @@ struct State {
             ad_fail("Referenced an unknown variable a%u!", index);
         return &variables[index];
     }
+
+    /// Unchecked variable lookup that may be performed without holding ``mutex``
+    Variable *lookup(ADIndex index) { return &variables[index]; }
+
+    /// Replace the label of a variable, releasing the previous one if owned
+    void set_label(ADIndex index, Variable *v, char *label, bool owned) {
+        char *&ref = labels[index];
+        if (v->flags & (uint8_t) VariableFlags::FreeLabel)
+            free(ref);
+        ref = label;
+        if (owned)
+            v->flags |= (uint8_t) VariableFlags::FreeLabel;
+        else
+            v->flags &= (uint8_t) ~VariableFlags::FreeLabel;
+    }
 };
 
+struct Gather;
+
 // Special edge (scatter, gather, scatter_reduce, block_sum, etc.)
 struct Special {
     virtual void backward(Variable * /* source */,
@@ -446,6 +753,9 @@ struct Special {
         ad_fail("Special::forward(): not implemented!");
     }
 
+    /// Return the gather operation implemented by this edge, if any
+    virtual Gather *as_gather() { return nullptr; }
+
     virtual ~Special() = default;
 };
 
@@ -477,6 +787,18 @@ struct EdgeRef {
           source_counter(source_counter), target_counter(target_counter) { }
 };
 
+/// Cached ordering of a previous AD traversal (see ``ADFlag::CachePlan``)
+struct TraversalPlan {
+    /// Edge counters relative to the smallest one, in the original order
+    std::vector<std::pair<uint64_t, uint64_t>> signature;
+
+    /// Permutation that brings the edges into traversal order
+    std::vector<uint32_t> order;
+
+    /// Topological levels of the reordered edges (for ``ADFlag::LevelSchedule``)
+    std::vector<uint32_t> levels;
+};
+
 /**
  * This data structure encodes an AD scope that can be used to selectively
  * enable/disable derivative propagation for certain variables
@@ -512,6 +834,9 @@ struct Scope {
     // Current ``state.counter`` value when entering this scope
     uint64_t counter = 0;
 
+    /// Unique ID of this scope's 'implicit_in' set (see ``state.implicit_epoch``)
+    uint32_t epoch = 0;
+
     /**
      * \brief Depending on the value of 'complement', this set specifies
      * variables for which AD is enabled or disabled.
@@ -593,9 +918,7 @@ static thread_local LocalState local_state;
 
 #if defined(DRJIT_SANITIZE_INTENSE)
 static void ad_sanitation_checkpoint_variables() {
-    state.variables.emplace_back();
-    state.variables.pop_back();
-    state.variables.shrink_to_fit();
+    // Nothing to do: 'state.variables' never relocates its entries
 }
 static void ad_sanitation_checkpoint_edges() {
     state.edges.emplace_back();
@@ -642,6 +965,45 @@ static bool ad_var_dec_ref_int(ADIndex index, Variable *v) noexcept {
     }
 }
 
+/**
+ * \brief Lock-free reference count increase
+ *
+ * This is legal because the caller already owns a reference to ``index``,
+ * which means the variable cannot be freed or reused concurrently.
+ */
+static void ad_var_inc_ref_fast(ADIndex index) noexcept {
+    Variable *v = state.lookup(index);
+    ad_trace("ad_var_inc_ref(a%u): %u", index, v->ref_count.load() + 1);
+    v->ref_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Attempt a lock-free reference count decrease
+ *
+ * Decreasing the reference count to zero frees the variable, and reaching a
+ * count of two may break a reference cycle involving a ``CustomOp`` (see \ref
+ * ad_decref_custom_op_output()). Both require ``state.mutex``. This function
+ * thus only handles the common case where the count remains above this range
+ * and otherwise returns ``false``, in which case the caller must acquire the
+ * lock and use \ref ad_var_dec_ref_int().
+ */
+static bool ad_var_dec_ref_fast(ADIndex index) noexcept {
+    DRJIT_MARK_USED(index);
+    std::atomic<uint32_t> &ref_count = state.lookup(index)->ref_count;
+    uint32_t value = ref_count.load(std::memory_order_relaxed);
+
+    while (value > 3) {
+        if (ref_count.compare_exchange_weak(value, value - 1,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+            ad_trace("ad_var_dec_ref(a%u): %u", index, value - 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static void ad_free_edges(uint32_t index, Variable *v) {
     EdgeIndex edge_id = v->next_bwd;
     v->next_bwd = 0;
@@ -694,6 +1056,10 @@ static void ad_free(ADIndex index, Variable *v) {
 
     ad_free_edges(index, v);
 
+    if (unlikely(v->flags & (uint8_t) VariableFlags::SparseGrad))
+        state.sparse_grads.erase(index);
+
+    state.set_label(index, v, nullptr, false);
     *v = Variable { };
     state.unused_variables.push(index);
 }
@@ -709,10 +1075,8 @@ Index ad_var_copy_ref_impl(Index index) JIT_NOEXCEPT {
         if (!scopes.empty())
             scopes.back().maybe_disable(ad_index);
 
-        if (ad_index) {
-            std::lock_guard<std::mutex> guard(state.mutex);
-            ad_var_inc_ref_int(ad_index, state[ad_index]);
-        }
+        if (ad_index)
+            ad_var_inc_ref_fast(ad_index);
     }
 
     return combine(ad_index, jit_index);
@@ -724,10 +1088,8 @@ Index ad_var_inc_ref_impl(Index index) JIT_NOEXCEPT {
 
     jit_var_inc_ref(jit_index);
 
-    if (unlikely(ad_index)) {
-        std::lock_guard<std::mutex> guard(state.mutex);
-        ad_var_inc_ref_int(ad_index, state[ad_index]);
-    }
+    if (unlikely(ad_index))
+        ad_var_inc_ref_fast(ad_index);
 
     return index;
 }
@@ -747,7 +1109,7 @@ void ad_var_dec_ref_impl(Index index) JIT_NOEXCEPT {
 
     jit_var_dec_ref(jit_index);
 
-    if (unlikely(ad_index)) {
+    if (unlikely(ad_index) && !ad_var_dec_ref_fast(ad_index)) {
         std::lock_guard<std::mutex> guard(state.mutex);
         ad_var_dec_ref_int(ad_index, state[ad_index]);
     }
@@ -786,9 +1148,10 @@ static std::pair<ADIndex, Variable *> ad_var_new(JitBackend backend,
     if (unlikely(unused.empty() || !reuse_indices)) {
         index = (ADIndex) state.variables.size();
         state.variables.emplace_back();
+        state.labels.emplace_back();
+        state.implicit_epoch.emplace_back();
     } else {
-        index = unused.top();
-        unused.pop();
+        index = unused.pop();
     }
 
 #if defined(DRJIT_SANITIZE_INTENSE)
@@ -797,19 +1160,20 @@ static std::pair<ADIndex, Variable *> ad_var_new(JitBackend backend,
 
     Variable *v = &state.variables[index];
     v->ref_count = 1;
-    v->size = size;
+    v->size = (uint32_t) size;
     v->counter = state.counter++;
     v->backend = (uint8_t) backend;
     v->type = (uint8_t) type;
     v->flags = symbolic ? (uint8_t) VariableFlags::Symbolic : (uint8_t) 0;
 
     const char *prefix = jit_prefix(backend);
-    if (prefix) {
-        v->label = concat(prefix, label);
+    if (prefix)
+        state.labels[index] = concat(prefix, label);
+    else
+        state.labels[index] = (char *) label;
+
+    if (prefix)
         v->flags |= (uint8_t) VariableFlags::FreeLabel;
-    } else {
-        v->label = (char *) label;
-    }
 
     return { index, v };
 }
@@ -823,8 +1187,7 @@ static EdgeIndex ad_edge_new() {
         index = (EdgeIndex) state.edges.size();
         state.edges.emplace_back();
     } else {
-        index = unused.top();
-        unused.pop();
+        index = unused.pop();
     }
 
 #if defined(DRJIT_SANITIZE_INTENSE)
@@ -918,6 +1281,35 @@ struct ReleaseHelper {
     }
 };
 
+/// Check if the given JIT variable is a floating point literal equal to one
+static bool ad_is_one_literal(JitIndex index) {
+    if (!index || jit_var_state(index) != VarState::Literal)
+        return false;
+
+    switch (jit_var_type(index)) {
+        case VarType::Float16: {
+                dr::half value;
+                jit_var_read(index, 0, &value);
+                return (float) value == 1.f;
+            }
+
+        case VarType::Float32: {
+                float value;
+                jit_var_read(index, 0, &value);
+                return value == 1.f;
+            }
+
+        case VarType::Float64: {
+                double value;
+                jit_var_read(index, 0, &value);
+                return value == 1.0;
+            }
+
+        default:
+            return false;
+    }
+}
+
 /// Forward declaration of a helper function defined later on
 uint32_t ad_record_implicit_dependence(LocalState &ls, ReleaseHelper &rl,
                                        JitBackend backend, uint32_t source,
@@ -950,11 +1342,10 @@ DRJIT_NOINLINE Index ad_var_new_impl(const char *label, JitVar &&result,
     #pragma GCC diagnostic pop
 #endif
 
-    std::lock_guard<std::mutex> guard(state.mutex);
-
     /* Potentially turn off derivative tracking for some of the operands if
        we're within a scope that enables/disables gradient propagation
-       (globally, or only for specific variables) */
+       (globally, or only for specific variables). Scopes are thread-local,
+       hence this step does not require holding 'state.mutex'. */
     LocalState &ls = local_state;
     std::vector<Scope> &scopes = ls.scopes;
     if (!scopes.empty()) {
@@ -980,6 +1371,10 @@ DRJIT_NOINLINE Index ad_var_new_impl(const char *label, JitVar &&result,
          reuse_indices = flags & (uint32_t) JitFlag::ReuseIndices;
 
     VarInfo info = jit_set_backend(result.index());
+
+    /* Only enter the critical section now. The queries above call into
+       drjit-core and should not extend the time spent holding the lock. */
+    std::lock_guard<std::mutex> guard(state.mutex);
     ReleaseHelper rh;
 
     /* Turn symbolic reads from non-symbolic variables into gathers,
@@ -1044,6 +1439,26 @@ DRJIT_NOINLINE Index ad_var_new_impl(const char *label, JitVar &&result,
 
         Variable *v_source = state[source];
 
+        if constexpr (!std::is_same_v<ArgType, SpecialArg>) {
+            /* Fold edges with the same source (e.g., in ``x*x``) into a
+               single edge with a combined weight */
+            EdgeIndex match = 0;
+            for (EdgeIndex e = edge_index; e; e = state.edges[e].next_bwd) {
+                if (state.edges[e].source == source) {
+                    match = e;
+                    break;
+                }
+            }
+
+            if (match) {
+                ad_trace("ad_var_new(a%u <- a%u): merging edge %zu into "
+                         "an existing edge.", ad_index, source, i);
+                JitVar &weight = state.edges[match].weight;
+                weight = weight + args[i].weight;
+                continue;
+            }
+        }
+
         EdgeIndex edge_index_new = ad_edge_new();
         Edge &edge = state.edges[edge_index_new];
         edge.source = source;
@@ -1062,6 +1477,15 @@ DRJIT_NOINLINE Index ad_var_new_impl(const char *label, JitVar &&result,
         v_source->next_fwd = edge_index_new;
     }
 
+    if constexpr (!std::is_same_v<ArgType, SpecialArg>) {
+        // Unit weights don't need to be stored or multiplied during traversal
+        for (EdgeIndex e = edge_index; e; e = state.edges[e].next_bwd) {
+            JitVar &weight = state.edges[e].weight;
+            if (ad_is_one_literal(weight.index()))
+                weight = JitVar();
+        }
+    }
+
     if constexpr (N > 0) {
         if (!edge_index) {
             // All edges were pruned, don't create the node after all
@@ -1112,8 +1536,9 @@ JitIndex ad_grad(Index index, bool null_ok) {
 
     if (ad_index) {
         std::lock_guard<std::mutex> guard(state.mutex);
-        const Variable *v = state[ad_index];
-        result = v->grad;
+        Variable *v = state[ad_index];
+        ad_densify_grad(ad_index, v);
+        result = ad_cast(v->grad, (VarType) v->type);
         backend = (JitBackend) v->backend;
         type = (VarType) v->type;
         size = v->size;
@@ -1147,6 +1572,30 @@ void ad_clear_grad(Index index) {
     std::lock_guard<std::mutex> guard(state.mutex);
     Variable *v = state[ad_index];
     v->grad = JitVar();
+
+    if (unlikely(v->flags & (uint8_t) VariableFlags::SparseGrad)) {
+        v->flags &= (uint8_t) ~VariableFlags::SparseGrad;
+        state.sparse_grads.erase(ad_index);
+    }
+}
+
+void ad_var_set_grad_type(Index index, VarType type) {
+    ADIndex ad_index = ::ad_index(index);
+    if (ad_index == 0)
+        return;
+
+    if (type != VarType::Void && type != VarType::Float16 &&
+        type != VarType::Float32 && type != VarType::Float64)
+        ad_raise("ad_var_set_grad_type(): the gradient type must be a "
+                 "floating point type!");
+
+    std::lock_guard<std::mutex> guard(state.mutex);
+    Variable *v = state[ad_index];
+    ad_log("ad_var_set_grad_type(a%u, %s)", ad_index, jit_type_name(type));
+
+    ad_densify_grad(ad_index, v);
+    v->grad_type = type == (VarType) v->type ? 0 : (uint8_t) type;
+    v->grad = ad_cast(v->grad, type == VarType::Void ? (VarType) v->type : type);
 }
 
 void ad_accum_grad(Index index, JitIndex value) {
@@ -1171,10 +1620,11 @@ void ad_accum_grad(Index index, JitIndex value) {
     if (v->size != size_in && size_in != 1 && size_in != 0 && v->size != 1)
         ad_raise("ad_set_grad(): attempted to store a gradient of size "
                  "%zu into AD variable a%u, which has size %zu!",
-                 size_in, ad_index, v->size);
+                 size_in, ad_index, (size_t) v->size);
 
     ad_log("ad_accum_grad(a%u, r%u)", ad_index, value);
 
+    ad_densify_grad(ad_index, v);
     v->accum(value_v, size_in);
 }
 
@@ -1222,15 +1672,12 @@ Index ad_var_set_label(Index index, size_t argc, ...) {
 
         Variable *v = state[ad_index];
 
-        if (v->flags & (uint8_t) VariableFlags::FreeLabel)
-            free(v->label);
-
         VarInfo info = jit_set_backend(jit_index);
         const char *prefix = jit_prefix(info.backend);
         if (!prefix || !label)
-            v->label = label ? strdup(label) : nullptr;
+            state.set_label(ad_index, v, label ? strdup(label) : nullptr, true);
         else
-            v->label = concat(prefix, label);
+            state.set_label(ad_index, v, concat(prefix, label), true);
 
         const uint8_t flags = (uint8_t) VariableFlags::FreeLabel |
                               (uint8_t) VariableFlags::CustomLabel;
@@ -1442,6 +1889,242 @@ static void ad_clear_todo(std::vector<EdgeRef> &todo, bool remove_edges) {
     todo.clear();
 }
 
+/**
+ * Determine whether the gradient of a variable visited by a reverse-mode
+ * traversal can still be observed. This is the case when something besides
+ * the AD graph references the variable (e.g., an array held by the user or
+ * a custom operation), or when a traversed edge propagates its gradient
+ * further to such a variable. The function is conservative and considers
+ * variables created by symbolic operations and custom operations as live.
+ */
+static bool ad_is_live(ADIndex index,
+                       tsl::robin_map<ADIndex, bool, UInt32Hasher> &live) {
+    auto it = live.find(index);
+    if (it != live.end())
+        return it->second;
+
+    Variable *v = state[index];
+
+    // Forward edges reference their source, todo lists their target
+    uint32_t internal_refs = 0;
+    for (EdgeIndex e = v->next_fwd; e; e = state.edges[e].next_fwd)
+        internal_refs++;
+    for (EdgeIndex e = v->next_bwd; e; e = state.edges[e].next_bwd)
+        internal_refs += state.edges[e].visited ? 1 : 0;
+
+    bool result =
+        v->ref_count.load(std::memory_order_relaxed) > internal_refs ||
+        (v->flags & ((uint8_t) VariableFlags::Symbolic |
+                     (uint8_t) VariableFlags::CustomOpOutput |
+                     (uint8_t) VariableFlags::LoopBoundary |
+                     (uint8_t) VariableFlags::SparseGrad)) != 0;
+
+    for (EdgeIndex e = v->next_bwd; e && !result; e = state.edges[e].next_bwd) {
+        const Edge &edge = state.edges[e];
+        if (edge.visited)
+            result = edge.is_custom || ad_is_live(edge.source, live);
+    }
+
+    live[index] = result;
+    return result;
+}
+
+/**
+ * Remove edges from a reverse-mode todo list whose gradients would only flow
+ * into variables that nobody can read anymore (``ADFlag::PruneDead``).
+ * Such edges remain in the graph unless ``remove_edges`` is set.
+ */
+static void ad_prune_bwd(std::vector<EdgeRef> &todo, bool remove_edges) {
+    tsl::robin_map<ADIndex, bool, UInt32Hasher> live;
+    std::vector<EdgeRef> dead;
+    size_t j = 0;
+
+    for (size_t i = 0; i < todo.size(); ++i) {
+        const EdgeRef &er = todo[i];
+        if (state.edges[er.id].is_custom || ad_is_live(er.source, live))
+            todo[j++] = er;
+        else
+            dead.push_back(er);
+    }
+
+    if (dead.empty())
+        return;
+
+    ad_log("ad_prune_bwd(): skipping %zu of %zu edges that don't reach a live "
+           "variable.", dead.size(), todo.size());
+
+    todo.resize(j);
+    ad_clear_todo(dead, remove_edges);
+}
+
+/**
+ * \brief Reorder a sorted edge list into topological levels
+ *
+ * An edge's level is the length of the longest path leading to the variable
+ * from which it propagates gradients. Edges within the same level are
+ * therefore independent of each other. The function stably sorts ``todo`` by
+ * level and returns the level of each edge following the reordering.
+ */
+static std::vector<uint32_t> ad_level_schedule(std::vector<EdgeRef> &todo,
+                                               dr::ADMode mode,
+                                               std::vector<uint32_t> *perm = nullptr) {
+    tsl::robin_map<ADIndex, uint32_t, UInt32Hasher> var_level;
+    std::vector<std::pair<uint32_t, uint32_t>> order;
+    order.reserve(todo.size());
+
+    /* The input is sorted so that all edges propagating into a variable
+       precede edges propagating out of it, hence a single pass suffices. */
+    for (size_t i = 0; i < todo.size(); ++i) {
+        ADIndex v0i = todo[i].source, v1i = todo[i].target;
+        if (mode == dr::ADMode::Backward)
+            std::swap(v0i, v1i);
+
+        auto it = var_level.find(v0i);
+        uint32_t level = it != var_level.end() ? it->second : 0;
+
+        auto [it2, success] = var_level.emplace(v1i, level + 1);
+        if (!success && it2->second < level + 1)
+            it2.value() = level + 1;
+
+        order.emplace_back(level, (uint32_t) i);
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+                     [](const std::pair<uint32_t, uint32_t> &a,
+                        const std::pair<uint32_t, uint32_t> &b) {
+                         return a.first < b.first;
+                     });
+
+    std::vector<EdgeRef> todo_new;
+    std::vector<uint32_t> levels;
+    todo_new.reserve(todo.size());
+    levels.reserve(todo.size());
+
+    for (auto [level, i] : order) {
+        todo_new.push_back(todo[i]);
+        levels.push_back(level);
+    }
+
+    // Optionally, compose the reordering with an existing permutation
+    if (perm) {
+        std::vector<uint32_t> perm_new;
+        perm_new.reserve(order.size());
+        for (auto [level, i] : order)
+            perm_new.push_back((*perm)[i]);
+        perm->swap(perm_new);
+    }
+
+    todo.swap(todo_new);
+    return levels;
+}
+
+/// Comparison function that brings edges into traversal order
+static bool ad_edge_before(dr::ADMode mode, const EdgeRef &a, const EdgeRef &b) {
+    if (mode == dr::ADMode::Forward)
+        return std::tie(a.source_counter, a.target_counter) <
+               std::tie(b.source_counter, b.target_counter);
+    else
+        return std::tie(a.target_counter, a.source_counter) >
+               std::tie(b.target_counter, b.source_counter);
+}
+
+/**
+ * \brief Bring ``todo`` into traversal order using a cached plan, if possible
+ *
+ * Graphs are identified by the creation order (i.e., the counter values) of
+ * the variables along each edge, relative to the oldest variable involved.
+ * Graphs with the same structure recorded at different times therefore map to
+ * the same plan. If no matching plan exists, the function sorts the edges and
+ * records a new plan. Used when ``ADFlag::CachePlan`` is specified.
+ */
+static void ad_plan_apply(std::vector<EdgeRef> &todo, dr::ADMode mode,
+                          bool level_schedule, std::vector<uint32_t> &levels) {
+    size_t n = todo.size();
+
+    uint64_t base = (uint64_t) -1;
+    for (const EdgeRef &er : todo)
+        base = std::min(base, std::min(er.source_counter, er.target_counter));
+
+    std::vector<std::pair<uint64_t, uint64_t>> signature;
+    signature.reserve(n);
+
+    uint64_t key = ((uint64_t) mode << 1) | (uint64_t) level_schedule;
+    for (const EdgeRef &er : todo) {
+        uint64_t s = er.source_counter - base,
+                 t = er.target_counter - base;
+        signature.emplace_back(s, t);
+        key = (key ^ s) * 0x100000001b3ull;
+        key = (key ^ t) * 0x100000001b3ull;
+    }
+
+    std::vector<EdgeRef> todo_new;
+    todo_new.reserve(n);
+
+    auto it = state.plans.find(key);
+    if (it != state.plans.end() && it->second.signature == signature) {
+        const TraversalPlan &plan = it->second;
+        ad_log("ad_traverse(): reusing cached plan for %zu edges.", n);
+
+        for (uint32_t i : plan.order)
+            todo_new.push_back(todo[i]);
+        todo.swap(todo_new);
+        levels = plan.levels;
+        return;
+    }
+
+    std::vector<uint32_t> order(n);
+    for (size_t i = 0; i < n; ++i)
+        order[i] = (uint32_t) i;
+
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return ad_edge_before(mode, todo[a], todo[b]);
+    });
+
+    for (uint32_t i : order)
+        todo_new.push_back(todo[i]);
+    todo.swap(todo_new);
+
+    if (level_schedule)
+        levels = ad_level_schedule(todo, mode, &order);
+
+    // Bound the size of the cache
+    if (state.plans.size() >= 64)
+        state.plans.clear();
+
+    TraversalPlan &plan = state.plans[key];
+    plan.signature = std::move(signature);
+    plan.order = std::move(order);
+    plan.levels = levels;
+}
+
+/**
+ * \brief Backward contributions of 'Gather' edges, grouped by the variable
+ * being gathered from.
+ *
+ * Reverse-mode traversal defers the adjoint scatter of gather operations until
+ * the gradient of the source variable is needed. Contributions of gathers
+ * with identical offsets and masks are summed so that they only require a
+ * single scatter-add. The entries store copies of the 'Gather' instances so
+ * that the ``ClearEdges`` flag can release the original edges.
+ */
+using PendingGathers =
+    tsl::robin_map<ADIndex, std::vector<std::pair<dr::unique_ptr<Special>, JitVar>>,
+                   UInt32Hasher>;
+
+/// Try to defer the backward pass of a 'Gather' edge (defined further below)
+static bool ad_gather_defer(PendingGathers &pg, ADIndex source_i,
+                            Variable *source, const Variable *target,
+                            Special *special);
+
+/// Perform the deferred adjoint scatters into variable 'source_i'
+static void ad_gather_flush(PendingGathers &pg, ADIndex source_i);
+
+/// Retain the deferred adjoint scatters as a sparse gradient of 'source_i'
+static void ad_gather_keep_sparse(PendingGathers &pg, ADIndex source_i);
+
+/// Convert a sparse gradient (if present) into a dense one
+static void ad_densify_grad(ADIndex index, Variable *v);
+
 void ad_traverse(dr::ADMode mode, uint32_t flags) {
     if (mode != dr::ADMode::Forward && mode != dr::ADMode::Backward)
         ad_raise("ad_traverse(): invalid mode specified!");
@@ -1456,20 +2139,66 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
         return;
 
     todo.swap(todo_tls);
-    bool clear_edges = flags & (uint32_t) dr::ADFlag::ClearEdges;
+    bool clear_edges = flags & (uint32_t) dr::ADFlag::ClearEdges,
+         level_schedule = flags & (uint32_t) dr::ADFlag::LevelSchedule,
+         cache_plan = flags & (uint32_t) dr::ADFlag::CachePlan,
+         sparse_grad = flags & (uint32_t) dr::ADFlag::SparseGrad;
 
     std::lock_guard<std::mutex> guard(state.mutex);
+    ADStats &stats = state.stats;
+    auto time_start = std::chrono::steady_clock::now();
+    stats.traversals++;
+
+    auto time_stop = [&]() {
+        std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - time_start;
+        stats.traverse_time += elapsed.count();
+    };
+
     try {
+        if ((flags & (uint32_t) dr::ADFlag::PruneDead) &&
+            mode == dr::ADMode::Backward)
+            ad_prune_bwd(todo, clear_edges);
+
+        /* In level-scheduled mode, contributions of simple edges are
+           collected per target variable and merged at the end of each
+           level in a fixed order using a balanced sum */
+        std::vector<uint32_t> levels;
+        std::vector<std::pair<ADIndex, std::vector<JitVar>>> terms;
+        tsl::robin_map<ADIndex, size_t, UInt32Hasher> term_slot;
+
         // Bring the edges into the appropriate order
-        std::sort(todo.begin(), todo.end(),
-                  [mode](const EdgeRef &a, const EdgeRef &b) {
-                      if (mode == dr::ADMode::Forward)
-                          return std::tie(a.source_counter, a.target_counter) <
-                                 std::tie(b.source_counter, b.target_counter);
-                      else
-                          return std::tie(a.target_counter, a.source_counter) >
-                                 std::tie(b.target_counter, b.source_counter);
-                  });
+        if (unlikely(cache_plan)) {
+            ad_plan_apply(todo, mode, level_schedule, levels);
+        } else {
+            std::sort(todo.begin(), todo.end(),
+                      [mode](const EdgeRef &a, const EdgeRef &b) {
+                          return ad_edge_before(mode, a, b);
+                      });
+
+            if (level_schedule)
+                levels = ad_level_schedule(todo, mode);
+        }
+
+        auto merge_terms = [&]() {
+            for (auto &[index, values] : terms) {
+                size_t n = values.size();
+                while (n > 1) {
+                    size_t h = n / 2;
+                    for (size_t j = 0; j < h; ++j)
+                        values[j] = values[2 * j] + values[2 * j + 1];
+                    if (n & 1)
+                        values[h] = std::move(values[n - 1]);
+                    n = h + (n & 1);
+                }
+
+                Variable *v = state[index];
+                v->accum(values[0], v->size);
+            }
+
+            terms.clear();
+            term_slot.clear();
+        };
 
         // Any edges with an ID less than this value will be postponed
         uint64_t postpone_before = 0;
@@ -1481,13 +2210,48 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
 
         tsl::robin_set<uint32_t, UInt32Hasher> pending;
 
+        /* Estimated size of the gradient arithmetic that was queued up since
+           the last evaluation, which is checked against 'traverse_budget' */
+        size_t budget = state.traverse_budget, pending_bytes = 0;
+
+        /* Number of edges processed since the last evaluation, which is
+           checked against 'traverse_chunk' */
+        size_t chunk = state.traverse_chunk, pending_edges = 0;
+
         auto postprocess = [&](uint32_t prev_i, uint32_t cur_i) {
             if (!prev_i || prev_i == cur_i)
                 return;
             pending.erase(prev_i);
 
-            Variable *prev = state[prev_i],
-                     *cur = cur_i ? state[cur_i] : nullptr;
+            Variable *prev = state[prev_i],
+                     *cur = cur_i ? state[cur_i] : nullptr;
+
+            /* Evaluate the gradients computed so far when they exceed the
+               memory budget. This releases the edge weights and intermediate
+               gradients referenced by the unevaluated expressions (edge
+               weights are only dropped when 'ClearEdges' is specified). */
+            if (budget && pending_bytes > budget && cur) {
+                ad_log("ad_traverse(): memory budget exceeded (%zu > %zu "
+                       "bytes), evaluating %zu gradients.", pending_bytes,
+                       budget, pending.size());
+                for (uint32_t todo: pending)
+                    jit_var_schedule(state[todo]->grad.index());
+                jit_eval();
+                pending_bytes = pending_edges = 0;
+            }
+
+            /* Launch the gradients of each chunk of edges. Kernel launches
+               are asynchronous, hence the device processes this chunk while
+               the host continues to traverse the remainder of the graph. */
+            if (chunk && pending_edges >= chunk && cur) {
+                ad_log("ad_traverse(): processed a chunk of %zu edges, "
+                       "evaluating %zu gradients.", pending_edges,
+                       pending.size());
+                for (uint32_t todo: pending)
+                    jit_var_schedule(state[todo]->grad.index());
+                jit_eval();
+                pending_bytes = pending_edges = 0;
+            }
 
             /* Wavefront-style evaluation of loops with differentiable
                variables produces dummy nodes with the 'LoopBoundary' flag set
@@ -1524,13 +2288,22 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
             if (clear_grad) {
                 ad_log("ad_traverse(): clearing gradient at intermediate variable a%u", prev_i);
                 prev->grad = JitVar();
+            } else {
+                prev->store_grad();
             }
         };
 
         uint32_t v0i_prev = 0;
+        PendingGathers pending_gathers;
 
         // This is the main AD traversal loop
-        for (EdgeRef &er : todo) {
+        for (size_t i = 0; i < todo.size(); ++i) {
+            EdgeRef &er = todo[i];
+
+            // Gradients of the next level depend on the merged terms
+            if (level_schedule && i > 0 && levels[i] != levels[i - 1])
+                merge_terms();
+
             Edge &edge = state.edges[er.id];
 
             Variable *v0, *v1;
@@ -1542,6 +2315,19 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
                 std::swap(v0i, v1i);
             }
 
+            // Sparse gradients from earlier traversals become dense here
+            ad_densify_grad(v0i, v0);
+            ad_densify_grad(v1i, v1);
+
+            // Propagate using the primal type (see ad_var_set_grad_type())
+            v0->load_grad();
+            if (edge.special)
+                v1->load_grad();
+
+            // Complete the gradient of 'v0' if it is the target of gathers
+            if (!pending_gathers.empty())
+                ad_gather_flush(pending_gathers, v0i);
+
             size_t grad_size = v0->grad.size();
 
             if (unlikely(v0->counter < postpone_before)) {
@@ -1551,6 +2337,7 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
 
                     ls.scopes.back().postponed.push_back(er);
                     er.id = er.source = er.target = 0;
+                    stats.edges_postponed++;
                     continue;
                 } else if (v1->counter < postpone_before) {
                     ad_raise(
@@ -1567,12 +2354,14 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
                 if (grad_size == 0) {
                     ad_log("ad_traverse(): skipping edge a%u -> a%u (no source "
                            "gradient).", v0i, v1i);
+                    stats.edges_skipped++;
                     continue;
                 } else {
                     ad_raise("ad_traverse(): gradient propagation encountered "
                              "variable a%u (\"%s\") with an invalid gradient size "
                              "(expected=%zu, actual=%zu)!",
-                             v0i, v0->label ? v0->label : "", v0->size, grad_size);
+                             v0i, state.labels[v0i] ? state.labels[v0i] : "",
+                             (size_t) v0->size, grad_size);
                 }
             }
 
@@ -1581,6 +2370,12 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
 
             pending.insert(v1i);
 
+            if (budget)
+                pending_bytes += (size_t) v1->size *
+                                 jit_type_size((VarType) v1->type);
+            pending_edges++;
+            stats.edges_traversed++;
+
             ad_log("ad_traverse(): processing edge a%u -> a%u ..", v0i, v1i);
 
             // Only propagate the label to the gradient if this doesn't require
@@ -1589,15 +2384,19 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
             if (unlikely(v0->flags & (uint8_t) VariableFlags::CustomLabel) &&
                 jit_var_ref(v0->grad.index()) == 1) {
                 dr::string tmp;
-                tmp.put(v0->label, " [grad]");
+                tmp.put(state.labels[v0i], " [grad]");
                 if (v0->grad.valid())
                     dr::set_label(v0->grad, tmp.c_str());
             }
 
             if (unlikely(edge.special)) {
+                stats.edges_special++;
+                stats.edges_custom += edge.is_custom;
+
                 if (mode == dr::ADMode::Forward)
                     edge.special->forward(v0, v1);
-                else
+                else if (!ad_gather_defer(pending_gathers, v1i, v1, v0,
+                                          edge.special.get()))
                     edge.special->backward(v1, v0);
 
                 if (clear_edges) {
@@ -1611,22 +2410,50 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
                     edge2.special.reset();
                 }
             } else {
-                v1->mul_accum(v0->grad, edge.weight, v0->size);
+                if (level_schedule) {
+                    auto [it, success] = term_slot.emplace(v1i, terms.size());
+                    if (success)
+                        terms.emplace_back(v1i, std::vector<JitVar>());
+                    terms[it->second].second.push_back(
+                        v1->mul_term(v0->grad, edge.weight, v0->size));
+                } else {
+                    v1->mul_accum(v0->grad, edge.weight, v0->size);
+                }
 
                 if (clear_edges)
                     edge.weight = JitVar();
             }
         }
 
+        if (level_schedule)
+            merge_terms();
+
+        // Process remaining gathers, e.g., from input variables
+        std::vector<ADIndex> gather_sources;
+        for (auto &kv : pending_gathers)
+            gather_sources.push_back(kv.first);
+        for (ADIndex index : gather_sources) {
+            if (sparse_grad)
+                ad_gather_keep_sparse(pending_gathers, index);
+            else
+                ad_gather_flush(pending_gathers, index);
+        }
 
         postprocess(v0i_prev, 0);
+
+        // Convert the remaining gradients back to their storage type
+        for (uint32_t index : pending)
+            state[index]->store_grad();
+
         ad_log("ad_traverse(): done.");
     } catch (...) {
         ad_clear_todo(todo, false);
+        time_stop();
         throw;
     }
 
     ad_clear_todo(todo, clear_edges);
+    time_stop();
 
     if (todo_tls.empty())
         todo_tls.swap(todo);
@@ -1636,6 +2463,42 @@ void ad_traverse(dr::ADMode mode, uint32_t flags) {
 // AD scope management
 // ==========================================================================
 
+/// Return a fresh \ref Scope::epoch value (zero means 'no scope')
+static uint32_t ad_scope_epoch_new() {
+    uint32_t epoch;
+    do {
+        epoch = ++state.scope_epoch;
+    } while (unlikely(epoch == 0));
+    return epoch;
+}
+
+/**
+ * \brief Release the implicit dependencies of a scope that is being left.
+ *
+ * When 'parent' is specified, they are instead merged into its sets. The
+ * epoch stamps are updated to preserve the invariant that a nonzero stamp
+ * refers to a set that actually contains the variable. Must be called while
+ * holding the state lock.
+ */
+static void ad_scope_release_implicit(const Scope &scope, Scope *parent) {
+    for (uint32_t i : scope.implicit_in) {
+        uint32_t &epoch = state.implicit_epoch[i];
+        if (parent) {
+            epoch = parent->epoch;
+            if (parent->implicit_in.insert(i).second)
+                continue;
+        } else if (epoch == scope.epoch) {
+            epoch = 0;
+        }
+        ad_var_dec_ref_int(i, state[i]);
+    }
+
+    for (uint32_t i : scope.implicit_out) {
+        if (!parent || !parent->implicit_out.insert(i).second)
+            ad_var_dec_ref_int(i, state[i]);
+    }
+}
+
 void ad_scope_enter(ADScope type, size_t size, const Index *indices, int symbolic) {
     std::vector<Scope> &scopes = local_state.scopes;
     Scope scope;
@@ -1651,6 +2514,7 @@ void ad_scope_enter(ADScope type, size_t size, const Index *indices, int symboli
     scope.postponed.clear();
     scope.implicit_in.clear();
     scope.implicit_out.clear();
+    scope.epoch = ad_scope_epoch_new();
     scope.type = type;
 
     switch (type) {
@@ -1722,23 +2586,12 @@ void ad_scope_leave(bool process_postponed) {
 
     ad_log("ad_scope_leave(%s)", type_name);
 
-    if (scopes.size() < 2 || !scopes[scopes.size() - 2].symbolic) {
-        std::lock_guard<std::mutex> guard(state.mutex);
-        for (uint32_t i: scope.implicit_in)
-            ad_var_dec_ref_int(i, state[i]);
-        for (uint32_t i: scope.implicit_out)
-            ad_var_dec_ref_int(i, state[i]);
-    } else {
+    /* access state data structure */ {
         std::lock_guard<std::mutex> guard(state.mutex);
-        Scope &prev = scopes[scopes.size() - 2];
-        for (uint32_t i : scope.implicit_in) {
-            if (!prev.implicit_in.insert(i).second)
-                ad_var_dec_ref_int(i, state[i]);
-        }
-        for (uint32_t i : scope.implicit_out) {
-            if (!prev.implicit_out.insert(i).second)
-                ad_var_dec_ref_int(i, state[i]);
-        }
+        Scope *prev = nullptr;
+        if (scopes.size() >= 2 && scopes[scopes.size() - 2].symbolic)
+            prev = &scopes[scopes.size() - 2];
+        ad_scope_release_implicit(scope, prev);
     }
 
     if (scope.isolate && !scope.postponed.empty()) {
@@ -1859,6 +2712,74 @@ struct MaskGuard {
     JitMask mask;
 };
 
+/**
+ * \brief Reproducible scatter-addition used by the adjoint of gathers
+ *
+ * Floating point atomics produce sums that depend on the order in which
+ * threads happen to run. This function instead quantizes ``value`` into
+ * 64-bit fixed-point numbers using a power-of-two scale derived from the
+ * largest magnitude among its entries. Integer addition is associative, hence
+ * the subsequent atomic accumulation and conversion back into the original
+ * type produce bit-for-bit identical results across runs.
+ *
+ * The price is an extra horizontal reduction with a host synchronization to
+ * find the scale, 64-bit atomics, and a loss of accuracy for entries that
+ * are more than ~2^(62 - log2(width)) times smaller than the largest one.
+ */
+static void ad_scatter_add_deterministic(JitBackend backend, JitVar &target,
+                                         const JitVar &value,
+                                         JitIndex offset, JitIndex mask) {
+    VarType vt = (VarType) jit_var_type(value.index());
+    size_t width = std::max({ (size_t) jit_var_size(value.index()),
+                              (size_t) jit_var_size(offset),
+                              (size_t) jit_var_size(mask) });
+
+    JitVar value_d = JitVar::steal(jit_var_cast(value.index(), VarType::Float64, 0)),
+           max_abs = JitVar::steal(jit_var_reduce(
+               backend, VarType::Float64, ReduceOp::Max,
+               JitVar::steal(jit_var_abs(value_d.index())).index()));
+
+    double m = 0.0;
+    jit_var_read(max_abs.index(), 0, &m);
+
+    if (m == 0.0)
+        return;
+
+    if (!std::isfinite(m)) {
+        // Non-finite gradients propagate regardless of the order
+        target = JitVar::steal(jit_var_scatter(target.index(), value.index(),
+                                               offset, mask, ReduceOp::Add,
+                                               ReduceMode::Auto));
+        return;
+    }
+
+    // Choose a scale so that the sum of all entries fits into an int64_t
+    int exponent = 0;
+    std::frexp(m * (double) width, &exponent);
+    double scale = std::ldexp(1.0, 62 - exponent),
+           inv_scale = std::ldexp(1.0, exponent - 62);
+
+    JitVar q = JitVar::steal(jit_var_mul(
+        value_d.index(), scalar(backend, VarType::Float64, scale).index()));
+    q = JitVar::steal(jit_var_round(q.index()));
+    q = JitVar::steal(jit_var_cast(q.index(), VarType::Int64, 0));
+    q = JitVar::steal(jit_var_cast(q.index(), VarType::UInt64, 1));
+
+    uint64_t zero = 0;
+    JitVar acc = JitVar::steal(jit_var_literal(
+        backend, VarType::UInt64, &zero, jit_var_size(target.index())));
+    acc = JitVar::steal(jit_var_scatter(acc.index(), q.index(), offset, mask,
+                                        ReduceOp::Add, ReduceMode::Auto));
+
+    acc = JitVar::steal(jit_var_cast(acc.index(), VarType::Int64, 1));
+    acc = JitVar::steal(jit_var_cast(acc.index(), VarType::Float64, 0));
+    acc = JitVar::steal(jit_var_mul(
+        acc.index(), scalar(backend, VarType::Float64, inv_scale).index()));
+    acc = JitVar::steal(jit_var_cast(acc.index(), vt, 0));
+
+    target = target + acc;
+}
+
 struct Gather : Special {
     Gather(const GenericArray<uint32_t> &offset, const JitMask &mask,
            ReduceMode reduce_mode = ReduceMode::Auto)
@@ -1871,15 +2792,54 @@ struct Gather : Special {
     }
 
     void backward(Variable *source, const Variable *target) override {
-        JitVar &source_grad = source->grad;
-
-        if (source->size == 1 && target->size == 1 &&
-            !(target->flags & VariableFlags::Symbolic)) {
+        if (scalar_case(source, target)) {
             // Downgrade to scalar op
             source->accum(target->grad & mask, 1);
             return;
         }
 
+        scatter_grad(source, target->grad);
+    }
+
+    /// Can the adjoint be computed without a scatter operation?
+    static bool scalar_case(const Variable *source, const Variable *target) {
+        return source->size == 1 && target->size == 1 &&
+               !(target->flags & VariableFlags::Symbolic);
+    }
+
+    /**
+     * \brief Select the reduction strategy of the adjoint scatter
+     *
+     * Many lanes gathering from few elements (e.g., texels of a small
+     * texture) turn into heavily contended atomics in reverse mode. When the
+     * user did not request a specific mode, and \ref ReduceMode::Auto would
+     * not already expand the target on the LLVM backend, switch to
+     * \ref ReduceMode::Local once the ratio of gathered elements to source
+     * elements crosses ``state.local_reduce_ratio``.
+     */
+    ReduceMode adjoint_mode(const Variable *source) const {
+        uint32_t ratio = state.local_reduce_ratio;
+        if (reduce_mode != ReduceMode::Auto || ratio == 0)
+            return reduce_mode;
+
+        size_t width = dr::width(offset, mask),
+               source_size = std::max((size_t) source->size, (size_t) 1);
+
+        if (width / source_size < ratio)
+            return reduce_mode;
+
+        if (backend == JitBackend::LLVM &&
+            source_size * jit_type_size((VarType) source->type) <=
+                (size_t) jit_llvm_expand_threshold())
+            return reduce_mode;
+
+        return ReduceMode::Local;
+    }
+
+    /// Scatter-accumulate the gradient 'grad' of the output into 'source'
+    void scatter_grad(Variable *source, const JitVar &grad) const {
+        JitVar &source_grad = source->grad;
+
         if (!source_grad.valid()) {
             VarType type = (VarType)source->type;
             source_grad = scalar(backend, type, 0.0);
@@ -1889,12 +2849,43 @@ struct Gather : Special {
             source_grad.resize(source->size);
 
         MaskGuard guard(backend, mask_stack);
+        if (state.deterministic && reduce_mode != ReduceMode::Permute) {
+            ad_scatter_add_deterministic(backend, source_grad, grad,
+                                         offset.index(), mask.index());
+            return;
+        }
+
+        VarType type = (VarType) source->type;
+        if (state.kahan && reduce_mode != ReduceMode::Permute &&
+            (type == VarType::Float32 || type == VarType::Float64)) {
+            // Track the round-off error in a second buffer, then fold it back
+            JitVar comp = scalar(backend, type, 0.0);
+            comp.resize(source->size);
+
+            uint32_t target_1 = source_grad.release(),
+                     target_2 = comp.release();
+            jit_var_scatter_add_kahan(&target_1, &target_2, grad.index(),
+                                      offset.index(), mask.index());
+            source_grad = JitVar::steal(target_1) + JitVar::steal(target_2);
+            return;
+        }
+
         dr::scatter_reduce(
             reduce_mode == ReduceMode::Permute ? ReduceOp::Identity
                                                : ReduceOp::Add,
-            source_grad, target->grad, offset, mask, reduce_mode);
+            source_grad, grad, offset, mask, adjoint_mode(source));
+    }
+
+    /// Could this operation share its adjoint scatter with 'g'?
+    bool same_access(const Gather &g) const {
+        return offset.index() == g.offset.index() &&
+               mask.index() == g.mask.index() &&
+               mask_stack.index() == g.mask_stack.index() &&
+               reduce_mode == g.reduce_mode;
     }
 
+    Gather *as_gather() override { return this; }
+
     void forward(const Variable *source, Variable *target) override {
         MaskGuard guard(backend, mask_stack);
         target->accum(dr::gather<JitVar>(source->grad, offset, mask),
@@ -1907,6 +2898,104 @@ struct Gather : Special {
     ReduceMode reduce_mode;
 };
 
+static bool ad_gather_defer(PendingGathers &pg, ADIndex source_i,
+                            Variable *source, const Variable *target,
+                            Special *special) {
+    Gather *g = special->as_gather();
+
+    // Permuting scatters overwrite, hence their inputs cannot be merged
+    if (!g || g->reduce_mode == ReduceMode::Permute ||
+        Gather::scalar_case(source, target) || !target->grad.valid())
+        return false;
+
+    auto &list = pg[source_i];
+    for (auto &[op, grad] : list) {
+        if (op->as_gather()->same_access(*g)) {
+            ad_log("ad_traverse(): merging adjoint of gather into a%u.",
+                   source_i);
+            grad = grad + target->grad;
+            return true;
+        }
+    }
+
+    list.emplace_back(dr::unique_ptr<Special>(new Gather(*g)), target->grad);
+    return true;
+}
+
+static void ad_gather_flush(PendingGathers &pg, ADIndex source_i) {
+    auto it = pg.find(source_i);
+    if (it == pg.end())
+        return;
+
+    Variable *source = state[source_i];
+    for (auto &[op, grad] : it.value())
+        op->as_gather()->scatter_grad(source, grad);
+
+    pg.erase(it);
+}
+
+static void ad_gather_keep_sparse(PendingGathers &pg, ADIndex source_i) {
+    Variable *source = state[source_i];
+
+    // Mixing with a dense gradient requires a dense result anyways
+    if (source->grad.valid()) {
+        ad_gather_flush(pg, source_i);
+        return;
+    }
+
+    auto it = pg.find(source_i);
+    if (it == pg.end())
+        return;
+
+    ad_log("ad_traverse(): storing sparse gradient of a%u.", source_i);
+    auto &list = state.sparse_grads[source_i];
+    for (auto &entry : it.value())
+        list.push_back(std::move(entry));
+    source->flags |= (uint8_t) VariableFlags::SparseGrad;
+    pg.erase(it);
+}
+
+static void ad_densify_grad(ADIndex index, Variable *v) {
+    if (likely(!(v->flags & (uint8_t) VariableFlags::SparseGrad)))
+        return;
+
+    v->flags &= (uint8_t) ~VariableFlags::SparseGrad;
+    auto it = state.sparse_grads.find(index);
+    if (it == state.sparse_grads.end())
+        return;
+
+    ad_log("ad_densify_grad(a%u)", index);
+    auto list = std::move(it.value());
+    state.sparse_grads.erase(it);
+
+    for (auto &[op, grad] : list)
+        op->as_gather()->scatter_grad(v, grad);
+}
+
+void ad_grad_sparse(Index index, dr::vector<uint32_t> &out) {
+    ADIndex ad_index = ::ad_index(index);
+    if (!ad_index)
+        return;
+
+    std::lock_guard<std::mutex> guard(state.mutex);
+    Variable *v = state[ad_index];
+    if (!(v->flags & (uint8_t) VariableFlags::SparseGrad))
+        return;
+
+    auto it = state.sparse_grads.find(ad_index);
+    if (it == state.sparse_grads.end())
+        return;
+
+    for (auto &[op, grad] : it.value()) {
+        const Gather *g = op->as_gather();
+        JitMask mask =
+            g->mask.valid() ? (g->mask & g->mask_stack) : g->mask_stack;
+        out.push_back(jit_var_inc_ref(g->offset.index()));
+        out.push_back(jit_var_inc_ref(grad.index()));
+        out.push_back(mask.release());
+    }
+}
+
 /// Edge representing a scatter operation
 struct Scatter : Special {
     Scatter(const GenericArray<uint32_t> &offset, const JitMask &mask,
@@ -2211,20 +3300,126 @@ Index ad_var_new(JitIndex i0) {
         const char *prefix = jit_prefix(info.backend);
 
         std::lock_guard<std::mutex> guard(state.mutex);
-        Variable *v = state[ad_index(result)];
+        ADIndex index = ad_index(result);
+        Variable *v = state[index];
 
         if (!prefix || !label)
-            v->label = label ? strdup(label) : nullptr;
+            state.set_label(index, v, label ? strdup(label) : nullptr, true);
         else
-            v->label = concat(prefix, label);
+            state.set_label(index, v, concat(prefix, label), true);
 
-        v->flags |= (uint8_t) VariableFlags::FreeLabel |
-                    (uint8_t) VariableFlags::CustomLabel;
+        v->flags |= (uint8_t) VariableFlags::CustomLabel;
     }
 
     return result;
 }
 
+void ad_var_new_n(size_t n, const JitIndex *in, Index *out) {
+    /* Like ad_var_new_impl(), check the thread-local AD scope before doing
+       anything else. Without inputs, gradient tracking can only be disabled
+       by a dr.suspend_grad() region. */
+    const std::vector<Scope> &scopes = local_state.scopes;
+    if (!scopes.empty()) {
+        const Scope &scope = scopes.back();
+        bool active = scope.complement || !scope.indices.empty();
+
+        if (!active && !scope.force_grad) {
+            for (size_t i = 0; i < n; ++i)
+                out[i] = jit_var_inc_ref(in[i]);
+            return;
+        }
+    }
+
+    uint32_t flags = jit_flags();
+
+    bool symbolic      = flags & (uint32_t) JitFlag::SymbolicScope,
+         reuse_indices = flags & (uint32_t) JitFlag::ReuseIndices;
+
+    struct Entry {
+        VarInfo info;
+        char *label;
+    };
+
+    // Query drjit-core for all variables before entering the critical section
+    std::vector<Entry> entries(n);
+    for (size_t i = 0; i < n; ++i) {
+        JitIndex index = in[i];
+        Entry &e = entries[i];
+        e.label = nullptr;
+
+        if (!index)
+            continue;
+
+        jit_var_inc_ref(index);
+        e.info = jit_set_backend(index);
+
+        const char *label = jit_var_label(index),
+                   *prefix = jit_prefix(e.info.backend);
+        if (label)
+            e.label = prefix ? concat(prefix, label) : strdup(label);
+    }
+
+    std::lock_guard<std::mutex> guard(state.mutex);
+    for (size_t i = 0; i < n; ++i) {
+        JitIndex index = in[i];
+        if (!index) {
+            out[i] = 0;
+            continue;
+        }
+
+        const Entry &e = entries[i];
+        auto [ad_index, v] = ad_var_new(e.info.backend, e.info.size,
+                                        e.info.type, symbolic, reuse_indices,
+                                        nullptr);
+
+        ad_log("ad_var_new(): %s a%u[%zu] = new()", jit_type_name(e.info.type),
+               ad_index, e.info.size);
+
+        if (e.label) {
+            state.set_label(ad_index, v, e.label, true);
+            v->flags |= (uint8_t) VariableFlags::CustomLabel;
+        }
+
+        if (unlikely(!scopes.empty()))
+            scopes.back().enable(ad_index);
+
+        out[i] = combine(ad_index, index);
+    }
+}
+
+void ad_var_inc_ref_n(size_t n, const Index *indices) JIT_NOEXCEPT {
+    for (size_t i = 0; i < n; ++i) {
+        JitIndex jit_index = ::jit_index(indices[i]);
+        ADIndex ad_index = ::ad_index(indices[i]);
+
+        jit_var_inc_ref(jit_index);
+        if (ad_index)
+            ad_var_inc_ref_fast(ad_index);
+    }
+}
+
+void ad_var_dec_ref_n(size_t n, const Index *indices) JIT_NOEXCEPT {
+    /* Try the lock-free path first and only acquire 'state.mutex' once the
+       first variable requiring it is encountered. The lock is then held until
+       all remaining variables have been processed. */
+    std::unique_lock<std::mutex> guard(state.mutex, std::defer_lock);
+
+    for (size_t i = 0; i < n; ++i) {
+        JitIndex jit_index = ::jit_index(indices[i]);
+        ADIndex ad_index = ::ad_index(indices[i]);
+
+        jit_var_dec_ref(jit_index);
+
+        if (likely(!ad_index) || ad_var_dec_ref_fast(ad_index))
+            continue;
+
+        if (!guard.owns_lock())
+            guard.lock();
+
+        ad_var_dec_ref_int(ad_index, state[ad_index]);
+    }
+}
+
 // ==========================================================================
 // Convenience wrappers of jit_var_* functions()
 // ==========================================================================
@@ -2234,10 +3429,8 @@ Index ad_var_schedule_force(Index index, int *rv) {
     ADIndex ad_index = ::ad_index(index);
 
     jit_index = jit_var_schedule_force(jit_index, rv);
-    if (ad_index) {
-        std::lock_guard<std::mutex> guard(state.mutex);
-        ad_var_inc_ref_int(ad_index, state[ad_index]);
-    }
+    if (ad_index)
+        ad_var_inc_ref_fast(ad_index);
 
     return combine(ad_index, jit_index);
 }
@@ -2247,10 +3440,8 @@ Index ad_var_data(Index index, void **ptr) {
     ADIndex ad_index = ::ad_index(index);
 
     jit_index = jit_var_data(jit_index, ptr);
-    if (ad_index) {
-        std::lock_guard<std::mutex> guard(state.mutex);
-        ad_var_inc_ref_int(ad_index, state[ad_index]);
-    }
+    if (ad_index)
+        ad_var_inc_ref_fast(ad_index);
 
     return combine(ad_index, jit_index);
 }
@@ -2907,6 +4098,14 @@ static Index ad_var_memop_remap(Index index, bool input) {
         if (ad_index == 0)
             return index;
 
+        // Skip the hash set if the input was already registered
+        if (input) {
+            uint32_t &epoch = state.implicit_epoch[ad_index];
+            if (epoch == scope.epoch)
+                return index;
+            epoch = scope.epoch;
+        }
+
         auto &implicit = input ? scope.implicit_in : scope.implicit_out;
         auto [it, success] = implicit.insert(ad_index);
         if (success) {
@@ -3000,6 +4199,23 @@ public:
         if (source_grad.size() != source->size)
             source_grad.resize(source->size);
 
+        if (state.deterministic) {
+            // Unpack the packet scatter into 'n' reproducible scatters
+            JitVar offset_n = JitVar::steal(jit_var_mul(
+                offset.index(),
+                JitVar::steal(jit_var_u32(m_backend, (uint32_t) n)).index()));
+
+            for (size_t i = 0; i < n; ++i) {
+                JitVar offset_i = JitVar::steal(jit_var_add(
+                    offset_n.index(),
+                    JitVar::steal(jit_var_u32(m_backend, (uint32_t) i)).index()));
+                ad_scatter_add_deterministic(
+                    m_backend, source_grad, JitVar::borrow(grad_out[i]),
+                    offset_i.index(), mask.index());
+            }
+            return;
+        }
+
         source_grad = JitVar::steal(jit_var_scatter_packet(
             n, source_grad.index(), grad_out.data(), offset.index(),
             mask.index(), ReduceOp::Add, mode));
@@ -3071,10 +4287,8 @@ Index ad_var_scatter(Index target, Index value, JitIndex offset, JitIndex mask,
     bool perm_scatter = op == ReduceOp::Identity && mode == ReduceMode::Permute;
     if (is_detached(value) && (is_detached(target) || perm_scatter)) {
         ADIndex ad_index = ::ad_index(target);
-        if (ad_index) {
-            std::lock_guard<std::mutex> guard(state.mutex);
-            ad_var_inc_ref_int(ad_index, state[ad_index]);
-        }
+        if (ad_index)
+            ad_var_inc_ref_fast(ad_index);
 
         return combine(ad_index, result.release());
     } else {
@@ -3398,12 +4612,54 @@ const char *ad_var_whos() {
     for (uint32_t id : indices) {
         const Variable *v = state[id];
         buffer.fmt("  %-9i %-3s %12zu %8u    %s\n", id, type_name_short[v->type],
-                   v->size, v->ref_count, v->label ? v->label : "");
+                   (size_t) v->size, v->ref_count.load(),
+                   state.labels[id] ? state.labels[id] : "");
     }
     buffer.put("  =========================================================\n");
     return buffer.get();
 }
 
+/// Size of the memory region held by an evaluated JIT variable
+static size_t jit_var_bytes(const JitVar &v) {
+    if (!v.valid() || jit_var_state(v.index()) != VarState::Evaluated)
+        return 0;
+    return jit_var_size(v.index()) * jit_type_size(jit_var_type(v.index()));
+}
+
+void ad_var_memory(void (*callback)(void *payload, const char *label,
+                                    size_t grad_bytes, size_t edge_bytes),
+                   void *payload) {
+    struct Record {
+        std::string label;
+        size_t grad_bytes, edge_bytes;
+    };
+
+    std::vector<Record> records;
+    {
+        std::lock_guard<std::mutex> guard(state.mutex);
+        for (size_t i = 1; i < state.variables.size(); ++i) {
+            const Variable *v = &state.variables[i];
+            if (v->ref_count == 0)
+                continue;
+
+            // Edge weights are attributed to the target of the edge
+            size_t edge_bytes = 0;
+            for (EdgeIndex e = v->next_bwd; e; e = state.edges[e].next_bwd)
+                edge_bytes += jit_var_bytes(state.edges[e].weight);
+
+            size_t grad_bytes = jit_var_bytes(v->grad);
+            if (grad_bytes == 0 && edge_bytes == 0)
+                continue;
+
+            const char *label = state.labels[(uint32_t) i];
+            records.push_back({ label ? label : "", grad_bytes, edge_bytes });
+        }
+    }
+
+    for (const Record &r : records)
+        callback(payload, r.label.c_str(), r.grad_bytes, r.edge_bytes);
+}
+
 const char *ad_var_graphviz() {
     std::lock_guard<std::mutex> guard(state.mutex);
 
@@ -3430,7 +4686,7 @@ const char *ad_var_graphviz() {
 
     for (uint32_t index : indices) {
         const Variable *v = state[index];
-        const char *label = v->label,
+        const char *label = state.labels[index],
                    *label_without_prefix = label;
 
         size_t prefix_hash = 0;
@@ -3539,7 +4795,7 @@ const char *ad_var_graphviz() {
             buffer.put("|{Symbolic}");
 
         buffer.fmt("|{Type: %s|Size: %zu}|{a%u|Refs: %u}}\"",
-            type_name_short[v->type], v->size,
+            type_name_short[v->type], (size_t) v->size,
             index, (uint32_t) v->ref_count);
 
         if (color)
@@ -3590,6 +4846,77 @@ const char *ad_var_graphviz() {
 void ad_set_leak_warnings(int value) { state.leak_warnings = (bool) value; }
 int ad_leak_warnings() { return (int) state.leak_warnings; }
 
+void ad_stats(ADStats *out, int reset) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    *out = state.stats;
+    out->variables = state.variables.size() - state.unused_variables.size() - 1;
+    out->edges = state.edges.size() - state.unused_edges.size() - 1;
+
+    if (reset)
+        state.stats = ADStats { };
+}
+
+void ad_set_traverse_budget(size_t value) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.traverse_budget = value;
+}
+
+size_t ad_traverse_budget() {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    return state.traverse_budget;
+}
+
+void ad_set_traverse_chunk(size_t value) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.traverse_chunk = value;
+}
+
+size_t ad_traverse_chunk() {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    return state.traverse_chunk;
+}
+
+void ad_set_local_reduce_ratio(uint32_t value) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.local_reduce_ratio = value;
+}
+
+uint32_t ad_local_reduce_ratio() {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    return state.local_reduce_ratio;
+}
+
+void ad_set_deterministic(bool value) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.deterministic = value;
+}
+
+bool ad_deterministic() {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    return state.deterministic;
+}
+
+void ad_set_kahan(bool value) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.kahan = value;
+}
+
+bool ad_kahan() {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    return state.kahan;
+}
+
+void ad_set_sorted_reuse(int value) {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.unused_variables.set_sorted(value != 0);
+    state.unused_edges.set_sorted(value != 0);
+}
+
+int ad_sorted_reuse() {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    return (int) state.unused_variables.sorted;
+}
+
 // ==========================================================================
 // Functionality to track implicit inputs of recorded computation
 // ==========================================================================
@@ -3607,7 +4934,13 @@ void ad_var_check_implicit(uint64_t index) {
         if (scopes.empty())
             ad_raise("ad_var_check_implicit(): no scope found!");
 
-        auto [it, success] = scopes.back().implicit_in.insert(ad_index);
+        Scope &scope = scopes.back();
+        uint32_t &epoch = state.implicit_epoch[ad_index];
+        if (epoch == scope.epoch)
+            return;
+        epoch = scope.epoch;
+
+        auto [it, success] = scope.implicit_in.insert(ad_index);
         if (success) {
             ad_log("ad_check_implicit(): registered an implicit input dependence on "
                    "variable a%u.", ad_index);
@@ -3663,7 +4996,7 @@ uint32_t ad_record_implicit_dependence(LocalState &ls, ReleaseHelper &rh,
             "2. Is this potentially a bug in your code? Did you mean to gather an\n"
             "   element from the variable instead of reading it directly? In that case,\n"
             "   please fix the operation referenced in the stack trace.",
-            source, v_source->size);
+            source, (size_t) v_source->size);
 
     auto [ad_index, v] = ad_var_new(backend, 1, (VarType) v_source->type,
                                     true, reuse_indices, "gather");
@@ -3682,11 +5015,17 @@ uint32_t ad_record_implicit_dependence(LocalState &ls, ReleaseHelper &rh,
         "ad_var_new(): a%u = gather(a%u) [converted from scalar read].",
         ad_index, source);
 
-    auto [it, success] = scopes.back().implicit_in.insert(source);
-    if (success) {
-        ad_var_inc_ref_int(source, v_source);
-        ad_log("ad_var_new(): registered an implicit input dependence "
-               "on variable a%u.", ad_index);
+    // The epoch stamp avoids a hash set lookup for repeated reads
+    Scope &scope = scopes.back();
+    uint32_t &epoch = state.implicit_epoch[source];
+    if (epoch != scope.epoch) {
+        epoch = scope.epoch;
+        auto [it, success] = scope.implicit_in.insert(source);
+        if (success) {
+            ad_var_inc_ref_int(source, v_source);
+            ad_log("ad_var_new(): registered an implicit input dependence "
+                   "on variable a%u.", ad_index);
+        }
     }
     rh.put(ad_index);
     return ad_index;
@@ -3723,6 +5062,7 @@ struct PushScope {
     PushScope(const Scope &scope) {
         std::vector<Scope> &scopes = local_state.scopes;
         scopes.push_back(scope);
+        scopes.back().epoch = ad_scope_epoch_new();
 
         if (scopes.size() >= 2) {
             Scope &child_scope  = scopes[scopes.size() - 1],
@@ -3754,10 +5094,7 @@ struct PushScope {
             }
 
             std::lock_guard<std::mutex> guard(state.mutex);
-            for (uint32_t i: child_scope.implicit_in)
-                ad_var_dec_ref_int(i, state[i]);
-            for (uint32_t i: child_scope.implicit_out)
-                ad_var_dec_ref_int(i, state[i]);
+            ad_scope_release_implicit(child_scope, nullptr);
 
         } else if (scopes.size() == 0) {
             ad_fail("PushScope::~PushScope(): underflow!");
@@ -3926,13 +5263,14 @@ void ad_add_special(uint32_t v0i, uint32_t v1i, bool is_custom,
 }
 
 static Variable *ad_custom_output_create(uint32_t index, Variable *v) {
-    bool is_scatter = v->label && strncmp(v->label, "scatter", 7) == 0;
+    const char *label = state.labels[index];
+    bool is_scatter = label && strncmp(label, "scatter", 7) == 0;
 
     // References should be held by: caller & CustomOp (2x)
     // Side effects can have a higher refcount
     ad_assert(v->ref_count == 3 || is_scatter,
               "ad_custom_op(): invalid reference count %u in variable a%u",
-              v->ref_count, index);
+              v->ref_count.load(), index);
 
     v->flags |= VariableFlags::CustomOpOutput;
 
@@ -4035,6 +5373,7 @@ bool ad_custom_op(dr::detail::CustomOpBase *op) {
         scope.postponed.clear();
         scope.implicit_in.clear();
         scope.implicit_out.clear();
+        scope.epoch = 0;
     }
 
     ad_add_special(v0i, v1i, true,
@@ -4042,17 +5381,13 @@ bool ad_custom_op(dr::detail::CustomOpBase *op) {
 
     Variable *v0 = state[v0i], *v1 = state[v1i];
 
-    if (v1->flags & (uint8_t) VariableFlags::FreeLabel)
-        free(v1->label);
-
     const char *prefix = jit_prefix(op->m_backend);
     if (!prefix)
-        v1->label = strdup(name);
+        state.set_label(v1i, v1, strdup(name), true);
     else
-        v1->label = concat(prefix, name);
+        state.set_label(v1i, v1, concat(prefix, name), true);
 
-    v1->flags |= (uint8_t) VariableFlags::FreeLabel |
-                 (uint8_t) VariableFlags::CustomLabel;
+    v1->flags |= (uint8_t) VariableFlags::CustomLabel;
 
     ad_var_dec_ref_int(v0i, v0);
     ad_var_dec_ref_int(v1i, v1);
@@ -16,6 +16,8 @@
 #include <drjit/custom.h>
 #include <algorithm>
 #include <string>
+#include <atomic>
+#include <mutex>
 #include "common.h"
 
 namespace dr = drjit;
@@ -63,6 +65,35 @@ static void ad_call_check_rv(JitBackend backend, size_t size,
                              vector<uint64_t> &rv,
                              const vector<uint64_t> &rv2);
 
+/**
+ * Cache of the per-instance buffers assembled by getters. When enabled via
+ * ad_set_call_cache(), a getter whose instances return the same literals and
+ * variables as in a previous call directly gathers from the buffer built back
+ * then, which skips the allocation and aggregation of a new one. The key
+ * stores a (tag, value) pair per instance, where the tag distinguishes
+ * missing instances (0), literals (1), and variables (2). Entries keep these
+ * variables alive, hence their IDs can't be reused while they are cached. A
+ * modification of an instance field creates a new variable, which
+ * invalidates the entry.
+ */
+struct GetterCacheEntry {
+    JitBackend backend;
+    std::string name;
+    size_t slot;
+    VarType type;
+    vector<uint64_t> key;
+    index32_vector vars;
+    JitVar buf;
+};
+
+static constexpr size_t GetterCacheSize = 16;
+
+static struct GetterCache {
+    std::mutex mutex;
+    size_t next = 0;
+    GetterCacheEntry entries[GetterCacheSize];
+} getter_cache;
+
 // Strategy 1: this is a getter. turn the call into a gather operation
 static void ad_call_getter(JitBackend backend, const char *domain,
                            const char *name, size_t size, uint32_t index,
@@ -149,6 +180,11 @@ static void ad_call_getter(JitBackend backend, const char *domain,
 
     jit_new_scope(backend);
 
+    bool use_cache = ad_call_cache() != 0;
+    std::string cache_name;
+    if (use_cache)
+        cache_name = std::string(domain_or_empty) + separator + name;
+
     for (size_t i = 0; i < rv2.size(); ++i) {
         // Deallocate previous entry
         jit_var_dec_ref((uint32_t) rv[i]);
@@ -183,6 +219,46 @@ static void ad_call_getter(JitBackend backend, const char *domain,
         VarType type = jit_var_type((uint32_t) rv2[i]);
         size_t tsize = jit_type_size(type);
 
+        vector<uint64_t> key;
+        if (use_cache) {
+            key.reserve(callable_count * 2);
+            for (size_t j = 0; j < callable_count; ++j) {
+                uint32_t rv3_i = rv3[i+j*rv2.size()];
+                uint64_t tag = 0, value = 0;
+                if (rv3_i) {
+                    if (jit_var_state(rv3_i) == VarState::Literal) {
+                        tag = 1;
+                        jit_var_read(rv3_i, 0, &value);
+                    } else {
+                        tag = 2;
+                        value = rv3_i;
+                    }
+                }
+                key.push_back(tag);
+                key.push_back(value);
+            }
+
+            JitVar cached;
+            {
+                std::lock_guard<std::mutex> guard(getter_cache.mutex);
+                for (GetterCacheEntry &e : getter_cache.entries) {
+                    if (e.buf.valid() && e.backend == backend && e.slot == i &&
+                        e.type == type && e.name == cache_name &&
+                        e.key.size() == key.size() &&
+                        memcmp(e.key.data(), key.data(),
+                               key.size() * sizeof(uint64_t)) == 0) {
+                        cached = e.buf;
+                        break;
+                    }
+                }
+            }
+
+            if (cached.valid()) {
+                rv[i] = jit_var_gather(cached.index(), index, mask.index());
+                continue;
+            }
+        }
+
         void *ptr =
             jit_malloc(backend == JitBackend::CUDA ? AllocType::Device
                                                    : AllocType::HostAsync,
@@ -237,6 +313,20 @@ static void ad_call_getter(JitBackend backend, const char *domain,
 
         jit_aggregate(backend, ptr, agg, (uint32_t) (p - agg));
         rv[i] = jit_var_gather(buf.index(), index, mask.index());
+
+        if (use_cache) {
+            GetterCacheEntry entry { backend, cache_name, i, type,
+                                     std::move(key), {}, buf };
+            for (size_t j = 0; j < callable_count; ++j) {
+                uint32_t rv3_i = rv3[i+j*rv2.size()];
+                if (rv3_i && jit_var_state(rv3_i) != VarState::Literal)
+                    entry.vars.push_back_borrow(rv3_i);
+            }
+
+            std::lock_guard<std::mutex> guard(getter_cache.mutex);
+            std::swap(getter_cache.entries[getter_cache.next], entry);
+            getter_cache.next = (getter_cache.next + 1) % GetterCacheSize;
+        }
     }
 }
 
@@ -248,7 +338,7 @@ static void ad_call_symbolic(JitBackend backend, const char *domain,
                              vector<uint64_t> &rv, vector<bool> &rv_ad,
                              ad_call_func func, void *payload,
                              dr::vector<uint32_t> &implicit_in,
-                             bool ad) {
+                             bool ad, vector<void *> &ad_callables) {
     (void) domain;
     (void) size;
 
@@ -321,8 +411,15 @@ static void ad_call_symbolic(JitBackend backend, const char *domain,
                 func(payload, ptr, args2, rv2);
                 inst_id[callable_count_final] = (uint32_t) i + 1;
 
-                for (uint64_t index2: rv2)
+                bool callable_ad = false;
+                for (uint64_t index2: rv2) {
                     ad_var_check_implicit(index2);
+                    callable_ad |= (index2 >> 32) != 0;
+                }
+
+                // Remember callables with differentiable outputs (see CallOp)
+                if (callable_ad)
+                    ad_callables.push_back(ptr);
 
                 // Perform some sanity checks on the return values
                 ad_call_check_rv(backend, size, i, rv, rv2);
@@ -372,18 +469,174 @@ static void ad_call_symbolic(JitBackend backend, const char *domain,
     jit_new_scope(backend);
 }
 
-// Strategy 3: group the arguments and evaluate a kernel per callable
-static void ad_call_reduce(JitBackend backend, const char *domain,
-                            const char *name, size_t size, uint32_t index_,
-                            uint32_t mask_, size_t callable_count,
-                            const vector<uint64_t> args_,
-                            vector<uint64_t> &rv,
-                            ad_call_func func, void *payload) {
-    (void) name; // unused
+/// Maximum number of callables that ad_call() inlines into the caller
+static std::atomic<uint32_t> call_inline_limit { 0 };
+
+uint32_t ad_call_inline() { return call_inline_limit; }
+void ad_set_call_inline(uint32_t value) { call_inline_limit = value; }
+
+/// Inline symbolic calls whose instance index is a literal?
+static std::atomic<bool> call_flatten { false };
+
+int ad_call_flatten() { return call_flatten; }
+void ad_set_call_flatten(int value) { call_flatten = value != 0; }
+
+// Strategy 2b: inline a small number of callables as a chain of masked
+// evaluations and select() operations. This avoids the indirect call of
+// strategy 2 and is worthwhile when each callable only performs a few
+// operations. Since all callables run on every lane, the cost grows with
+// 'callable_count'. The callables in the range [callable_first,
+// callable_count) are candidates, which in the case of a literal index
+// (e.g., a nested call targeting a member of the calling instance) reduces
+// to a single inlined callable.
+static void ad_call_inline_select(JitBackend backend, const char *domain,
+                                  const char *name, size_t size,
+                                  uint32_t index_, uint32_t mask_,
+                                  size_t callable_first, size_t callable_count,
+                                  const vector<uint64_t> args,
+                                  vector<uint64_t> &rv, ad_call_func func,
+                                  void *payload) {
     const char *domain_or_empty = domain ? domain : "",
                *separator = domain ? "::" : "";
 
-    JitVar index;
+    // Masked instance array, includes the mask stack
+    JitVar index = ad_call_index(backend, domain, size, index_, mask_);
+
+    jit_log(LogLevel::InfoSym,
+            "ad_call_inline_select(\"%s%s%s\", index=r%u, callables=%zu)",
+            domain_or_empty, separator, name, index.index(), callable_count);
+
+    vector<uint64_t> rv2;
+    bool rv_initialized = false;
+
+    for (size_t i = callable_first; i < callable_count; ++i) {
+        void *ptr;
+        if (domain) {
+            ptr = jit_registry_ptr(backend, domain, (uint32_t) i + 1);
+            if (!ptr)
+                continue;
+        } else {
+            ptr = (void *) (uintptr_t) i;
+        }
+
+        JitVar id = JitVar::steal(jit_var_u32(backend, (uint32_t) i + 1)),
+               active = JitVar::steal(jit_var_eq(index.index(), id.index()));
+
+        rv2.clear();
+        {
+            // Side effects of the callable only apply to its own lanes
+            jit_var_inc_ref(active.index());
+            scoped_set_mask mask_guard(backend, active.index());
+            scoped_set_self set_self(backend, (uint32_t) i + 1);
+            func(payload, ptr, args, rv2);
+        }
+
+        // Perform some sanity checks on the return values
+        ad_call_check_rv(backend, size, i, rv, rv2);
+        rv_initialized = true;
+
+        // Merge 'rv2' into 'rv' (main function return values)
+        for (size_t j = 0; j < rv2.size(); ++j) {
+            uint64_t r = ad_var_select(active.index(), rv2[j], rv[j]);
+            ad_var_dec_ref(rv[j]);
+            rv[j] = r;
+        }
+    }
+
+    // All callables were missing, let's zero-initialize the return value
+    if (!rv_initialized) {
+        {
+            // Suppress side effects
+            scoped_record record_guard(backend);
+            func(payload, nullptr, args, rv2);
+        }
+        rv.resize(rv2.size());
+        for (size_t i = 0; i < rv2.size(); ++i) {
+            uint64_t zero = 0;
+            uint32_t idx = (uint32_t) rv2[i];
+            if (idx)
+                rv[i] = jit_var_literal(backend, jit_var_type(idx), &zero, size);
+        }
+    }
+}
+
+/**
+ * Cache of masked instance index arrays used by evaluated calls. A wavefront
+ * renderer often dispatches several methods on the same instance array in a
+ * row. Reusing the masked index variable of the previous call enables
+ * jit_var_call_reduce() to return the cached bucket partition of that
+ * variable. Entries keep the inputs alive, hence variable IDs can't be reused
+ * while they are in the cache.
+ */
+struct CallCacheEntry {
+    JitBackend backend;
+    const char *domain;
+    size_t size;
+    JitVar index_in, mask_in, mask_stack, index;
+};
+
+static constexpr size_t CallCacheSize = 8;
+
+static struct CallCache {
+    std::mutex mutex;
+    bool enabled = false;
+    size_t next = 0;
+    CallCacheEntry entries[CallCacheSize];
+} call_cache;
+
+int ad_call_cache() {
+    std::lock_guard<std::mutex> guard(call_cache.mutex);
+    return call_cache.enabled;
+}
+
+void ad_set_call_cache(int value) {
+    CallCacheEntry entries[CallCacheSize];
+    GetterCacheEntry getter_entries[GetterCacheSize];
+    {
+        std::lock_guard<std::mutex> guard(call_cache.mutex);
+        call_cache.enabled = value != 0;
+        if (!value) {
+            // Release the references outside of the critical section
+            for (size_t i = 0; i < CallCacheSize; ++i)
+                entries[i] = std::move(call_cache.entries[i]);
+            call_cache.next = 0;
+        }
+    }
+
+    if (!value) {
+        std::lock_guard<std::mutex> guard(getter_cache.mutex);
+        for (size_t i = 0; i < GetterCacheSize; ++i)
+            std::swap(getter_entries[i], getter_cache.entries[i]);
+        getter_cache.next = 0;
+    }
+}
+
+static bool domain_equal(const char *a, const char *b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+/// Compute the masked instance array of an evaluated call (possibly cached)
+static JitVar ad_call_index(JitBackend backend, const char *domain, size_t size,
+                            uint32_t index_, uint32_t mask_) {
+    JitVar mask_stack;
+    bool cache;
+    {
+        std::lock_guard<std::mutex> guard(call_cache.mutex);
+        cache = call_cache.enabled;
+    }
+
+    if (cache) {
+        mask_stack = JitVar::steal(jit_var_mask_peek(backend));
+
+        std::lock_guard<std::mutex> guard(call_cache.mutex);
+        for (CallCacheEntry &e : call_cache.entries) {
+            if (e.index.valid() && e.backend == backend && e.size == size &&
+                domain_equal(e.domain, domain) &&
+                e.index_in.index() == index_ && e.mask_in.index() == mask_ &&
+                e.mask_stack.index() == mask_stack.index())
+                return e.index;
+        }
+    }
 
     // Apply mask stack
     JitVar mask_combined = {};
@@ -397,10 +650,48 @@ static void ad_call_reduce(JitBackend backend, const char *domain,
         mask_combined = JitVar::steal(jit_var_mask_apply(mask.index(), (uint32_t) size));
     }
 
-    index = JitVar::steal(jit_var_and(index_, mask_combined.index()));
+    JitVar index = JitVar::steal(jit_var_and(index_, mask_combined.index()));
     if (index.size() == 1)
         index.resize(size);
 
+    if (cache) {
+        CallCacheEntry entry { backend, domain, size, JitVar::borrow(index_),
+                               JitVar::borrow(mask_), std::move(mask_stack),
+                               index };
+        std::lock_guard<std::mutex> guard(call_cache.mutex);
+        if (call_cache.enabled) {
+            std::swap(call_cache.entries[call_cache.next], entry);
+            call_cache.next = (call_cache.next + 1) % CallCacheSize;
+        }
+    }
+
+    return index;
+}
+
+/// Evaluated calls batch targets with fewer entries into a symbolic call
+static std::atomic<uint32_t> call_reduce_batch { 0 };
+
+uint32_t ad_call_reduce_batch() { return call_reduce_batch; }
+void ad_set_call_reduce_batch(uint32_t value) { call_reduce_batch = value; }
+
+// Strategy 3: group the arguments and evaluate a kernel per callable. Targets
+// with only a few entries are optionally combined into a single symbolic call
+// (see ad_set_call_reduce_batch()). The function returns 'false' when this
+// nested call took ownership of 'cleanup'.
+static bool ad_call_reduce(JitBackend backend, const char *domain,
+                           const char *name, size_t size, uint32_t index_,
+                           uint32_t mask_, size_t callable_count,
+                           size_t callable_count_in,
+                           const vector<uint64_t> args_,
+                           vector<uint64_t> &rv,
+                           ad_call_func func, void *payload,
+                           ad_call_cleanup &cleanup, bool ad) {
+    (void) name; // unused
+    const char *domain_or_empty = domain ? domain : "",
+               *separator = domain ? "::" : "";
+
+    JitVar index = ad_call_index(backend, domain, size, index_, mask_);
+
     jit_var_schedule(index.index());
     index64_vector args;
     args.reserve(args_.size());
@@ -421,12 +712,29 @@ static void ad_call_reduce(JitBackend backend, const char *domain,
     args2.clear();
 
     vector<uint64_t> rv2;
-    bool rv_initialized = false;
+    bool rv_initialized = false, owned = true;
     size_t last_size = 0;
     JitVar memop_mask = JitVar::steal(jit_var_bool(backend, true));
 
+    // Identify small targets that should be batched into one kernel
+    uint32_t batch = call_reduce_batch;
+    vector<bool> small(n_inst, false);
+    uint32_t n_small = 0;
+    if (batch) {
+        for (size_t i = 0; i < n_inst; ++i) {
+            if (buckets[i].id != 0 && jit_var_size(buckets[i].index) < batch) {
+                small[i] = true;
+                n_small++;
+            }
+        }
+        if (n_small < 2) {
+            small = vector<bool>(n_inst, false);
+            n_small = 0;
+        }
+    }
+
     for (size_t i = 0; i < n_inst; ++i) {
-        if (buckets[i].id == 0)
+        if (buckets[i].id == 0 || small[i])
             continue;
 
         rv_initialized = true;
@@ -486,6 +794,69 @@ static void ad_call_reduce(JitBackend backend, const char *domain,
         args2.release();
     }
 
+    if (n_small) {
+        jit_log(LogLevel::InfoSym,
+                "ad_call_reduce(\"%s%s%s\"): batching %u small targets into "
+                "a symbolic call.", domain_or_empty, separator, name, n_small);
+        rv_initialized = true;
+
+        // Flag the small targets and find the entries referencing them
+        bool false_v = false;
+        JitVar flags = JitVar::steal(jit_var_literal(
+            backend, VarType::Bool, &false_v, callable_count + 1));
+        for (size_t i = 0; i < n_inst; ++i) {
+            if (!small[i])
+                continue;
+            JitVar target = JitVar::steal(jit_var_u32(backend, buckets[i].id));
+            flags = JitVar::steal(jit_var_scatter(
+                flags.index(), memop_mask.index(), target.index(),
+                memop_mask.index(), ReduceOp::Identity, ReduceMode::Auto));
+        }
+
+        JitVar sel = JitVar::steal(jit_var_gather(
+                   flags.index(), index.index(), memop_mask.index())),
+               lanes = JitVar::steal(jit_var_compress(sel.index())),
+               index_s = JitVar::steal(jit_var_gather(
+                   index.index(), lanes.index(), memop_mask.index()));
+
+        for (size_t j = 0; j < args.size(); ++j) {
+            if (jit_var_size((uint32_t) args[j]) == 1)
+                args2.push_back_borrow(args[j]);
+            else
+                args2.push_back_steal(ad_var_gather(
+                    args[j], lanes.index(), memop_mask.index(),
+                    ReduceMode::Permute));
+        }
+
+        // From here on, the nested call owns 'cleanup'
+        ad_call_cleanup cleanup_s = cleanup;
+        cleanup = nullptr;
+
+        rv2.clear();
+        {
+            scoped_set_mask mask_guard(backend, jit_var_bool(backend, true));
+            owned = ad_call(backend, domain, 1, callable_count_in, name, false,
+                            index_s.index(), 0, args2, rv2, payload, func,
+                            cleanup_s, ad);
+        }
+
+        index64_vector rv_s;
+        for (uint64_t r : rv2)
+            rv_s.push_back_steal(r);
+
+        ad_call_check_rv(backend, size, 0, rv, rv2);
+
+        for (size_t j = 0; j < rv_s.size(); ++j) {
+            uint64_t r =
+                ad_var_scatter(rv[j], rv_s[j], lanes.index(), memop_mask.index(),
+                               ReduceOp::Identity, ReduceMode::Permute);
+            ad_var_dec_ref(rv[j]);
+            rv[j] = r;
+        }
+
+        args2.release();
+    }
+
     // All targets were fully masked, let's zero-initialize the return value
     if (!rv_initialized) {
         {
@@ -505,6 +876,47 @@ static void ad_call_reduce(JitBackend backend, const char *domain,
 
     for (uint64_t r : rv)
         jit_var_schedule((uint32_t) r);
+
+    return owned;
+}
+
+// Strategy 4: sort the lanes by callable ID (counting sort), then trace the
+// callables symbolically. Adjacent threads of the resulting kernel then tend
+// to take the same branch. The function computes the permutation 'perm' that
+// groups the lanes and its inverse 'dest' used to scatter the results back.
+static void ad_call_sort(JitBackend backend, const char *domain, size_t size,
+                         uint32_t index_, uint32_t mask_, size_t callable_count,
+                         JitVar &index_p, JitVar &perm, JitVar &dest) {
+    JitVar index = ad_call_index(backend, domain, size, index_, mask_);
+
+    // Determine the position of each lane within its bucket
+    uint32_t zero = 0;
+    uint32_t counts_tmp = jit_var_literal(backend, VarType::UInt32, &zero,
+                                          callable_count + 1);
+    JitVar true_mask = JitVar::steal(jit_var_bool(backend, true));
+    JitVar slot = JitVar::steal(
+        jit_var_scatter_inc(&counts_tmp, index.index(), true_mask.index()));
+    JitVar counts = JitVar::steal(counts_tmp);
+
+    // Start of each bucket
+    JitVar offsets = JitVar::steal(jit_var_block_prefix_reduce(
+        ReduceOp::Add, counts.index(), (uint32_t) (callable_count + 1), 1, 0));
+
+    dest = JitVar::steal(jit_var_gather(offsets.index(), index.index(),
+                                        true_mask.index()));
+    dest = JitVar::steal(jit_var_add(dest.index(), slot.index()));
+
+    JitVar lanes = JitVar::steal(jit_var_counter(backend, size));
+    perm = JitVar::steal(jit_var_literal(backend, VarType::UInt32, &zero, size));
+    perm = JitVar::steal(jit_var_scatter(perm.index(), lanes.index(),
+                                         dest.index(), true_mask.index(),
+                                         ReduceOp::Identity,
+                                         ReduceMode::Permute));
+    jit_var_eval(perm.index());
+    jit_var_schedule(dest.index());
+
+    index_p = JitVar::steal(jit_var_gather(index.index(), perm.index(),
+                                           true_mask.index()));
 }
 
 // Helper function full of checks (used by all strategies)
@@ -709,6 +1121,23 @@ public:
     /// Backward AD callback (invoked by backward() once per callable)
     void backward_cb(void *self, const vector<uint64_t> &args,
                      vector<uint64_t> &rv) {
+        if (m_ad_filter && std::find(m_ad_callables.begin(), m_ad_callables.end(),
+                                     self) == m_ad_callables.end()) {
+            /* The primal trace established that the outputs of this callable
+               don't depend on differentiable inputs. Its adjoint is zero, and
+               there is no need to trace it another time. */
+            m_temp.release();
+            uint64_t zero = 0;
+            for (size_t i = 0; i < m_input_offsets.size(); ++i) {
+                uint32_t arg = (uint32_t) args[m_input_offsets[i]],
+                         index = jit_var_literal(m_backend, jit_var_type(arg),
+                                                 &zero, 1);
+                m_temp.push_back_steal(index);
+                rv.push_back(index);
+            }
+            return;
+        }
+
         m_args2.release();
         for (size_t i = 0; i < m_args.size(); ++i)
             m_args2.push_back_borrow(args[i]);
@@ -764,6 +1193,12 @@ public:
 
     void disable_deleter() { m_cleanup = nullptr; }
 
+    /// Restrict backward() to callables known to have differentiable outputs
+    void set_ad_callables(vector<void *> &&callables) {
+        m_ad_callables = std::move(callables);
+        m_ad_filter = true;
+    }
+
 private:
     std::string m_name, m_name_op;
     const char *m_domain;
@@ -779,6 +1214,8 @@ private:
     void *m_payload;
     ad_call_func m_func;
     ad_call_cleanup m_cleanup;
+    vector<void *> m_ad_callables;
+    bool m_ad_filter = false;
 };
 
 // Generic checks, then forward either to ad_call_symbolic or ad_call_reduce
@@ -811,9 +1248,13 @@ bool ad_call(JitBackend backend, const char *domain, int symbolic,
             }
         }
 
-        if (symbolic != 0 && symbolic != 1)
-            jit_raise("ad_call(): 'symbolic' must be -1, 0, or 1!");
+        if (symbolic == 2 && jit_flag(JitFlag::SymbolicScope))
+            symbolic = 1; // Cannot reorder lanes within a symbolic operation
+
+        if (symbolic < 0 || symbolic > 2)
+            jit_raise("ad_call(): 'symbolic' must be -1, 0, 1, or 2!");
 
+        size_t callable_count_in = callable_count;
         if (domain)
             callable_count = jit_registry_id_bound(backend, domain);
 
@@ -861,17 +1302,84 @@ bool ad_call(JitBackend backend, const char *domain, int symbolic,
             return true;
         }
 
+        if (symbolic == 2 && !is_getter && size > 1) {
+            JitVar index_p, perm, dest;
+            ad_call_sort(backend, domain, size, index, mask, callable_count,
+                         index_p, perm, dest);
+
+            JitVar true_mask = JitVar::steal(jit_var_bool(backend, true));
+            index64_vector args_p;
+            args_p.reserve(args.size());
+            for (uint64_t arg_i : args) {
+                if (jit_var_size((uint32_t) arg_i) == 1)
+                    args_p.push_back_borrow(arg_i);
+                else
+                    args_p.push_back_steal(ad_var_gather(
+                        arg_i, perm.index(), true_mask.index(),
+                        ReduceMode::Permute));
+            }
+
+            // The lanes were reordered, the mask stack no longer applies.
+            // It was already folded into 'index_p' by ad_call_sort().
+            scoped_set_mask mask_guard(backend, jit_var_bool(backend, true));
+
+            // From here on, the nested call owns 'cleanup'
+            ad_call_cleanup cleanup_p = cleanup;
+            cleanup = nullptr;
+
+            vector<uint64_t> rv_p;
+            bool result = ad_call(backend, domain, 1, callable_count_in, name,
+                                  false, index_p.index(), 0, args_p, rv_p,
+                                  payload, func, cleanup_p, ad);
+
+            // Undo the permutation
+            for (uint64_t &i : rv)
+                ad_var_dec_ref(i);
+            rv.clear();
+            for (uint64_t i : rv_p) {
+                if (!i) {
+                    rv.push_back(0);
+                    continue;
+                }
+                rv.push_back(ad_var_gather(i, dest.index(), true_mask.index(),
+                                           ReduceMode::Permute));
+                ad_var_dec_ref(i);
+            }
+
+            return result;
+        }
+
         vector<bool> rv_ad;
+        vector<void *> ad_callables;
+        bool ad_filter = false;
         dr::detail::ad_index32_vector implicit_in;
 
         if (is_getter) {
             ad_call_getter(backend, domain, name, size, index, mask,
                            callable_count, args, rv, rv_ad, func, payload,
                            implicit_in, ad);
+        } else if (symbolic && call_flatten &&
+                   jit_var_state(index) == VarState::Literal) {
+            // All lanes target the same callable: inline it into the caller.
+            // In a nested call, this merges the inner callable into the body
+            // of each outer callable instead of dispatching twice.
+            uint32_t target = 0;
+            jit_var_read(index, 0, &target);
+            bool valid = target >= 1 && target <= callable_count;
+            size_t first = valid ? target - 1 : 0,
+                   last  = valid ? target : 0;
+            ad_call_inline_select(backend, domain, name, size, index, mask,
+                                  first, last, args, rv, func, payload);
+            ad = false; // derivative already tracked, no CustomOp needed
+        } else if (symbolic && callable_count <= call_inline_limit) {
+            ad_call_inline_select(backend, domain, name, size, index, mask,
+                                  0, callable_count, args, rv, func, payload);
+            ad = false; // derivative already tracked, no CustomOp needed
         } else if (symbolic) {
             ad_call_symbolic(backend, domain, name, size, index, mask,
                              callable_count, args, rv, rv_ad, func, payload,
-                             implicit_in, ad);
+                             implicit_in, ad, ad_callables);
+            ad_filter = true;
         } else {
             if (jit_flag(JitFlag::SymbolicScope))
                 jit_raise(
@@ -881,8 +1389,11 @@ bool ad_call(JitBackend backend, const char *domain, int symbolic,
                     "documentation of drjit.JitFlag.SymbolicCalls and drjit.switch() for general\n"
                     "information on symbolic and evaluated calls, as well as their limitations.");
 
-            ad_call_reduce(backend, domain, name, size, index, mask,
-                           callable_count, args, rv, func, payload);
+            bool owned = ad_call_reduce(backend, domain, name, size, index,
+                                        mask, callable_count, callable_count_in,
+                                        args, rv, func, payload, cleanup, ad);
+            if (!owned)
+                return false; // the CallOp of a nested call owns 'cleanup'
             ad = false; // derivative already tracked, no CustomOp needed
         }
 
@@ -907,11 +1418,24 @@ bool ad_call(JitBackend backend, const char *domain, int symbolic,
             for (uint32_t index2: implicit_in)
                 op->add_index(backend, index2, true);
 
+            if (ad_filter)
+                op->set_ad_callables(std::move(ad_callables));
+
+            // Create AD variables for all differentiable outputs at once
+            vector<uint32_t> rv_jit;
             for (size_t i = 0; i < rv.size(); ++i) {
+                if (rv_ad[i])
+                    rv_jit.push_back((uint32_t) rv[i]);
+            }
+
+            vector<uint64_t> rv_new(rv_jit.size(), 0);
+            ad_var_new_n(rv_jit.size(), rv_jit.data(), rv_new.data());
+
+            for (size_t i = 0, j = 0; i < rv.size(); ++i) {
                 if (!rv_ad[i])
                     continue;
 
-                uint64_t index2 = ad_var_new((uint32_t) rv[i]);
+                uint64_t index2 = rv_new[j++];
 
                 jit_var_dec_ref((uint32_t) rv[i]);
                 rv[i] = index2;
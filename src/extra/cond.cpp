@@ -18,11 +18,25 @@
 #include <drjit-core/hash.h>
 #include <tsl/robin_map.h>
 #include <tsl/robin_set.h>
+#include <mutex>
+#include <string>
 
 namespace dr = drjit;
 
 using JitVar = GenericArray<void>;
 
+/// Statistics of previous 'auto' mode conditionals, keyed by their label
+struct CondStats {
+    uint32_t calls = 0;
+    bool uniform = true;
+};
+
+static std::mutex cond_stats_lock;
+static tsl::robin_map<std::string, CondStats> cond_stats;
+
+/// Re-examine divergent conditionals after this many calls
+static constexpr uint32_t CondStatsInterval = 16;
+
 static void ad_cond_evaluated(JitBackend backend, const char *label,
                               void *payload, uint32_t cond_t, uint32_t cond_f,
                               const dr::vector<uint64_t> &args,
@@ -410,6 +424,48 @@ public:
         return ((uint64_t) ad_index) << 32;
     }
 
+    /**
+     * \brief Check if all entries of the condition take the same branch
+     *
+     * Derivative propagation normally records a new conditional statement
+     * that re-traces both branches. When the condition mask has been
+     * evaluated at this point (e.g., because the primal computation ran
+     * before the AD traversal), a single reduction reveals whether only one
+     * branch is taken. The derivative is then computed by tracing only this
+     * branch without a surrounding conditional. The result is cached, so
+     * that subsequent forward/backward passes through the same
+     * operation don't repeat the reduction.
+     *
+     * Returns \c 1 or \c 0 when all entries take the ``true`` or ``false``
+     * branch, and \c -1 otherwise.
+     */
+    int uniform_branch() {
+        if (m_branch == -2) {
+            m_branch = -1;
+
+            if (jit_var_state(m_cond) == VarState::Evaluated) {
+                uint32_t count = 0, size = (uint32_t) jit_var_size(m_cond);
+
+                JitVar mask_u32 = JitVar::steal(
+                           jit_var_cast(m_cond, VarType::UInt32, 0)),
+                       total = JitVar::steal(jit_var_reduce(
+                           m_backend, VarType::UInt32, ReduceOp::Add,
+                           mask_u32.index()));
+                jit_var_read(total.index(), 0, &count);
+
+                if (count == 0 || count == size) {
+                    m_branch = count != 0 ? 1 : 0;
+                    jit_log(LogLevel::InfoSym,
+                            "CondOp(\"%s\"): all entries take the '%s' "
+                            "branch, skipping the other one.", m_label.c_str(),
+                            m_branch ? "true" : "false");
+                }
+            }
+        }
+
+        return m_branch;
+    }
+
     void forward() override {
         dr::string label = m_label + " [ad, fwd]";
 
@@ -422,13 +478,18 @@ public:
         for (size_t i : m_input_offsets)
             args.push_back_steal(ad_grad(m_args[i]));
 
-        ad_cond(
-            m_backend, 1, label.c_str(), this, m_cond, args, rv,
-            [](void *p, bool value, const dr::vector<uint64_t> &args,
-               dr::vector<uint64_t> &rv) {
-                ((CondOp *) p)->forward_cb(value, args, rv);
-            },
-            nullptr, false);
+        int branch = uniform_branch();
+        if (branch != -1) {
+            forward_cb(branch == 1, args, rv);
+        } else {
+            ad_cond(
+                m_backend, 1, label.c_str(), this, m_cond, args, rv,
+                [](void *p, bool value, const dr::vector<uint64_t> &args,
+                   dr::vector<uint64_t> &rv) {
+                    ((CondOp *) p)->forward_cb(value, args, rv);
+                },
+                nullptr, false);
+        }
 
         ad_assert(rv.size() == m_output_offsets.size(),
                   "CondOp::forward(): size mismatch!");
@@ -451,13 +512,18 @@ public:
         for (size_t i = 0; i < m_output_offsets.size(); ++i)
             args.push_back_steal(ad_grad(from_ad_index(m_output_indices[i])));
 
-        ad_cond(
-            m_backend, 1, label.c_str(), this, m_cond, args, rv,
-            [](void *p, bool value, const dr::vector<uint64_t> &args,
-               dr::vector<uint64_t> &rv) {
-                ((CondOp *) p)->backward_cb(value, args, rv);
-            },
-            nullptr, false);
+        int branch = uniform_branch();
+        if (branch != -1) {
+            backward_cb(branch == 1, args, rv);
+        } else {
+            ad_cond(
+                m_backend, 1, label.c_str(), this, m_cond, args, rv,
+                [](void *p, bool value, const dr::vector<uint64_t> &args,
+                   dr::vector<uint64_t> &rv) {
+                    ((CondOp *) p)->backward_cb(value, args, rv);
+                },
+                nullptr, false);
+        }
 
         ad_assert(rv.size() == m_input_offsets.size(),
                   "CondOp::backward(): size mismatch!");
@@ -584,6 +650,8 @@ private:
     dr::vector<bool> m_args_implicit;
     dr::vector<size_t> m_input_offsets;
     dr::vector<size_t> m_output_offsets;
+    /// Cached result of uniform_branch() (-2: not yet computed)
+    int m_branch = -2;
 };
 
 bool ad_cond(JitBackend backend, int symbolic, const char *label, void *payload,
@@ -611,8 +679,11 @@ bool ad_cond(JitBackend backend, int symbolic, const char *label, void *payload,
         }
     }
 
-    if (symbolic != 0 && symbolic != 1)
-        jit_raise("'symbolic' must equal 0, 1, or -1.");
+    if (symbolic == 2 && jit_flag(JitFlag::SymbolicScope))
+        symbolic = 1;
+
+    if (symbolic != 0 && symbolic != 1 && symbolic != 2)
+        jit_raise("'symbolic' must equal 0, 1, 2, or -1.");
 
     if (jit_var_state(cond) == VarState::Literal) {
         jit_log(LogLevel::InfoSym,
@@ -628,6 +699,55 @@ bool ad_cond(JitBackend backend, int symbolic, const char *label, void *payload,
            neg_mask = JitVar::steal(jit_var_not(cond)),
            false_mask = JitVar::steal(jit_var_mask_apply(neg_mask.index(), (uint32_t) size));
 
+    if (symbolic == 2) {
+        /* Automatic mode: count the active entries that take the 'true'
+           branch. When all of them agree, only that branch must be executed.
+           Otherwise, symbolic mode avoids running both sides over the full
+           array. Labeled conditionals that were divergent in the past skip
+           the (synchronizing) count and are only re-examined periodically. */
+        bool labeled = strcmp(label, "unnamed") != 0, count = true;
+
+        if (labeled) {
+            std::lock_guard<std::mutex> guard(cond_stats_lock);
+            CondStats &stats = cond_stats[label];
+            count = stats.uniform || stats.calls % CondStatsInterval == 0;
+            stats.calls++;
+        }
+
+        symbolic = 1;
+        if (count) {
+            uint32_t value[2] = { 0, 0 };
+            uint32_t masks[2] = { true_mask.index(), false_mask.index() };
+
+            for (int i = 0; i < 2; ++i) {
+                JitVar mask_u32 = JitVar::steal(
+                           jit_var_cast(masks[i], VarType::UInt32, 0)),
+                       total = JitVar::steal(jit_var_reduce(
+                           backend, VarType::UInt32, ReduceOp::Add,
+                           mask_u32.index()));
+                jit_var_read(total.index(), 0, &value[i]);
+            }
+
+            bool uniform = value[0] == 0 || value[1] == 0;
+
+            jit_log(LogLevel::InfoSym,
+                    "ad_cond(\"%s\"): automatic mode, %u/%u entries take the "
+                    "'true' branch.", label, value[0], value[0] + value[1]);
+
+            if (labeled) {
+                std::lock_guard<std::mutex> guard(cond_stats_lock);
+                cond_stats[label].uniform = uniform;
+            }
+
+            if (uniform) {
+                bool taken = value[0] != 0;
+                scoped_push_mask guard(backend, masks[taken ? 0 : 1]);
+                body_cb(payload, taken, args, rv);
+                return true;
+            }
+        }
+    }
+
     if (symbolic) {
         dr::vector<size_t> input_offsets, output_offsets;
         dr::detail::ad_index32_vector implicit_in, implicit_out;
@@ -14,6 +14,8 @@
 
 #include "common.h"
 #include <drjit/custom.h>
+#include <algorithm>
+#include <atomic>
 #include <string>
 
 namespace dr = drjit;
@@ -24,7 +26,7 @@ static bool ad_loop_symbolic(JitBackend backend, const char *name,
                              void *payload,
                              ad_loop_read read_cb, ad_loop_write write_cb,
                              ad_loop_cond cond_cb, ad_loop_body body_cb,
-                             index64_vector &backup,
+                             int unroll, index64_vector &backup,
                              dr::vector<uint32_t> &implicit_in,
                              dr::vector<uint32_t> &implicit_out) {
     index64_vector indices1;
@@ -99,6 +101,35 @@ static bool ad_loop_symbolic(JitBackend backend, const char *name,
                 body_cb(payload);
             }
 
+            // Record further copies of the body, each guarded by the loop condition
+            for (int k = 1; k < unroll; ++k) {
+                index64_vector state_prev, state_next;
+                read_cb(payload, state_prev);
+
+                uint32_t active_k_initial = cond_cb(payload);
+                JitVar active_k = JitVar::steal(jit_var_mask_apply(
+                    active_k_initial, (uint32_t) jit_var_size(active_k_initial)));
+
+                {
+                    scoped_push_mask m(backend, active_k.index());
+                    body_cb(payload);
+                }
+
+                // Lanes that have finished keep their state
+                read_cb(payload, state_next);
+                for (size_t i = 0; i < state_next.size(); ++i) {
+                    uint64_t i1 = state_prev[i], i2 = state_next[i];
+
+                    // Skip variables that are unchanged or the target of side effects
+                    if (i1 == i2 || jit_var_is_dirty((uint32_t) i2))
+                        continue;
+
+                    state_next[i] = ad_var_select(active_k.index(), i2, i1);
+                    ad_var_dec_ref(i2);
+                }
+                write_cb(payload, state_next, false);
+            }
+
             // Fetch latest version of loop state
             read_cb(payload, indices1);
             for (uint64_t i : indices1) {
@@ -145,11 +176,134 @@ static bool ad_loop_symbolic(JitBackend backend, const char *name,
     return needs_ad;
 }
 
+/// Number of iterations between termination checks of masked evaluated loops
+static std::atomic<uint32_t> loop_check_interval { 1 };
+
+uint32_t ad_loop_check_interval() { return loop_check_interval; }
+void ad_set_loop_check_interval(uint32_t value) {
+    loop_check_interval = value ? value : 1;
+}
+
+/// Number of iterations that evaluated loops perform per kernel launch
+static std::atomic<uint32_t> loop_batch_size { 1 };
+
+uint32_t ad_loop_batch() { return loop_batch_size; }
+void ad_set_loop_batch(uint32_t value) { loop_batch_size = value; }
+
+/**
+ * Evaluated loops can optionally perform several iterations per kernel
+ * launch, which amortizes the cost of tracing the loop body. In this case,
+ * each step of the evaluated loop records the body only once into a nested
+ * symbolic loop that performs up to 'size' iterations. The nested loops may
+ * create LoopOp nodes that share this data structure, which is tracked by
+ * the reference count 'refs'. Once ownership has been transferred to such a
+ * node, the last reference also destroys the caller's payload.
+ */
+struct LoopBatch {
+    JitBackend backend;
+    const char *name;
+    void *payload;
+    ad_loop_read read_cb;
+    ad_loop_write write_cb;
+    ad_loop_cond cond_cb;
+    ad_loop_body body_cb;
+    ad_loop_body inverse_cb;
+    ad_loop_delete delete_cb;
+    long long max_iterations;
+    int checkpoint;
+    uint32_t size;
+    /// Iteration counter and loop condition of the nested loop
+    JitVar counter, active;
+    std::atomic<size_t> refs { 1 };
+    bool transferred = false;
+};
+
+static void loop_batch_read(void *p, dr::vector<uint64_t> &indices) {
+    LoopBatch *b = (LoopBatch *) p;
+    b->read_cb(b->payload, indices);
+    indices.push_back(ad_var_inc_ref(b->counter.index()));
+}
+
+static void loop_batch_write(void *p, const dr::vector<uint64_t> &indices,
+                             bool restart) {
+    LoopBatch *b = (LoopBatch *) p;
+    dr::vector<uint64_t> tmp;
+    tmp.reserve(indices.size() - 1);
+    for (size_t i = 0; i + 1 < indices.size(); ++i)
+        tmp.push_back(indices[i]);
+    b->write_cb(b->payload, tmp, restart);
+    b->counter = JitVar::borrow((uint32_t) indices[indices.size() - 1]);
+}
+
+static uint32_t loop_batch_cond(void *p) {
+    LoopBatch *b = (LoopBatch *) p;
+    uint32_t cond = b->cond_cb(b->payload);
+    JitVar limit = JitVar::steal(jit_var_u32(b->backend, b->size)),
+           in_batch = JitVar::steal(jit_var_lt(b->counter.index(), limit.index()));
+    b->active = JitVar::steal(jit_var_and(cond, in_batch.index()));
+    return b->active.index();
+}
+
+static void loop_batch_body(void *p) {
+    LoopBatch *b = (LoopBatch *) p;
+    b->body_cb(b->payload);
+    JitVar one = JitVar::steal(jit_var_u32(b->backend, 1));
+    b->counter = JitVar::steal(jit_var_add(b->counter.index(), one.index()));
+}
+
+static void loop_batch_inverse(void *p) {
+    LoopBatch *b = (LoopBatch *) p;
+    b->inverse_cb(b->payload);
+    JitVar one = JitVar::steal(jit_var_u32(b->backend, 1));
+    b->counter = JitVar::steal(jit_var_sub(b->counter.index(), one.index()));
+}
+
+static void loop_batch_delete(void *p) {
+    LoopBatch *b = (LoopBatch *) p;
+    if (--b->refs != 0)
+        return;
+    if (b->transferred && b->delete_cb)
+        b->delete_cb(b->payload);
+    delete b;
+}
+
+/// Execute the loop body, potentially several iterations at once
+static void ad_loop_evaluated_body(LoopBatch *b, void *payload,
+                                   ad_loop_body body_cb) {
+    if (!b) {
+        body_cb(payload);
+        return;
+    }
+
+    b->counter = JitVar::steal(jit_var_u32(b->backend, 0));
+    b->refs++;
+
+    bool done;
+    try {
+        done = ad_loop(b->backend, 1, 0, b->max_iterations, 1, b->checkpoint,
+                       false, b->name, b, loop_batch_read, loop_batch_write,
+                       loop_batch_cond, loop_batch_body,
+                       b->inverse_cb ? loop_batch_inverse : nullptr,
+                       loop_batch_delete, true);
+    } catch (...) {
+        b->refs--;
+        throw;
+    }
+
+    if (done)
+        b->refs--;
+    else
+        b->transferred = true; // A LoopOp now holds a reference
+
+    b->counter = b->active = JitVar();
+}
+
 // Simple wavefront-style evaluated loop that masks inactive entries
 static size_t ad_loop_evaluated_mask(JitBackend backend, const char *name,
                                      void *payload, ad_loop_read read_cb,
                                      ad_loop_write write_cb,
                                      ad_loop_cond cond_cb, ad_loop_body body_cb,
+                                     LoopBatch *batch,
                                      index64_vector indices1,
                                      JitVar active) {
     index64_vector indices2;
@@ -157,11 +311,17 @@ static size_t ad_loop_evaluated_mask(JitBackend backend, const char *name,
     size_t it = 0;
     bool grad_suspended = ad_grad_suspended();
 
+    /* Checking for termination requires a device->host synchronization.
+       Optionally only do so every few iterations. The loop then runs
+       speculative iterations where all entries are masked, which doesn't
+       change the loop state. */
+    uint32_t check_interval = loop_check_interval;
+
     while (true) {
         // Evaluate the loop state
         jit_eval();
 
-        if (!jit_var_any(active.index()))
+        if (it % check_interval == 0 && !jit_var_any(active.index()))
             break;
 
         jit_log(LogLevel::InfoSym,
@@ -171,7 +331,7 @@ static size_t ad_loop_evaluated_mask(JitBackend backend, const char *name,
         // Push the mask onto mask stack and execute the loop body
         {
             scoped_push_mask guard(backend, (uint32_t) active.index());
-            body_cb(payload);
+            ad_loop_evaluated_body(batch, payload, body_cb);
         }
 
         // Capture the state of all variables following execution of the loop body
@@ -219,15 +379,22 @@ static size_t ad_loop_evaluated_mask(JitBackend backend, const char *name,
     return it;
 }
 
+/// Occupancy below which evaluated loops compress their state (1 = always)
+static std::atomic<float> loop_compress_ratio { 1.f };
+
+float ad_loop_compress_ratio() { return loop_compress_ratio; }
+void ad_set_loop_compress_ratio(float value) { loop_compress_ratio = value; }
+
 // Simple wavefront-style evaluated loop that progressively reduces the size
 // of the loop state to ignore inactive entries
 static size_t
 ad_loop_evaluated_compress(JitBackend backend, const char *name, void *payload,
                            ad_loop_read read_cb, ad_loop_write write_cb,
                            ad_loop_cond cond_cb, ad_loop_body body_cb,
-                           index64_vector indices,
+                           LoopBatch *batch, index64_vector indices,
                            JitVar active) {
     uint32_t size = (uint32_t) active.size(), it = 0;
+    bool grad_suspended = ad_grad_suspended();
 
     JitVar true_mask = JitVar::steal(jit_var_bool(backend, true)),
            zero = JitVar::steal(jit_var_u32(backend, 0)),
@@ -282,14 +449,28 @@ ad_loop_evaluated_compress(JitBackend backend, const char *name, void *payload,
           This variant launches a single kernel per iteration, and it is
           fairly write and atomic-heavy. It tends to run faster on the CUDA
           backend
+
+       When the occupancy ratio set via ad_set_loop_compress_ratio() is below
+       1, the function always uses variant 1, which knows the number of
+       remaining entries before touching the loop state. It then only
+       compresses when the occupancy drops below this ratio, and otherwise
+       keeps the loop state and masks finished entries via 'alive' (like
+       ad_loop_evaluated_mask()).
      */
-    bool reduce_then_gather = backend == JitBackend::LLVM;
+    float ratio = loop_compress_ratio;
+    bool reduce_then_gather = backend == JitBackend::LLVM || ratio < 1.f;
+
+    // Entries of the loop state that haven't finished (invalid: all of them)
+    JitVar alive;
 
     while (true) {
         // Determine which entries aren't active, these must be written out
         JitVar not_active = JitVar::steal(jit_var_not(active.index()));
+        if (alive.valid())
+            not_active &= alive;
 
         uint32_t size_next = 0;
+        bool compressed = true;
 
         if (reduce_then_gather) {
             for (uint64_t &index: indices) {
@@ -324,20 +505,32 @@ ad_loop_evaluated_compress(JitBackend backend, const char *name, void *payload,
 
             jit_eval();
 
-            for (size_t i = 0; i < indices.size(); ++i) {
-                // Gather remaining active entries. We always do this even when
-                // the loop state was not compressed, which ensures identical code
-                // generation in each iteration to benefit from kernel caching.
-                uint32_t t_index = (uint32_t)
-                    ad_var_gather(indices[i], active_index.index(),
-                                  true_mask.index(), ReduceMode::Permute);
-                ad_var_dec_ref(indices[i]);
-                indices[i] = t_index;
-            }
+            jit_log(LogLevel::InfoSym,
+                    "ad_loop_evaluated(\"%s\"): occupancy %u/%u (%.1f%%).",
+                    name, size_next, size, 100.0 * size_next / size);
+
+            compressed = ratio >= 1.f || (float) size_next < ratio * (float) size;
 
-            idx = JitVar::steal((uint32_t) ad_var_gather(idx.index(), active_index.index(),
-                                                         true_mask.index(), ReduceMode::Permute));
-            dr::schedule(idx);
+            if (compressed) {
+                for (size_t i = 0; i < indices.size(); ++i) {
+                    // Gather remaining active entries. We always do this even when
+                    // the loop state was not compressed, which ensures identical code
+                    // generation in each iteration to benefit from kernel caching.
+                    uint32_t t_index = (uint32_t)
+                        ad_var_gather(indices[i], active_index.index(),
+                                      true_mask.index(), ReduceMode::Permute);
+                    ad_var_dec_ref(indices[i]);
+                    indices[i] = t_index;
+                }
+
+                idx = JitVar::steal((uint32_t) ad_var_gather(idx.index(), active_index.index(),
+                                                             true_mask.index(), ReduceMode::Permute));
+                dr::schedule(idx);
+                alive = JitVar();
+            } else {
+                // Occupancy is still high, keep the state and mask instead
+                alive = active;
+            }
         } else {
             // Increase an atomic counter to determine the position in the output array
             uint32_t counter_tmp = jit_var_u32(backend, 0);
@@ -393,26 +586,69 @@ ad_loop_evaluated_compress(JitBackend backend, const char *name, void *payload,
         if (size_next == 0)
             break; // all done!
 
-        if (size != size_next)
-            jit_log(LogLevel::InfoSym,
-                    "ad_loop_evaluated(\"%s\"): compressed loop state from %u "
-                    "to %u entries.", name, size, size_next);
+        if (compressed) {
+            if (size != size_next)
+                jit_log(LogLevel::InfoSym,
+                        "ad_loop_evaluated(\"%s\"): compressed loop state from %u "
+                        "to %u entries.", name, size, size_next);
+            size = size_next;
+        }
+
+        /* As in ad_loop_evaluated_mask(), mark the end of each iteration in
+           the AD graph. Reverse-mode traversal then evaluates gradients one
+           iteration at a time, undoing each compaction step via the
+           permutation stored by the gather/scatter edges above, instead of
+           producing a single kernel that spans all iterations. */
+        if (!grad_suspended) {
+            for (size_t i = 0; i < indices.size(); ++i) {
+                if (skip[i] || !(indices[i] >> 32))
+                    continue;
+
+                uint64_t index_new = ad_var_copy(indices[i]);
+                ad_mark_loop_boundary(index_new);
+                ad_var_dec_ref(indices[i]);
+                indices[i] = index_new;
+            }
+        }
 
-        size = size_next;
         write_cb(payload, indices, false);
-        indices.release();
+        if (!alive.valid())
+            indices.release();
 
         jit_log(LogLevel::InfoSym,
                 "ad_loop_evaluated(\"%s\"): executing loop iteration %zu.", name, ++it);
 
         // Execute the loop body
         {
-            scoped_push_mask guard(backend, (uint32_t) true_mask.index());
-            body_cb(payload);
+            scoped_push_mask guard(backend, (uint32_t) (alive.valid()
+                                                ? alive.index()
+                                                : true_mask.index()));
+            ad_loop_evaluated_body(batch, payload, body_cb);
         }
 
         active = JitVar::borrow(cond_cb(payload));
-        read_cb(payload, indices);
+
+        if (alive.valid()) {
+            // Finished entries remain in the loop state, preserve their values
+            index64_vector indices2;
+            read_cb(payload, indices2);
+
+            for (size_t i = 0; i < indices.size(); ++i) {
+                uint64_t i1 = indices[i], i2 = indices2[i];
+
+                if (skip[i] || i1 == i2 || jit_var_is_dirty((uint32_t) i2))
+                    continue;
+
+                indices2[i] = ad_var_select(alive.index(), i2, i1);
+                ad_var_dec_ref(i2);
+            }
+
+            indices.release();
+            indices.swap(indices2);
+            active &= alive;
+        } else {
+            read_cb(payload, indices);
+        }
     }
 
     if (it > 0)
@@ -421,11 +657,15 @@ ad_loop_evaluated_compress(JitBackend backend, const char *name, void *payload,
     return it;
 }
 
-static void ad_loop_evaluated(JitBackend backend, const char *name,
+/// Returns 'false' when LoopOp nodes took over ownership of the payload
+static bool ad_loop_evaluated(JitBackend backend, const char *name,
                               void *payload, ad_loop_read read_cb,
                               ad_loop_write write_cb,
                               ad_loop_cond cond_cb,
                               ad_loop_body body_cb,
+                              ad_loop_body inverse_cb,
+                              ad_loop_delete delete_cb,
+                              long long max_iterations, int checkpoint,
                               bool compress) {
     index64_vector indices;
 
@@ -458,18 +698,50 @@ static void ad_loop_evaluated(JitBackend backend, const char *name,
         compress = false;
     }
 
+    LoopBatch *batch = nullptr;
+    uint32_t batch_size = loop_batch_size;
+    if (batch_size > 1) {
+        batch = new LoopBatch();
+        batch->backend = backend;
+        batch->name = name;
+        batch->payload = payload;
+        batch->read_cb = read_cb;
+        batch->write_cb = write_cb;
+        batch->cond_cb = cond_cb;
+        batch->body_cb = body_cb;
+        batch->inverse_cb = inverse_cb;
+        batch->delete_cb = delete_cb;
+        batch->max_iterations = max_iterations;
+        batch->checkpoint = checkpoint;
+        batch->size = batch_size;
+    }
+
     size_t it;
-    if (compress)
-        it = ad_loop_evaluated_compress(backend, name, payload, read_cb,
-                                        write_cb, cond_cb, body_cb,
-                                        std::move(indices), std::move(active));
-    else
-        it = ad_loop_evaluated_mask(backend, name, payload, read_cb, write_cb,
-                                    cond_cb, body_cb, std::move(indices),
-                                    std::move(active));
+    try {
+        if (compress)
+            it = ad_loop_evaluated_compress(backend, name, payload, read_cb,
+                                            write_cb, cond_cb, body_cb, batch,
+                                            std::move(indices), std::move(active));
+        else
+            it = ad_loop_evaluated_mask(backend, name, payload, read_cb, write_cb,
+                                        cond_cb, body_cb, batch, std::move(indices),
+                                        std::move(active));
+    } catch (...) {
+        if (batch)
+            loop_batch_delete(batch);
+        throw;
+    }
+
+    bool owned = true;
+    if (batch) {
+        owned = !batch->transferred;
+        loop_batch_delete(batch);
+    }
 
     jit_log(LogLevel::Debug,
             "ad_loop_evaluated(\"%s\"): loop finished after %zu iterations.", name, it);
+
+    return owned;
 }
 
 /// CustomOp that hooks a recorded loop into the AD graph
@@ -477,14 +749,15 @@ struct LoopOp : public dr::detail::CustomOpBase {
 public:
     LoopOp(JitBackend backend, const char *name, void *payload,
            ad_loop_read read_cb, ad_loop_write write_cb, ad_loop_cond cond_cb,
-           ad_loop_body body_cb, ad_loop_delete delete_cb,
-           const index64_vector &state,
+           ad_loop_body body_cb, ad_loop_body inverse_cb,
+           ad_loop_delete delete_cb, const index64_vector &state,
            const dr::vector<uint32_t> &implicit_in,
-           long long max_iterations)
+           long long max_iterations, int checkpoint)
         : m_backend(backend), m_name(name), m_payload(payload),
           m_read_cb(read_cb), m_write_cb(write_cb), m_cond_cb(cond_cb),
-          m_body_cb(body_cb), m_delete_cb(delete_cb), m_diff_count(0),
-          m_max_iterations(max_iterations), m_reset(false) {
+          m_body_cb(body_cb), m_inverse_cb(inverse_cb), m_delete_cb(delete_cb),
+          m_diff_count(0), m_max_iterations(max_iterations),
+          m_checkpoint(checkpoint), m_reset(false) {
         m_name_op = "Loop: " + m_name;
 
         m_inputs.reserve(state.size());
@@ -643,7 +916,8 @@ public:
         m_state2.release();
     }
 
-    void forward() override {
+    /// Run the loop on the primal state and the current tangents of the inputs
+    void fwd_loop() {
         std::string fwd_name = m_name + " [ad, fwd]";
 
         m_state.release();
@@ -666,11 +940,29 @@ public:
         }
 
         ad_loop(
-            m_backend, 1, 0, 0, fwd_name.c_str(), this,
+            m_backend, 1, 0, 0, 1, 0, false, fwd_name.c_str(), this,
             [](void *p, dr::vector<uint64_t> &i) { ((LoopOp *) p)->read(i); },
             [](void *p, const dr::vector<uint64_t> &i, bool reset) { ((LoopOp *) p)->write(i, reset); },
             [](void *p) { return ((LoopOp *) p)->fwd_cond(); },
-            [](void *p) { return ((LoopOp *) p)->fwd_body(); }, nullptr, false);
+            [](void *p) { return ((LoopOp *) p)->fwd_body(); }, nullptr,
+            nullptr, false);
+    }
+
+    void forward() override {
+        if (fwd_fused_valid()) {
+            // The tangents were already computed along with the primal loop
+            for (size_t i = 0; i < m_inputs.size(); ++i) {
+                const Input &in = m_inputs[i];
+                if (!in.has_grad_out)
+                    continue;
+
+                ad_accum_grad(combine(m_output_indices[in.grad_out_offset]),
+                              m_fused_grad_out[in.grad_in_offset]);
+            }
+            return;
+        }
+
+        fwd_loop();
 
         for (size_t i = 0; i < m_inputs.size(); ++i) {
             const Input &in = m_inputs[i];
@@ -684,15 +976,67 @@ public:
         m_state.release();
     }
 
+    /* Fused forward mode: when the loop inputs already carry tangents at the
+       time when the loop is recorded, the function below records a single
+       loop that computes both the primal state and the tangents. Its primal
+       outputs replace those of the original loop (which is then never
+       compiled), and the tangents are cached until forward() is called. They
+       are only reused when the gradients of the inputs haven't changed in the
+       meantime. Otherwise, forward() re-runs the loop as usual. */
+
+    void forward_fused(const index64_vector &state_in, index64_vector &state_out) {
+        for (uint32_t index : m_input_indices)
+            m_fused_grad_in.push_back_steal(ad_grad(combine(index)));
+
+        fwd_loop();
+
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            // Only replace outputs that were actually changed by the loop
+            if ((uint32_t) state_in[i] == (uint32_t) state_out[i])
+                continue;
+            jit_var_inc_ref((uint32_t) m_state[i]);
+            ad_var_dec_ref(state_out[i]);
+            state_out[i] = (uint32_t) m_state[i];
+        }
+
+        for (size_t i = 0; i < m_diff_count; ++i)
+            m_fused_grad_out.push_back_borrow(
+                (uint32_t) m_state[m_inputs.size() + i]);
+
+        m_state.release();
+    }
+
+    bool fwd_fused_valid() {
+        if (m_fused_grad_out.size() == 0)
+            return false;
+
+        for (size_t i = 0; i < m_input_indices.size(); ++i) {
+            uint32_t prev = m_fused_grad_in[i],
+                     grad = ad_grad(combine(m_input_indices[i]));
+
+            bool same = grad == prev || (jit_var_is_zero_literal(grad) &&
+                                         jit_var_is_zero_literal(prev));
+            jit_var_dec_ref(grad);
+            if (!same)
+                return false;
+        }
+
+        return true;
+    }
+
     // -------------------------------------------------------------------
 
     void backward() override {
-        if (m_max_iterations == -1) {
+        if (m_inverse_cb) {
+            backward_inverse();
+        } else if (m_checkpoint > 0) {
+            backward_checkpoint();
+        } else if (m_max_iterations == -1) {
             backward_simple();
         } else {
             jit_raise("CustomOp::backward(): the reverse-mode derivative of a "
-                      "complex loop (with max_iterations != -1) is not yet "
-                      "implemented!");
+                      "complex loop (with max_iterations != -1) requires an "
+                      "inverse of the loop body or a checkpoint interval!");
         }
     }
 
@@ -812,11 +1156,12 @@ public:
         }
 
         ad_loop(
-            m_backend, 1, 0, 0, fwd_name.c_str(), this,
+            m_backend, 1, 0, 0, 1, 0, false, fwd_name.c_str(), this,
             [](void *p, dr::vector<uint64_t> &i) { ((LoopOp *) p)->read(i); },
             [](void *p, const dr::vector<uint64_t> &i, bool reset) { ((LoopOp *) p)->write(i, reset); },
             [](void *p) { return ((LoopOp *) p)->fwd_cond(); },
-            [](void *p) { return ((LoopOp *) p)->bwd_body_simple(); }, nullptr, false);
+            [](void *p) { return ((LoopOp *) p)->bwd_body_simple(); }, nullptr,
+            nullptr, false);
 
 
         size_t offset = m_inputs.size();
@@ -845,6 +1190,396 @@ public:
         m_state.release();
     }
 
+    // -------------------------------------------------------------------
+
+    /* The functions below differentiate general loops in reverse mode
+       without storing the loop state of every iteration. Both variants
+       first re-run the loop to determine the number of iterations 'count'
+       performed by each lane. The reverse-mode loop then uses the following
+       state layout in 'm_state':
+
+         [ primal state (n entries), gradients of the differentiable state
+           (m_diff_count entries), remaining iterations, <extra entries> ]
+
+       1. backward_inverse() (a.k.a. "path replay") reconstructs the state
+          preceding an iteration via the user-provided inverse of the body:
+
+            state, grad_state = <final state, output gradients>
+            while count > 0:
+                state = inverse(state)
+                dr.enable_grad(state)
+                grad_state = dr.backward_to(state, grad=body(state) * grad_state)
+                count -= 1
+
+          This requires O(state) memory.
+
+       2. backward_checkpoint() stores the loop state every K iterations
+          while re-running the loop. Each step of the reverse-mode loop then
+          either advances the state from the last checkpoint by one iteration
+          ('steps' > 0) or backpropagates through the iteration that produced
+          the current gradients. This requires O(state * iterations / K)
+          memory and O(K * iterations) evaluations of the loop body.
+     */
+
+    /// Run the loop body (or its inverse) on the primal state in 'm_state'.
+    /// Stores the resulting state in 'm_state2'.
+    void primal_step(ad_loop_body cb) {
+        m_state2.release();
+        for (size_t i = 0; i < m_inputs.size(); ++i)
+            m_state2.push_back_borrow((uint32_t) m_state[i]);
+
+        m_write_cb(m_payload, m_state2, true);
+        {
+            // Begin a recording session and abort it by not
+            // calling .disarm(). This suppresses side effects.
+            scoped_record record_guard(m_backend);
+
+            cb(m_payload);
+        }
+        m_state2.release();
+        m_read_cb(m_payload, m_state2);
+    }
+
+    /// Backpropagate 'grad_out' through one iteration of the loop body
+    /// evaluated at the primal state in 'm_state'. Returns the primal output
+    /// of the body via 'state_out' and the gradients of its differentiable
+    /// inputs via 'grad_in'.
+    void vjp_step(const index32_vector &grad_out, index32_vector &state_out,
+                  index32_vector &grad_in) {
+        m_state2.release();
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            uint64_t index;
+            if (m_inputs[i].is_diff)
+                index = ad_var_new((uint32_t) m_state[i]);
+            else
+                index = ad_var_inc_ref(m_state[i]);
+            m_state2.push_back_steal(index);
+        }
+
+        m_write_cb(m_payload, m_state2, true);
+        {
+            scoped_record record_guard(m_backend);
+            m_body_cb(m_payload);
+        }
+
+        index64_vector out;
+        m_read_cb(m_payload, out);
+
+        // AD backward propagation pass
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            const Input &in = m_inputs[i];
+            if (!in.is_diff)
+                continue;
+            ad_accum_grad(out[i], grad_out[in.grad_in_offset]);
+            ad_enqueue(dr::ADMode::Backward, out[i]);
+        }
+
+        ad_traverse(dr::ADMode::Backward, (uint32_t) dr::ADFlag::ClearNone);
+
+        for (size_t i = 0; i < m_inputs.size(); ++i)
+            state_out.push_back_borrow((uint32_t) out[i]);
+
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            if (m_inputs[i].is_diff)
+                grad_in.push_back_steal(ad_grad(m_state2[i]));
+        }
+
+        m_state2.release();
+    }
+
+    /// Number of entries processed by the loop
+    size_t width() const {
+        size_t result = 1;
+        for (const Input &in : m_inputs)
+            result = std::max(result, jit_var_size(in.index));
+        return result;
+    }
+
+    void count_body() {
+        size_t n = m_inputs.size();
+        JitVar ctr = JitVar::borrow((uint32_t) m_state[n]),
+               one = JitVar::steal(jit_var_u32(m_backend, 1));
+
+        if (!m_ckpt.empty()) {
+            // Store the loop state every 'm_checkpoint' iterations
+            JitVar k = JitVar::steal(jit_var_u32(m_backend, (uint32_t) m_checkpoint)),
+                   zero = JitVar::steal(jit_var_u32(m_backend, 0)),
+                   count = JitVar::steal(jit_var_u32(m_backend, m_ckpt_count)),
+                   slot = JitVar::steal(jit_var_div(ctr.index(), k.index())),
+                   rem = JitVar::steal(jit_var_mod(ctr.index(), k.index())),
+                   in_range = JitVar::steal(jit_var_lt(slot.index(), count.index())),
+                   active = JitVar::steal(jit_var_eq(rem.index(), zero.index())),
+                   offset = JitVar::steal(jit_var_add(m_ckpt_offset.index(), slot.index()));
+            active &= in_range;
+
+            for (size_t i = 0; i < n; ++i) {
+                uint32_t index = jit_var_scatter(
+                    m_ckpt[i], (uint32_t) m_state[i], offset.index(),
+                    active.index(), ReduceOp::Identity, ReduceMode::Permute);
+                jit_var_dec_ref(m_ckpt[i]);
+                m_ckpt[i] = index;
+            }
+        }
+
+        primal_step(m_body_cb);
+
+        index64_vector state;
+        for (size_t i = 0; i < n; ++i)
+            state.push_back_borrow((uint32_t) m_state2[i]);
+        state.push_back_steal(jit_var_add(ctr.index(), one.index()));
+        m_state2.release();
+        m_state.release();
+        m_state.swap(state);
+    }
+
+    /// Re-run the loop to determine the final state and iteration count
+    void count_iterations() {
+        std::string count_name = m_name + " [ad, bwd, count]";
+
+        uint32_t zero = 0;
+        m_state.release();
+        for (const Input &i : m_inputs)
+            m_state.push_back_borrow(i.index);
+        m_state.push_back_steal(
+            jit_var_literal(m_backend, VarType::UInt32, &zero, width()));
+
+        ad_loop(
+            m_backend, 1, 0, 0, 1, 0, false, count_name.c_str(), this,
+            [](void *p, dr::vector<uint64_t> &i) { ((LoopOp *) p)->read(i); },
+            [](void *p, const dr::vector<uint64_t> &i, bool reset) { ((LoopOp *) p)->write(i, reset); },
+            [](void *p) { return ((LoopOp *) p)->fwd_cond(); },
+            [](void *p) { return ((LoopOp *) p)->count_body(); }, nullptr,
+            nullptr, false);
+    }
+
+    /// Loop condition of the reverse-mode loops: iterations remain
+    uint32_t bwd_cond() {
+        JitVar zero = JitVar::steal(jit_var_u32(m_backend, 0));
+        m_active = JitVar::steal(jit_var_gt(
+            (uint32_t) m_state[m_inputs.size() + m_diff_count], zero.index()));
+        return m_active.index();
+    }
+
+    /// Create the state of the reverse-mode loop (without extra entries)
+    void bwd_init(const index32_vector &state, uint32_t count) {
+        index64_vector result;
+        for (uint32_t index : state)
+            result.push_back_borrow(index);
+
+        uint64_t zero = 0;
+        for (const Input &in : m_inputs) {
+            if (!in.is_diff)
+                continue;
+
+            uint32_t grad;
+            if (in.has_grad_out)
+                grad = ad_grad(combine(m_output_indices[in.grad_out_offset]));
+            else
+                grad = jit_var_literal(m_backend, jit_var_type(in.index), &zero);
+            result.push_back_steal(grad);
+        }
+        result.push_back_borrow(count);
+
+        m_state.release();
+        m_state.swap(result);
+    }
+
+    /// Propagate the gradients of the reverse-mode loop to the loop inputs
+    void bwd_finalize() {
+        for (const Input &in : m_inputs) {
+            if (!in.is_diff || !in.has_grad_in)
+                continue;
+
+            ad_accum_grad(combine(m_input_indices[in.grad_in_index]),
+                          (uint32_t) m_state[m_inputs.size() + in.grad_in_offset]);
+        }
+
+        m_state.release();
+        m_active = JitVar();
+    }
+
+    void bwd_body_inverse() {
+        size_t n = m_inputs.size(), d = m_diff_count;
+
+        // Step back to the state preceding the current iteration
+        primal_step(m_inverse_cb);
+
+        index64_vector state;
+        for (size_t i = 0; i < n; ++i)
+            state.push_back_borrow((uint32_t) m_state2[i]);
+        m_state2.release();
+        for (size_t i = 0; i < n; ++i)
+            std::swap(state[i], m_state[i]);
+
+        index32_vector grad_out, state_out, grad_in;
+        for (size_t i = 0; i < d; ++i)
+            grad_out.push_back_borrow((uint32_t) m_state[n + i]);
+        vjp_step(grad_out, state_out, grad_in);
+
+        // 'state' now holds the state following the iteration
+        state.release();
+        for (size_t i = 0; i < n; ++i)
+            state.push_back_borrow(m_state[i]);
+        for (size_t i = 0; i < d; ++i)
+            state.push_back_borrow(grad_in[i]);
+
+        JitVar one = JitVar::steal(jit_var_u32(m_backend, 1));
+        state.push_back_steal(
+            jit_var_sub((uint32_t) m_state[n + d], one.index()));
+
+        m_state.release();
+        m_state.swap(state);
+    }
+
+    void backward_inverse() {
+        std::string bwd_name = m_name + " [ad, bwd, inverse]";
+        size_t n = m_inputs.size();
+
+        count_iterations();
+
+        index32_vector state;
+        for (size_t i = 0; i < n; ++i)
+            state.push_back_borrow((uint32_t) m_state[i]);
+        JitVar count = JitVar::borrow((uint32_t) m_state[n]);
+        bwd_init(state, count.index());
+
+        ad_loop(
+            m_backend, 1, 0, 0, 1, 0, false, bwd_name.c_str(), this,
+            [](void *p, dr::vector<uint64_t> &i) { ((LoopOp *) p)->read(i); },
+            [](void *p, const dr::vector<uint64_t> &i, bool reset) { ((LoopOp *) p)->write(i, reset); },
+            [](void *p) { return ((LoopOp *) p)->bwd_cond(); },
+            [](void *p) { return ((LoopOp *) p)->bwd_body_inverse(); }, nullptr,
+            nullptr, false);
+
+        bwd_finalize();
+    }
+
+    /// Fetch the checkpoint preceding iteration 'it - 1' and the number of
+    /// iterations needed to reach it from there.
+    void ckpt_fetch(const JitVar &it, index32_vector &state, JitVar &steps) {
+        JitVar zero = JitVar::steal(jit_var_u32(m_backend, 0)),
+               one = JitVar::steal(jit_var_u32(m_backend, 1)),
+               k = JitVar::steal(jit_var_u32(m_backend, (uint32_t) m_checkpoint)),
+               valid = JitVar::steal(jit_var_gt(it.index(), zero.index())),
+               prev = JitVar::steal(jit_var_sub(it.index(), one.index()));
+        prev = JitVar::steal(jit_var_select(valid.index(), prev.index(), zero.index()));
+
+        JitVar slot = JitVar::steal(jit_var_div(prev.index(), k.index())),
+               offset = JitVar::steal(jit_var_add(m_ckpt_offset.index(), slot.index())),
+               true_mask = JitVar::steal(jit_var_bool(m_backend, true));
+        steps = JitVar::steal(jit_var_mod(prev.index(), k.index()));
+
+        for (uint32_t index : m_ckpt)
+            state.push_back_steal(
+                jit_var_gather(index, offset.index(), true_mask.index()));
+    }
+
+    void bwd_body_checkpoint() {
+        size_t n = m_inputs.size(), d = m_diff_count;
+        JitVar ctr = JitVar::borrow((uint32_t) m_state[n + d]),
+               steps = JitVar::borrow((uint32_t) m_state[n + d + 1]),
+               zero = JitVar::steal(jit_var_u32(m_backend, 0)),
+               one = JitVar::steal(jit_var_u32(m_backend, 1)),
+               replay = JitVar::steal(jit_var_gt(steps.index(), zero.index()));
+
+        // Entries that are still replaying don't backpropagate
+        uint64_t zero_f = 0;
+        index32_vector grad_out, state_out, grad_in;
+        for (const Input &in : m_inputs) {
+            if (!in.is_diff)
+                continue;
+            JitVar zero_g = JitVar::steal(
+                jit_var_literal(m_backend, jit_var_type(in.index), &zero_f));
+            grad_out.push_back_steal(jit_var_select(
+                replay.index(), zero_g.index(),
+                (uint32_t) m_state[n + in.grad_in_offset]));
+        }
+
+        vjp_step(grad_out, state_out, grad_in);
+
+        // Entries that backpropagated move on to the previous iteration
+        JitVar ctr_next = JitVar::steal(jit_var_sub(ctr.index(), one.index())),
+               steps_next;
+        index32_vector state_next;
+        ckpt_fetch(ctr_next, state_next, steps_next);
+
+        index64_vector state;
+        for (size_t i = 0; i < n; ++i)
+            state.push_back_steal(jit_var_select(replay.index(), state_out[i],
+                                                 state_next[i]));
+        for (size_t i = 0; i < d; ++i)
+            state.push_back_steal(jit_var_select(
+                replay.index(), (uint32_t) m_state[n + i], grad_in[i]));
+
+        JitVar steps_dec = JitVar::steal(jit_var_sub(steps.index(), one.index()));
+        state.push_back_steal(
+            jit_var_select(replay.index(), ctr.index(), ctr_next.index()));
+        state.push_back_steal(
+            jit_var_select(replay.index(), steps_dec.index(), steps_next.index()));
+
+        m_state.release();
+        m_state.swap(state);
+    }
+
+    void backward_checkpoint() {
+        std::string bwd_name = m_name + " [ad, bwd, checkpoint]";
+        size_t n = m_inputs.size(), w = width();
+
+        // Determine the number of checkpoints per entry
+        uint64_t max_iterations = (uint64_t) m_max_iterations;
+        if (m_max_iterations <= 0) {
+            count_iterations();
+            JitVar max_count = JitVar::steal(jit_var_reduce(
+                m_backend, VarType::UInt32, ReduceOp::Max, (uint32_t) m_state[n]));
+            uint32_t value = 0;
+            jit_var_read(max_count.index(), 0, &value);
+            max_iterations = value;
+            m_state.release();
+        }
+
+        uint64_t k = (uint64_t) m_checkpoint,
+                 ckpt_count = std::max((max_iterations + k - 1) / k, (uint64_t) 1);
+        if (ckpt_count * w > 0xFFFFFFFFull)
+            jit_raise("LoopOp::backward_checkpoint(): too many checkpoints, "
+                      "please increase the checkpoint interval!");
+        m_ckpt_count = (uint32_t) ckpt_count;
+
+        JitVar lanes = JitVar::steal(jit_var_counter(m_backend, w)),
+               scale = JitVar::steal(jit_var_u32(m_backend, m_ckpt_count));
+        m_ckpt_offset = JitVar::steal(jit_var_mul(lanes.index(), scale.index()));
+        m_ckpt_offset.schedule_();
+
+        uint64_t zero = 0;
+        for (const Input &in : m_inputs) {
+            JitVar buf = JitVar::steal(jit_var_literal(
+                m_backend, jit_var_type(in.index), &zero, ckpt_count * w));
+            buf.schedule_force_();
+            m_ckpt.push_back_borrow(buf.index());
+        }
+        jit_eval();
+
+        // Re-run the loop and store checkpoints
+        count_iterations();
+
+        JitVar count = JitVar::borrow((uint32_t) m_state[n]), steps;
+        index32_vector state;
+        ckpt_fetch(count, state, steps);
+        bwd_init(state, count.index());
+        m_state.push_back_borrow(steps.index());
+
+        ad_loop(
+            m_backend, 1, 0, 0, 1, 0, false, bwd_name.c_str(), this,
+            [](void *p, dr::vector<uint64_t> &i) { ((LoopOp *) p)->read(i); },
+            [](void *p, const dr::vector<uint64_t> &i, bool reset) { ((LoopOp *) p)->write(i, reset); },
+            [](void *p) { return ((LoopOp *) p)->bwd_cond(); },
+            [](void *p) { return ((LoopOp *) p)->bwd_body_checkpoint(); }, nullptr,
+            nullptr, false);
+
+        bwd_finalize();
+        m_ckpt.release();
+        m_ckpt_offset = JitVar();
+    }
+
 private:
     struct Input {
         uint32_t index;
@@ -872,6 +1607,7 @@ private:
     ad_loop_write m_write_cb;
     ad_loop_cond m_cond_cb;
     ad_loop_body m_body_cb;
+    ad_loop_body m_inverse_cb;
     ad_loop_delete m_delete_cb;
     /// Loop state of nested loop
     index64_vector m_state;
@@ -882,13 +1618,26 @@ private:
     // Offset of implicit indices in m_input_indices
     size_t m_implicit_in_offset;
     long long m_max_iterations;
+    /// Checkpoint interval of reverse-mode differentiation (0: disabled)
+    int m_checkpoint;
+    /// Input gradients and resulting tangents of a fused forward-mode loop
+    index32_vector m_fused_grad_in;
+    index32_vector m_fused_grad_out;
+    /// Loop condition of the reverse-mode loops below
+    JitVar m_active;
+    /// Checkpointed loop state and offset of each lane's checkpoints
+    index32_vector m_ckpt;
+    JitVar m_ckpt_offset;
+    uint32_t m_ckpt_count;
     bool m_reset;
 };
 
 bool ad_loop(JitBackend backend, int symbolic, int compress,
-             long long max_iterations, const char *name, void *payload,
-             ad_loop_read read_cb, ad_loop_write write_cb, ad_loop_cond cond_cb,
-             ad_loop_body body_cb, ad_loop_delete delete_cb, bool ad) {
+             long long max_iterations, int unroll, int checkpoint,
+             bool fwd_fused, const char *name, void *payload,
+             ad_loop_read read_cb, ad_loop_write write_cb,
+             ad_loop_cond cond_cb, ad_loop_body body_cb,
+             ad_loop_body inverse_cb, ad_loop_delete delete_cb, bool ad) {
     if (name == nullptr)
         name = "unnamed";
 
@@ -923,6 +1672,12 @@ bool ad_loop(JitBackend backend, int symbolic, int compress,
     if (max_iterations < -1)
         jit_raise("'max_iterations' must be >= -1.");
 
+    if (unroll < 1)
+        jit_raise("'unroll' must be >= 1.");
+
+    if (checkpoint < 0)
+        jit_raise("'checkpoint' must be >= 0.");
+
     if (symbolic) {
         index64_vector indices_in;
         read_cb(payload, indices_in);
@@ -931,7 +1686,8 @@ bool ad_loop(JitBackend backend, int symbolic, int compress,
         bool needs_ad;
         {
             needs_ad = ad_loop_symbolic(backend, name, payload, read_cb,
-                                        write_cb, cond_cb, body_cb, indices_in,
+                                        write_cb, cond_cb, body_cb, unroll,
+                                        indices_in,
                                         implicit_in, implicit_out);
         }
         needs_ad &= ad;
@@ -959,8 +1715,11 @@ bool ad_loop(JitBackend backend, int symbolic, int compress,
 
             nanobind::ref<LoopOp> op =
                 new LoopOp(backend, name, payload, read_cb, write_cb,
-                           cond_cb, body_cb, delete_cb, indices_in,
-                           implicit_in, max_iterations);
+                           cond_cb, body_cb, inverse_cb, delete_cb, indices_in,
+                           implicit_in, max_iterations, checkpoint);
+
+            if (fwd_fused)
+                op->forward_fused(indices_in, indices_out);
 
             for (size_t i = 0; i < indices_out.size(); ++i) {
                 VarType vt = jit_var_type((uint32_t) indices_out[i]);
@@ -1007,9 +1766,14 @@ bool ad_loop(JitBackend backend, int symbolic, int compress,
                       "evaluated loops, as well as their limitations.");
 
         scoped_isolation_guard guard;
-        ad_loop_evaluated(backend, name, payload, read_cb, write_cb,
-                          cond_cb, body_cb, compress);
+        bool owned = ad_loop_evaluated(backend, name, payload, read_cb,
+                                       write_cb, cond_cb, body_cb, inverse_cb,
+                                       delete_cb, max_iterations, checkpoint,
+                                       compress);
         guard.disarm();
+
+        if (!owned)
+            return false; // LoopOp will eventually call delete_cb()
     }
 
     return true; // Caller should directly call delete()
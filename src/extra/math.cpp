@@ -14,6 +14,7 @@
 #include <drjit/jit.h>
 #include <drjit/math.h>
 #include "common.h"
+#include <atomic>
 
 namespace dr = drjit;
 
@@ -26,6 +27,17 @@ using Float16 = GenericArray<dr::half>;
 using Float32 = GenericArray<float>;
 using Float64 = GenericArray<double>;
 
+/// Use lower-degree polynomial fits in half/single precision? (see ad_set_math_fast_approx())
+static std::atomic<bool> math_fast_approx { false };
+
+bool ad_math_fast_approx() { return math_fast_approx; }
+void ad_set_math_fast_approx(bool value) { math_fast_approx = value; }
+
+/// Evaluate the default or lower-accuracy version of a math function
+#define DR_MATH_TIER(name, Type, arg)                                          \
+    (math_fast_approx ? dr::name<Type, false, true>(arg)                       \
+                      : dr::name<Type, false>(arg))
+
 #define DEFINE_MATH_OP(name)                                                   \
     DRJIT_EXTRA_EXPORT uint32_t jit_var_##name(uint32_t i0) {                  \
         VarInfo info = jit_set_backend(i0);                                    \
@@ -103,7 +115,6 @@ DEFINE_MATH_OP(erf)
 DEFINE_MATH_OP_2(atan2)
 DEFINE_MATH_OP_2(ldexp)
 DEFINE_MATH_OP_PAIR(frexp)
-DEFINE_MATH_OP_PAIR(sincos)
 DEFINE_MATH_OP_PAIR(sincosh)
 
 // The operations below need special casing to use intrinsics on CUDA hardware
@@ -113,7 +124,7 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_exp(uint32_t i0) {
 
     switch (info.type) {
         case VarType::Float16:
-            return dr::exp<Float16, false>(Float16::borrow(i0)).release();
+            return DR_MATH_TIER(exp, Float16, Float16::borrow(i0)).release();
 
         case VarType::Float32:
             if (info.backend == JitBackend::CUDA) {
@@ -121,7 +132,7 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_exp(uint32_t i0) {
                 return jit_var_exp2_intrinsic(value.index());
             }
 
-            return dr::exp<Float32, false>(Float32::borrow(i0)).release();
+            return DR_MATH_TIER(exp, Float32, Float32::borrow(i0)).release();
 
         case VarType::Float64:
             return dr::exp<Float64, false>(Float64::borrow(i0)).release();
@@ -137,12 +148,12 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_exp2(uint32_t i0) {
 
     switch (info.type) {
         case VarType::Float16:
-            return dr::exp2<Float16, false>(Float16::borrow(i0)).release();
+            return DR_MATH_TIER(exp2, Float16, Float16::borrow(i0)).release();
 
         case VarType::Float32:
             if (info.backend == JitBackend::CUDA)
                 return jit_var_exp2_intrinsic(i0);
-            return dr::exp2<Float32, false>(Float32::borrow(i0)).release();
+            return DR_MATH_TIER(exp2, Float32, Float32::borrow(i0)).release();
 
         case VarType::Float64:
             return dr::exp2<Float64, false>(Float64::borrow(i0)).release();
@@ -158,13 +169,13 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_log(uint32_t i0) {
 
     switch (info.type) {
         case VarType::Float16:
-            return dr::log<Float16, false>(Float16::borrow(i0)).release();
+            return DR_MATH_TIER(log, Float16, Float16::borrow(i0)).release();
 
         case VarType::Float32:
             if (info.backend == JitBackend::CUDA)
                 return (Float32::steal(jit_var_log2_intrinsic(i0)) *
                         dr::LogTwo<float>).release();
-            return dr::log<Float32, false>(Float32::borrow(i0)).release();
+            return DR_MATH_TIER(log, Float32, Float32::borrow(i0)).release();
 
         case VarType::Float64:
             return dr::log<Float64, false>(Float64::borrow(i0)).release();
@@ -180,12 +191,12 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_log2(uint32_t i0) {
 
     switch (info.type) {
         case VarType::Float16:
-            return dr::log2<Float16, false>(Float16::borrow(i0)).release();
+            return DR_MATH_TIER(log2, Float16, Float16::borrow(i0)).release();
 
         case VarType::Float32:
             if (info.backend == JitBackend::CUDA)
                 return jit_var_log2_intrinsic(i0);
-            return dr::log2<Float32, false>(Float32::borrow(i0)).release();
+            return DR_MATH_TIER(log2, Float32, Float32::borrow(i0)).release();
 
         case VarType::Float64:
             return dr::log2<Float64, false>(Float64::borrow(i0)).release();
@@ -201,12 +212,12 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_sin(uint32_t i0) {
 
     switch (info.type) {
         case VarType::Float16:
-            return dr::sin<Float16, false>(Float16::borrow(i0)).release();
+            return DR_MATH_TIER(sin, Float16, Float16::borrow(i0)).release();
 
         case VarType::Float32:
             if (info.backend == JitBackend::CUDA)
                 return jit_var_sin_intrinsic(i0);
-            return dr::sin<Float32, false>(Float32::borrow(i0)).release();
+            return DR_MATH_TIER(sin, Float32, Float32::borrow(i0)).release();
 
         case VarType::Float64:
             return dr::sin<Float64, false>(Float64::borrow(i0)).release();
@@ -222,12 +233,12 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_cos(uint32_t i0) {
 
     switch (info.type) {
         case VarType::Float16:
-            return dr::cos<Float16, false>(Float16::borrow(i0)).release();
+            return DR_MATH_TIER(cos, Float16, Float16::borrow(i0)).release();
 
         case VarType::Float32:
             if (info.backend == JitBackend::CUDA)
                 return jit_var_cos_intrinsic(i0);
-            return dr::cos<Float32, false>(Float32::borrow(i0)).release();
+            return DR_MATH_TIER(cos, Float32, Float32::borrow(i0)).release();
 
         case VarType::Float64:
             return dr::cos<Float64, false>(Float64::borrow(i0)).release();
@@ -236,3 +247,28 @@ DRJIT_EXTRA_EXPORT uint32_t jit_var_cos(uint32_t i0) {
             return 0;
     }
 }
+
+DRJIT_EXTRA_EXPORT UInt32Pair jit_var_sincos(uint32_t i0) {
+    VarInfo info = jit_set_backend(i0);
+
+    switch (info.type) {
+        case VarType::Float16: {
+                auto [a, b] = DR_MATH_TIER(sincos, Float16, Float16::borrow(i0));
+                return { a.release(), b.release() };
+            }
+
+        case VarType::Float32: {
+                auto [a, b] = DR_MATH_TIER(sincos, Float32, Float32::borrow(i0));
+                return { a.release(), b.release() };
+            }
+
+        case VarType::Float64: {
+                auto [a, b] = dr::sincos<Float64, false>(Float64::borrow(i0));
+                return { a.release(), b.release() };
+            }
+
+        default:
+            jit_fail("jit_var_sincos(): invalid operand!");
+            return { 0, 0 };
+    }
+}
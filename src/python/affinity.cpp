@@ -0,0 +1,208 @@
+/*
+    affinity.cpp -- placement of the LLVM backend's worker threads onto
+    processor cores and NUMA nodes
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include "affinity.h"
+#include <nanothread/nanothread.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#  include <sched.h>
+#  include <pthread.h>
+#  include <cstdio>
+#  include <cstdlib>
+#endif
+
+/// Currently active policy ("none", "compact", or "numa")
+static std::string affinity_policy = "none";
+
+#if defined(__linux__)
+/// Affinity mask of the process before any worker was pinned
+static cpu_set_t affinity_process_mask;
+static bool affinity_process_mask_valid = false;
+
+/// Parse a Linux CPU list (e.g., "0-15,32-47")
+static std::vector<uint32_t> parse_cpu_list(const char *s) {
+    std::vector<uint32_t> result;
+    while (*s) {
+        char *end;
+        unsigned long start = strtoul(s, &end, 10), stop = start;
+        if (end == s)
+            break;
+        s = end;
+        if (*s == '-')
+            stop = strtoul(s + 1, (char **) &s, 10);
+        for (unsigned long i = start; i <= stop; ++i)
+            result.push_back((uint32_t) i);
+        while (*s == ',' || *s == '\n')
+            ++s;
+    }
+    return result;
+}
+
+/// Return the CPUs of each NUMA node that the process is allowed to use
+static std::vector<std::vector<uint32_t>> numa_nodes() {
+    std::vector<std::vector<uint32_t>> nodes;
+
+    for (uint32_t i = 0; ; ++i) {
+        char path[64], buf[4096];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", i);
+        FILE *f = fopen(path, "r");
+        if (!f)
+            break;
+        size_t size = fread(buf, 1, sizeof(buf) - 1, f);
+        fclose(f);
+        buf[size] = '\0';
+
+        std::vector<uint32_t> cpus;
+        for (uint32_t cpu : parse_cpu_list(buf)) {
+            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &affinity_process_mask))
+                cpus.push_back(cpu);
+        }
+        if (!cpus.empty())
+            nodes.push_back(std::move(cpus));
+    }
+
+    // Kernels without NUMA support: a single node containing all CPUs
+    if (nodes.empty()) {
+        nodes.emplace_back();
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &affinity_process_mask))
+                nodes[0].push_back(cpu);
+        }
+    }
+
+    return nodes;
+}
+
+struct AffinityContext {
+    std::vector<cpu_set_t> masks;
+    std::unique_ptr<std::atomic<bool>[]> pinned;
+    std::atomic<uint32_t> remaining;
+};
+
+static void affinity_pin_worker(uint32_t, void *payload) {
+    AffinityContext *ctx = (AffinityContext *) payload;
+    uint32_t id = pool_thread_id();
+
+    if (id >= 1 && id <= ctx->masks.size() && !ctx->pinned[id - 1].exchange(true)) {
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t),
+                               &ctx->masks[id - 1]);
+        ctx->remaining--;
+    }
+
+    // Linger briefly so that the other work units are claimed by other workers
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+}
+#endif
+
+/// Apply 'affinity_policy' to all current workers of the thread pool
+static void affinity_apply() {
+#if defined(__linux__)
+    if (!affinity_process_mask_valid) {
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &affinity_process_mask))
+            nb::raise("drjit.set_thread_affinity(): sched_getaffinity() failed!");
+        affinity_process_mask_valid = true;
+    }
+
+    uint32_t n = pool_size(nullptr);
+    if (n == 0)
+        return;
+
+    std::vector<std::vector<uint32_t>> nodes = numa_nodes();
+    std::vector<uint32_t> cpus;
+    for (const std::vector<uint32_t> &node : nodes)
+        cpus.insert(cpus.end(), node.begin(), node.end());
+
+    AffinityContext ctx;
+    ctx.masks.resize(n);
+    ctx.pinned.reset(new std::atomic<bool>[n]);
+    ctx.remaining = n;
+
+    for (uint32_t i = 0; i < n; ++i) {
+        cpu_set_t &mask = ctx.masks[i];
+        ctx.pinned[i] = false;
+
+        if (affinity_policy == "compact") {
+            // One core per worker, filling up one node after the other
+            CPU_ZERO(&mask);
+            CPU_SET(cpus[i % cpus.size()], &mask);
+        } else if (affinity_policy == "numa") {
+            // Contiguous groups of workers share the cores of a NUMA node
+            CPU_ZERO(&mask);
+            for (uint32_t cpu : nodes[(size_t) i * nodes.size() / n])
+                CPU_SET(cpu, &mask);
+        } else {
+            mask = affinity_process_mask;
+        }
+    }
+
+    // nanothread does not control which worker runs a work unit. Submit
+    // batches until every worker has processed one of them.
+    nb::gil_scoped_release guard;
+    for (uint32_t attempt = 0; attempt < 100 && ctx.remaining > 0; ++attempt)
+        task_wait_and_release(task_submit_dep(
+            nullptr, nullptr, 0, n, affinity_pin_worker, &ctx));
+#endif
+}
+
+static void set_thread_affinity(const std::string &policy) {
+    if (policy != "none" && policy != "compact" && policy != "numa")
+        nb::raise("drjit.set_thread_affinity(): 'policy' must equal \"none\", "
+                  "\"compact\", or \"numa\"!");
+
+#if !defined(__linux__)
+    if (policy != "none")
+        nb::raise("drjit.set_thread_affinity(): thread pinning is only "
+                  "supported on Linux!");
+#endif
+
+    if (policy == affinity_policy)
+        return;
+
+    affinity_policy = policy;
+    affinity_apply();
+}
+
+static std::vector<std::vector<uint32_t>> numa_node_cpus() {
+#if defined(__linux__)
+    if (!affinity_process_mask_valid) {
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &affinity_process_mask))
+            nb::raise("drjit.numa_nodes(): sched_getaffinity() failed!");
+        affinity_process_mask_valid = true;
+    }
+    return numa_nodes();
+#else
+    return { };
+#endif
+}
+
+void export_affinity(nb::module_ &m) {
+    m.def("thread_count", &jit_llvm_thread_count, doc_thread_count)
+     .def("set_thread_count",
+          [](uint32_t size) {
+              jit_llvm_set_thread_count(size);
+              // Newly created workers inherit the mask of the calling thread
+              if (affinity_policy != "none")
+                  affinity_apply();
+          }, "size"_a, doc_set_thread_count)
+     .def("thread_affinity", []() { return affinity_policy; },
+          doc_thread_affinity)
+     .def("set_thread_affinity", &set_thread_affinity, "policy"_a,
+          doc_set_thread_affinity)
+     .def("numa_nodes", &numa_node_cpus, doc_numa_nodes);
+}
@@ -0,0 +1,16 @@
+/*
+    affinity.h -- placement of the LLVM backend's worker threads onto
+    processor cores and NUMA nodes
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+#include "common.h"
+
+extern void export_affinity(nb::module_ &);
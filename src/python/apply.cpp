@@ -171,6 +171,25 @@ PyObject *apply(ArrayOp op, Slot slot, std::index_sequence<Is...> is,
     constexpr size_t N = sizeof...(Args);
 
     try {
+        // Fast path: operands of the same non-tensor type, whose operation
+        // has a native implementation, need no promotion or further dispatch
+        if constexpr (Mode == Normal) {
+            if ((o[Is].type().is(tp) && ...)) {
+                const ArraySupplement &s = supp(tp);
+                void *impl = s[op];
+
+                if (!s.is_tensor && impl != DRJIT_OP_DEFAULT &&
+                    impl != DRJIT_OP_NOT_IMPLEMENTED) {
+                    using Impl = void (*)(first_t<const ArrayBase *, Args>...,
+                                          ArrayBase *);
+                    nb::object result = nb::inst_alloc(tp);
+                    ((Impl) impl)(inst_ptr(o[Is])..., inst_ptr(result));
+                    nb::inst_mark_ready(result);
+                    return result.release().ptr();
+                }
+            }
+        }
+
         // All arguments must first be promoted to the same type
         if (!(o[Is].type().is(tp) && ...)) {
             promote(o, sizeof...(Args), Mode == Select);
@@ -364,9 +383,31 @@ void tensor_broadcast(nb::object &tensor, nb::object &array,
     // At this point, we know that shape_src.size() == shape_dst.size()
     // See apply_tensor for details.
 
+    /* Merge adjacent axes that are either all broadcast or all kept, e.g.
+       (1, 1, 3) -> (H, W, 3) only involves two groups of sizes H*W and 3.
+       This reduces the number of index operations to at most one per group. */
+    vector<size_t> group_size;
+    vector<bool> group_bcast;
     size_t size = 1;
-    for (size_t i = 0; i < ndim; ++i)
+
+    for (size_t i = 0; i < ndim; ++i) {
+        if (shape_dst[i] == 1)
+            continue;
+        bool bcast = shape_src[i] == 1;
+        if (!group_size.empty() && group_bcast[group_bcast.size() - 1] == bcast)
+            group_size[group_size.size() - 1] *= shape_dst[i];
+        else {
+            group_size.push_back(shape_dst[i]);
+            group_bcast.push_back(bcast);
+        }
         size *= shape_dst[i];
+    }
+
+    size_t ngroups = group_size.size();
+
+    // A single-element operand is broadcast implicitly by the JIT
+    if (ngroups == 1 && group_bcast[0])
+        return;
 
     nb::handle tp = tensor.type();
     const ArraySupplement &s = supp(tp);
@@ -374,19 +415,26 @@ void tensor_broadcast(nb::object &tensor, nb::object &array,
     nb::type_object_t<ArrayBase> index_type =
         nb::borrow<nb::type_object_t<ArrayBase>>(s.tensor_index);
 
-    nb::object index  = arange(index_type, 0, (Py_ssize_t) size, 1),
-               size_o = index_type(size);
-
-    for (size_t i = 0; i < ndim; ++i) {
-        size_t size_next = size / shape_dst[i];
+    nb::object index = arange(index_type, 0, (Py_ssize_t) size, 1);
 
-        nb::object size_next_o = index_type(size_next);
+    for (size_t i = 0; i < ngroups; ++i) {
+        size_t size_next = size / group_size[i];
 
-        if (shape_src[i] == 1 && shape_dst[i] != 1)
-            index = (index % size_next_o) + index.floor_div(size_o) * size_next_o;
+        if (group_bcast[i]) {
+            if (i == 0) {
+                // 'index' is smaller than 'size'
+                index = index % index_type(size_next);
+            } else if (i == ngroups - 1) {
+                // 'size_next' equals 1
+                index = index.floor_div(index_type(size));
+            } else {
+                nb::object size_next_o = index_type(size_next);
+                index = (index % size_next_o) +
+                        index.floor_div(index_type(size)) * size_next_o;
+            }
+        }
 
         size = size_next;
-        size_o = std::move(size_next_o);
     }
 
     array = gather(nb::borrow<nb::type_object>(array.type()),
@@ -628,7 +676,11 @@ void traverse(const char *op, TraverseCallback &tc, nb::handle h) {
             for (nb::handle h2 : nb::borrow<nb::dict>(h).values())
                 traverse(op, tc, h2);
         } else {
-            if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
+            if (const dr::detail::TraverseCallbacks *cb = get_traverse_cb_native(tp); cb) {
+                cb->ro(h.ptr(), &tc, [](void *p, uint64_t index) {
+                    (*(TraverseCallback *) p)(index);
+                });
+            } else if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
                 for (auto [k, v] : ds)
                     traverse(op, tc, nb::getattr(h, k));
             } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
@@ -882,7 +934,16 @@ nb::object transform(const char *op, TransformCallback &tc, nb::handle h) {
                 tmp[k] = transform(op, tc, v);
             result = std::move(tmp);
         } else {
-            if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
+            if (const dr::detail::TraverseCallbacks *cb = get_traverse_cb_native(tp); cb) {
+                // Update a copy, or the instance itself (reference semantics)
+                PyObject *copy = cb->copy(h.ptr());
+                if (!copy && PyErr_Occurred())
+                    nb::raise_python_error();
+                result = copy ? nb::steal(copy) : nb::borrow(h);
+                cb->rw(result.ptr(), &tc, [](void *p, uint64_t index) {
+                    return (*(TransformCallback *) p)(index);
+                });
+            } else if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
                 nb::object tmp = tp();
                 for (auto [k, v] : ds)
                     nb::setattr(tmp, k, transform(op, tc, nb::getattr(h, k)));
@@ -11,11 +11,14 @@
 #include <drjit/autodiff.h>
 #include <drjit/custom.h>
 #include <nanobind/trampoline.h>
+#include <nanobind/stl/optional.h>
+#include <tsl/robin_map.h>
 #include "autodiff.h"
 #include "apply.h"
 #include "meta.h"
 #include "init.h"
 #include "base.h"
+#include "profile.h"
 
 static void set_grad_enabled(nb::handle h, bool enable_) {
     struct SetGradEnabled : TraverseCallback {
@@ -178,6 +181,41 @@ nb::object grad(nb::handle h, bool preserve_type_) {
     return transform("drjit.grad", g, h);
 }
 
+static nb::list grad_sparse(nb::handle_t<dr::ArrayBase> h) {
+    nb::handle tp = h.type();
+    const ArraySupplement &s = supp(tp);
+
+    if (s.ndim != 1 || !s.is_diff || !is_float(s))
+        nb::raise("drjit.grad_sparse(): expected a differentiable flat "
+                  "floating point array (e.g., 'drjit.cuda.ad.Float').");
+
+    ArrayMeta m = s;
+    m.is_diff = false;
+    nb::handle value_tp = meta_get_type(m);
+    m.type = (uint16_t) VarType::UInt32;
+    nb::handle index_tp = meta_get_type(m);
+    m.type = (uint16_t) VarType::Bool;
+    nb::handle mask_tp = meta_get_type(m);
+
+    dr::vector<uint32_t> indices;
+    ad_grad_sparse(s.index(inst_ptr(h)), indices);
+
+    nb::handle types[3] = { index_tp, value_tp, mask_tp };
+    nb::list result;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        nb::object entry[3];
+        for (size_t j = 0; j < 3; ++j) {
+            entry[j] = nb::inst_alloc(types[j]);
+            supp(types[j]).init_index(indices[i + j], inst_ptr(entry[j]));
+            nb::inst_mark_ready(entry[j]);
+            jit_var_dec_ref(indices[i + j]);
+        }
+        result.append(nb::make_tuple(entry[0], entry[1], entry[2]));
+    }
+
+    return result;
+}
+
 static void clear_grad(nb::handle dst) {
     struct ClearGrad : TraverseCallback {
         void operator()(nb::handle h) override {
@@ -190,6 +228,22 @@ static void clear_grad(nb::handle dst) {
     traverse("drjit.clear_grad", cg, dst);
 }
 
+static void set_grad_type(nb::handle h, std::optional<VarType> type_) {
+    struct SetGradType : TraverseCallback {
+        VarType type;
+        SetGradType(VarType type) : type(type) { }
+
+        void operator()(nb::handle h) override {
+            const ArraySupplement &s = supp(h.type());
+            if (s.is_diff && is_float(s))
+                ad_var_set_grad_type(s.index(inst_ptr(h)), type);
+        }
+    };
+
+    SetGradType sgt(type_.value_or(VarType::Void));
+    traverse("drjit.set_grad_type", sgt, h);
+}
+
 static void accum_grad(nb::handle target, nb::handle source) {
     struct SetGrad : TraversePairCallback {
         void operator()(nb::handle h1, nb::handle h2) override {
@@ -304,6 +358,7 @@ static void forward_from(nb::handle_t<dr::ArrayBase> h, uint32_t flags) {
         ::clear_grad(h);
         ::accum_grad(h, full("ones", at, nb::int_(1), 1));
         enqueue_impl(dr::ADMode::Forward, h);
+        trace_span span("drjit.forward_from", "ad_traverse");
         nb::gil_scoped_release r;
         ad_traverse(dr::ADMode::Forward, flags);
     }
@@ -318,6 +373,7 @@ static void backward_from(nb::handle_t<dr::ArrayBase> h, uint32_t flags) {
         ::clear_grad(h);
         ::accum_grad(h, full("ones", at, nb::int_(1), 1));
         enqueue_impl(dr::ADMode::Backward, h);
+        trace_span span("drjit.backward_from", "ad_traverse");
         nb::gil_scoped_release r;
         ad_traverse(dr::ADMode::Backward, flags);
     }
@@ -326,6 +382,7 @@ static void backward_from(nb::handle_t<dr::ArrayBase> h, uint32_t flags) {
 static nb::object forward_to(nb::handle h, uint32_t flags) {
     if (check_grad_enabled("drjit.forward_to", h, flags)) {
         enqueue_impl(dr::ADMode::Backward, h);
+        trace_span span("drjit.forward_to", "ad_traverse");
         nb::gil_scoped_release r;
         ad_traverse(dr::ADMode::Forward, flags);
     }
@@ -335,6 +392,7 @@ static nb::object forward_to(nb::handle h, uint32_t flags) {
 static nb::object backward_to(nb::handle h, uint32_t flags) {
     if (check_grad_enabled("drjit.backward_to", h, flags)) {
         enqueue_impl(dr::ADMode::Forward, h);
+        trace_span span("drjit.backward_to", "ad_traverse");
         nb::gil_scoped_release r;
         ad_traverse(dr::ADMode::Backward, flags);
     }
@@ -494,47 +552,103 @@ private:
 // Cache the value of 'inspect.CO_VARARGS'
 static size_t co_varargs = 0, co_varkeywords = 0;
 
+/// Parameter layout of a ``CustomOp.eval()`` implementation
+struct CustomOpLayout {
+    /// The (unbound) 'eval' function that this layout was computed from
+    nb::object eval;
+
+    /// Names of ordinary parameters, excluding 'self'
+    dr::vector<nb::object> names;
+
+    /// Names of the '*args' and '**kwargs' parameters, if present
+    nb::object varargs, varkw;
+};
+
+/**
+ * Inspecting the signature of 'eval()' via its code object requires a number
+ * of attribute lookups and allocations that can dominate the cost of custom
+ * operations on small arrays. It is therefore only done once per class. The
+ * table intentionally leaks, and it holds a reference to each class so that
+ * its address cannot be reused.
+ */
+static const CustomOpLayout &custom_op_layout(nb::handle cls) {
+    static auto *layouts =
+        new tsl::robin_map<PyObject *, dr::unique_ptr<CustomOpLayout>>();
+
+    nb::object eval_func = cls.attr("eval");
+
+    auto it = layouts->find(cls.ptr());
+    if (it != layouts->end() && it->second->eval.is(eval_func))
+        return *it->second;
+
+    dr::unique_ptr<CustomOpLayout> layout(new CustomOpLayout());
+    layout->eval = eval_func;
+
+    // Unimplemented 'eval()', raise an error message when it is called
+    if (!nb::hasattr(eval_func, "__code__")) {
+        static CustomOpLayout *fallback = new CustomOpLayout();
+        fallback->eval = eval_func;
+        return *fallback;
+    }
+
+    // The following is based on the implementation of inspect.getargs
+    nb::object co = eval_func.attr("__code__"),
+               co_varnames = co.attr("co_varnames");
+
+    size_t co_argc  = nb::cast<size_t>(co.attr("co_argcount")),
+           co_flags = nb::cast<size_t>(co.attr("co_flags")),
+           co_arg_pos = co_argc;
+
+    for (size_t i = 1 /* skip 'self' */; i < co_argc; ++i)
+        layout->names.push_back(co_varnames[i]);
+
+    if (co_flags & co_varargs)
+        layout->varargs = co_varnames[co_arg_pos++];
+
+    if (co_flags & co_varkeywords)
+        layout->varkw = co_varnames[co_arg_pos++];
+
+    if (it == layouts->end())
+        cls.inc_ref();
+
+    CustomOpLayout &result = *layout;
+    (*layouts)[cls.ptr()] = std::move(layout);
+    return result;
+}
+
 nb::object custom(nb::type_object_t<PyCustomOp> cls, nb::args args, nb::kwargs kwargs) {
     try {
+        const CustomOpLayout &layout = custom_op_layout(cls);
         nb::object op = cls();
 
-        nb::object eval_func = op.attr("eval"),
-                   output = eval_func(*detach(args), **detach(kwargs));
+        // Call the unbound function to skip the creation of a bound method
+        nb::object output = layout.eval(op, *detach(args), **detach(kwargs));
 
         // Ensure that the output is registered with the AD layer without depending
         // on previous computation. That dependence is reintroduced later below.
         output = new_grad(output);
 
-        // The following is based on the implementation of inspect.getargs
-        nb::object co = eval_func.attr("__code__"),
-                   co_varnames = co.attr("co_varnames");
-
-        size_t co_argc  = nb::cast<size_t>(co.attr("co_argcount")),
-               co_flags = nb::cast<size_t>(co.attr("co_flags")),
-               argc = nb::len(args);
-
+        size_t argc = nb::len(args), names = layout.names.size();
         nb::dict inputs;
 
         // Extract ordinary arguments specified using positional or keyword syntax
-        for (size_t i = 1 /* skip 'self' */; i < co_argc; ++i) {
-            nb::object key = co_varnames[i];
-            if (i - 1 < argc) {
-                inputs[key] = args[i - 1];
+        for (size_t i = 0; i < names; ++i) {
+            nb::handle key = layout.names[i];
+            if (i < argc) {
+                inputs[key] = args[i];
             } else if (kwargs.contains(key)) {
                 inputs[key] = kwargs[key];
                 nb::del(kwargs[key]);
             }
         }
 
-        size_t co_arg_pos = co_argc;
-
         // Extract variable-length positional arguments
-        if (co_flags & co_varargs)
-            inputs[co_varnames[co_arg_pos++]] = nb::handle(args)[nb::slice(co_argc - 1, argc)];
+        if (layout.varargs.is_valid())
+            inputs[layout.varargs] = nb::handle(args)[nb::slice(names, argc)];
 
         // Extract variable-length keyword arguments
-        if (co_flags & co_varkeywords)
-            inputs[co_varnames[co_arg_pos++]] = kwargs;
+        if (layout.varkw.is_valid())
+            inputs[layout.varkw] = kwargs;
 
         PyCustomOp *op_cpp = nb::cast<PyCustomOp *>(op);
         op_cpp->set_input(inputs);
@@ -576,6 +690,10 @@ void export_autodiff(nb::module_ &m) {
         .value("ClearInterior", dr::ADFlag::ClearInterior, doc_ADFlag_ClearInterior)
         .value("ClearVertices", dr::ADFlag::ClearVertices, doc_ADFlag_ClearVertices)
         .value("AllowNoGrad", dr::ADFlag::AllowNoGrad, doc_ADFlag_AllowNoGrad)
+        .value("LevelSchedule", dr::ADFlag::LevelSchedule, doc_ADFlag_LevelSchedule)
+        .value("CachePlan", dr::ADFlag::CachePlan, doc_ADFlag_CachePlan)
+        .value("SparseGrad", dr::ADFlag::SparseGrad, doc_ADFlag_SparseGrad)
+        .value("PruneDead", dr::ADFlag::PruneDead, doc_ADFlag_PruneDead)
         .value("Default", dr::ADFlag::Default, doc_ADFlag_Default);
 
     m.def("set_grad_enabled", &set_grad_enabled, doc_set_grad_enabled)
@@ -590,10 +708,13 @@ void export_autodiff(nb::module_ &m) {
      .def("accum_grad", &::accum_grad, "target"_a, "source"_a, doc_accum_grad,
           nb::sig("def accum_grad(target: T, source: T) -> None"))
      .def("clear_grad", &::clear_grad, doc_clear_grad)
+     .def("set_grad_type", &::set_grad_type, "arg"_a, "type"_a.none(),
+          doc_set_grad_type)
      .def("replace_grad", &::replace_grad, doc_replace_grad,
           nb::sig("def replace_grad(arg0: T, arg1: T, /) -> None"))
      .def("grad", &::grad, "arg"_a, "preserve_type"_a = true, doc_grad,
           nb::sig("def grad(arg: T, preserve_type: bool = True) -> T"))
+     .def("grad_sparse", &::grad_sparse, "arg"_a, doc_grad_sparse)
      .def("detach", &::detach, "arg"_a, "preserve_type"_a = true, doc_detach,
           nb::sig("def detach(arg: T, preserve_type: bool = True) -> T"))
      .def("enqueue", &enqueue_impl, "mode"_a, "arg"_a, doc_enqueue)
@@ -601,7 +722,11 @@ void export_autodiff(nb::module_ &m) {
           [](dr::ADMode mode, nb::args args) {
               enqueue_impl(mode, args);
           }, "mode"_a, "args"_a)
-     .def("traverse", &ad_traverse, "mode"_a, "flags"_a = dr::ADFlag::Default, doc_traverse,
+     .def("traverse",
+          [](dr::ADMode mode, uint32_t flags) {
+              trace_span span("drjit.traverse", "ad_traverse");
+              ad_traverse(mode, flags);
+          }, "mode"_a, "flags"_a = dr::ADFlag::Default, doc_traverse,
           nb::sig("def traverse(mode: drjit.ADMode, flags: drjit.ADFlag | int = drjit.ADFlag.Default) -> None"))
      .def("forward_from", &::forward_from, "arg"_a, "flags"_a = dr::ADFlag::Default, doc_forward_from,
           nb::sig("def forward_from(arg: drjit.AnyArray, flags: drjit.ADFlag | int = drjit.ADFlag.Default) -> None"))
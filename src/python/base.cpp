@@ -39,10 +39,68 @@
                               h0, h1);                                         \
     }
 
+/**
+ * \brief Coarse classification of the arguments of functions that accept both
+ * Dr.Jit arrays and builtin Python numbers (e.g., ``dr.fma()``).
+ *
+ * These functions examine the tag once to select an implementation instead of
+ * having nanobind try a chain of overloads with casts between the attempts.
+ * Arguments of other types (e.g., NumPy scalars) are forwarded to the
+ * remaining overloads, which perform the needed implicit conversions.
+ */
+enum class ArgKind : uint8_t { Int, Float, Other, Array };
+
+static ArgKind arg_kind(nb::handle h) {
+    PyTypeObject *tp = (PyTypeObject *) h.type().ptr();
+    if (tp == &PyFloat_Type)
+        return ArgKind::Float;
+    else if (tp == &PyLong_Type || tp == &PyBool_Type)
+        return ArgKind::Int;
+    else if (is_drjit_type(tp))
+        return ArgKind::Array;
+    else if (PyFloat_Check(h.ptr()))
+        return ArgKind::Float;
+    else if (PyLong_Check(h.ptr()))
+        return ArgKind::Int;
+    else
+        return ArgKind::Other;
+}
+
+/// Combined tag of several arguments (arrays take precedence)
+template <typename... Ts> ArgKind arg_kind(nb::handle h, Ts... hs) {
+    ArgKind k0 = arg_kind(h), k1 = arg_kind(hs...);
+    return k0 > k1 ? k0 : k1;
+}
+
+/// Convert builtin Python numbers (returns 'false' upon overflow)
+static bool arg_double(nb::handle h, double &out) {
+    out = PyFloat_AsDouble(h.ptr());
+    if (NB_UNLIKELY(out == -1.0 && PyErr_Occurred())) {
+        PyErr_Clear();
+        return false;
+    }
+    return true;
+}
+
+static bool arg_ssize(nb::handle h, Py_ssize_t &out) {
+    out = PyLong_AsSsize_t(h.ptr());
+    if (NB_UNLIKELY(out == -1 && PyErr_Occurred())) {
+        PyErr_Clear();
+        return false;
+    }
+    return true;
+}
+
 #define DR_MATH_UNOP(name, op)                                                 \
-    m.def(#name, [](nb::handle_t<ArrayBase> h0) {                              \
-        return nb::steal(apply<Normal>(                                        \
-            op, #name, std::make_index_sequence<1>(), h0.ptr()));              \
+    m.def(#name, [](nb::handle h0) {                                           \
+        ArgKind k = arg_kind(h0);                                              \
+        double v0;                                                             \
+        if (k == ArgKind::Array)                                               \
+            return nb::steal(apply<Normal>(                                    \
+                op, #name, std::make_index_sequence<1>(), h0.ptr()));          \
+        else if (k != ArgKind::Other && arg_double(h0, v0))                    \
+            return nb::steal(PyFloat_FromDouble(dr::name(v0)));                \
+        return nb::steal(NB_NEXT_OVERLOAD);                                    \
     }, doc_##name, nb::sig("def " #name "(arg: ArrayT, /) -> ArrayT"));        \
     m.def(#name, [](double v0) { return dr::name(v0); });
 
@@ -65,11 +123,36 @@
 
 #define DR_MATH_BINOP(name, op)                                                \
     m.def(#name, [](nb::handle h0, nb::handle h1) {                            \
-        if (NB_UNLIKELY(!is_drjit_array(h0) && !is_drjit_array(h1)))           \
-            return nb::steal(NB_NEXT_OVERLOAD);                                \
-        return nb::steal(apply<Normal>(                                        \
-            op, #name, std::make_index_sequence<2>(), h0.ptr(), h1.ptr()));    \
+        ArgKind k = arg_kind(h0, h1);                                          \
+        double v0, v1;                                                         \
+        if (k == ArgKind::Array)                                               \
+            return nb::steal(apply<Normal>(                                    \
+                op, #name, std::make_index_sequence<2>(), h0.ptr(), h1.ptr()));\
+        else if (k != ArgKind::Other && arg_double(h0, v0) &&                  \
+                 arg_double(h1, v1))                                           \
+            return nb::steal(PyFloat_FromDouble(dr::name(v0, v1)));            \
+        return nb::steal(NB_NEXT_OVERLOAD);                                    \
+    }, doc_##name);                                                            \
+    m.def(#name, [](double v0, double v1) { return dr::name(v0, v1); });
+
+/// Like DR_MATH_BINOP, but integer arguments produce an integer result
+#define DR_MATH_BINOP_INT(name, op)                                            \
+    m.def(#name, [](nb::handle h0, nb::handle h1) {                            \
+        ArgKind k = arg_kind(h0, h1);                                          \
+        Py_ssize_t i0, i1;                                                     \
+        double v0, v1;                                                         \
+        if (k == ArgKind::Array)                                               \
+            return nb::steal(apply<Normal>(                                    \
+                op, #name, std::make_index_sequence<2>(), h0.ptr(), h1.ptr()));\
+        else if (k == ArgKind::Int && arg_ssize(h0, i0) && arg_ssize(h1, i1))  \
+            return nb::steal(PyLong_FromSsize_t(dr::name(i0, i1)));            \
+        else if (k != ArgKind::Other && arg_double(h0, v0) &&                  \
+                 arg_double(h1, v1))                                           \
+            return nb::steal(PyFloat_FromDouble(dr::name(v0, v1)));            \
+        return nb::steal(NB_NEXT_OVERLOAD);                                    \
     }, doc_##name);                                                            \
+    m.def(#name,                                                               \
+          [](Py_ssize_t a, Py_ssize_t b) { return dr::name(a, b); });          \
     m.def(#name, [](double v0, double v1) { return dr::name(v0, v1); });
 
 nb::handle array_module;
@@ -737,13 +820,10 @@ nb::object matmul(nb::handle h0, nb::handle h1) {
         if (d0 && d1) {
             const ArraySupplement &s0 = supp(tp0), &s1 = supp(tp1);
 
+            // Tensor products are handled by a separate Python implementation
             if (s0.is_tensor || s1.is_tensor)
-                nb::raise(
-                    "this operation only handles fixed-sizes arrays. A different "
-                    "approach is needed for multiplications involving potentially "
-                    "large dynamic arrays/tensors. Other other tools like PyTorch, "
-                    "JAX, or Tensorflow will be preferable in such situations "
-                    "(e.g., to train neural networks");
+                return nb::module_::import_("drjit._matmul")
+                    .attr("tensor_matmul")(h0, h1);
 
             if (s0.is_complex || s1.is_complex || s0.is_quaternion || s1.is_quaternion)
                 nb::raise("complex/quaternion-valued inputs not supported.");
@@ -1001,9 +1081,45 @@ nb::handle DR_STR(_traverse_write);
 nb::handle DR_STR(_traverse_read);
 nb::handle DR_STR(_traverse_1_cb_rw);
 nb::handle DR_STR(_traverse_1_cb_ro);
+nb::handle DR_STR(_traverse_1_cb_native);
 nb::handle DR_STR(typing);
 nb::handle DR_STR(get_type_hints);
 
+/// Maps the address of dataclass types to a (weak reference, fields) pair
+static nb::handle dataclass_fields_cache;
+
+nb::object get_dataclass_fields(nb::handle tp) {
+    nb::object result = nb::getattr(tp, DR_STR(__dataclass_fields__), nb::handle());
+    if (!result.is_valid())
+        return result;
+
+    // dataclasses.fields() and typing.get_type_hints() are expensive, and
+    // PyTree traversals query them at every call. Reuse the previous result.
+    nb::int_ key((uintptr_t) tp.ptr());
+    PyObject *entry = PyDict_GetItem(dataclass_fields_cache.ptr(), key.ptr());
+    if (entry)
+        return nb::borrow<nb::tuple>(entry)[1];
+
+    result = nb::module_::import_(DR_STR(dataclasses)).attr(DR_STR(fields))(tp);
+
+    // Handle postponed type information
+    nb::object hints = nb::module_::import_(DR_STR(typing)).attr(DR_STR(get_type_hints))(tp);
+    for (auto field : result) {
+        nb::object field_type = field.attr(DR_STR(type));
+        if (field_type.type().is(&PyUnicode_Type))
+            field.attr(DR_STR(type)) = hints[field.attr(DR_STR(name))];
+    }
+
+    // Drop the entry once the type is garbage collected
+    nb::weakref wr(tp, nb::cpp_function([key](nb::handle) {
+        if (PyDict_DelItem(dataclass_fields_cache.ptr(), key.ptr()))
+            PyErr_Clear();
+    }));
+
+    nb::borrow<nb::dict>(dataclass_fields_cache)[key] = nb::make_tuple(wr, result);
+    return result;
+}
+
 void export_base(nb::module_ &m) {
     // Create interned strings for a few very commonly used identifiers. This
     // cannot be done statically as the GIL might not have been acquired.
@@ -1017,8 +1133,10 @@ void export_base(nb::module_ &m) {
     DR_STR(_traverse_read) = PyUnicode_InternFromString("_traverse_read");
     DR_STR(_traverse_1_cb_rw) = PyUnicode_InternFromString("_traverse_1_cb_rw");
     DR_STR(_traverse_1_cb_ro) = PyUnicode_InternFromString("_traverse_1_cb_ro");
+    DR_STR(_traverse_1_cb_native) = PyUnicode_InternFromString("_traverse_1_cb_native");
     DR_STR(typing) = PyUnicode_InternFromString("typing");
     DR_STR(get_type_hints) = PyUnicode_InternFromString("get_type_hints");
+    dataclass_fields_cache = PyDict_New();
 
     // Generic type variable used in many places
     for (const char *name :
@@ -1167,8 +1285,16 @@ void export_base(nb::module_ &m) {
         doc_ArrayBase_index_ad);
 
     m.def("abs",
-          [](nb::handle_t<ArrayBase> h0) {
-              return nb::steal(nb_absolute(h0.ptr()));
+          [](nb::handle h0) {
+              switch (arg_kind(h0)) {
+                  case ArgKind::Array:
+                      return nb::steal(nb_absolute(h0.ptr()));
+                  case ArgKind::Int:
+                  case ArgKind::Float:
+                      return nb::steal(PyNumber_Absolute(h0.ptr()));
+                  default:
+                      return nb::steal(NB_NEXT_OVERLOAD);
+              }
           }, doc_abs,
           nb::sig("def abs(arg: ArrayT, /) -> ArrayT"))
      .def("abs", [](Py_ssize_t v) { return dr::abs(v); })
@@ -1222,17 +1348,28 @@ void export_base(nb::module_ &m) {
           nb::sig("def square(arg: T, /) -> T"));
     m.def("matmul", &matmul, doc_matmul);
 
-    m.def("minimum",
-          [](Py_ssize_t a, Py_ssize_t b) { return dr::minimum(a, b); });
-    DR_MATH_BINOP(minimum, ArrayOp::Minimum);
-
-    m.def("maximum",
-          [](Py_ssize_t a, Py_ssize_t b) { return dr::maximum(a, b); });
-    DR_MATH_BINOP(maximum, ArrayOp::Maximum);
+    DR_MATH_BINOP_INT(minimum, ArrayOp::Minimum);
+    DR_MATH_BINOP_INT(maximum, ArrayOp::Maximum);
 
     DR_MATH_BINOP(atan2, ArrayOp::Atan2);
 
-    m.def("fma", (nb::object (*)(nb::handle, nb::handle, nb::handle)) fma)
+    m.def("fma",
+          [](nb::handle h0, nb::handle h1, nb::handle h2) {
+              ArgKind k = arg_kind(h0, h1, h2);
+              Py_ssize_t i0, i1, i2;
+              double v0, v1, v2;
+
+              if (k == ArgKind::Array)
+                  return fma(h0, h1, h2);
+              else if (k == ArgKind::Int && arg_ssize(h0, i0) &&
+                       arg_ssize(h1, i1) && arg_ssize(h2, i2))
+                  return nb::steal(PyLong_FromSsize_t(dr::fma(i0, i1, i2)));
+              else if (k != ArgKind::Other && arg_double(h0, v0) &&
+                       arg_double(h1, v1) && arg_double(h2, v2))
+                  return nb::steal(PyFloat_FromDouble(dr::fma(v0, v1, v2)));
+
+              return nb::steal(NB_NEXT_OVERLOAD);
+          })
      .def("fma",
           [](Py_ssize_t a, Py_ssize_t b, Py_ssize_t c) {
               return dr::fma(a, b, c);
@@ -1243,7 +1380,14 @@ void export_base(nb::module_ &m) {
           });
 
     m.def("select",
-          nb::overload_cast<nb::handle, nb::handle, nb::handle>(&select),
+          [](nb::handle h0, nb::handle h1, nb::handle h2) {
+              // Python booleans directly pick one of the arguments
+              if (h0.is(Py_True) || h0.is(Py_False)) {
+                  if (!is_drjit_array(h1) && !is_drjit_array(h2))
+                      return nb::borrow(h0.is(Py_True) ? h1 : h2);
+              }
+              return select(h0, h1, h2);
+          },
           doc_select);
 
     m.def("select",
@@ -1252,18 +1396,24 @@ void export_base(nb::module_ &m) {
           });
 
     m.def("power",
-          [](Py_ssize_t arg0, Py_ssize_t arg1) { return std::pow(arg0, arg1); },
-          doc_pow);
+          [](nb::handle h0, nb::handle h1) {
+              ArgKind k = arg_kind(h0, h1);
+              double v0, v1;
 
-    m.def("power", [](double arg0, double arg1) { return std::pow(arg0, arg1); });
+              if (k == ArgKind::Array)
+                  return nb::steal(nb_power(h0.ptr(), h1.ptr()));
+              else if (k != ArgKind::Other && arg_double(h0, v0) &&
+                       arg_double(h1, v1))
+                  return nb::steal(PyFloat_FromDouble(std::pow(v0, v1)));
+
+              return nb::steal(NB_NEXT_OVERLOAD);
+          },
+          doc_pow);
 
     m.def("power",
-          [](nb::handle h0, nb::handle h1) {
-              if (NB_UNLIKELY(!is_drjit_array(h0) && !is_drjit_array(h1)))
-                  return nb::steal(NB_NEXT_OVERLOAD);
-              return nb::steal(nb_power(h0.ptr(), h1.ptr()));
-          }
-    );
+          [](Py_ssize_t arg0, Py_ssize_t arg1) { return std::pow(arg0, arg1); });
+
+    m.def("power", [](double arg0, double arg1) { return std::pow(arg0, arg1); });
 
     m.def("reinterpret_array", &reinterpret_array, doc_reinterpret_array);
 
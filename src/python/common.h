@@ -61,6 +61,7 @@ extern nb::handle DR_STR(_traverse_write);
 extern nb::handle DR_STR(_traverse_read);
 extern nb::handle DR_STR(_traverse_1_cb_rw);
 extern nb::handle DR_STR(_traverse_1_cb_ro);
+extern nb::handle DR_STR(_traverse_1_cb_native);
 extern nb::handle DR_STR(typing);
 extern nb::handle DR_STR(get_type_hints);
 
@@ -72,22 +73,9 @@ inline nb::dict get_drjit_struct(nb::handle tp) {
     return nb::borrow<nb::dict>(result);
 }
 
-/// Extract the dataclass fields element of a custom data structure type, if available
-inline nb::object get_dataclass_fields(nb::handle tp) {
-    nb::object result = nb::getattr(tp, DR_STR(__dataclass_fields__), nb::handle());
-    if (result.is_valid()) {
-        result = nb::module_::import_(DR_STR(dataclasses)).attr(DR_STR(fields))(tp);
-
-        // Handle postponed type information
-        nb::object hints = nb::module_::import_(DR_STR(typing)).attr(DR_STR(get_type_hints))(tp);
-        for (auto field : result) {
-            nb::object field_type = field.attr(DR_STR(type));
-            if (field_type.type().is(&PyUnicode_Type))
-                field.attr(DR_STR(type)) = hints[field.attr(DR_STR(name))];
-        }
-    }
-    return result;
-}
+/// Extract the dataclass fields element of a custom data structure type, if
+/// available. The result is cached per type (see base.cpp)
+extern nb::object get_dataclass_fields(nb::handle tp);
 
 /// Extract a read-only callback to traverse custom data structures
 inline nb::object get_traverse_cb_ro(nb::handle tp) {
@@ -98,3 +86,13 @@ inline nb::object get_traverse_cb_ro(nb::handle tp) {
 inline nb::object get_traverse_cb_rw(nb::handle tp) {
     return nb::getattr(tp, DR_STR(_traverse_1_cb_rw), nb::handle());
 }
+
+/// Extract the native traversal callbacks of a type bound via
+/// drjit::bind_traverse(), if available
+inline const dr::detail::TraverseCallbacks *get_traverse_cb_native(nb::handle tp) {
+    nb::object o = nb::getattr(tp, DR_STR(_traverse_1_cb_native), nb::handle());
+    if (!o.is_valid() || !PyCapsule_IsValid(o.ptr(), "drjit.TraverseCallbacks"))
+        return nullptr;
+    return (const dr::detail::TraverseCallbacks *) PyCapsule_GetPointer(
+        o.ptr(), "drjit.TraverseCallbacks");
+}
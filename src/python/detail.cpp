@@ -334,6 +334,15 @@ void export_detail(nb::module_ &) {
 
      .def("cuda_compute_capability", &jit_cuda_compute_capability)
 
+     .def("cuda_host_register", &cuda_host_register, "array"_a,
+          "enable"_a = true, doc_detail_cuda_host_register)
+     .def("cuda_event_record", &cuda_event_record,
+          doc_detail_cuda_event_record)
+     .def("cuda_stream_wait_event", &cuda_stream_wait_event, "event"_a,
+          doc_detail_cuda_stream_wait_event)
+     .def("cuda_event_destroy", &cuda_event_destroy, "event"_a,
+          doc_detail_cuda_event_destroy)
+
      .def("new_scope", &jit_new_scope, "backend"_a, doc_detail_new_scope)
      .def("scope", &jit_scope, "backend"_a, doc_detail_scope)
      .def("set_scope", &jit_set_scope, "backend"_a, "scope"_a, doc_detail_set_scope);
@@ -345,5 +354,59 @@ void export_detail(nb::module_ &) {
     d.def("leak_warnings", &leak_warnings, doc_leak_warnings);
     d.def("set_leak_warnings", &set_leak_warnings, doc_set_leak_warnings);
 
+    d.def("ad_sorted_reuse", []() { return (bool) ad_sorted_reuse(); },
+          doc_detail_ad_sorted_reuse);
+    d.def("set_ad_sorted_reuse",
+          [](bool value) { ad_set_sorted_reuse((int) value); }, "value"_a,
+          doc_detail_set_ad_sorted_reuse);
+    d.def("ad_traverse_budget", &ad_traverse_budget,
+          doc_detail_ad_traverse_budget);
+    d.def("set_ad_traverse_budget", &ad_set_traverse_budget, "value"_a,
+          doc_detail_set_ad_traverse_budget);
+    d.def("ad_traverse_chunk", &ad_traverse_chunk,
+          doc_detail_ad_traverse_chunk);
+    d.def("set_ad_traverse_chunk", &ad_set_traverse_chunk, "value"_a,
+          doc_detail_set_ad_traverse_chunk);
+    d.def("ad_local_reduce_ratio", &ad_local_reduce_ratio,
+          doc_detail_ad_local_reduce_ratio);
+    d.def("set_ad_local_reduce_ratio", &ad_set_local_reduce_ratio, "value"_a,
+          doc_detail_set_ad_local_reduce_ratio);
+    d.def("ad_deterministic", &ad_deterministic,
+          doc_detail_ad_deterministic);
+    d.def("set_ad_deterministic", &ad_set_deterministic, "value"_a,
+          doc_detail_set_ad_deterministic);
+    d.def("ad_kahan", &ad_kahan, doc_detail_ad_kahan);
+    d.def("ad_math_fast_approx", &ad_math_fast_approx,
+          doc_detail_ad_math_fast_approx);
+    d.def("set_ad_math_fast_approx", &ad_set_math_fast_approx, "value"_a,
+          doc_detail_set_ad_math_fast_approx);
+    d.def("ad_call_cache", [] { return ad_call_cache() != 0; },
+          doc_detail_ad_call_cache);
+    d.def("set_ad_call_cache", [](bool value) { ad_set_call_cache(value); },
+          "value"_a, doc_detail_set_ad_call_cache);
+    d.def("ad_call_inline", &ad_call_inline, doc_detail_ad_call_inline);
+    d.def("set_ad_call_inline", &ad_set_call_inline, "value"_a,
+          doc_detail_set_ad_call_inline);
+    d.def("ad_call_flatten", [] { return ad_call_flatten() != 0; },
+          doc_detail_ad_call_flatten);
+    d.def("set_ad_call_flatten", [](bool value) { ad_set_call_flatten(value); },
+          "value"_a, doc_detail_set_ad_call_flatten);
+    d.def("ad_call_reduce_batch", &ad_call_reduce_batch,
+          doc_detail_ad_call_reduce_batch);
+    d.def("set_ad_call_reduce_batch", &ad_set_call_reduce_batch, "value"_a,
+          doc_detail_set_ad_call_reduce_batch);
+    d.def("ad_loop_compress_ratio", &ad_loop_compress_ratio,
+          doc_detail_ad_loop_compress_ratio);
+    d.def("set_ad_loop_compress_ratio", &ad_set_loop_compress_ratio, "value"_a,
+          doc_detail_set_ad_loop_compress_ratio);
+    d.def("ad_loop_check_interval", &ad_loop_check_interval,
+          doc_detail_ad_loop_check_interval);
+    d.def("set_ad_loop_check_interval", &ad_set_loop_check_interval, "value"_a,
+          doc_detail_set_ad_loop_check_interval);
+    d.def("ad_loop_batch", &ad_loop_batch, doc_detail_ad_loop_batch);
+    d.def("set_ad_loop_batch", &ad_set_loop_batch, "value"_a,
+          doc_detail_set_ad_loop_batch);
+    d.def("set_ad_kahan", &ad_set_kahan, "value"_a, doc_detail_set_ad_kahan);
+
     trace_func_handle = d.attr("trace_func");
 }
@@ -68,6 +68,16 @@ VarType dlpack_type_to_drjit(nb::dlpack::dtype dt) {
             }
             break;
 
+        case nb::dlpack::dtype_code::Bfloat:
+            // Dr.Jit has no native bfloat16 type. Map the storage to 16-bit
+            // unsigned integers so that the data can be imported without a
+            // copy. See drjit.bfloat16_to_float() and float_to_bfloat16().
+            switch (dt.bits) {
+                case 16: return VarType::UInt16;
+                default: break;
+            }
+            break;
+
         default:
             break;
     }
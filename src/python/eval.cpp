@@ -11,6 +11,8 @@
 #include "eval.h"
 #include "apply.h"
 #include "local.h"
+#include "profile.h"
+#include "memory.h"
 
 bool schedule(nb::handle h) {
     bool result_ = false;
@@ -79,19 +81,29 @@ static void make_opaque(nb::handle h) {
 static void make_opaque_2(nb::args args) { return make_opaque(args); }
 
 bool eval(nb::handle h) {
+    trace_span span("eval", "eval");
+    memory_check(h);
     if (schedule(h)) {
-        nb::gil_scoped_release guard;
-        jit_eval();
+        {
+            nb::gil_scoped_release guard;
+            jit_eval();
+        }
+        memory_sample();
         return true;
     }
     return false;
 }
 
 static bool eval_2(nb::args args) {
+    trace_span span("eval", "eval");
+    memory_check(args);
     bool rv = schedule(args);
     if (rv || nb::len(args) == 0) {
-        nb::gil_scoped_release guard;
-        jit_eval();
+        {
+            nb::gil_scoped_release guard;
+            jit_eval();
+        }
+        memory_sample();
     }
     return rv;
 }
@@ -9,16 +9,74 @@
 */
 
 #include "history.h"
+#include <nanobind/stl/string.h>
+
+/// Entries retrieved from Dr.Jit-Core at profile range boundaries
+static dr::vector<HistoryRecord> history_records;
+
+/// Stack of labels of active 'drjit.profile_range' scopes
+static dr::vector<std::string> history_labels;
+
+static std::string history_label() {
+    std::string result;
+    for (const std::string &s : history_labels) {
+        if (!result.empty())
+            result += '/';
+        result += s;
+    }
+    return result;
+}
+
+/// Move pending entries from Dr.Jit-Core into 'history_records'
+static void history_drain() {
+    if (!jit_flag(JitFlag::KernelHistory))
+        return;
+
+    KernelHistoryEntry *data = jit_kernel_history();
+    if (!data)
+        return;
+
+    std::string label = history_label();
+    for (KernelHistoryEntry *entry = data; (uint32_t) entry->backend; ++entry)
+        history_records.push_back({ *entry, label });
+
+    free(data);
+}
+
+static void history_clear() {
+    for (HistoryRecord &r : history_records)
+        free(r.entry.ir);
+    history_records.clear();
+}
+
+void history_take(dr::vector<HistoryRecord> &out) {
+    history_drain();
+    for (HistoryRecord &r : history_records)
+        out.push_back(std::move(r));
+    history_records.clear();
+}
+
+void history_push_label(const char *label) {
+    history_drain();
+    history_labels.push_back(label);
+}
+
+void history_pop_label() {
+    history_drain();
+    if (!history_labels.empty())
+        history_labels.pop_back();
+}
 
 void export_history(nb::module_ &m) {
     nb::object io = nb::module_::import_("io").attr("StringIO");
     m.def(
         "kernel_history",
         [io](dr::vector<KernelType> types) {
-            KernelHistoryEntry *data  = jit_kernel_history();
-            KernelHistoryEntry *entry = data;
+            history_drain();
+
             nb::list history;
-            while (entry && (uint32_t) entry->backend) {
+            for (HistoryRecord &r : history_records) {
+                KernelHistoryEntry *entry = &r.entry;
                 bool queried_type = types.size() == 0;
                 for (KernelType t : types)
                     queried_type |= t == entry->type;
@@ -47,19 +105,21 @@ void export_history(nb::module_ &m) {
                         dict["backend_time"]   = entry->backend_time;
                     }
                     dict["execution_time"] = entry->execution_time;
+                    dict["label"] = r.label;
 
                     history.append(dict);
                 }
-
-                free(entry->ir);
-                entry++;
             }
-            free(data);
+            history_clear();
             return history;
         },
         "types"_a = nb::list(), doc_kernel_history);
 
-    m.def("kernel_history_clear", &jit_kernel_history_clear,
+    m.def("kernel_history_clear",
+          []() {
+              history_clear();
+              jit_kernel_history_clear();
+          },
           doc_kernel_history_clear);
 
     nb::enum_<KernelType>(m, "KernelType")
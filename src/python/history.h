@@ -11,5 +11,19 @@
 #pragma once
 
 #include "common.h"
+#include <string>
+
+/// Kernel history entry tagged with the profile range stack active at launch
+struct HistoryRecord {
+    KernelHistoryEntry entry;
+    std::string label;
+};
 
 extern void export_history(nb::module_ &m);
+
+/// Attribute subsequent kernel launches to a nested 'drjit.profile_range'
+extern void history_push_label(const char *label);
+extern void history_pop_label();
+
+/// Move all pending kernel history entries into 'out' (the caller must free 'entry.ir')
+extern void history_take(dr::vector<HistoryRecord> &out);
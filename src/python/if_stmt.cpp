@@ -116,9 +116,11 @@ nb::object if_stmt(nb::tuple args, nb::handle cond, nb::callable true_fn,
             symbolic = 1;
         else if (mode == "evaluated")
             symbolic = 0;
+        else if (mode == "auto")
+            symbolic = 2;
         else
             nb::raise("invalid 'mode' argument (must equal None, "
-                      "\"scalar\", \"symbolic\", or \"evaluated\").");
+                      "\"scalar\", \"symbolic\", \"evaluated\", or \"auto\").");
 
         const char *name_cstr =
             name.has_value() ? name.value().c_str() : "unnamed";
@@ -185,7 +187,7 @@ void export_if_stmt(nb::module_ &m) {
                         "arg_labels: typing.Sequence[str] = (), "
                         "rv_labels: typing.Sequence[str] = (), "
                         "label: str | None = None, "
-                        "mode: typing.Literal['scalar', 'symbolic', 'evaluated', None] = None, "
+                        "mode: typing.Literal['scalar', 'symbolic', 'evaluated', 'auto', None] = None, "
                         "strict: bool = True) "
             "-> T")
     );
@@ -18,7 +18,9 @@
 #include "shape.h"
 #include "dlpack.h"
 #include "init.h"
+#include "apply.h"
 
+#include <limits>
 #include <mutex>
 #include <thread>
 #include <condition_variable>
@@ -26,6 +28,77 @@
 /// Forward declaration
 static bool array_init_from_seq(PyObject *self, const ArraySupplement &s, PyObject *seq);
 
+#if !defined(Py_LIMITED_API)
+/**
+ * \brief Decode the entries of a list/tuple consisting of builtin Python
+ * ``float``, ``int``, and ``bool`` instances into a contiguous buffer.
+ *
+ * This avoids the reference counting and type caster overheads of the
+ * general per-element path. The function returns ``false`` when it
+ * encounters another type of object or an integer that does not fit into the
+ * target type, in which case the caller should fall back to the general path.
+ */
+template <typename T>
+static bool seq_decode_fast(PyObject **items, Py_ssize_t size, T *out) {
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *o = items[i];
+        PyTypeObject *tp = Py_TYPE(o);
+
+        if constexpr (std::is_same_v<T, dr::half>) {
+            (void) tp; (void) out;
+            return false;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            if (o == Py_True)
+                out[i] = true;
+            else if (o == Py_False)
+                out[i] = false;
+            else
+                return false;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (tp == &PyFloat_Type) {
+                out[i] = (T) PyFloat_AS_DOUBLE(o);
+            } else if (tp == &PyLong_Type || tp == &PyBool_Type) {
+                double d = PyLong_AsDouble(o);
+                if (NB_UNLIKELY(d == -1.0 && PyErr_Occurred())) {
+                    PyErr_Clear();
+                    return false;
+                }
+                out[i] = (T) d;
+            } else {
+                return false;
+            }
+        } else {
+            if (tp != &PyLong_Type && tp != &PyBool_Type)
+                return false;
+
+            int overflow = 0;
+            long long v = PyLong_AsLongLongAndOverflow(o, &overflow);
+            if (NB_UNLIKELY(overflow || (v == -1 && PyErr_Occurred()))) {
+                PyErr_Clear();
+                return false;
+            }
+
+            if constexpr (std::is_signed_v<T>) {
+                if (v < (long long) std::numeric_limits<T>::min() ||
+                    v > (long long) std::numeric_limits<T>::max())
+                    return false;
+            } else {
+                if (v < 0 || (unsigned long long) v >
+                                 (unsigned long long) std::numeric_limits<T>::max())
+                    return false;
+            }
+
+            out[i] = (T) v;
+        }
+    }
+
+    return true;
+}
+#else
+template <typename T>
+static bool seq_decode_fast(PyObject **, Py_ssize_t, T *) { return false; }
+#endif
+
 /// Convenience function to skip costly examinations of common types
 static bool is_builtin(PyTypeObject *tp) {
     return tp == &PyLong_Type || tp == &PyFloat_Type || tp == &PyBool_Type;
@@ -311,6 +384,33 @@ static bool array_init_from_seq(PyObject *self, const ArraySupplement &s, PyObje
              "Input has the wrong size (expected %u elements, got %zd).",
              (unsigned) s.shape[0], size);
 
+#if !defined(Py_LIMITED_API)
+    /* Static 1D arrays (e.g., ``drjit.scalar.Array3f``): decode builtin
+       Python numbers directly into the storage of the array */
+    if (!is_dynamic && s.ndim == 1 && s.data && !s.is_class &&
+        (tp == &PyTuple_Type || tp == &PyList_Type)) {
+        PyObject **items = tp == &PyList_Type ? ((PyListObject *) seq)->ob_item
+                                              : ((PyTupleObject *) seq)->ob_item;
+        nb::inst_zero(self);
+        void *p = s.data(inst_ptr(self));
+        bool success;
+
+        switch ((VarType) s.type) {
+            case VarType::Bool:    success = seq_decode_fast(items, size, (bool *) p); break;
+            case VarType::Float32: success = seq_decode_fast(items, size, (float *) p); break;
+            case VarType::Float64: success = seq_decode_fast(items, size, (double *) p); break;
+            case VarType::Int32:   success = seq_decode_fast(items, size, (int32_t *) p); break;
+            case VarType::UInt32:  success = seq_decode_fast(items, size, (uint32_t *) p); break;
+            case VarType::Int64:   success = seq_decode_fast(items, size, (int64_t *) p); break;
+            case VarType::UInt64:  success = seq_decode_fast(items, size, (uint64_t *) p); break;
+            default: success = false;
+        }
+
+        if (success)
+            return true;
+    }
+#endif
+
     if (size == 1 && s.init_const) {
         nb::object o = nb::steal(sq_item(seq, 0));
         raise_if(!o.is_valid(), "Item retrieval failed.");
@@ -326,6 +426,8 @@ static bool array_init_from_seq(PyObject *self, const ArraySupplement &s, PyObje
         {                                                                  \
             nb::detail::make_caster<T> caster;                             \
             T *p = (T *) storage.get();                                    \
+            if (fast_items && seq_decode_fast<T>(fast_items, size, p))     \
+                break;                                                     \
             for (Py_ssize_t i = 0; i < size; ++i) {                        \
                 nb::object o = nb::steal(sq_item(seq, i));                 \
                 if (NB_UNLIKELY(!o.is_valid() ||                           \
@@ -342,6 +444,16 @@ static bool array_init_from_seq(PyObject *self, const ArraySupplement &s, PyObje
         if (!s.is_class) {
             size_t byte_size = jit_type_size((VarType) s.type) * (size_t) size;
             dr::unique_ptr<uint8_t[]> storage(new uint8_t[byte_size]);
+
+            // Direct access to the entries of lists and tuples
+            PyObject **fast_items = nullptr;
+#if !defined(Py_LIMITED_API)
+            if (tp == &PyList_Type)
+                fast_items = ((PyListObject *) seq)->ob_item;
+            else if (tp == &PyTuple_Type)
+                fast_items = ((PyTupleObject *) seq)->ob_item;
+#endif
+
             switch ((VarType) s.type) {
                 case VarType::Bool:    FROM_SEQ_IMPL(bool);     break;
                 case VarType::Float16: FROM_SEQ_IMPL(dr::half); break;
@@ -398,9 +510,290 @@ static bool array_init_from_seq(PyObject *self, const ArraySupplement &s, PyObje
     return true;
 }
 
-// Forward declaration
+// Forward declarations
 static void ndarray_keep_alive(JitBackend backend, uint32_t index,
                                nb::detail::ndarray_handle *p);
+static void ndarray_free_cb_2(void *p);
+
+/// CUDA driver API entry points used to upload page-locked host memory
+struct CudaHostApi {
+    int (*cuPointerGetAttribute)(void *, int, unsigned long long) = nullptr;
+    int (*cuMemHostRegister)(void *, size_t, unsigned int) = nullptr;
+    int (*cuMemHostUnregister)(void *) = nullptr;
+    int (*cuMemcpyHtoDAsync)(unsigned long long, const void *, size_t, void *) = nullptr;
+    int (*cuMemcpyPeerAsync)(unsigned long long, void *, unsigned long long,
+                             void *, size_t, void *) = nullptr;
+    int (*cuMemGetInfo)(size_t *, size_t *) = nullptr;
+    int (*cuCtxPushCurrent)(void *) = nullptr;
+    int (*cuCtxPopCurrent)(void **) = nullptr;
+    int (*cuEventCreate)(void **, unsigned int) = nullptr;
+    int (*cuEventRecord)(void *, void *) = nullptr;
+    int (*cuEventDestroy)(void *) = nullptr;
+    int (*cuStreamWaitEvent)(void *, void *, unsigned int) = nullptr;
+    bool ready = false;
+
+    bool init() {
+        if (ready)
+            return true;
+        if (!jit_has_backend(JitBackend::CUDA))
+            return false;
+
+        cuPointerGetAttribute = (decltype(cuPointerGetAttribute)) jit_cuda_lookup("cuPointerGetAttribute");
+        cuMemHostRegister = (decltype(cuMemHostRegister)) jit_cuda_lookup("cuMemHostRegister_v2");
+        cuMemHostUnregister = (decltype(cuMemHostUnregister)) jit_cuda_lookup("cuMemHostUnregister");
+        cuMemcpyHtoDAsync = (decltype(cuMemcpyHtoDAsync)) jit_cuda_lookup("cuMemcpyHtoDAsync_v2");
+        cuMemcpyPeerAsync = (decltype(cuMemcpyPeerAsync)) jit_cuda_lookup("cuMemcpyPeerAsync");
+        cuMemGetInfo = (decltype(cuMemGetInfo)) jit_cuda_lookup("cuMemGetInfo_v2");
+        cuCtxPushCurrent = (decltype(cuCtxPushCurrent)) jit_cuda_lookup("cuCtxPushCurrent_v2");
+        cuCtxPopCurrent = (decltype(cuCtxPopCurrent)) jit_cuda_lookup("cuCtxPopCurrent_v2");
+        cuEventCreate = (decltype(cuEventCreate)) jit_cuda_lookup("cuEventCreate");
+        cuEventRecord = (decltype(cuEventRecord)) jit_cuda_lookup("cuEventRecord");
+        cuEventDestroy = (decltype(cuEventDestroy)) jit_cuda_lookup("cuEventDestroy_v2");
+        cuStreamWaitEvent = (decltype(cuStreamWaitEvent)) jit_cuda_lookup("cuStreamWaitEvent");
+
+        ready = cuPointerGetAttribute && cuMemHostRegister && cuMemHostUnregister &&
+                cuMemcpyHtoDAsync && cuMemcpyPeerAsync && cuMemGetInfo &&
+                cuCtxPushCurrent && cuCtxPopCurrent && cuEventCreate &&
+                cuEventRecord && cuEventDestroy && cuStreamWaitEvent;
+        return ready;
+    }
+};
+
+static CudaHostApi cuda_host_api;
+
+/// Make Dr.Jit's CUDA context current while calling the driver API
+struct scoped_cuda_context {
+    scoped_cuda_context() { cuda_host_api.cuCtxPushCurrent(jit_cuda_context()); }
+    ~scoped_cuda_context() {
+        void *ctx;
+        cuda_host_api.cuCtxPopCurrent(&ctx);
+    }
+};
+
+/**
+ * If ``ptr`` refers to page-locked host memory (e.g., a pinned PyTorch CPU
+ * tensor or a buffer registered via ``drjit.detail.cuda_host_register()``),
+ * upload it to a new device allocation without going through a staging
+ * buffer. The copy is asynchronous on Dr.Jit's stream, and the ndarray is
+ * kept alive until it completes. Returns zero if the fast path isn't
+ * applicable.
+ */
+static uint32_t cuda_import_pinned(VarType vt, const void *ptr, size_t size,
+                                   nb::detail::ndarray_handle *th) {
+    if (!size || !cuda_host_api.init())
+        return 0;
+
+    scoped_cuda_context guard;
+
+    // CU_POINTER_ATTRIBUTE_MEMORY_TYPE == 2, CU_MEMORYTYPE_HOST == 1
+    unsigned int mem_type = 0;
+    if (cuda_host_api.cuPointerGetAttribute(&mem_type, 2,
+                                            (unsigned long long) (uintptr_t) ptr) != 0 ||
+        mem_type != 1)
+        return 0;
+
+    size_t bytes = size * jit_type_size(vt);
+    void *dst = jit_malloc(AllocType::Device, bytes);
+
+    if (cuda_host_api.cuMemcpyHtoDAsync((unsigned long long) (uintptr_t) dst,
+                                        ptr, bytes, jit_cuda_stream()) != 0) {
+        jit_free(dst);
+        return 0;
+    }
+
+    uint32_t index = jit_var_mem_map(JitBackend::CUDA, vt, dst, size, 1);
+
+    // Release the ndarray once the stream has finished reading from it
+    nb::detail::ndarray_inc_ref(th);
+    jit_enqueue_host_func(JitBackend::CUDA, ndarray_free_cb_2, th);
+
+    return index;
+}
+
+void cuda_host_register(nb::handle h, bool enable) {
+    nb::ndarray<nb::device::cpu, nb::c_contig> arr =
+        nb::cast<nb::ndarray<nb::device::cpu, nb::c_contig>>(h);
+
+    if (!cuda_host_api.init())
+        nb::raise("drjit.detail.cuda_host_register(): the CUDA backend is "
+                  "not available.");
+
+    scoped_cuda_context guard;
+    int rv = enable ? cuda_host_api.cuMemHostRegister(arr.data(), arr.nbytes(), 0)
+                    : cuda_host_api.cuMemHostUnregister(arr.data());
+    if (rv != 0)
+        nb::raise("drjit.detail.cuda_host_register(): %s failed (error %i).",
+                  enable ? "cuMemHostRegister" : "cuMemHostUnregister", rv);
+}
+
+uintptr_t cuda_event_record() {
+    if (!cuda_host_api.init())
+        nb::raise("drjit.detail.cuda_event_record(): the CUDA backend is "
+                  "not available.");
+
+    scoped_cuda_context guard;
+    void *event = nullptr;
+
+    // CU_EVENT_DISABLE_TIMING == 2
+    int rv = cuda_host_api.cuEventCreate(&event, 2);
+    if (rv == 0) {
+        rv = cuda_host_api.cuEventRecord(event, jit_cuda_stream());
+        if (rv != 0)
+            cuda_host_api.cuEventDestroy(event);
+    }
+
+    if (rv != 0)
+        nb::raise("drjit.detail.cuda_event_record(): failed (error %i).", rv);
+
+    return (uintptr_t) event;
+}
+
+void cuda_stream_wait_event(uintptr_t event) {
+    if (!cuda_host_api.init())
+        nb::raise("drjit.detail.cuda_stream_wait_event(): the CUDA backend "
+                  "is not available.");
+
+    scoped_cuda_context guard;
+    int rv = cuda_host_api.cuStreamWaitEvent(jit_cuda_stream(), (void *) event, 0);
+    if (rv != 0)
+        nb::raise("drjit.detail.cuda_stream_wait_event(): failed (error %i).", rv);
+}
+
+void cuda_event_destroy(uintptr_t event) {
+    if (!event || !cuda_host_api.init())
+        return;
+
+    scoped_cuda_context guard;
+    cuda_host_api.cuEventDestroy((void *) event);
+}
+
+bool cuda_mem_info(size_t *free, size_t *total) {
+    if (!cuda_host_api.init())
+        return false;
+
+    scoped_cuda_context guard;
+    return cuda_host_api.cuMemGetInfo(free, total) == 0;
+}
+
+/// Restore the CUDA device of the current thread when leaving a scope
+struct scoped_cuda_device {
+    int backup;
+    scoped_cuda_device(int device) : backup(jit_cuda_device()) {
+        jit_cuda_set_device(device);
+    }
+    ~scoped_cuda_device() { jit_cuda_set_device(backup); }
+};
+
+/**
+ * Copy the (evaluated) CUDA variable ``index`` that resides on the current
+ * device to a new allocation on ``device`` using a peer-to-peer transfer.
+ * Returns a new reference to a variable that must subsequently only be used
+ * while ``device`` is the active device.
+ */
+static uint32_t cuda_copy_to_device(uint32_t index, int device) {
+    int src_device = jit_cuda_device();
+    if (device == src_device) {
+        jit_var_inc_ref(index);
+        return index;
+    }
+
+    VarType vt = jit_var_type(index);
+    size_t size = jit_var_size(index);
+
+    void *src_ptr = nullptr;
+    JitVar src = JitVar::steal(jit_var_data(index, &src_ptr));
+    void *src_ctx = jit_cuda_context();
+
+    // The source may be the result of a kernel that is still running
+    jit_sync_thread();
+
+    scoped_cuda_device guard(device);
+    void *dst_ctx = jit_cuda_context();
+    size_t bytes = size * jit_type_size(vt);
+    void *dst_ptr = jit_malloc(AllocType::Device, bytes);
+
+    int rv = cuda_host_api.cuMemcpyPeerAsync(
+        (unsigned long long) (uintptr_t) dst_ptr, dst_ctx,
+        (unsigned long long) (uintptr_t) src_ptr, src_ctx, bytes,
+        jit_cuda_stream());
+
+    if (rv != 0) {
+        jit_free(dst_ptr);
+        nb::raise("drjit.to_device(): cuMemcpyPeerAsync failed (error %i).", rv);
+    }
+
+    uint32_t result = jit_var_mem_map(JitBackend::CUDA, vt, dst_ptr, size, 1);
+
+    // Keep the source alive until the copy has finished
+    jit_sync_thread();
+
+    return result;
+}
+
+static nb::object to_device(nb::handle h, int device) {
+    struct ToDevice : TransformCallback {
+        int device;
+        ToDevice(int device) : device(device) { }
+
+        void operator()(nb::handle h1, nb::handle h2) override {
+            const ArraySupplement &s = supp(h1.type());
+
+            if (s.index && (JitBackend) s.backend == JitBackend::CUDA) {
+                JitVar value = JitVar::steal(cuda_copy_to_device(
+                    (uint32_t) s.index(inst_ptr(h1)), device));
+                s.init_index(value.index(), inst_ptr(h2));
+            } else {
+                nb::inst_copy(h2, h1);
+            }
+        }
+    };
+
+    if (!cuda_host_api.init())
+        nb::raise("drjit.to_device(): the CUDA backend is not available.");
+
+    int count = jit_cuda_device_count();
+    if (device < 0 || device >= count)
+        nb::raise("drjit.to_device(): invalid device index %i (the system "
+                  "has %i CUDA device(s)).", device, count);
+
+    ToDevice td(device);
+    return transform("drjit.to_device", td, h);
+}
+
+/**
+ * Request a DLPack capsule from a CUDA producer (e.g., a PyTorch tensor) and
+ * pass Dr.Jit's stream to ``__dlpack__(stream=...)``. The producer then makes
+ * this stream wait for pending work via an event, which avoids stalling the
+ * host. Returns an invalid object if the input isn't a CUDA array or does not
+ * support this protocol.
+ */
+static nb::object dlpack_import_capsule(nb::handle arg) {
+    if (PyCapsule_CheckExact(arg.ptr()) || !jit_has_backend(JitBackend::CUDA))
+        return { };
+
+    nb::object device_fn = nb::getattr(arg, "__dlpack_device__", nb::handle()),
+               dlpack_fn = nb::getattr(arg, "__dlpack__", nb::handle());
+    if (!device_fn.is_valid() || !dlpack_fn.is_valid())
+        return { };
+
+    try {
+        nb::tuple device = nb::borrow<nb::tuple>(device_fn());
+        if (nb::cast<int32_t>(device[0]) != nb::device::cuda::value)
+            return { };
+
+        // A null handle refers to the legacy default stream (1)
+        uintptr_t stream = (uintptr_t) jit_cuda_stream();
+        if (!stream)
+            stream = 1;
+
+        return dlpack_fn("stream"_a = stream);
+    } catch (nb::python_error &) {
+        // Fall back to the standard protocol without a stream
+        return { };
+    } catch (nb::cast_error &) {
+        return { };
+    }
+}
 
 nb::object import_ndarray(ArrayMeta m, PyObject *arg, vector<size_t> *shape_out,
                           bool force_ad) {
@@ -430,14 +823,24 @@ nb::object import_ndarray(ArrayMeta m, PyObject *arg, vector<size_t> *shape_out,
         conf.ndim -= 1;
     }
 
+    nb::object capsule = dlpack_import_capsule(arg);
+    PyObject *source = capsule.is_valid() ? capsule.ptr() : arg;
+
     nb::detail::ndarray_handle *th = nb::detail::ndarray_import(
-        arg, &conf, (uint8_t) nb::detail::cast_flags::convert, nullptr);
+        source, &conf, (uint8_t) nb::detail::cast_flags::convert, nullptr);
+
+    if (!th && capsule.is_valid()) {
+        // The capsule is consumed by the first import attempt, retry normally
+        source = arg;
+        th = nb::detail::ndarray_import(
+            source, &conf, (uint8_t) nb::detail::cast_flags::convert, nullptr);
+    }
 
     if (!th && m.ndim > 1 && m.shape[m.ndim - 1] == DRJIT_DYNAMIC) {
         // Try conversion of scalar to vectorized representation
         conf.ndim--;
         th = nb::detail::ndarray_import(
-            arg, &conf, (uint8_t) nb::detail::cast_flags::convert, nullptr);
+            source, &conf, (uint8_t) nb::detail::cast_flags::convert, nullptr);
         if (!th)
             conf.ndim++;
     }
@@ -553,7 +956,12 @@ nb::object import_ndarray(ArrayMeta m, PyObject *arg, vector<size_t> *shape_out,
                 default: nb::raise("Unsupported source device!");
             }
 
-            index = jit_var_mem_copy(backend, at, vt, ndarr.data(), size);
+            index = 0;
+            if (backend == JitBackend::CUDA && at == AllocType::Host)
+                index = cuda_import_pinned(vt, ndarr.data(), size, th);
+
+            if (!index)
+                index = jit_var_mem_copy(backend, at, vt, ndarr.data(), size);
         }
 
         supp(temp_t).init_index(index, inst_ptr(temp));
@@ -994,6 +1402,9 @@ nb::object extract_type(nb::object tp) {
 }
 
 void export_init(nb::module_ &m) {
+    m.def("to_device", &to_device, "arg"_a, "device"_a, doc_to_device,
+          nb::sig("def to_device(arg: T, device: int) -> T"));
+
     m.def("empty",
           [](nb::type_object dtype, size_t size) {
               return full("empty", dtype, nb::handle(), size);
@@ -31,5 +31,14 @@ extern nb::object import_ndarray(ArrayMeta m, PyObject *arg,
                                  dr::vector<size_t> *shape = nullptr,
                                  bool force_ad = false);
 
+/// Page-lock (or unlock) the memory of a CPU ndarray for faster CUDA imports
+extern void cuda_host_register(nb::handle h, bool enable);
+extern uintptr_t cuda_event_record();
+extern void cuda_stream_wait_event(uintptr_t event);
+extern void cuda_event_destroy(uintptr_t event);
+
+/// Query the free and total memory of the active CUDA device
+extern bool cuda_mem_info(size_t *free, size_t *total);
+
 // Helper function to extract the type of constructs such as typing.Optional[T]
 extern nb::object extract_type(nb::object tp);
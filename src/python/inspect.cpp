@@ -51,6 +51,23 @@ static nb::object whos(bool ad, bool as_string) {
     }
 }
 
+static nb::dict ad_stats_py(bool reset) {
+    ADStats stats;
+    ad_stats(&stats, (int) reset);
+
+    nb::dict result;
+    result["variables"] = stats.variables;
+    result["edges"] = stats.edges;
+    result["traversals"] = stats.traversals;
+    result["edges_traversed"] = stats.edges_traversed;
+    result["edges_special"] = stats.edges_special;
+    result["edges_custom"] = stats.edges_custom;
+    result["edges_postponed"] = stats.edges_postponed;
+    result["edges_skipped"] = stats.edges_skipped;
+    result["traverse_time"] = stats.traverse_time;
+    return result;
+}
+
 void set_label(nb::handle h, nb::str label) {
     nb::handle tp = h.type();
     bool is_drjit = is_drjit_type(tp);
@@ -119,6 +136,7 @@ void export_inspect(nb::module_ &m) {
      .def("whos_ad", [](bool as_string) { return whos(true, as_string); },
           "as_string"_a = false, doc_whos_ad,
           nb::sig("def whos_ad(as_string: bool) -> str | None"))
+     .def("ad_stats", &ad_stats_py, "reset"_a = false, doc_ad_stats)
      .def("set_label", &set_label, doc_set_label)
      .def("set_label", &set_label_2);
 }
@@ -23,21 +23,68 @@ struct Callback {
 static nb::object traverse(nb::handle tp, nb::handle v1, nb::handle v2,
                            bool ret, Callback *cb);
 
-Local::Local(nb::handle dtype, size_t length, nb::handle value)
+/// Return the value of a literal index/mask variable, or ``false`` otherwise
+static bool literal_value(uint32_t index, uint32_t &value) {
+    if (!index || jit_var_state(index) != VarState::Literal)
+        return false;
+    if (jit_var_type(index) == VarType::Bool) {
+        bool b;
+        jit_var_read(index, 0, &b);
+        value = b;
+    } else {
+        jit_var_read(index, 0, &value);
+    }
+    return true;
+}
+
+Local::Local(nb::handle dtype, size_t length, nb::handle value,
+             const char *placement)
     : m_dtype(nb::borrow(dtype)), m_length(length),
       m_value(value.is_none() ? nb::object() : nb::borrow(value)) {
 
+    // Shared memory isn't exposed by Dr.Jit-Core. Until then, the "shared"
+    // and "auto" placements use ordinary local memory via variable arrays.
+    if (strcmp(placement, "registers") == 0)
+        m_registers = true;
+    else if (strcmp(placement, "auto") != 0 &&
+             strcmp(placement, "shared") != 0 &&
+             strcmp(placement, "local") != 0)
+        nb::raise("drjit.alloc_local(): 'placement' must be \"auto\", "
+                  "\"registers\", \"shared\", or \"local\" (got \"%s\").",
+                  placement);
+
     /// Allocate variable arrays for the input PyTree
     struct LocalCallback : Callback {
         size_t length;
+        bool registers;
         dr::vector<uint32_t> arrays;
         JitBackend backend = JitBackend::None;
 
-        LocalCallback(size_t length) : length(length) {}
+        LocalCallback(size_t length, bool registers)
+            : length(length), registers(registers) {}
 
         nb::object process(nb::handle tp, nb::handle v1, nb::handle) override {
             const ArraySupplement &s = supp(tp);
             backend = (JitBackend) s.backend;
+
+            if (registers) {
+                // One ordinary variable per entry, zero-initialized by default
+                uint32_t init;
+                if (v1.is_valid()) {
+                    init = (uint32_t) s.index(inst_ptr(v1));
+                    jit_var_inc_ref(init);
+                } else {
+                    uint64_t zero = 0;
+                    init = jit_var_literal(backend, (VarType) s.type, &zero, 1);
+                }
+                for (size_t i = 0; i < length; ++i) {
+                    jit_var_inc_ref(init);
+                    arrays.push_back(init);
+                }
+                jit_var_dec_ref(init);
+                return nb::object();
+            }
+
             uint32_t result;
             if (v1.is_valid()) {
                 uint32_t i1 = (uint32_t) s.index(inst_ptr(v1));
@@ -55,7 +102,7 @@ Local::Local(nb::handle dtype, size_t length, nb::handle value)
         }
     };
 
-    LocalCallback cb(m_length);
+    LocalCallback cb(m_length, m_registers);
 
     traverse(m_dtype, m_value, nb::handle(), false, &cb);
     m_arrays = std::move(cb.arrays);
@@ -74,7 +121,7 @@ Local::Local(nb::handle dtype, size_t length, nb::handle value)
     m_mask_tp = meta_get_type(m);
 }
 
-Local::Local(const Local &l) : m_dtype(l.m_dtype), m_length(l.m_length), m_value(l.m_value), m_backend(l.m_backend), m_index_tp(l.m_index_tp), m_mask_tp(l.m_mask_tp) {
+Local::Local(const Local &l) : m_dtype(l.m_dtype), m_length(l.m_length), m_value(l.m_value), m_backend(l.m_backend), m_registers(l.m_registers), m_index_tp(l.m_index_tp), m_mask_tp(l.m_mask_tp) {
     m_arrays.reserve(l.m_arrays.size());
     for (uint32_t index: l.m_arrays) {
         jit_var_inc_ref(index);
@@ -87,6 +134,22 @@ Local::~Local() {
         jit_var_dec_ref(index);
 }
 
+uint32_t Local::register_index(const char *name, nb::handle index) const {
+    uint32_t index_v = (uint32_t) supp(m_index_tp).index(inst_ptr(index));
+    if (!m_registers)
+        return index_v;
+
+    uint32_t value;
+    if (!literal_value(index_v, value))
+        nb::raise("Local.%s(): buffers with placement=\"registers\" can only "
+                  "be accessed using literal (compile-time constant) indices.",
+                  name);
+    if (value >= m_length)
+        nb::raise("Local.%s(): index %u is out of bounds for a buffer of "
+                  "size %zu.", name, value, m_length);
+    return value;
+}
+
 nb::object Local::read(nb::handle index_, nb::handle mask_) const {
     nb::object index =
         index_.type().is(m_index_tp) ? nb::borrow(index_) : m_index_tp(index_);
@@ -96,17 +159,34 @@ nb::object Local::read(nb::handle index_, nb::handle mask_) const {
     /// Read from the variable arrays
     struct GetItemCallback : Callback {
         const dr::vector<uint32_t> &arrays;
-        uint32_t index, mask, ctr;
+        uint32_t index, mask, ctr, stride;
         GetItemCallback(const dr::vector<uint32_t> &arrays, uint32_t index,
-                        uint32_t mask)
-            : arrays(arrays), index(index), mask(mask), ctr(0) {}
+                        uint32_t mask, uint32_t stride)
+            : arrays(arrays), index(index), mask(mask), ctr(0), stride(stride) {}
 
         nb::object process(nb::handle tp, nb::handle, nb::handle) override {
             const ArraySupplement &s = supp(tp);
             if (ctr >= arrays.size())
                 nb::raise("Local.read(): internal error, ran out of "
                           "variable arrays!");
-            uint32_t result = jit_array_read(arrays[ctr++], index, mask);
+            uint32_t result;
+            if (stride) {
+                // Register placement, 'index' is the literal entry index
+                uint32_t entry = arrays[ctr + index], active;
+                if (literal_value(mask, active) && active) {
+                    jit_var_inc_ref(entry);
+                    result = entry;
+                } else {
+                    uint64_t zero = 0;
+                    uint32_t zero_v = jit_var_literal(
+                        (JitBackend) s.backend, (VarType) s.type, &zero, 1);
+                    result = jit_var_select(mask, entry, zero_v);
+                    jit_var_dec_ref(zero_v);
+                }
+                ctr += stride;
+            } else {
+                result = jit_array_read(arrays[ctr++], index, mask);
+            }
             nb::object result_o = nb::inst_alloc(tp);
             s.init_index(result, inst_ptr(result_o));
             nb::inst_mark_ready(result_o);
@@ -115,9 +195,9 @@ nb::object Local::read(nb::handle index_, nb::handle mask_) const {
         }
     };
 
-    GetItemCallback cb(m_arrays,
-                       (uint32_t) supp(m_index_tp).index(inst_ptr(index)),
-                       (uint32_t) supp(m_mask_tp).index(inst_ptr(mask)));
+    GetItemCallback cb(m_arrays, register_index("read", index),
+                       (uint32_t) supp(m_mask_tp).index(inst_ptr(mask)),
+                       m_registers ? (uint32_t) m_length : 0u);
 
     nb::object result = traverse(m_dtype, m_value, nb::handle(), true, &cb);
 
@@ -139,10 +219,10 @@ void Local::write(nb::handle value_, nb::handle index_, nb::handle mask_) {
     /// Write to the variable arrays
     struct SetItemCallback : Callback {
         dr::vector<uint32_t> &arrays;
-        uint32_t index, mask, ctr;
+        uint32_t index, mask, ctr, stride;
         SetItemCallback(dr::vector<uint32_t> &arrays, uint32_t index,
-                        uint32_t mask)
-            : arrays(arrays), index(index), mask(mask), ctr(0) {}
+                        uint32_t mask, uint32_t stride)
+            : arrays(arrays), index(index), mask(mask), ctr(0), stride(stride) {}
 
         nb::object process(nb::handle tp, nb::handle,
                            nb::handle value) override {
@@ -156,6 +236,22 @@ void Local::write(nb::handle value_, nb::handle index_, nb::handle mask_) {
                           "must use 'drjit.detach()' to disable gradient "
                           "tracking of the written value.");
 
+            if (stride) {
+                // Register placement, 'index' is the literal entry index
+                uint32_t &entry = arrays[ctr + index];
+                uint32_t active, result;
+                if (literal_value(mask, active) && active) {
+                    jit_var_inc_ref((uint32_t) value_i);
+                    result = (uint32_t) value_i;
+                } else {
+                    result = jit_var_select(mask, (uint32_t) value_i, entry);
+                }
+                jit_var_dec_ref(entry);
+                entry = result;
+                ctr += stride;
+                return nb::object();
+            }
+
             uint32_t result =
                 jit_array_write(arrays[ctr], index, (uint32_t) value_i, mask);
             jit_var_dec_ref(arrays[ctr]);
@@ -164,9 +260,9 @@ void Local::write(nb::handle value_, nb::handle index_, nb::handle mask_) {
         }
     };
 
-    SetItemCallback cb(m_arrays,
-                       (uint32_t) supp(m_index_tp).index(inst_ptr(index)),
-                       (uint32_t) supp(m_mask_tp).index(inst_ptr(mask)));
+    SetItemCallback cb(m_arrays, register_index("write", index),
+                       (uint32_t) supp(m_mask_tp).index(inst_ptr(mask)),
+                       m_registers ? (uint32_t) m_length : 0u);
 
     traverse(m_dtype, m_value, value, false, &cb);
 
@@ -395,12 +491,14 @@ void export_local(nb::module_ &m) {
 
     m.def(
         "alloc_local",
-        [](nb::type_object h, size_t size, nb::handle value) {
-            return new Local(h, size, value);
+        [](nb::type_object h, size_t size, nb::handle value,
+           const char *placement) {
+            return new Local(h, size, value, placement);
         },
-        "dtype"_a, "size"_a, "value"_a = nb::none(),
+        "dtype"_a, "size"_a, "value"_a = nb::none(), "placement"_a = "auto",
         nb::rv_policy::take_ownership,
-        nb::sig("def alloc_local(dtype: type[T], size: int, value: T | None = None) "
+        nb::sig("def alloc_local(dtype: type[T], size: int, value: T | None = None, "
+                "placement: typing.Literal['auto', 'registers', 'shared', 'local'] = 'auto') "
                 "-> Local[T]"),
         doc_alloc_local
     );
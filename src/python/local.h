@@ -18,8 +18,14 @@ public:
     /**
      * \brief Allocate local memory to store a PyTree of type ``dtype`` with length
      * length ``length``. If desired, a default value can be specified.
+     *
+     * The ``placement`` argument (``"auto"``, ``"registers"``, ``"shared"``,
+     * or ``"local"``) selects where the buffer is stored. With
+     * ``"registers"``, each entry is represented by a separate ordinary
+     * variable, which requires all indices to be literal constants.
      */
-    Local(nb::handle dtype, size_t length, nb::handle value = nb::none());
+    Local(nb::handle dtype, size_t length, nb::handle value = nb::none(),
+          const char *placement = "auto");
 
     /// Copy constructor
     Local(const Local &l);
@@ -30,6 +36,9 @@ public:
     /// Return the length of the local memory region
     size_t len() const { return m_length; }
 
+    /// Are the entries stored in separate variables (i.e., registers)?
+    bool registers() const { return m_registers; }
+
     /// Return a human-readable description of the type
     nb::str repr() const;
 
@@ -48,12 +57,18 @@ public:
     const dr::vector<uint32_t> &arrays() const { return m_arrays; }
     dr::vector<uint32_t> &arrays() { return m_arrays; }
 
+protected:
+    /// Convert an index for read()/write(), checks literal-ness for register placement
+    uint32_t register_index(const char *name, nb::handle index) const;
+
 protected:
     nb::object m_dtype;
     size_t m_length;
     nb::object m_value;
+    /// Variable arrays, or ``m_length`` variables per leaf when ``m_registers`` is set
     dr::vector<uint32_t> m_arrays;
     JitBackend m_backend;
+    bool m_registers = false;
     nb::handle m_index_tp;
     nb::handle m_mask_tp;
 };
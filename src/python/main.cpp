@@ -37,11 +37,72 @@
 #include "texture.h"
 #include "history.h"
 #include "profile.h"
+#include "memory.h"
 #include "tracker.h"
 #include "local.h"
+#include "affinity.h"
+#include "parallel.h"
 
 static int active_backend = -1;
 
+/**
+ * Binding the array, matrix, tensor, texture, etc. types of a JIT backend
+ * accounts for a large part of the time needed to ``import drjit``. The
+ * following data structure and functions defer this step until an attribute
+ * of the associated Python module is first accessed.
+ */
+struct LazyModule {
+    /// Fully qualified module name
+    const char *name;
+
+    /// Function that binds the module contents
+    void (*bind)(nb::module_ &);
+
+    /// Module that must be bound first (e.g., ``drjit.llvm`` for ``drjit.llvm.ad``)
+    LazyModule *parent;
+
+    /// Was ``bind()`` called already?
+    bool bound;
+};
+
+static void lazy_bind(LazyModule &lm) {
+    if (lm.bound)
+        return;
+    lm.bound = true;
+    if (lm.parent)
+        lazy_bind(*lm.parent);
+    nb::module_ m = nb::module_::import_(lm.name);
+    lm.bind(m);
+}
+
+static void lazy_install(nb::module_ &m, LazyModule &lm) {
+    LazyModule *p = &lm;
+
+    m.def("__getattr__", [p](nb::handle key) -> nb::object {
+        lazy_bind(*p);
+
+        // Look up the module dictionary, since getattr() would recurse
+        PyObject *dict = PyModule_GetDict(nb::module_::import_(p->name).ptr()),
+                 *value = PyDict_GetItemWithError(dict, key.ptr());
+
+        if (!value) {
+            if (!PyErr_Occurred())
+                PyErr_Format(PyExc_AttributeError,
+                             "module '%s' has no attribute '%U'", p->name,
+                             key.ptr());
+            nb::raise_python_error();
+        }
+
+        return nb::borrow(value);
+    });
+
+    m.def("__dir__", [p]() -> nb::object {
+        lazy_bind(*p);
+        nb::module_ m = nb::module_::import_(p->name);
+        return nb::steal(PyDict_Keys(PyModule_GetDict(m.ptr())));
+    });
+}
+
 static void set_flag_py(JitFlag flag, bool value) {
     if (flag == JitFlag::Debug) {
         if (value)
@@ -166,14 +227,23 @@ NB_MODULE(_drjit_ext, m_) {
         .value("Clamp", dr::WrapMode::Clamp)
         .value("Mirror", dr::WrapMode::Mirror);
 
+    nb::enum_<dr::BlockFormat>(m, "BlockFormat", doc_BlockFormat)
+        .value("BC1", dr::BlockFormat::BC1, doc_BlockFormat_BC1)
+        .value("BC4", dr::BlockFormat::BC4, doc_BlockFormat_BC4)
+        .value("BC5", dr::BlockFormat::BC5, doc_BlockFormat_BC5);
+
     m.def("has_backend", &jit_has_backend, doc_has_backend);
 
+    m.def("cuda_device_count", &jit_cuda_device_count, doc_cuda_device_count)
+     .def("cuda_device", &jit_cuda_device, doc_cuda_device)
+     .def("set_cuda_device", &jit_cuda_set_device, "device"_a,
+          doc_set_cuda_device)
+     .def("sync_all_devices", &jit_sync_all_devices, doc_sync_all_devices);
+
     m.def("sync_thread", &jit_sync_thread, doc_sync_thread)
      .def("flush_kernel_cache", &jit_flush_kernel_cache, doc_flush_kernel_cache)
      .def("flush_malloc_cache", &jit_flush_malloc_cache, doc_flush_malloc_cache)
      .def("malloc_clear_statistics", &jit_malloc_clear_statistics)
-     .def("thread_count", &jit_llvm_thread_count, doc_thread_count)
-     .def("set_thread_count", &jit_llvm_set_thread_count, doc_set_thread_count)
      .def("expand_threshold", &jit_llvm_expand_threshold, doc_expand_threshold)
      .def("set_expand_threshold", &jit_llvm_set_expand_threshold, doc_set_expand_threshold);
 
@@ -203,6 +273,27 @@ NB_MODULE(_drjit_ext, m_) {
         .def("__exit__", &scoped_set_flag_py::__exit__, nb::arg().none(),
              nb::arg().none(), nb::arg().none());
 
+    struct scoped_set_device_py {
+        int device, backup = 0;
+        scoped_set_device_py(int device) : device(device) { }
+
+        void __enter__() {
+            backup = jit_cuda_device();
+            jit_cuda_set_device(device);
+        }
+
+        void __exit__(nb::handle, nb::handle, nb::handle) {
+            jit_cuda_set_device(backup);
+        }
+    };
+
+    nb::class_<scoped_set_device_py>(m, "scoped_set_device",
+                                     doc_scoped_set_device)
+        .def(nb::init<int>(), "device"_a)
+        .def("__enter__", &scoped_set_device_py::__enter__)
+        .def("__exit__", &scoped_set_device_py::__exit__, nb::arg().none(),
+             nb::arg().none(), nb::arg().none());
+
     // Intrusive reference counting
     nb::intrusive_init(
         [](PyObject *o) noexcept {
@@ -245,19 +336,26 @@ NB_MODULE(_drjit_ext, m_) {
     export_print(m);
     export_history(m);
     export_profile(m);
+    export_memory(m);
     export_tracker(detail);
     export_local(m);
+    export_affinity(m);
+    export_parallel(m);
 
     export_scalar(scalar);
 
 #if defined(DRJIT_ENABLE_LLVM)
-    export_llvm(llvm);
-    export_llvm_ad(llvm_ad);
+    static LazyModule llvm_lazy { "drjit.llvm", export_llvm, nullptr, false },
+                      llvm_ad_lazy { "drjit.llvm.ad", export_llvm_ad, &llvm_lazy, false };
+    lazy_install(llvm, llvm_lazy);
+    lazy_install(llvm_ad, llvm_ad_lazy);
 #endif
 
 #if defined(DRJIT_ENABLE_CUDA)
-    export_cuda(cuda);
-    export_cuda_ad(cuda_ad);
+    static LazyModule cuda_lazy { "drjit.cuda", export_cuda, nullptr, false },
+                      cuda_ad_lazy { "drjit.cuda.ad", export_cuda_ad, &cuda_lazy, false };
+    lazy_install(cuda, cuda_lazy);
+    lazy_install(cuda_ad, cuda_ad_lazy);
 #endif
 
     /// Automatic backend selection
@@ -17,6 +17,130 @@
 #include "autodiff.h"
 #include <nanobind/stl/optional.h>
 
+/// Collect the flat array types that make up an array-of-structures record
+static void record_types(const char *name, nb::handle tp,
+                         const ArraySupplement &word_supp,
+                         dr::vector<nb::handle> &out) {
+    if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
+        for (auto [k, v] : ds)
+            record_types(name, v, word_supp, out);
+        return;
+    }
+
+    if (is_drjit_type(tp)) {
+        const ArraySupplement &s = supp(tp);
+
+        if (!s.is_tensor && s.backend == word_supp.backend) {
+            if (s.ndim == 1 && s.shape[0] == DRJIT_DYNAMIC &&
+                jit_type_size((VarType) s.type) ==
+                    jit_type_size((VarType) word_supp.type)) {
+                out.push_back(tp);
+                return;
+            } else if (s.ndim > 1 && s.shape[0] != DRJIT_DYNAMIC) {
+                for (size_t i = 0; i < s.shape[0]; ++i)
+                    record_types(name, s.value, word_supp, out);
+                return;
+            }
+        }
+    }
+
+    nb::raise_type_error(
+        "drjit.%s(): type '%s' cannot be part of an array-of-structures "
+        "record. Records may only contain DRJIT_STRUCT types and static or "
+        "flat arrays of the same backend whose elements have the same size "
+        "as those of the flat array.", name, nb::type_name(tp).c_str());
+}
+
+/// Assemble a record of type 'tp' from consecutive words of a flat array
+static nb::object record_build(nb::handle tp, const nb::object *words,
+                               size_t &pos) {
+    if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
+        nb::object out = tp();
+        for (auto [k, v] : ds)
+            nb::setattr(out, k, record_build(v, words, pos));
+        return out;
+    }
+
+    const ArraySupplement &s = supp(tp);
+    if (s.ndim == 1) {
+        nb::object word = words[pos++];
+        if (!word.type().is(tp))
+            word = array_module.attr("reinterpret_array")(tp, word);
+        return word;
+    }
+
+    nb::object out = nb::inst_alloc(tp);
+    nb::inst_zero(out);
+    for (size_t i = 0; i < s.shape[0]; ++i)
+        out[i] = record_build(s.value, words, pos);
+    return out;
+}
+
+/// Flatten a record of type 'tp' into words of the flat array type 'word_tp'
+static void record_flatten(nb::handle tp, nb::handle value,
+                           nb::handle word_tp, nb::list &out) {
+    if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
+        for (auto [k, v] : ds)
+            record_flatten(v, nb::getattr(value, k), word_tp, out);
+        return;
+    }
+
+    const ArraySupplement &s = supp(tp);
+    nb::object o = nb::borrow(value);
+    if (!o.type().is(tp))
+        o = tp(o);
+
+    if (s.ndim == 1) {
+        if (!tp.is(word_tp))
+            o = array_module.attr("reinterpret_array")(word_tp, o);
+        out.append(o);
+    } else {
+        for (size_t i = 0; i < s.shape[0]; ++i)
+            record_flatten(s.value, o[i], word_tp, out);
+    }
+}
+
+/**
+ * Gather an array-of-structures record 'dtype' whose flat array fields are
+ * stored as consecutive words of 'source'. Records with a power-of-two
+ * number of words are fetched via a single packet gather.
+ */
+static nb::object gather_record(nb::type_object dtype, nb::object source,
+                                nb::object index, nb::object active,
+                                ReduceMode mode) {
+    nb::handle source_tp = source.type();
+    const ArraySupplement &source_supp = supp(source_tp);
+
+    dr::vector<nb::handle> types;
+    record_types("gather", dtype, source_supp, types);
+    size_t n = types.size();
+
+    dr::vector<nb::object> words(n, nb::object());
+    if (n > 1 && (n & (n - 1)) == 0) {
+        uint64_t source_index = source_supp.index(inst_ptr(source));
+        uint32_t offset_index = (uint32_t) supp(index.type()).index(inst_ptr(index));
+        uint32_t mask_index = (uint32_t) supp(active.type()).index(inst_ptr(active));
+        uint64_t *out_indices = (uint64_t *) alloca(sizeof(uint64_t) * n);
+        ad_var_gather_packet(n, source_index, offset_index, mask_index,
+                             out_indices, mode);
+        for (size_t i = 0; i < n; ++i) {
+            nb::object elem = inst_alloc(source_tp);
+            source_supp.init_index(out_indices[i], inst_ptr(elem));
+            nb::inst_mark_ready(elem);
+            ad_var_dec_ref(out_indices[i]);
+            words[i] = std::move(elem);
+        }
+    } else {
+        nb::int_ size_o(n);
+        for (size_t i = 0; i < n; ++i)
+            words[i] = gather(nb::borrow<nb::type_object>(source_tp), source,
+                              index * size_o + nb::int_(i), active, mode);
+    }
+
+    size_t pos = 0;
+    return record_build(dtype, words.data(), pos);
+}
+
 nb::object gather(nb::type_object dtype, nb::object source,
                   nb::object index, nb::object active,
                   ReduceMode mode, nb::handle shape) {
@@ -83,7 +207,9 @@ nb::object gather(nb::type_object dtype, nb::object source,
         }
     }
 
-    if (!is_drjit_type(dtype))
+    bool is_record = is_drjit_source_1d && get_drjit_struct(dtype).is_valid();
+
+    if (!is_drjit_type(dtype) && !is_record)
         nb::raise_type_error("drjit.gather(<%s>): unsupported dtype!",
                              nb::type_name(dtype).c_str());
 
@@ -125,6 +251,9 @@ nb::object gather(nb::type_object dtype, nb::object source,
         }
     }
 
+    if (is_record)
+        return gather_record(dtype, source, index, active, mode);
+
     const ArraySupplement &dtype_supp = supp(dtype);
     if (has_shape && nb::len(shape) != dtype_supp.ndim)
         nb::raise("drjit.gather(): the 'shape' parameter has an incorrect "
@@ -315,6 +444,40 @@ static void scatter_generic(const char *name, ReduceOp op, nb::object target,
         }
     }
 
+    if (get_drjit_struct(value_tp).is_valid()) {
+        // Scatter an array-of-structures record into consecutive words
+        dr::vector<nb::handle> types;
+        record_types(name, value_tp, target_supp, types);
+
+        nb::list words;
+        record_flatten(value_tp, value, target_tp, words);
+        size_t n = types.size();
+
+        if ((JitBackend) target_meta.backend != JitBackend::None && n > 1 &&
+            (n & (n - 1)) == 0 &&
+            (op == ReduceOp::Identity || op == ReduceOp::Add)) {
+            uint64_t target_index = target_supp.index(inst_ptr(target));
+            uint32_t offset_index = (uint32_t) supp(index.type()).index(inst_ptr(index));
+            uint32_t mask_index = (uint32_t) supp(active.type()).index(inst_ptr(active));
+            uint64_t *values = (uint64_t *) alloca(sizeof(uint64_t) * n);
+
+            for (size_t i = 0; i < n; ++i)
+                values[i] = target_supp.index(inst_ptr(words[i]));
+
+            uint64_t new_index = ad_var_scatter_packet(
+                n, target_index, values, offset_index, mask_index, op, mode);
+
+            target_supp.reset_index(new_index, inst_ptr(target));
+            ad_var_dec_ref(new_index);
+        } else {
+            nb::int_ size_o(n);
+            for (size_t i = 0; i < n; ++i)
+                scatter_generic(name, op, target, words[i],
+                                index * size_o + nb::int_(i), active, mode);
+        }
+        return;
+    }
+
     if (!is_drjit_type(value_tp)) {
         try {
             value = target.type()(value);
@@ -485,6 +648,21 @@ void scatter_add_kahan(nb::handle_t<dr::ArrayBase> target_1,
     if (!tp1.is(tp2))
         nb::raise("drjit.scatter_add_kahan(): 'target_1/2' have inconsistent types.");
 
+    if (s.is_tensor) {
+        // Accumulate into the flat storage of the tensors
+        nb::object array_1 = nb::steal(s.tensor_array(target_1.ptr())),
+                   array_2 = nb::steal(s.tensor_array(target_2.ptr()));
+
+        if (value.type().is(tp1))
+            value = nb::steal(s.tensor_array(value.ptr()));
+
+        scatter_add_kahan(nb::handle_t<dr::ArrayBase>(array_1.ptr()),
+                          nb::handle_t<dr::ArrayBase>(array_2.ptr()),
+                          std::move(value), std::move(index),
+                          std::move(active));
+        return;
+    }
+
     if (s.ndim != 1 ||
         (s.type != (uint8_t) VarType::Float32 &&
          s.type != (uint8_t) VarType::Float64) ||
@@ -572,6 +750,21 @@ static void ravel_recursive(nb::handle result, nb::handle value,
     }
 }
 
+/// Collect the flat arrays of a nested array, ordered by their output offset
+static void ravel_leaves(nb::handle value, const size_t *shape,
+                         const int64_t *strides, Py_ssize_t offset, int depth,
+                         int stop_depth, nb::object *leaves) {
+    if (depth == stop_depth) {
+        leaves[offset] = nb::borrow(value);
+    } else {
+        for (size_t i = 0; i < shape[depth]; ++i) {
+            ravel_leaves(value[i], shape, strides, offset, depth + 1,
+                         stop_depth, leaves);
+            offset += strides[depth];
+        }
+    }
+}
+
 nb::object ravel(nb::handle h, char order,
                  vector<size_t> *shape_out,
                  vector<int64_t> *strides_out,
@@ -663,27 +856,72 @@ nb::object ravel(nb::handle h, char order,
     m.ndim = 1;
     m.shape[0] = DRJIT_DYNAMIC;
 
+    // Number of flat arrays stored in a nested JIT array
+    size_t leaf_count = 1;
+    int stop_depth = (int) shape.size() - is_dynamic;
+    for (int i = 0; i < stop_depth; ++i)
+        leaf_count *= shape[i];
+
+    if (is_dynamic && leaf_count == 1) {
+        // The nested array wraps a single flat array, which is already contiguous
+        nb::object leaf = nb::borrow(h);
+        for (int i = 0; i < stop_depth; ++i)
+            leaf = leaf[0];
+
+        if (shape_out)
+            *shape_out = std::move(shape);
+        if (strides_out)
+            *strides_out = std::move(strides);
+        return leaf;
+    }
+
     size_t size = stride;
 
     // Create an empty array of the right shape
-    nb::object result = full("empty", meta_get_type(m), nb::handle(), 1, &size);
+    nb::handle result_tp = meta_get_type(m);
+    nb::object result = full("empty", result_tp, nb::handle(), 1, &size);
 
-    nb::handle index_dtype;
+    nb::handle index_dtype, mask_dtype;
     if (is_dynamic) {
         m.type = (uint16_t) VarType::UInt32;
         index_dtype = meta_get_type(m);
+        m.type = (uint16_t) VarType::Bool;
+        mask_dtype = meta_get_type(m);
     }
 
-    if (is_dynamic && (order == 'A' || order == 'F') && shape.size() == 2 &&
-        shape[0] > 1 && ((shape[0]-1) & shape[0])==0) {
-        // Reduce via dr.scatter() to benefit from new packet write feature for power-of-two sized ravels
-        scatter(result, nb::borrow(h),
-                arange(nb::borrow<nb::type_object_t<ArrayBase>>(index_dtype), 0,
-                       shape[1], 1),
-                nb::bool_(true), ReduceMode::Permute);
+    if (is_dynamic && backend != JitBackend::None &&
+        (order == 'A' || order == 'F') && leaf_count > 1 &&
+        (leaf_count & (leaf_count - 1)) == 0) {
+        /* In F-style order, the flat arrays are interleaved. Write them using
+           a single packet scatter (including nested types like matrices) */
+        dr::vector<nb::object> leaves(leaf_count, nb::object());
+        ravel_leaves(h, shape.data(), strides.data(), 0, 0, stop_depth,
+                     leaves.data());
+
+        nb::object index = arange(
+            nb::borrow<nb::type_object_t<ArrayBase>>(index_dtype), 0,
+            (Py_ssize_t) shape[stop_depth], 1);
+        nb::object active = mask_dtype(true);
+
+        const ArraySupplement &rs = supp(result_tp);
+        uint64_t *values = (uint64_t *) alloca(sizeof(uint64_t) * leaf_count);
+        for (size_t i = 0; i < leaf_count; ++i) {
+            if (!leaves[i].type().is(result_tp))
+                leaves[i] = result_tp(leaves[i]);
+            values[i] = rs.index(inst_ptr(leaves[i]));
+        }
+
+        uint64_t new_index = ad_var_scatter_packet(
+            leaf_count, rs.index(inst_ptr(result)), values,
+            (uint32_t) supp(index.type()).index(inst_ptr(index)),
+            (uint32_t) supp(active.type()).index(inst_ptr(active)),
+            ReduceOp::Identity, ReduceMode::Permute);
+
+        rs.reset_index(new_index, inst_ptr(result));
+        ad_var_dec_ref(new_index);
     } else {
         ravel_recursive(result, h, index_dtype, shape.data(), strides.data(), 0, 0,
-                        (int) shape.size() - is_dynamic);
+                        stop_depth);
     }
 
     if (shape_out)
@@ -727,6 +965,27 @@ static nb::object unravel_recursive(nb::handle dtype,
     }
 }
 
+/// Assemble a nested array from flat arrays ordered by their input offset
+static nb::object unravel_assemble(nb::handle dtype, const nb::object *leaves,
+                                   const Py_ssize_t *shape,
+                                   const Py_ssize_t *strides,
+                                   Py_ssize_t offset, int depth,
+                                   int stop_depth) {
+    if (depth == stop_depth)
+        return leaves[offset];
+
+    const ArraySupplement &s = supp(dtype);
+
+    nb::object result = dtype();
+    for (Py_ssize_t i = 0; i < shape[depth]; ++i) {
+        result[i] = unravel_assemble(s.value, leaves, shape, strides, offset,
+                                     depth + 1, stop_depth);
+        offset += strides[depth];
+    }
+
+    return result;
+}
+
 nb::object unravel(const nb::type_object_t<ArrayBase> &dtype,
                    nb::handle_t<ArrayBase> array, char order) {
     const ArraySupplement &s = supp(dtype);
@@ -741,7 +1000,7 @@ nb::object unravel(const nb::type_object_t<ArrayBase> &dtype,
     m.is_valid = 1;
     m.ndim = 1;
     m.shape[0] = DRJIT_DYNAMIC;
-    nb::handle flat = meta_get_type(m);
+    nb::handle flat = meta_get_type(m), leaf_tp = flat;
 
     if (!flat.is(array.type())) {
         m2 = m;
@@ -798,24 +1057,58 @@ nb::object unravel(const nb::type_object_t<ArrayBase> &dtype,
             "drjit.unravel(): order parameter must equal 'C' or 'F'.");
     }
 
-    nb::handle index_dtype;
+    nb::handle index_dtype, mask_dtype;
     bool is_dynamic = s.shape[s.ndim - 1] == DRJIT_DYNAMIC;
     if (is_dynamic) {
         m.type = (uint16_t) VarType::UInt32;
         index_dtype = meta_get_type(m);
+        m.type = (uint16_t) VarType::Bool;
+        mask_dtype = meta_get_type(m);
     }
 
-    if (is_dynamic && (order == 'A' || order == 'F') && s.ndim == 2 &&
-        s.shape[0] > 1 && ((s.shape[0]-1) & s.shape[0])==0) {
-        // Potentially use dr.gather() to benefit from new packet gather feature for power-of-two sized unravels
-        return gather(
-            dtype, nb::borrow(array),
-            arange(nb::borrow<nb::type_object_t<ArrayBase>>(index_dtype), 0,
-                   shape[1], 1),
-            nb::bool_(true));
+    // Number of flat arrays stored in 'dtype'
+    int stop_depth = ndim - is_dynamic;
+    size_t leaf_count = 1;
+    for (int i = 0; i < stop_depth; ++i)
+        leaf_count *= (size_t) shape[i];
+
+    if (is_dynamic && leaf_count == 1) {
+        // The nested array wraps a single flat array, which is already contiguous
+        nb::object leaf = array.type().is(leaf_tp) ? nb::borrow(array)
+                                                   : leaf_tp(array);
+        return unravel_assemble(dtype, &leaf, shape, strides, 0, 0, stop_depth);
+    } else if (is_dynamic && (JitBackend) s.backend != JitBackend::None &&
+               (order == 'A' || order == 'F') && leaf_count > 1 &&
+               (leaf_count & (leaf_count - 1)) == 0) {
+        /* In F-style order, the flat arrays are interleaved. Fetch them using
+           a single packet gather (including nested types like matrices) */
+        nb::object index = arange(
+            nb::borrow<nb::type_object_t<ArrayBase>>(index_dtype), 0,
+            shape[stop_depth], 1);
+        nb::object active = mask_dtype(true);
+
+        uint64_t *out = (uint64_t *) alloca(sizeof(uint64_t) * leaf_count);
+        ad_var_gather_packet(
+            leaf_count, supp(array.type()).index(inst_ptr(array)),
+            (uint32_t) supp(index.type()).index(inst_ptr(index)),
+            (uint32_t) supp(active.type()).index(inst_ptr(active)), out,
+            ReduceMode::Auto);
+
+        const ArraySupplement &ls = supp(leaf_tp);
+        dr::vector<nb::object> leaves(leaf_count, nb::object());
+        for (size_t i = 0; i < leaf_count; ++i) {
+            nb::object leaf = inst_alloc(leaf_tp);
+            ls.init_index(out[i], inst_ptr(leaf));
+            nb::inst_mark_ready(leaf);
+            ad_var_dec_ref(out[i]);
+            leaves[i] = std::move(leaf);
+        }
+
+        return unravel_assemble(dtype, leaves.data(), shape, strides, 0, 0,
+                                stop_depth);
     } else {
         return unravel_recursive(dtype, array, index_dtype, shape, strides, 0, 0,
-                                 (int) ndim - index_dtype.is_valid());
+                                 stop_depth);
     }
 }
 
@@ -1078,25 +1371,43 @@ static nb::object repeat_or_tile(nb::handle h, size_t count, bool tile) {
             size_t size     = s.len(inst_ptr(h1)),
                    combined = count * size;
 
-            if (combined) {
-                ArrayMeta m = s;
-                m.type = (uint16_t) VarType::UInt32;
-
-                nb::object index = arange(
-                    nb::borrow<nb::type_object_t<ArrayBase>>(meta_get_type(m)),
-                    0, (Py_ssize_t) combined, 1),
-                    divisor_o = nb::int_(tile ? size : count);
-
-                nb::object result = gather(
-                    nb::borrow<nb::type_object>(h1.type()),
-                    nb::borrow(h1),
-                    tile ? (index % divisor_o) : index.floor_div(divisor_o),
-                    nb::bool_(true),
-                    ReduceMode::Auto
-                );
-
+            if (!combined)
+                return;
+
+            // Literals and single-element arrays broadcast. Resize them
+            // instead of gathering, which would force an evaluation of the
+            // input and issue a load per lane in the consuming kernel.
+            uint64_t var_index = s.index(inst_ptr(h1));
+            if ((var_index >> 32) == 0 && (uint32_t) var_index &&
+                (size == 1 ||
+                 jit_var_state((uint32_t) var_index) == VarState::Literal)) {
+                uint32_t new_index =
+                    jit_var_resize((uint32_t) var_index, combined);
+                nb::object result = nb::inst_alloc(h1.type());
+                s.init_index(new_index, inst_ptr(result));
+                jit_var_dec_ref(new_index);
+                nb::inst_mark_ready(result);
                 nb::inst_replace_move(h2, result);
+                return;
             }
+
+            ArrayMeta m = s;
+            m.type = (uint16_t) VarType::UInt32;
+
+            nb::object index = arange(
+                nb::borrow<nb::type_object_t<ArrayBase>>(meta_get_type(m)),
+                0, (Py_ssize_t) combined, 1),
+                divisor_o = nb::int_(tile ? size : count);
+
+            nb::object result = gather(
+                nb::borrow<nb::type_object>(h1.type()),
+                nb::borrow(h1),
+                tile ? (index % divisor_o) : index.floor_div(divisor_o),
+                nb::bool_(true),
+                ReduceMode::Auto
+            );
+
+            nb::inst_replace_move(h2, result);
         }
     };
 
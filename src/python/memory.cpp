@@ -0,0 +1,266 @@
+/*
+    memory.cpp -- memory usage accounting (drjit.memory_report() and the
+    memory monitor)
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include "memory.h"
+#include "apply.h"
+#include "init.h"
+#include <nanobind/stl/string.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdio>
+#include <algorithm>
+
+#if !defined(_WIN32)
+#  include <unistd.h>
+#endif
+
+/// Accumulated statistics of a profile range (identified by its label path)
+struct RangeMemory {
+    size_t count = 0;
+    int64_t retained = 0;
+    size_t peak = 0;
+};
+
+/// A currently active profile range
+struct OpenRange {
+    std::string label;
+    size_t entry, peak;
+};
+
+bool memory_monitor_active = false;
+static size_t memory_threshold = 0;
+static size_t memory_peak = 0;
+static bool memory_in_callback = false;
+static nb::handle memory_callback;
+static std::unordered_map<std::string, RangeMemory> memory_ranges;
+static dr::vector<OpenRange> memory_open;
+
+/// Resident set size of the process (Linux), or zero if unavailable
+static size_t memory_host_used() {
+    size_t result = 0;
+#if defined(__linux__)
+    if (FILE *f = fopen("/proc/self/statm", "r")) {
+        unsigned long long size, resident;
+        if (fscanf(f, "%llu %llu", &size, &resident) == 2)
+            result = (size_t) resident * (size_t) sysconf(_SC_PAGESIZE);
+        fclose(f);
+    }
+#endif
+    return result;
+}
+
+/**
+ * Memory used on the active CUDA device if the CUDA backend is available,
+ * otherwise the resident memory of the process. The second value is the
+ * capacity of the device (or zero when unknown).
+ */
+static std::pair<size_t, size_t> memory_used() {
+    size_t free = 0, total = 0;
+    if (jit_has_backend(JitBackend::CUDA) && cuda_mem_info(&free, &total))
+        return { total - free, total };
+    return { memory_host_used(), 0 };
+}
+
+size_t memory_sample() {
+    if (!memory_monitor_active)
+        return 0;
+
+    size_t used = memory_used().first;
+    if (used > memory_peak)
+        memory_peak = used;
+    for (OpenRange &r : memory_open) {
+        if (used > r.peak)
+            r.peak = used;
+    }
+    return used;
+}
+
+void memory_range_push(const char *label) {
+    if (!memory_monitor_active)
+        return;
+
+    std::string path = memory_open.empty()
+                           ? std::string(label)
+                           : memory_open[memory_open.size() - 1].label + "/" + label;
+    size_t used = memory_sample();
+    memory_open.push_back({ std::move(path), used, used });
+}
+
+void memory_range_pop() {
+    if (!memory_monitor_active || memory_open.empty())
+        return;
+
+    size_t used = memory_sample();
+    OpenRange r = memory_open[memory_open.size() - 1];
+    memory_open.pop_back();
+
+    RangeMemory &m = memory_ranges[r.label];
+    m.count++;
+    m.retained += (int64_t) used - (int64_t) r.entry;
+    if (r.peak - r.entry > m.peak)
+        m.peak = r.peak - r.entry;
+}
+
+void memory_check(nb::handle h) {
+    if (!memory_monitor_active || memory_in_callback)
+        return;
+
+    // Bytes allocated by the outputs of the upcoming evaluation
+    struct ProjectedBytes : TraverseCallback {
+        size_t bytes = 0;
+        void operator()(nb::handle h) override {
+            const ArraySupplement &s = supp(h.type());
+            if (!s.index)
+                return;
+            uint32_t index = (uint32_t) s.index(inst_ptr(h));
+            if (index && jit_var_state(index) == VarState::Unevaluated)
+                bytes += jit_var_size(index) * jit_type_size(jit_var_type(index));
+        }
+    };
+
+    ProjectedBytes pb;
+    traverse("drjit.eval", pb, h);
+
+    size_t used = memory_sample();
+    if (!memory_callback.is_valid() || !memory_threshold ||
+        used + pb.bytes <= memory_threshold)
+        return;
+
+    nb::dict info;
+    info["used"] = used;
+    info["projected"] = pb.bytes;
+    info["threshold"] = memory_threshold;
+    size_t total = memory_used().second;
+    info["total"] = total ? nb::int_(total) : nb::none();
+
+    memory_in_callback = true;
+    try {
+        memory_callback(info);
+    } catch (...) {
+        memory_in_callback = false;
+        throw;
+    }
+    memory_in_callback = false;
+}
+
+static void enable_memory_monitor(size_t threshold, nb::handle callback) {
+    memory_callback.dec_ref();
+    memory_callback = callback.is_none() ? nb::handle() : callback.inc_ref();
+    memory_threshold = threshold;
+    memory_ranges.clear();
+    memory_open.clear();
+    memory_monitor_active = true;
+    memory_peak = memory_used().first;
+}
+
+static void disable_memory_monitor() {
+    memory_callback.dec_ref();
+    memory_callback = nb::handle();
+    memory_threshold = 0;
+    memory_ranges.clear();
+    memory_open.clear();
+    memory_monitor_active = false;
+}
+
+static nb::dict memory_report(nb::args roots) {
+    // Live bytes of evaluated JIT arrays reachable from 'roots'
+    struct LiveBytes : TraverseCallback {
+        std::unordered_set<uint32_t> visited;
+        nb::dict labels;
+
+        void operator()(nb::handle h) override {
+            const ArraySupplement &s = supp(h.type());
+            if (!s.index)
+                return;
+            uint32_t index = (uint32_t) s.index(inst_ptr(h));
+            if (!index || !visited.insert(index).second ||
+                jit_var_state(index) != VarState::Evaluated)
+                return;
+
+            const char *label = jit_var_label(index);
+            nb::str key(label ? label : "");
+            size_t bytes = jit_var_size(index) * jit_type_size(jit_var_type(index));
+
+            nb::object entry = labels.get(key, nb::none());
+            if (entry.is_none()) {
+                nb::dict d;
+                d["live"] = bytes;
+                d["arrays"] = 1;
+                labels[key] = d;
+            } else {
+                entry["live"] = nb::cast<size_t>(entry["live"]) + bytes;
+                entry["arrays"] = nb::cast<size_t>(entry["arrays"]) + 1;
+            }
+        }
+    };
+
+    LiveBytes lb;
+    traverse("drjit.memory_report", lb, roots);
+
+    // Memory held by the AD graph (gradients and edge weights)
+    struct ADBytes {
+        nb::dict labels;
+        size_t total = 0;
+    } ab;
+
+    ad_var_memory(
+        [](void *payload, const char *label, size_t grad_bytes, size_t edge_bytes) {
+            ADBytes &ab = *(ADBytes *) payload;
+            nb::str key(label);
+            nb::object entry = ab.labels.get(key, nb::none());
+            if (entry.is_none()) {
+                nb::dict d;
+                d["grad"] = grad_bytes;
+                d["edges"] = edge_bytes;
+                ab.labels[key] = d;
+            } else {
+                entry["grad"] = nb::cast<size_t>(entry["grad"]) + grad_bytes;
+                entry["edges"] = nb::cast<size_t>(entry["edges"]) + edge_bytes;
+            }
+            ab.total += grad_bytes + edge_bytes;
+        }, &ab);
+
+    nb::dict ranges;
+    for (auto &[label, m] : memory_ranges) {
+        nb::dict d;
+        d["count"] = m.count;
+        d["retained"] = m.retained;
+        d["peak"] = m.peak;
+        ranges[nb::str(label.c_str(), label.size())] = d;
+    }
+
+    auto [used, total] = memory_used();
+    bool cuda = total != 0;
+
+    nb::dict result;
+    result["device"] = cuda ? "cuda" : "host";
+    result["used"] = used;
+    result["total"] = cuda ? nb::int_(total) : nb::none();
+    result["peak"] = memory_monitor_active ? nb::int_(std::max(memory_peak, used))
+                                           : nb::none();
+    result["labels"] = lb.labels;
+    result["ad"] = ab.labels;
+    result["ad_total"] = ab.total;
+    result["ranges"] = ranges;
+    return result;
+}
+
+void export_memory(nb::module_ &m) {
+    m.def("memory_report", &memory_report, doc_memory_report,
+          nb::sig("def memory_report(*roots: object) -> dict"))
+     .def("enable_memory_monitor", &enable_memory_monitor,
+          "threshold"_a = 0, "callback"_a = nb::none(),
+          doc_enable_memory_monitor,
+          nb::sig("def enable_memory_monitor(threshold: int = 0, callback: typing.Callable[[dict], None] | None = None) -> None"))
+     .def("disable_memory_monitor", &disable_memory_monitor,
+          doc_disable_memory_monitor);
+}
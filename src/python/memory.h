@@ -0,0 +1,34 @@
+/*
+    memory.h -- memory usage accounting (drjit.memory_report() and the
+    memory monitor)
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+#include "common.h"
+
+/// Was the memory monitor enabled via ``drjit.enable_memory_monitor()``?
+extern bool memory_monitor_active;
+
+/// Record memory usage at the beginning/end of a 'drjit.profile_range'
+extern void memory_range_push(const char *label);
+extern void memory_range_pop();
+
+/**
+ * \brief Invoked by ``drjit.eval()`` before evaluating the PyTree ``h``.
+ *
+ * Samples the memory usage and calls the user-provided callback if the
+ * evaluation would exceed the configured threshold.
+ */
+extern void memory_check(nb::handle h);
+
+/// Sample the memory usage (e.g., following an evaluation) and return it
+extern size_t memory_sample();
+
+extern void export_memory(nb::module_ &);
@@ -0,0 +1,66 @@
+/*
+    parallel.cpp -- task-parallel execution of Python code on Dr.Jit's
+    thread pool (drjit.parallel_for())
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include "parallel.h"
+#include <nanothread/nanothread.h>
+#include <exception>
+#include <vector>
+
+struct ParallelForContext {
+    nb::handle fn;
+    std::vector<nb::object> results;
+    std::vector<std::exception_ptr> errors;
+};
+
+static void parallel_for_task(uint32_t index, void *payload) {
+    ParallelForContext *ctx = (ParallelForContext *) payload;
+
+    // The JIT and AD layers maintain per-thread state. Each task therefore
+    // records into the scope of the worker that runs it.
+    nb::gil_scoped_acquire guard;
+    try {
+        ctx->results[index] = ctx->fn(index);
+    } catch (...) {
+        ctx->errors[index] = std::current_exception();
+    }
+}
+
+static nb::list parallel_for(uint32_t n, nb::callable fn) {
+    if (jit_flag(JitFlag::SymbolicScope))
+        nb::raise("drjit.parallel_for(): cannot be called within a symbolic "
+                  "operation (e.g., a loop, conditional, or call)!");
+
+    ParallelForContext ctx;
+    ctx.fn = fn;
+    ctx.results.resize(n);
+    ctx.errors.resize(n);
+
+    if (n > 0) {
+        nb::gil_scoped_release guard;
+        task_wait_and_release(task_submit_dep(
+            nullptr, nullptr, 0, n, parallel_for_task, &ctx));
+    }
+
+    // Join deterministically: report the failure of the first failing task
+    for (std::exception_ptr &e : ctx.errors) {
+        if (e)
+            std::rethrow_exception(e);
+    }
+
+    nb::list result;
+    for (nb::object &o : ctx.results)
+        result.append(o);
+    return result;
+}
+
+void export_parallel(nb::module_ &m) {
+    m.def("parallel_for", &parallel_for, "n"_a, "fn"_a, doc_parallel_for);
+}
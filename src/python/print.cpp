@@ -39,9 +39,13 @@ struct suspend_grad_simple {
 
 /// Convert a Dr.Jit array into a human-readable representation. Used by
 /// drjit.print(), drjit.format(), and drjit.ArrayBase.__repr__()
+///
+/// When ``full_shape`` is specified, ``h`` is a compact array produced by
+/// repr_compact(), and the skipped entries are inferred from the difference.
 static void repr_array(Buffer &buffer, nb::handle h, size_t indent,
                        size_t threshold, const vector<size_t> &shape,
-                       size_t depth, nb::list &index) {
+                       size_t depth, nb::list &index,
+                       const vector<size_t> *full_shape = nullptr) {
     const ArraySupplement &s = supp(h.type());
 
     size_t ndim = shape.size();
@@ -93,17 +97,31 @@ static void repr_array(Buffer &buffer, nb::handle h, size_t indent,
         else
             buffer.put_dstr(nb::str(o).c_str());
     } else {
+        size_t full_size = full_shape ? (*full_shape)[i] : size;
+
         buffer.put('[');
         for (size_t j = 0; j < size; ++j) {
             index[i] = nb::cast(j);
             size_t edge_items = 3;
 
-            if (size > threshold && j == edge_items) {
+            if (full_size != size && j == edge_items) {
+                // Entries were already removed by repr_compact()
+                buffer.fmt(".. %zu skipped ..", full_size - size);
+                if (last_dim) {
+                    buffer.put(", ");
+                } else {
+                    buffer.put(",\n");
+                    buffer.put(' ', indent + 1);
+                }
+            }
+
+            if (full_size == size && size > threshold && j == edge_items) {
                 size_t j2 = size - edge_items - 1;
                 buffer.fmt(".. %zu skipped ..", (size_t) (j2 - j + 1));
                 j = j2;
             } else if (!last_dim) {
-                repr_array(buffer, h, indent + 1, threshold, shape, depth + 1, index);
+                repr_array(buffer, h, indent + 1, threshold, shape, depth + 1,
+                           index, full_shape);
             } else {
                 nb::object o = h[nb::tuple(index)];
 
@@ -131,6 +149,104 @@ static void repr_array(Buffer &buffer, nb::handle h, size_t indent,
     }
 }
 
+/**
+ * Large arrays are displayed in abbreviated form, but reading the displayed
+ * entries one at a time from a JIT array involves a separate device-to-host
+ * transfer for each of them. This function instead gathers all displayed
+ * entries into a compact array that is evaluated in one step. It returns an
+ * invalid object when no entries are skipped or the array type is not
+ * supported. Otherwise, ``shape_out`` receives the shape of the result.
+ */
+static nb::object repr_compact(nb::handle h, size_t threshold,
+                               const vector<size_t> &shape,
+                               vector<size_t> &shape_out) {
+    const ArraySupplement &s = supp(h.type());
+    JitBackend backend = (JitBackend) s.backend;
+    const size_t edge_items = 3;
+
+    if (backend == JitBackend::None || shape.empty())
+        return { };
+
+    dr::vector<uint32_t> index;
+    shape_out = shape;
+
+    if (s.is_tensor) {
+        bool skip = false;
+        for (size_t &n : shape_out) {
+            if (n > threshold && n > 2 * edge_items) {
+                n = 2 * edge_items;
+                skip = true;
+            }
+        }
+        if (!skip)
+            return { };
+
+        // Flat index of each displayed entry in C-style order
+        size_t ndim = shape.size(), count = 1;
+        for (size_t n : shape_out)
+            count *= n;
+
+        for (size_t k = 0; k < count; ++k) {
+            size_t rem = k, offset = 0, stride = 1;
+            for (size_t d = ndim; d-- > 0; ) {
+                size_t c = rem % shape_out[d];
+                rem /= shape_out[d];
+                if (shape[d] != shape_out[d] && c >= edge_items)
+                    c += shape[d] - 2 * edge_items;
+                offset += c * stride;
+                stride *= shape[d];
+            }
+            index.push_back((uint32_t) offset);
+        }
+    } else {
+        // Only the trailing dimension may be dynamic
+        for (size_t k = 0; k + 1 < s.ndim; ++k) {
+            if (s.shape[k] == DRJIT_DYNAMIC)
+                return { };
+        }
+
+        size_t n = shape.back();
+        if (n <= threshold || n <= 2 * edge_items)
+            return { };
+
+        shape_out.back() = 2 * edge_items;
+        for (size_t k = 0; k < edge_items; ++k)
+            index.push_back((uint32_t) k);
+        for (size_t k = n - edge_items; k < n; ++k)
+            index.push_back((uint32_t) k);
+    }
+
+    ArrayMeta m { };
+    m.backend = (uint16_t) backend;
+    m.type = (uint16_t) VarType::UInt32;
+    m.ndim = 1;
+    m.shape[0] = DRJIT_DYNAMIC;
+    nb::handle index_tp = meta_get_type(m);
+
+    uint32_t index_id = jit_var_mem_copy(backend, AllocType::Host, VarType::UInt32,
+                                         index.data(), index.size());
+    nb::object index_o = nb::inst_alloc(index_tp);
+    supp(index_tp).init_index(index_id, inst_ptr(index_o));
+    jit_var_dec_ref(index_id);
+    nb::inst_mark_ready(index_o);
+
+    suspend_grad_simple guard;
+    nb::object result;
+
+    if (s.is_tensor) {
+        nb::object flat = nb::steal(s.tensor_array(h.ptr()));
+        flat = gather(nb::borrow<nb::type_object>(flat.type()), flat, index_o,
+                      nb::cast(true));
+        result = h.type()(flat, cast_shape(shape_out));
+    } else {
+        result = gather(nb::borrow<nb::type_object>(h.type()), nb::borrow(h),
+                        index_o, nb::cast(true));
+    }
+
+    eval(result);
+    return result;
+}
+
 PyObject *tp_repr(PyObject *self) noexcept {
     try {
         vector<size_t> shape;
@@ -144,8 +260,14 @@ PyObject *tp_repr(PyObject *self) noexcept {
                 index.append(zero);
             if (!index.is_valid())
                 nb::raise_python_error();
-            schedule(self);
-            repr_array(buffer, self, 0, 20, shape, 0, index);
+            vector<size_t> compact_shape;
+            nb::object compact = repr_compact(self, 20, shape, compact_shape);
+            if (compact.is_valid()) {
+                repr_array(buffer, compact, 0, 20, compact_shape, 0, index, &shape);
+            } else {
+                schedule(self);
+                repr_array(buffer, self, 0, 20, shape, 0, index);
+            }
         }
         return PyUnicode_FromString(buffer.get());
     } catch (nb::python_error &e) {
@@ -178,7 +300,13 @@ void repr_general(Buffer &buffer, nb::handle h, size_t indent_, size_t threshold
                 index.append(zero);
             if (!index.is_valid())
                 nb::raise_python_error();
-            repr_array(buffer, h, indent_, threshold, shape, 0, index);
+            vector<size_t> compact_shape;
+            nb::object compact = repr_compact(h, threshold, shape, compact_shape);
+            if (compact.is_valid())
+                repr_array(buffer, compact, indent_, threshold, compact_shape,
+                           0, index, &shape);
+            else
+                repr_array(buffer, h, indent_, threshold, shape, 0, index);
         }
     } else if (tp.is(&PyUnicode_Type)) {
         if (indent > 2)
@@ -9,16 +9,206 @@
 */
 
 #include "profile.h"
+#include "history.h"
+#include "memory.h"
+#include <nanobind/stl/string.h>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <functional>
+
+/// Span captured by the built-in tracer
+struct TraceRecord {
+    std::string name;
+    const char *category;
+    std::string file;
+    uint32_t line = 0;
+    uint64_t start = 0, end = 0;
+    uint64_t thread = 0;
+    /// 1-based index of the enclosing span (zero if there is none)
+    uint32_t parent = 0;
+    /// Kernel-specific information
+    uint64_t size = 0;
+    bool cache_hit = false;
+};
+
+bool trace_active = false;
+static bool trace_kernels = false, trace_history_backup = false;
+static dr::vector<TraceRecord> trace_records;
+static std::string trace_prefix;
+static thread_local dr::vector<uint32_t> trace_stack;
+
+/// Wall clock time in nanoseconds since the UNIX epoch
+static uint64_t trace_time() {
+    return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t trace_thread() {
+    return (uint64_t) std::hash<std::thread::id>()(std::this_thread::get_id());
+}
+
+/// Find the innermost Python frame outside of the Dr.Jit package
+static void trace_callsite(TraceRecord &r) {
+    nb::object frame = nb::module_::import_("sys").attr("_getframe")(0);
+
+    while (!frame.is_none()) {
+        nb::object code = frame.attr("f_code");
+        std::string file = nb::cast<std::string>(code.attr("co_filename"));
+        if (trace_prefix.empty() || file.compare(0, trace_prefix.size(), trace_prefix) != 0) {
+            r.file = std::move(file);
+            r.line = nb::cast<uint32_t>(frame.attr("f_lineno"));
+            return;
+        }
+        frame = frame.attr("f_back");
+    }
+}
+
+/**
+ * Turn kernel launches since the previous call into records nested within
+ * the innermost open span. Dr.Jit-Core only reports their duration, hence
+ * they are placed back-to-back so that the last one ends at the current time.
+ */
+static void trace_flush_kernels() {
+    if (!trace_kernels)
+        return;
+
+    dr::vector<HistoryRecord> history;
+    history_take(history);
+
+    uint32_t parent = trace_stack.empty() ? 0 : trace_stack.back();
+    uint64_t time = trace_time(), total = 0;
+    for (HistoryRecord &h : history)
+        total += (uint64_t) (h.entry.execution_time * 1000.0);
+    time = time > total ? time - total : 0;
+
+    for (HistoryRecord &h : history) {
+        const KernelHistoryEntry &e = h.entry;
+        TraceRecord r;
+        if (e.type == KernelType::JIT) {
+            char kernel_hash[33];
+            snprintf(kernel_hash, sizeof(kernel_hash), "%016llx%016llx",
+                     (unsigned long long) e.hash[1],
+                     (unsigned long long) e.hash[0]);
+            r.name = kernel_hash;
+            r.cache_hit = e.cache_hit;
+        } else {
+            r.name = e.type == KernelType::Reduce ? "reduce" : "other";
+        }
+        r.category = "kernel";
+        r.start = time;
+        r.end = time += (uint64_t) (e.execution_time * 1000.0);
+        r.thread = trace_thread();
+        r.parent = parent;
+        r.size = e.size;
+        if (parent) {
+            r.file = trace_records[parent - 1].file;
+            r.line = trace_records[parent - 1].line;
+        }
+        trace_records.push_back(std::move(r));
+        free(h.entry.ir);
+    }
+}
+
+void trace_span::begin(const char *name, const char *category) {
+    trace_flush_kernels();
+
+    TraceRecord r;
+    r.name = name;
+    r.category = category;
+    r.thread = trace_thread();
+    r.parent = trace_stack.empty() ? 0 : trace_stack.back();
+    trace_callsite(r);
+    r.start = trace_time();
+
+    trace_records.push_back(std::move(r));
+    id = (uint32_t) trace_records.size();
+    trace_stack.push_back(id);
+}
+
+void trace_span::end() {
+    // The tracer was restarted while this span was open
+    if (!trace_active || id > trace_records.size())
+        return;
+
+    trace_flush_kernels();
+    trace_records[id - 1].end = trace_time();
+    if (!trace_stack.empty() && trace_stack.back() == id)
+        trace_stack.pop_back();
+}
+
+static void trace_start(bool kernels) {
+    trace_records.clear();
+    trace_stack.clear();
+
+    nb::object drjit_path = nb::module_::import_("os.path").attr("dirname")(
+        nb::module_::import_("drjit").attr("__file__"));
+    trace_prefix = nb::cast<std::string>(drjit_path);
+
+    if (trace_active && trace_kernels)
+        jit_set_flag(JitFlag::KernelHistory, trace_history_backup);
+
+    trace_kernels = kernels;
+    trace_active = true;
+    if (kernels) {
+        trace_history_backup = jit_flag(JitFlag::KernelHistory);
+        jit_set_flag(JitFlag::KernelHistory, true);
+    }
+}
+
+static nb::list trace_stop() {
+    nb::list result;
+    if (!trace_active)
+        return result;
+
+    trace_flush_kernels();
+    uint64_t now = trace_time();
+
+    for (const TraceRecord &r : trace_records) {
+        nb::dict d;
+        d["name"] = r.name;
+        d["category"] = r.category;
+        d["start"] = r.start;
+        d["end"] = r.end ? r.end : now;
+        d["thread"] = r.thread;
+        d["file"] = r.file;
+        d["line"] = r.line;
+        d["parent"] = r.parent ? nb::int_(r.parent - 1) : nb::none();
+        if (strcmp(r.category, "kernel") == 0) {
+            d["size"] = r.size;
+            d["cache_hit"] = r.cache_hit;
+        }
+        result.append(d);
+    }
+
+    if (trace_kernels)
+        jit_set_flag(JitFlag::KernelHistory, trace_history_backup);
+
+    trace_active = trace_kernels = false;
+    trace_records.clear();
+    trace_stack.clear();
+    return result;
+}
 
 void export_profile(nb::module_ &m) {
     struct profile_range {
-        const char *value;
+        std::string value;
+        std::unique_ptr<trace_span> span_guard;
+        profile_range(const char *value) : value(value) { }
 
         void __enter__() {
-            jit_profile_range_push(value);
+            history_push_label(value.c_str());
+            memory_range_push(value.c_str());
+            jit_profile_range_push(value.c_str());
+            span_guard.reset(new trace_span(value.c_str(), "profile_range"));
         }
 
         void __exit__(nb::handle, nb::handle, nb::handle) {
+            span_guard.reset();
+            history_pop_label();
+            memory_range_pop();
             jit_profile_range_pop();
         }
     };
@@ -30,4 +220,7 @@ void export_profile(nb::module_ &m) {
              nb::arg().none(), nb::arg().none());
 
     m.def("profile_mark", &jit_profile_mark, doc_profile_mark);
+
+    m.def("trace_start", &trace_start, "kernels"_a = true, doc_trace_start);
+    m.def("trace_stop", &trace_stop, doc_trace_stop);
 }
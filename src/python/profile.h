@@ -13,3 +13,35 @@
 #include "common.h"
 
 extern void export_profile(nb::module_&);
+
+/// Was the built-in tracer enabled via ``drjit.trace_start()``?
+extern bool trace_active;
+
+/**
+ * \brief Scope guard that records a span (e.g., a call to ``drjit.eval()``)
+ * while the built-in tracer is active.
+ *
+ * The constructor captures the Python callsite and must be called while
+ * holding the GIL. It is a no-op when the tracer is disabled.
+ */
+struct trace_span {
+    trace_span(const char *name, const char *category) {
+        if (trace_active)
+            begin(name, category);
+    }
+
+    ~trace_span() {
+        if (id)
+            end();
+    }
+
+    trace_span(const trace_span &) = delete;
+    trace_span &operator=(const trace_span &) = delete;
+
+private:
+    void begin(const char *name, const char *category);
+    void end();
+
+    /// 1-based index of the record (zero if the tracer was disabled)
+    uint32_t id = 0;
+};
@@ -53,3 +53,81 @@ void bind_pcg32(nb::module_ &m) {
     fields["inc"] = u64;
     pcg32.attr("DRJIT_STRUCT") = fields;
 }
+
+template <typename Guide>
+void bind_philox4x32(nb::module_ &m) {
+    using UInt64 = dr::uint64_array_t<Guide>;
+    using Philox4x32 = dr::Philox4x32<UInt64>;
+    using Mask = dr::mask_t<UInt64>;
+
+    auto philox = nb::class_<Philox4x32>(m, "Philox4x32", doc_Philox4x32)
+        .def(nb::init<size_t, const UInt64 &, const UInt64 &, const UInt64 &>(),
+             "size"_a = 1,
+             "seed"_a.sig("UInt64(0x853c49e6748fea9b)") = PHILOX_DEFAULT_SEED,
+             "counter"_a.sig("UInt64(0)") = 0,
+             "stream"_a.sig("UInt64(0)") = 0, doc_Philox4x32_Philox4x32)
+        .def(nb::init<const Philox4x32 &>(), doc_Philox4x32_Philox4x32_2)
+        .def("next_uint32x4", nb::overload_cast<>(&Philox4x32::next_uint32x4), doc_Philox4x32_next_uint32x4)
+        .def("next_uint32x4", nb::overload_cast<const Mask &>(&Philox4x32::next_uint32x4))
+        .def("next_uint32", nb::overload_cast<>(&Philox4x32::next_uint32), doc_Philox4x32_next_uint32)
+        .def("next_uint32", nb::overload_cast<const Mask &>(&Philox4x32::next_uint32))
+        .def("next_uint64", nb::overload_cast<>(&Philox4x32::next_uint64), doc_Philox4x32_next_uint64)
+        .def("next_uint64", nb::overload_cast<const Mask &>(&Philox4x32::next_uint64))
+        .def("next_float32", nb::overload_cast<>(&Philox4x32::next_float32))
+        .def("next_float32", nb::overload_cast<const Mask &>(
+                                 &Philox4x32::next_float32), doc_Philox4x32_next_float32)
+        .def("next_float64", nb::overload_cast<>(&Philox4x32::next_float64))
+        .def("next_float64", nb::overload_cast<const Mask &>(
+                                 &Philox4x32::next_float64), doc_Philox4x32_next_float64)
+        .def_rw("counter", &Philox4x32::counter, doc_Philox4x32_counter)
+        .def_rw("key", &Philox4x32::key, doc_Philox4x32_key)
+        .def_rw("stream", &Philox4x32::stream, doc_Philox4x32_stream);
+
+    nb::handle u64;
+    if constexpr (dr::is_array_v<UInt64>)
+        u64 = nb::type<UInt64>();
+    else
+        u64 = nb::handle((PyObject *) &PyLong_Type);
+
+    nb::dict fields;
+    fields["counter"] = u64;
+    fields["key"] = u64;
+    fields["stream"] = u64;
+    philox.attr("DRJIT_STRUCT") = fields;
+}
+
+template <typename Guide>
+void bind_sobol(nb::module_ &m) {
+    using UInt32 = dr::uint32_array_t<Guide>;
+    using Sobol = dr::Sobol<UInt32>;
+    using Mask = dr::mask_t<UInt32>;
+
+    auto sobol = nb::class_<Sobol>(m, "Sobol", doc_Sobol)
+        .def(nb::init<size_t, const UInt32 &, const UInt32 &>(),
+             "size"_a = 1, "seed"_a.sig("UInt32(0)") = 0,
+             "index"_a.sig("UInt32(0)") = 0, doc_Sobol_Sobol)
+        .def(nb::init<const Sobol &>(), doc_Sobol_Sobol_2)
+        .def("next_uint32", nb::overload_cast<>(&Sobol::next_uint32), doc_Sobol_next_uint32)
+        .def("next_uint32", nb::overload_cast<const Mask &>(&Sobol::next_uint32))
+        .def("next_float32", nb::overload_cast<>(&Sobol::next_float32))
+        .def("next_float32", nb::overload_cast<const Mask &>(
+                                 &Sobol::next_float32), doc_Sobol_next_float32)
+        .def("next_float64", nb::overload_cast<>(&Sobol::next_float64))
+        .def("next_float64", nb::overload_cast<const Mask &>(
+                                 &Sobol::next_float64), doc_Sobol_next_float64)
+        .def_rw("index", &Sobol::index, doc_Sobol_index)
+        .def_rw("seed", &Sobol::seed, doc_Sobol_seed)
+        .def_rw("dim", &Sobol::dim, doc_Sobol_dim);
+
+    nb::handle u32;
+    if constexpr (dr::is_array_v<UInt32>)
+        u32 = nb::type<UInt32>();
+    else
+        u32 = nb::handle((PyObject *) &PyLong_Type);
+
+    nb::dict fields;
+    fields["index"] = u32;
+    fields["seed"] = u32;
+    fields["dim"] = u32;
+    sobol.attr("DRJIT_STRUCT") = fields;
+}
@@ -324,16 +324,24 @@ nb::object reduce(uint32_t op, nb::handle h, nb::handle axis_, nb::handle mode)
         }
 
         int symbolic = -1;
+        bool pairwise = false;
         if (!mode.is_none()) {
             if (nb::isinstance<nb::str>(mode)) {
                 const char *s_ = nb::borrow<nb::str>(mode).c_str();
-                if (strcmp(s_, "symbolic") == 0)
+                if (strcmp(s_, "symbolic") == 0) {
                     symbolic = 1;
-                else if (strcmp(s_, "evaluated") == 0)
+                } else if (strcmp(s_, "evaluated") == 0) {
                     symbolic = 0;
+                } else if (strcmp(s_, "pairwise") == 0) {
+                    // Only floating point sums are affected by the
+                    // summation order, everything else is evaluated
+                    symbolic = 0;
+                    pairwise = op == (uint32_t) ReduceOp::Add && is_float(s);
+                }
             }
             if (symbolic == -1)
-                nb::raise("'mode' must be \'symbolic\", \"evaluated\", or None.");
+                nb::raise("'mode' must be \'symbolic\", \"evaluated\", "
+                          "\"pairwise\", or None.");
         }
 
         // Reduce along the first specified axis
@@ -386,7 +394,12 @@ nb::object reduce(uint32_t op, nb::handle h, nb::handle axis_, nb::handle mode)
                         symbolic = !is_evaluated && is_big_array;
                     }
                 }
-                if (symbolic) {
+                if (pairwise && nb::len(h) > 1) {
+                    // Tree of evaluated block reductions, see drjit._reduce
+                    result = nb::module_::import_("drjit._reduce")
+                                 .attr("block_reduce_pairwise")(
+                                     ReduceOp(op), h, nb::len(h));
+                } else if (symbolic) {
                     // Symbolic, via scatter
                     result = reduce_identity(tpa, (ReduceOp) op, 1);
                     ::scatter_reduce((ReduceOp) op, result, nb::borrow(h),
@@ -621,6 +634,23 @@ static nb::object prefix_reduce(ReduceOp op, nb::handle h, nb::handle axis, bool
     nb::raise_type_error("drjit.prefix_reduce(): 'value' must be a sequence type!");
 }
 
+static nb::object segmented_reduce(ReduceOp op, nb::handle h, nb::handle offsets) {
+    return nb::module_::import_("drjit._reduce")
+        .attr("segmented_reduce")(op, h, offsets);
+}
+
+static nb::object segmented_prefix_reduce(ReduceOp op, nb::handle h,
+                                          nb::handle offsets, bool exclusive,
+                                          bool reverse) {
+    return nb::module_::import_("drjit._reduce")
+        .attr("segmented_prefix_reduce")(op, h, offsets, exclusive, reverse);
+}
+
+static nb::object reduce_many(nb::handle ops, nb::handle arrays, nb::handle mode) {
+    return nb::module_::import_("drjit._reduce")
+        .attr("reduce_many")(ops, arrays, mode);
+}
+
 static nb::object block_reduce(ReduceOp op,
                                nb::handle h, uint32_t block_size,
                                std::optional<dr::string> mode) {
@@ -739,6 +769,13 @@ void export_reduce(nb::module_ & m) {
           nb::sig("def block_reduce(op: ReduceOp, value: T, block_size: int, mode: Literal['evaluated', 'symbolic', None] = None) -> T"))
      .def("block_sum", &block_sum, "value"_a, "block_size"_a, "mode"_a = nb::none(), doc_block_sum,
           nb::sig("def block_sum(value: T, block_size: int, mode: Literal['evaluated', 'symbolic', None] = None) -> T"))
+     .def("reduce_many", &reduce_many, "ops"_a, "arrays"_a, "mode"_a = nb::none(), doc_reduce_many,
+          nb::sig("def reduce_many(ops: Union[ReduceOp, Sequence[ReduceOp]], arrays: Sequence[ArrayBase], mode: Literal['evaluated', 'symbolic', None] = None) -> tuple[ArrayBase, ...]"))
+     .def("segmented_reduce", &segmented_reduce, "op"_a, "value"_a, "offsets"_a, doc_segmented_reduce,
+          nb::sig("def segmented_reduce(op: ReduceOp, value: ArrayT, offsets: object) -> ArrayT"))
+     .def("segmented_prefix_reduce", &segmented_prefix_reduce, "op"_a, "value"_a, "offsets"_a, "exclusive"_a = true, "reverse"_a = false,
+          doc_segmented_prefix_reduce,
+          nb::sig("def segmented_prefix_reduce(op: ReduceOp, value: ArrayT, offsets: object, exclusive: bool = True, reverse: bool = False) -> ArrayT"))
      .def("compress", &compress, doc_compress)
      .def("cumsum", [](nb::handle value, nb::handle axis, bool reverse) {
              return prefix_reduce(ReduceOp::Add, value, axis, false, reverse);
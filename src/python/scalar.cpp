@@ -16,6 +16,8 @@ void export_scalar(nb::module_& m) {
     ArrayBinding b;
     dr::bind_all<float>(b);
     bind_pcg32<float>(m);
+    bind_philox4x32<float>(m);
+    bind_sobol<float>(m);
     bind_texture_all<float>(m);
 
     m.attr("Bool") = nb::borrow(&PyBool_Type);
@@ -185,6 +185,26 @@ slice_index(const nb::type_object_t<ArrayBase> &dtype,
     return { nb::tuple(shape_out), index_out };
 }
 
+/// Does 'key' select all entries of a tensor with 'ndim' axes (e.g., 'x[:]', 'x[...]')?
+static bool is_full_slice(nb::tuple key, size_t ndim) {
+    size_t ellipsis_count = 0;
+    for (nb::handle h : key) {
+        if (h.type().is(&PyEllipsis_Type)) {
+            ellipsis_count++;
+            continue;
+        }
+        if (h.type().is(&PySlice_Type)) {
+            PySliceObject *sl = (PySliceObject *) h.ptr();
+            if (sl->start == Py_None && sl->stop == Py_None &&
+                sl->step == Py_None)
+                continue;
+        }
+        return false;
+    }
+
+    return ellipsis_count <= 1 && nb::len(key) - ellipsis_count <= ndim;
+}
+
 PyObject *mp_subscript(PyObject *self, PyObject *key) noexcept {
     nb::handle self_tp = nb::handle(self).type(),
                key_tp = nb::handle(key).type();
@@ -208,6 +228,13 @@ PyObject *mp_subscript(PyObject *self, PyObject *key) noexcept {
             else
                 key2 = nb::make_tuple(nb::handle(key));
 
+            // Full slices (e.g., 'x[:]', 'x[...]') reference the input as-is
+            if (is_full_slice(key2, nb::len(shape(self)))) {
+                nb::object out = nb::inst_alloc(self_tp);
+                nb::inst_copy(out, self);
+                return out.release().ptr();
+            }
+
             auto [out_shape, out_index] = slice_index(
                 nb::borrow<nb::type_object_t<ArrayBase>>(s.tensor_index),
                 nb::borrow<nb::tuple>(shape(self)), key2);
@@ -301,11 +328,34 @@ int mp_ass_subscript(PyObject *self, PyObject *key, PyObject *value) noexcept {
             else
                 key2 = nb::make_tuple(nb::handle(key));
 
+            nb::object target = nb::steal(s.tensor_array(self));
+
+            // Assigning a tensor of the same shape or a scalar to all entries
+            // (e.g., 'x[:] = y') replaces the storage instead of scattering
+            // into it. This avoids a kernel launch, as well as a copy when
+            // the previous storage is still referenced elsewhere.
+            nb::handle value_h(value);
+            if (is_full_slice(key2, nb::len(shape(self)))) {
+                nb::object array;
+                if (value_h.type().is(self_tp)) {
+                    if (shape(value_h).equal(shape(self)))
+                        array = nb::steal(s.tensor_array(value));
+                } else if (PyLong_CheckExact(value) || PyFloat_CheckExact(value) ||
+                           PyBool_Check(value)) {
+                    array = array_module.attr("full")(target.type(), value_h,
+                                                      nb::len(target));
+                }
+
+                if (array.is_valid()) {
+                    nb::inst_replace_copy(target, array);
+                    return 0;
+                }
+            }
+
             auto [out_shape, out_index] = slice_index(
                 nb::borrow<nb::type_object_t<ArrayBase>>(s.tensor_index),
                 nb::borrow<nb::tuple>(shape(self)), key2);
 
-            nb::object target = nb::steal(s.tensor_array(self));
             scatter(target, nb::borrow(value), out_index, nb::borrow(Py_True));
 
             return 0;
@@ -66,8 +66,10 @@ static int extract_mode(nb::kwargs &kwargs) {
         return 1;
     else if (strcmp(mode_str, "evaluated") == 0)
         return 0;
+    else if (strcmp(mode_str, "sorted") == 0)
+        return 2;
     else
-        nb::raise("'mode' must equal None, 'symbolic', or 'evaluated'");
+        nb::raise("'mode' must equal None, 'symbolic', 'sorted', or 'evaluated'");
 }
 
 static dr::string extract_label(nb::kwargs &kwargs, const char *def) {
@@ -28,6 +28,14 @@ void bind_texture(nb::module_ &m, const char *name) {
              doc_Texture_init_tensor)
         .def("set_value",  &Tex::set_value,  "value"_a,  "migrate"_a = false, doc_Texture_set_value)
         .def("set_tensor", &Tex::set_tensor, "tensor"_a, "migrate"_a = false, doc_Texture_set_tensor)
+        .def("update_region", [](Tex &t, const dr::vector<size_t> &offset,
+                                 const dr::vector<size_t> &extent,
+                                 const typename Tex::Storage &values) {
+                 if (offset.size() != Dimension || extent.size() != Dimension)
+                     nb::raise("Texture.update_region(): 'offset' and 'extent' "
+                               "must have %zu entries!", Dimension);
+                 t.update_region(offset.data(), extent.data(), values);
+             }, "offset"_a, "extent"_a, "values"_a, doc_Texture_update_region)
         .def("value", &Tex::value, nb::rv_policy::reference_internal, doc_Texture_value)
         .def("tensor",
              nb::overload_cast<>(&Tex::tensor, nb::const_),
@@ -174,6 +182,199 @@ void bind_texture(nb::module_ &m, const char *name) {
     tex.attr("IsTexture") = true;
 }
 
+template <typename Type, size_t Dimension>
+void bind_texture_array(nb::module_ &m, const char *name) {
+    using TexArray = dr::TextureArray<Type, Dimension>;
+    using TensorXf = typename TexArray::TensorXf;
+    using Float16 = dr::replace_scalar_t<Type, dr::half>;
+    using Float32 = dr::replace_scalar_t<Type, float>;
+    using Float64 = dr::replace_scalar_t<Type, double>;
+
+    nb::class_<TexArray>(m, name, doc_TextureArray)
+        .def("__init__", [](TexArray *t, const dr::vector<TensorXf> &layers,
+                            bool use_accel, bool migrate,
+                            dr::FilterMode filter_mode, dr::WrapMode wrap_mode) {
+                 new (t) TexArray(layers.data(), layers.size(), use_accel,
+                                  migrate, filter_mode, wrap_mode); },
+             "layers"_a, "use_accel"_a = true, "migrate"_a = true,
+             "filter_mode"_a = dr::FilterMode::Linear,
+             "wrap_mode"_a = dr::WrapMode::Clamp,
+             doc_TextureArray_init)
+        .def("set_layers", [](TexArray &t, const dr::vector<TensorXf> &layers,
+                              bool migrate) {
+                 t.set_layers(layers.data(), layers.size(), migrate); },
+             "layers"_a, "migrate"_a = false, doc_TextureArray_set_layers)
+        .def("layer_count", &TexArray::layer_count, doc_TextureArray_layer_count)
+        .def("texture", &TexArray::texture, nb::rv_policy::reference_internal,
+             doc_TextureArray_texture)
+        #define def_tex_array_eval(T)                                          \
+            def("eval",                                                        \
+                [](const TexArray &texture, const dr::Array<T, Dimension> &pos,\
+                   const std::optional<dr::mask_t<T>> active_) {               \
+                    dr::mask_t<T> active = active_.has_value() ?               \
+                                                     active_.value() :         \
+                                                     true;                     \
+                                                                               \
+                    dr::vector<T> values(texture.total_channels());            \
+                    texture.eval(pos, values.data(), active);                  \
+                                                                               \
+                    dr::vector<dr::vector<T>> result(texture.layer_count());   \
+                    for (size_t i = 0; i < result.size(); ++i) {               \
+                        size_t offset = texture.channel_offset(i);             \
+                        for (size_t j = 0; j < texture.channels(i); ++j)       \
+                            result[i].push_back(values[offset + j]);           \
+                    }                                                          \
+                                                                               \
+                    return result;                                             \
+                }, "pos"_a, "active"_a.sig("Bool(True)") = nb::none(),         \
+                doc_TextureArray_eval)
+        .def_tex_array_eval(Float32)
+        .def_tex_array_eval(Float16)
+        .def_tex_array_eval(Float64);
+        #undef def_tex_array_eval
+}
+
+template <typename Type>
+void bind_compressed_texture(nb::module_ &m, const char *name) {
+    using Tex = dr::CompressedTexture<Type>;
+    using Float16 = dr::replace_scalar_t<Type, dr::half>;
+    using Float32 = dr::replace_scalar_t<Type, float>;
+    using Float64 = dr::replace_scalar_t<Type, double>;
+
+    nb::class_<Tex>(m, name, doc_CompressedTexture)
+        .def(nb::init<size_t, size_t, dr::BlockFormat, const typename Tex::Data &,
+                      dr::FilterMode, dr::WrapMode>(),
+             "width"_a, "height"_a, "format"_a, "data"_a,
+             "filter_mode"_a = dr::FilterMode::Linear,
+             "wrap_mode"_a = dr::WrapMode::Clamp,
+             doc_CompressedTexture_init)
+        .def("value", &Tex::value, nb::rv_policy::reference_internal,
+             doc_CompressedTexture_value)
+        .def("format", &Tex::format, doc_CompressedTexture_format)
+        .def("filter_mode", &Tex::filter_mode, doc_Texture_filter_mode)
+        .def("wrap_mode", &Tex::wrap_mode, doc_Texture_wrap_mode)
+        .def_prop_ro("shape", [](const Tex &t) {
+            return nb::make_tuple(t.height(), t.width(), t.channels());
+        }, doc_Texture_shape)
+        #define def_tex_eval(T)                                                \
+            def("eval",                                                        \
+                [](const Tex &texture, const dr::Array<T, 2> &pos,             \
+                   const std::optional<dr::mask_t<T>> active_) {               \
+                    dr::mask_t<T> active = active_.has_value() ?               \
+                                                     active_.value() :         \
+                                                     true;                     \
+                                                                               \
+                    dr::vector<T> result(texture.channels());                  \
+                    texture.eval(pos, result.data(), active);                  \
+                                                                               \
+                    return result;                                             \
+                }, "pos"_a, "active"_a.sig("Bool(True)") = nb::none(),         \
+                doc_CompressedTexture_eval)
+        .def_tex_eval(Float32)
+        .def_tex_eval(Float16)
+        .def_tex_eval(Float64);
+        #undef def_tex_eval
+}
+
+template <typename Type, size_t Dimension>
+void bind_mip_texture(nb::module_ &m, const char *name) {
+    using Tex = dr::MipTexture<Type, Dimension>;
+    using Float32 = dr::replace_scalar_t<Type, float>;
+
+    nb::class_<Tex>(m, name, doc_MipTexture)
+        .def(nb::init<const typename Tex::TensorXf &, size_t, bool, bool,
+                      dr::FilterMode, dr::WrapMode>(),
+             "tensor"_a, "levels"_a = 0, "use_accel"_a = true, "migrate"_a = true,
+             "filter_mode"_a = dr::FilterMode::Linear,
+             "wrap_mode"_a = dr::WrapMode::Clamp,
+             doc_MipTexture_init)
+        .def("set_tensor", &Tex::set_tensor, "tensor"_a, "levels"_a = 0,
+             doc_MipTexture_set_tensor)
+        .def("level_count", &Tex::level_count, doc_MipTexture_level_count)
+        .def("level", &Tex::level, "index"_a, nb::rv_policy::reference_internal,
+             doc_MipTexture_level)
+        .def("filter_mode", &Tex::filter_mode, doc_Texture_filter_mode)
+        .def("wrap_mode", &Tex::wrap_mode, doc_Texture_wrap_mode)
+        .def("eval",
+             [](const Tex &texture, const dr::Array<Float32, Dimension> &pos,
+                const Float32 &lod, const std::optional<dr::mask_t<Float32>> active_) {
+                 dr::mask_t<Float32> active =
+                     active_.has_value() ? active_.value() : true;
+
+                 dr::vector<Float32> result(texture.shape()[Dimension]);
+                 texture.eval(pos, lod, result.data(), active);
+                 return result;
+             }, "pos"_a, "lod"_a, "active"_a.sig("Bool(True)") = nb::none(),
+             doc_MipTexture_eval)
+        .def("eval_grad",
+             [](const Tex &texture, const dr::Array<Float32, Dimension> &pos,
+                const dr::Array<Float32, Dimension> &dx,
+                const dr::Array<Float32, Dimension> &dy,
+                const std::optional<dr::mask_t<Float32>> active_) {
+                 dr::mask_t<Float32> active =
+                     active_.has_value() ? active_.value() : true;
+
+                 dr::vector<Float32> result(texture.shape()[Dimension]);
+                 texture.eval_grad(pos, dx, dy, result.data(), active);
+                 return result;
+             }, "pos"_a, "dx"_a, "dy"_a, "active"_a.sig("Bool(True)") = nb::none(),
+             doc_MipTexture_eval_grad);
+}
+
+template <typename Type>
+void bind_sparse_texture(nb::module_ &m, const char *name) {
+    using Tex = dr::SparseTexture3<Type>;
+    using Float32 = dr::replace_scalar_t<Type, float>;
+    using Array3f = dr::Array<Float32, 3>;
+    using Mask = dr::mask_t<Float32>;
+
+    nb::class_<Tex>(m, name, doc_SparseTexture)
+        .def(nb::init<const typename Tex::TensorXf &, size_t, float, bool, bool,
+                      dr::FilterMode>(),
+             "tensor"_a, "brick_size"_a = 16, "threshold"_a = 0.f,
+             "use_accel"_a = true, "migrate"_a = true,
+             "filter_mode"_a = dr::FilterMode::Linear,
+             doc_SparseTexture_init)
+        .def("brick_count", &Tex::brick_count, doc_SparseTexture_brick_count)
+        .def("atlas", &Tex::atlas, nb::rv_policy::reference_internal,
+             doc_SparseTexture_atlas)
+        .def("occupancy", &Tex::occupancy, doc_SparseTexture_occupancy)
+        .def("eval",
+             [](const Tex &texture, const Array3f &pos,
+                const std::optional<Mask> active_) {
+                 Mask active = active_.has_value() ? active_.value() : true;
+                 dr::vector<Float32> result(texture.atlas().shape()[3]);
+                 texture.eval(pos, result.data(), active);
+                 return result;
+             }, "pos"_a, "active"_a.sig("Bool(True)") = nb::none(),
+             doc_SparseTexture_eval)
+        .def("eval_cubic",
+             [](const Tex &texture, const Array3f &pos,
+                const std::optional<Mask> active_, bool force_nonaccel) {
+                 Mask active = active_.has_value() ? active_.value() : true;
+                 dr::vector<Float32> result(texture.atlas().shape()[3]);
+                 texture.eval_cubic(pos, result.data(), active, force_nonaccel);
+                 return result;
+             }, "pos"_a, "active"_a.sig("Bool(True)") = nb::none(),
+             "force_nonaccel"_a = false, doc_SparseTexture_eval_cubic)
+        .def("eval_fetch",
+             [](const Tex &texture, const Array3f &pos,
+                const std::optional<Mask> active_) {
+                 Mask active = active_.has_value() ? active_.value() : true;
+                 size_t channels = texture.atlas().shape()[3];
+
+                 dr::Array<Float32 *, 8> result_ptrs;
+                 dr::vector<dr::vector<Float32>> result(8);
+                 for (size_t i = 0; i < 8; ++i) {
+                     result[i].resize(channels);
+                     result_ptrs[i] = result[i].data();
+                 }
+                 texture.eval_fetch(pos, result_ptrs, active);
+                 return result;
+             }, "pos"_a, "active"_a.sig("Bool(True)") = nb::none(),
+             doc_SparseTexture_eval_fetch);
+}
+
 template <typename Type>
 void bind_texture_all(nb::module_ &m) {
     using Type16 = dr::float16_array_t<Type>;
@@ -188,4 +389,18 @@ void bind_texture_all(nb::module_ &m) {
     bind_texture<Type64, 1>(m, "Texture1f64");
     bind_texture<Type64, 2>(m, "Texture2f64");
     bind_texture<Type64, 3>(m, "Texture3f64");
+    bind_texture_array<Type16, 1>(m, "TextureArray1f16");
+    bind_texture_array<Type16, 2>(m, "TextureArray2f16");
+    bind_texture_array<Type16, 3>(m, "TextureArray3f16");
+    bind_texture_array<Type32, 1>(m, "TextureArray1f");
+    bind_texture_array<Type32, 2>(m, "TextureArray2f");
+    bind_texture_array<Type32, 3>(m, "TextureArray3f");
+    bind_texture_array<Type64, 1>(m, "TextureArray1f64");
+    bind_texture_array<Type64, 2>(m, "TextureArray2f64");
+    bind_texture_array<Type64, 3>(m, "TextureArray3f64");
+    bind_compressed_texture<Type32>(m, "CompressedTexture2f");
+    bind_mip_texture<Type32, 1>(m, "MipTexture1f");
+    bind_mip_texture<Type32, 2>(m, "MipTexture2f");
+    bind_mip_texture<Type32, 3>(m, "MipTexture3f");
+    bind_sparse_texture<Type32>(m, "SparseTexture3f");
 }
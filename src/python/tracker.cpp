@@ -25,6 +25,99 @@
 
 using index64_vector = dr::detail::index64_vector;
 
+/**
+ * \brief Compact 32-bit encoding of a combined AD/JIT variable index
+ *
+ * Variable indices normally occupy 64 bits (``ADIndex << 32 | JitIndex``).
+ * However, most state variables of loops, conditionals, and calls don't track
+ * derivatives, in which case only the JIT index is needed. This class stores
+ * such indices directly. Otherwise, it sets the high bit and uses the
+ * remaining bits to refer to a slot of a separate arena holding the full
+ * 64-bit index. Slots are recycled via a free list.
+ *
+ * ``PackedIndex`` owns a reference to the variable. The arena is only
+ * accessed while holding the GIL.
+ */
+struct PackedIndex {
+    static constexpr uint32_t ArenaFlag = 0x80000000u;
+
+    PackedIndex() = default;
+    PackedIndex(PackedIndex &&p) noexcept : m_value(p.m_value) { p.m_value = 0; }
+    PackedIndex &operator=(PackedIndex &&p) noexcept {
+        uint32_t old = m_value;
+        m_value = p.m_value;
+        p.m_value = 0;
+        release(old);
+        return *this;
+    }
+    PackedIndex(const PackedIndex &) = delete;
+    PackedIndex &operator=(const PackedIndex &) = delete;
+    ~PackedIndex() { release(m_value); }
+
+    /// Return the combined 64-bit index (without changing its reference count)
+    uint64_t get() const {
+        return (m_value & ArenaFlag) ? arena()[m_value & ~ArenaFlag]
+                                     : (uint64_t) m_value;
+    }
+
+    operator uint64_t() const { return get(); }
+
+    /// Replace the stored index with ``index`` and acquire a reference to it
+    PackedIndex &operator=(uint64_t index) {
+        uint32_t old = m_value;
+        m_value = encode(ad_var_inc_ref(index));
+        release(old);
+        return *this;
+    }
+
+private:
+    static dr::vector<uint64_t> &arena() {
+        static dr::vector<uint64_t> arena;
+        return arena;
+    }
+
+    static dr::vector<uint32_t> &free_slots() {
+        static dr::vector<uint32_t> free_slots;
+        return free_slots;
+    }
+
+    /// Encode an index (stealing its reference)
+    static uint32_t encode(uint64_t index) {
+        if (index < ArenaFlag)
+            return (uint32_t) index;
+
+        dr::vector<uint64_t> &a = arena();
+        dr::vector<uint32_t> &f = free_slots();
+        uint32_t slot;
+        if (!f.empty()) {
+            slot = f.back();
+            f.pop_back();
+            a[slot] = index;
+        } else {
+            if (a.size() >= ArenaFlag)
+                nb::raise("PackedIndex: arena capacity exceeded!");
+            slot = (uint32_t) a.size();
+            a.push_back(index);
+        }
+        return slot | ArenaFlag;
+    }
+
+    /// Release the reference held by an encoded index and recycle its slot
+    static void release(uint32_t value) {
+        if (value & ArenaFlag) {
+            uint32_t slot = value & ~ArenaFlag;
+            uint64_t index = arena()[slot];
+            arena()[slot] = 0;
+            free_slots().push_back(slot);
+            ad_var_dec_ref(index);
+        } else {
+            ad_var_dec_ref(value);
+        }
+    }
+
+    uint32_t m_value = 0;
+};
+
 /**
  * This struct represents the state of Python object encountered during PyTree
  * traversal. It could store a Dr.Jit array, a Python list/dict, etc.
@@ -40,10 +133,10 @@ struct Variable {
     nb::object value;
 
     /// For Dr.Jit arrays: the array ID encountered during the first PyTree traversal
-    uint64_t index_orig;
+    PackedIndex index_orig;
 
     /// For Dr.Jit arrays: the array ID encountered during the last PyTree traversal
-    uint64_t index;
+    PackedIndex index;
 
     /// The size of the array/list/dict/..
     size_t size;
@@ -51,23 +144,16 @@ struct Variable {
     /// Set to true when an in-place mutation was detected
     bool mutated;
 
-    ~Variable() {
-        ad_var_dec_ref(index_orig);
-        ad_var_dec_ref(index);
-    }
-
     /// Initialize from an existing object. The array indices must be set separately
     Variable(nb::handle value)
-        : value_orig(nb::borrow(value)), value(nb::borrow(value)), index_orig(0),
-          index(0), size(0), mutated(false) { }
+        : value_orig(nb::borrow(value)), value(nb::borrow(value)),
+          size(0), mutated(false) { }
 
     /// Move constructor
     Variable(Variable &&v) noexcept
         : value_orig(std::move(v.value_orig)),
-          value(std::move(v.value)), index_orig(v.index_orig),
-          index(v.index), size(v.size), mutated(v.mutated) {
-        v.index_orig = 0;
-        v.index = 0;
+          value(std::move(v.value)), index_orig(std::move(v.index_orig)),
+          index(std::move(v.index)), size(v.size), mutated(v.mutated) {
         v.size = 0;
         v.mutated = 0;
     }
@@ -76,13 +162,8 @@ struct Variable {
     Variable &operator=(Variable &&v) noexcept {
         value_orig = std::move(v.value_orig);
         value = std::move(v.value);
-        uint64_t old0 = index_orig, old1 = index;
-        index_orig = v.index_orig;
-        index = v.index;
-        v.index = 0;
-        v.index_orig = 0;
-        ad_var_dec_ref(old0);
-        ad_var_dec_ref(old1);
+        index_orig = std::move(v.index_orig);
+        index = std::move(v.index);
         size = v.size;
         mutated = v.mutated;
         v.size = 0;
@@ -112,8 +193,8 @@ using VariableMap =
 // so that callers don't inherit the STL header file dependencies required
 // by the VariableMap declaration above
 struct VariableTracker::Impl {
-    Impl(bool strict, bool check_size)
-        : strict(strict), check_size(check_size) { }
+    Impl(bool strict, bool check_size, bool cache_plan)
+        : strict(strict), check_size(check_size), cache_plan(cache_plan) { }
 
     /// Pointer to a hash table storing the variable state
     VariableMap state;
@@ -124,6 +205,47 @@ struct VariableTracker::Impl {
     /// Perform extra checks to ensure that the size of variables remains compatible?
     bool check_size;
 
+    /// Record the leaves visited by ``read()`` so that ``write()`` can replay them?
+    bool cache_plan;
+
+    /// A Dr.Jit array or ``Local`` leaf visited during the last ``read()``
+    struct PlanEntry {
+        /// The leaf object
+        nb::object h;
+        /// Its entry in 'state'
+        VariableMap::iterator it;
+        /// Type supplement of array leaves, ``nullptr`` for ``Local`` instances
+        const ArraySupplement *s;
+    };
+
+    /// Flattened leaves of the PyTree most recently passed to ``read()``
+    dr::vector<PlanEntry> plan;
+
+    /// Root object and labels of the traversal that recorded 'plan'
+    nb::object plan_root;
+    dr::vector<dr::string> plan_labels;
+    dr::string plan_default_label;
+
+    /// Can 'plan' be replayed by the next call to ``write()``?
+    bool plan_valid = false;
+
+    /// Forget the recorded plan
+    void plan_reset() {
+        plan.clear();
+        plan_root.reset();
+        plan_valid = false;
+    }
+
+    /// Check whether 'plan' describes the given traversal
+    bool plan_matches(nb::handle state, const dr::vector<dr::string> &labels,
+                      const char *default_label) const;
+
+    /**
+     * Write indices using the recorded plan instead of traversing the PyTree.
+     * Returns ``false`` without making changes when the leaves no longer match.
+     */
+    bool replay(Context &ctx);
+
     /// Implementation detail of ``read()`` and ``write()``
     void traverse(Context &ctx, nb::handle state,
                   const dr::vector<dr::string> &labels,
@@ -176,6 +298,12 @@ struct VariableTracker::Context {
     /// Temporary index into 'indices' during traversal
     size_t index_offset;
 
+    /// When reading: optional output array to record a plan for ``write()``
+    dr::vector<Impl::PlanEntry> *plan = nullptr;
+
+    /// Set when the plan is unusable (new variables, opaque traversal callbacks)
+    bool plan_invalid = false;
+
     Context(dr::vector<uint64_t> &indices, bool write, bool preserve_dirty,
             bool check_size)
         : indices(indices), write(write), preserve_dirty(preserve_dirty),
@@ -221,8 +349,65 @@ struct ScopedAppendLabel {
     size_t length;
 };
 
-VariableTracker::VariableTracker(bool strict, bool check_size)
-    : m_impl(new Impl(strict, check_size)) {
+/// Write the next index of 'ctx.indices' into the Dr.Jit array 'h'
+static void write_index(VariableTracker::Context &ctx, nb::handle h,
+                        const ArraySupplement &s, Variable *v, uint64_t idx,
+                        const VarInfo &vi, const dr::string &label) {
+    if (ctx.index_offset >= ctx.indices.size())
+        nb::raise("internal error at state variable '%s': ran "
+                  "out of indices", label.c_str());
+
+    uint64_t idx_new = ctx.indices[ctx.index_offset++];
+    VarInfo vi_new = jit_set_backend((uint32_t) idx_new);
+
+    if (vi_new.size != vi.size && vi_new.size != 1 &&
+        vi.size != 1 && ctx.check_size)
+        nb::raise("the symbolic operation tried to change the "
+                  "size of state variable '%s' of type "
+                  "'%s' from %zu to %zu. Aborting because "
+                  "these sizes aren't compatible",
+                  label.c_str(), nb::inst_name(h).c_str(),
+                  vi.size, vi_new.size);
+
+    if (vi.type != vi_new.type)
+        nb::raise("internal error: the JIT variable type of "
+                  "state variable '%s' (of type '%s') changed "
+                  "from '%s' to '%s'",
+                  label.c_str(), nb::inst_name(h).c_str(),
+                  jit_type_name(vi.type), jit_type_name(vi_new.type));
+
+    if (idx != idx_new &&
+        !(ctx.preserve_dirty && jit_var_is_dirty((uint32_t) idx))) {
+        #if defined(DEBUG_TRACKER)
+            printf("-> write: a%u r%u\n", (uint32_t) (idx_new >> 32), (uint32_t) idx_new);
+        #endif
+        s.reset_index(idx_new, inst_ptr(h));
+        v->index = idx_new;
+    }
+}
+
+/// Write the next indices of 'ctx.indices' into the arrays of a ``Local``
+static void write_local(VariableTracker::Context &ctx, Local &local,
+                        const dr::string &label) {
+    for (uint32_t &idx: local.arrays()) {
+        if (ctx.index_offset >= ctx.indices.size())
+            nb::raise("internal error at state variable '%s': ran "
+                      "out of indices", label.c_str());
+
+        uint64_t idx_new = ctx.indices[ctx.index_offset++];
+        if (!ctx.preserve_dirty) {
+            jit_var_dec_ref(idx);
+            jit_var_inc_ref((uint32_t)idx_new);
+            #if defined(DEBUG_TRACKER)
+                printf("write '%s' (array): r%u\n", label.c_str(), (uint32_t) idx_new);
+            #endif
+            idx = (uint32_t)idx_new;
+        }
+    }
+}
+
+VariableTracker::VariableTracker(bool strict, bool check_size, bool cache_plan)
+    : m_impl(new Impl(strict, check_size, cache_plan)) {
 }
 
 VariableTracker::~VariableTracker() {
@@ -238,7 +423,22 @@ void VariableTracker::read(nb::handle state, dr::vector<uint64_t> &indices,
         /* preserve_dirty = */ false,
         /* check_size = */ m_impl->check_size
     );
-    m_impl->traverse(ctx, state, labels, default_label);
+
+    Impl &impl = *m_impl;
+    impl.plan_reset();
+    if (impl.cache_plan)
+        ctx.plan = &impl.plan;
+
+    impl.traverse(ctx, state, labels, default_label);
+
+    if (impl.cache_plan && !ctx.plan_invalid) {
+        impl.plan_root = nb::borrow(state);
+        impl.plan_labels = labels;
+        impl.plan_default_label = default_label;
+        impl.plan_valid = true;
+    } else {
+        impl.plan.clear();
+    }
 }
 
 /// Traverse the PyTree ``state`` and write variable indices.
@@ -253,7 +453,66 @@ void VariableTracker::write(nb::handle state,
         /* preserve_dirty = */ preserve_dirty,
         /* check_size = */ m_impl->check_size
     );
-    m_impl->traverse(ctx, state, labels, default_label);
+
+    // A plan is consumed by the first write following the read that recorded it
+    Impl &impl = *m_impl;
+    bool plan_valid = impl.plan_valid;
+    impl.plan_valid = false;
+
+    bool replayed = plan_valid &&
+                    impl.plan_matches(state, labels, default_label) &&
+                    impl.replay(ctx);
+    impl.plan_reset();
+
+    if (!replayed)
+        impl.traverse(ctx, state, labels, default_label);
+}
+
+bool VariableTracker::Impl::plan_matches(nb::handle state_,
+                                         const dr::vector<dr::string> &labels,
+                                         const char *default_label) const {
+    if (!state_.is(plan_root) || labels.size() != plan_labels.size())
+        return false;
+
+    if (labels.empty())
+        return plan_default_label == dr::string(default_label);
+
+    for (size_t i = 0; i < labels.size(); ++i) {
+        if (!(labels[i] == plan_labels[i]))
+            return false;
+    }
+
+    return true;
+}
+
+bool VariableTracker::Impl::replay(Context &ctx) {
+    // Verify that each leaf still holds the index observed by read()
+    size_t count = 0;
+    for (const PlanEntry &e : plan) {
+        if (e.s) {
+            if (e.s->index(inst_ptr(e.h)) != e.it.value().index)
+                return false;
+            count++;
+        } else {
+            count += nb::cast<Local &>(e.h).arrays().size();
+        }
+    }
+
+    if (count != ctx.indices.size())
+        return false;
+
+    for (PlanEntry &e : plan) {
+        const dr::string &label = e.it.key();
+        if (e.s) {
+            uint64_t idx = e.s->index(inst_ptr(e.h));
+            write_index(ctx, e.h, *e.s, &e.it.value(), idx,
+                        jit_set_backend((uint32_t) idx), label);
+        } else {
+            write_local(ctx, nb::cast<Local &>(e.h), label);
+        }
+    }
+
+    return true;
 }
 
 
@@ -312,6 +571,10 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
     std::tie(it, new_variable) = state.try_emplace(ctx.label, h);
     Variable *v = &it.value();
 
+    // Insertions may relocate entries, which invalidates recorded iterators
+    if (new_variable)
+        ctx.plan_invalid = true;
+
     // Update the Python object
     nb::object prev = v->value;
     v->value = nb::borrow(h);
@@ -377,8 +640,8 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
 
             if (new_variable) {
                 if (!v->index_orig)
-                    v->index_orig = ad_var_inc_ref(idx);
-                v->index = ad_var_inc_ref(idx);
+                    v->index_orig = idx;
+                v->index = idx;
                 v->size = vi.size;
             } else {
                 if (vi.size != v->size && vi.size != 1 && v->size != 1 && check_size)
@@ -391,18 +654,14 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
 
                 changed = idx != v->index;
                 if (changed) {
-                    uint64_t old = v->index;
-                    v->index = ad_var_inc_ref(idx);
-                    ad_var_dec_ref(old);
+                    v->index = idx;
                     v->size = vi.size;
                 }
             }
 
             if (!ctx.write) {
                 if (idx != v->index) {
-                    uint64_t old = v->index;
-                    v->index = ad_var_inc_ref(idx);
-                    ad_var_dec_ref(old);
+                    v->index = idx;
                 }
                 ctx.indices.push_back(ad_var_inc_ref(idx));
                 ctx.index_offset++;
@@ -410,40 +669,11 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                     printf("-> read: a%u r%u\n", (uint32_t) (idx >> 32), (uint32_t) idx);
                 #endif
             } else {
-                if (ctx.index_offset >= ctx.indices.size())
-                    nb::raise("internal error at state variable '%s': ran "
-                              "out of indices", ctx.label.c_str());
-
-                uint64_t idx_new = ctx.indices[ctx.index_offset++];
-                VarInfo vi_new = jit_set_backend((uint32_t) idx_new);
-
-                if (vi_new.size != vi.size && vi_new.size != 1 &&
-                    vi.size != 1 && check_size)
-                    nb::raise("the symbolic operation tried to change the "
-                              "size of state variable '%s' of type "
-                              "'%s' from %zu to %zu. Aborting because "
-                              "these sizes aren't compatible",
-                              ctx.label.c_str(), nb::inst_name(h).c_str(),
-                              vi.size, vi_new.size);
-
-                if (vi.type != vi_new.type)
-                    nb::raise("internal error: the JIT variable type of "
-                              "state variable '%s' (of type '%s') changed "
-                              "from '%s' to '%s'",
-                              ctx.label.c_str(), nb::inst_name(h).c_str(),
-                              jit_type_name(vi.type), jit_type_name(vi_new.type));
-
-                if (idx != idx_new &&
-                    !(ctx.preserve_dirty && jit_var_is_dirty((uint32_t) idx))) {
-                    #if defined(DEBUG_TRACKER)
-                        printf("-> write: a%u r%u\n", (uint32_t) (idx_new >> 32), (uint32_t) idx_new);
-                    #endif
-                    s.reset_index(idx_new, inst_ptr(h));
-                    uint64_t old = v->index;
-                    v->index = ad_var_inc_ref(idx_new);
-                    ad_var_dec_ref(old);
-                }
+                write_index(ctx, h, s, v, idx, vi, ctx.label);
             }
+
+            if (ctx.plan)
+                ctx.plan->push_back({ nb::borrow(h), it, &s });
         }
     } else if (tp.is(local_type)) {
         Local & local = nb::cast<Local&>(h);
@@ -457,22 +687,11 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                     printf("read '%s' (array): r%u\n", ctx.label.c_str(), (uint32_t) idx);
                 #endif
             }
-        } else {
-            for (uint32_t &idx: arrays) {
-                if (ctx.index_offset >= ctx.indices.size())
-                    nb::raise("internal error at state variable '%s': ran "
-                              "out of indices", ctx.label.c_str());
 
-                uint64_t idx_new = ctx.indices[ctx.index_offset++];
-                if (!ctx.preserve_dirty) {
-                    jit_var_dec_ref(idx);
-                    jit_var_inc_ref((uint32_t)idx_new);
-                    #if defined(DEBUG_TRACKER)
-                        printf("write '%s' (array): r%u\n", ctx.label.c_str(), (uint32_t) idx_new);
-                    #endif
-                    idx = (uint32_t)idx_new;
-                }
-            }
+            if (ctx.plan)
+                ctx.plan->push_back({ nb::borrow(h), it, nullptr });
+        } else {
+            write_local(ctx, local, ctx.label);
         }
     } else if (tp.is(&PyTuple_Type)) {
         nb::tuple t = nb::borrow<nb::tuple>(h);
@@ -505,8 +724,20 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                 ScopedAppendLabel guard(ctx, ".", nb::str(k).c_str());
                 changed |= traverse(ctx, nb::getattr(h, k));
             }
+        } else if (const dr::detail::TraverseCallbacks *cb = get_traverse_cb_native(tp); cb) {
+            ScopedAppendLabel guard(ctx, "._traverse_cb()");
+            ctx.plan_invalid = true;
+            if (ctx.write)
+                cb->rw(h.ptr(), &ctx, [](void *p, uint64_t index) {
+                    return ((Context *) p)->_traverse_write(index);
+                });
+            else
+                cb->ro(h.ptr(), &ctx, [](void *p, uint64_t index) {
+                    ((Context *) p)->_traverse_read(index);
+                });
         } else if (traverse_cb.is_valid()) {
             ScopedAppendLabel guard(ctx, "._traverse_cb()");
+            ctx.plan_invalid = true;
             traverse_cb(
                 nb::cast(ctx, nb::rv_policy::reference)
                     .attr(ctx.write ? DR_STR(_traverse_write) : DR_STR(_traverse_read)));
@@ -593,6 +824,7 @@ void VariableTracker::Context::_traverse_read(uint64_t index) {
 }
 
 void VariableTracker::clear() {
+    m_impl->plan_reset();
     m_impl->state.clear();
 }
 
@@ -618,6 +850,7 @@ void VariableTracker::verify_size(size_t size) {
 
 nb::object VariableTracker::restore(const dr::vector<dr::string> &labels,
                                     const char *default_label) {
+    m_impl->plan_reset();
 
     dr::string label;
     if (labels.empty()) {
@@ -635,6 +868,7 @@ nb::object VariableTracker::restore(const dr::vector<dr::string> &labels,
 
 nb::object VariableTracker::rebuild(const dr::vector<dr::string> &labels,
                                     const char *default_label) {
+    m_impl->plan_reset();
 
     dr::string label;
     if (labels.empty()) {
@@ -57,8 +57,15 @@ public:
      *   not desired are evaluated loops with compression enabled (i.e.,
      *   inactive elements are pruned, which causes the array size to
      *   progressively shrink).
+     *
+     * - ``cache_plan``: Record the array leaves visited by \ref read(), so
+     *   that an immediately following \ref write() to the same PyTree can
+     *   update them without traversing it again. This is only safe when no
+     *   code can restructure the PyTree between the two calls, e.g., in
+     *   the read/write callbacks of evaluated loops.
      */
-    VariableTracker(bool strict = true, bool check_size = true);
+    VariableTracker(bool strict = true, bool check_size = true,
+                    bool cache_plan = false);
 
     /// Free all state, decrease reference counts, etc.
     ~VariableTracker();
@@ -27,6 +27,8 @@ struct LoopState {
     nb::callable cond;
     /// Function that evolves the loop state
     nb::callable body;
+    /// Optional function that undoes 'body' (for reverse-mode AD)
+    nb::object inverse;
     /// Holds a temporary reference to the loop condition
     nb::object active;
     /// Variable labels
@@ -39,7 +41,8 @@ struct LoopState {
     LoopState(nb::tuple &&state, nb::callable &&cond, nb::callable &&body,
               dr::vector<dr::string> &&labels, bool strict, bool check_size)
         : state(std::move(state)), cond(std::move(cond)), body(std::move(body)),
-          labels(std::move(labels)), tracker(strict, check_size), active_size(1) { }
+          labels(std::move(labels)), tracker(strict, check_size, true),
+          active_size(1) { }
 };
 
 /// Helper function to check that the type+size of the state variable returned
@@ -83,6 +86,12 @@ static void while_loop_body_cb(void *p) {
     ls->state = check_state("body", tuple_call(ls->body, ls->state), ls->state);
 };
 
+static void while_loop_inverse_cb(void *p) {
+    nb::gil_scoped_acquire guard;
+    LoopState *ls = (LoopState *) p;
+    ls->state = check_state("inverse", tuple_call(ls->inverse, ls->state), ls->state);
+};
+
 static void while_loop_read_cb(void *p, dr::vector<uint64_t> &indices) {
     nb::gil_scoped_acquire guard;
     LoopState *ls = (LoopState *) p;
@@ -115,7 +124,11 @@ nb::tuple while_loop(nb::tuple state, nb::callable cond, nb::callable body,
                      std::optional<dr::string> mode,
                      bool strict,
                      std::optional<bool> compress,
-                     std::optional<long long> max_iterations) {
+                     std::optional<long long> max_iterations,
+                     std::optional<int> unroll,
+                     std::optional<nb::callable> inverse,
+                     std::optional<int> checkpoint,
+                     std::optional<dr::string> ad_mode) {
     try {
         JitBackend backend = JitBackend::None;
 
@@ -163,6 +176,15 @@ nb::tuple while_loop(nb::tuple state, nb::callable cond, nb::callable body,
             nb::raise("invalid 'mode' argument (must equal None, "
                       "\"scalar\", \"symbolic\", or \"evaluated\")");
 
+        bool fwd_fused = false;
+        if (ad_mode.has_value()) {
+            if (ad_mode == "fwd_fused")
+                fwd_fused = true;
+            else
+                nb::raise("invalid 'ad_mode' argument (must equal None or "
+                          "\"fwd_fused\")");
+        }
+
         const char *name_cstr =
             name.has_value() ? name.value().c_str() : "unnamed";
 
@@ -170,13 +192,19 @@ nb::tuple while_loop(nb::tuple state, nb::callable cond, nb::callable body,
             new LoopState(std::move(state), std::move(cond), std::move(body),
                           std::move(labels), strict,
                           !compress.has_value() || !compress.value()));
+        if (inverse.has_value())
+            ls->inverse = std::move(inverse.value());
 
         bool rv = ad_loop(backend, symbolic,
                           compress.has_value() ? (int) compress.value() : -1,
                           max_iterations.has_value() ? max_iterations.value() : 0,
-                          name_cstr, ls.get(), while_loop_read_cb,
+                          unroll.has_value() ? unroll.value() : 1,
+                          checkpoint.has_value() ? checkpoint.value() : 0,
+                          fwd_fused, name_cstr, ls.get(), while_loop_read_cb,
                           while_loop_write_cb, while_loop_cond_cb,
-                          while_loop_body_cb, while_loop_delete_cb, true);
+                          while_loop_body_cb,
+                          ls->inverse.is_valid() ? while_loop_inverse_cb : nullptr,
+                          while_loop_delete_cb, true);
 
         ls->tracker.restore(ls->labels);
 
@@ -210,6 +238,8 @@ void export_while_loop(nb::module_ &m) {
           "labels"_a = nb::make_tuple(), "label"_a = nb::none(),
           "mode"_a = nb::none(), "strict"_a = true,
           "compress"_a = nb::none(), "max_iterations"_a = nb::none(),
+          "unroll"_a = nb::none(), "inverse"_a = nb::none(),
+          "checkpoint"_a = nb::none(), "ad_mode"_a = nb::none(),
           doc_while_loop,
           // Complicated signature to type-check while_loop via TypeVarTuple
           nb::sig(
@@ -221,7 +251,11 @@ void export_while_loop(nb::module_ &m) {
                            "mode: typing.Literal['scalar', 'symbolic', 'evaluated', None] = None, "
                            "strict: bool = True, "
                            "compress: bool | None = None, "
-                           "max_iterations: int | None = None) "
+                           "max_iterations: int | None = None, "
+                           "unroll: int | None = None, "
+                           "inverse: typing.Callable[[*Ts], tuple[*Ts]] | None = None, "
+                           "checkpoint: int | None = None, "
+                           "ad_mode: typing.Literal['fwd_fused', None] = None) "
             "-> tuple[*Ts]"
     ));
 }
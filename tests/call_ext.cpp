@@ -29,6 +29,13 @@ struct Sampler {
     dr::PCG32<dr::uint64_array_t<T>> rng;
 };
 
+template <typename Float> struct Ray {
+    dr::Array<Float, 3> o;
+    Float maxt;
+
+    DRJIT_STRUCT(Ray, o, maxt)
+};
+
 template <typename Float> struct Base : nb::intrusive_base {
     using Mask = dr::mask_t<Float>;
     using UInt32 = dr::uint32_array_t<Float>;
@@ -204,6 +211,14 @@ void bind(nb::module_ &m) {
 
     bind_traverse(sampler);
 
+    using Ray = ::Ray<Float>;
+    auto ray = nb::class_<Ray>(m, "Ray")
+        .def(nb::init<>())
+        .def_rw("o", &Ray::o)
+        .def_rw("maxt", &Ray::maxt);
+
+    bind_traverse(ray);
+
     nb::class_<BaseT, nb::intrusive_base>(m, "Base")
         .def("f", &BaseT::f)
         .def("f_masked", &BaseT::f_masked)
@@ -1,6 +1,7 @@
 #include <drjit/python.h>
 #include <drjit/autodiff.h>
 #include <drjit/packet.h>
+#include <drjit/custom.h>
 
 namespace nb = nanobind;
 namespace dr = drjit;
@@ -43,6 +44,31 @@ private:
 };
 
 
+/// C++ custom operation computing 'x^2' with a hand-written derivative
+template <typename Float>
+struct Square : dr::CustomOp<Float, Float> {
+    using Base = dr::CustomOp<Float, Float>;
+    using Base::Base;
+
+    Float eval(const Float &x) {
+        m_x = x;
+        return x * x;
+    }
+
+    void forward() override {
+        Base::set_grad_out(2.f * m_x * Base::template grad_in<0>());
+    }
+
+    void backward() override {
+        Base::template set_grad_in<0>(2.f * m_x * Base::grad_out());
+    }
+
+    const char *name() const override { return "Square"; }
+
+private:
+    dr::detached_t<Float> m_x;
+};
+
 template <JitBackend Backend> void bind(nb::module_ &m) {
     dr::ArrayBinding b;
     using Float = dr::DiffArray<Backend, float>;
@@ -67,6 +93,9 @@ template <JitBackend Backend> void bind(nb::module_ &m) {
     m.def("cpp_make_opaque",
           [](CustomFloatHolder &holder) { dr::make_opaque(holder); }
     );
+
+    m.def("cpp_custom_square",
+          [](const Float &x) { return dr::custom<Square<Float>>(x); });
 }
 
 NB_MODULE(custom_type_ext, m) {
@@ -427,3 +427,88 @@ def test22_and_mask(t):
 
     arr &= m
     assert dr.all(arr == t(1, 2, 0, 0))
+
+@pytest.test_arrays('float32, jit, shape=(*)')
+def test23_math_fast_approx(t):
+    x = dr.linspace(t, 0.01, 10, 1000)
+    funcs = (dr.sin, dr.cos, dr.exp, dr.exp2, dr.log, dr.log2)
+    ref = [f(x) for f in funcs]
+    dr.eval(ref)
+
+    try:
+        dr.detail.set_ad_math_fast_approx(True)
+        assert dr.detail.ad_math_fast_approx()
+        for f, r in zip(funcs, ref):
+            assert dr.allclose(f(x), r, rtol=2e-5, atol=1e-5)
+        s, c = dr.sincos(x)
+        assert dr.allclose(s, ref[0], rtol=2e-5, atol=1e-5)
+        assert dr.allclose(c, ref[1], rtol=2e-5, atol=1e-5)
+    finally:
+        dr.detail.set_ad_math_fast_approx(False)
+
+@pytest.test_arrays('float32, jit, shape=(*)')
+def test24_trig_shared_reduction(t):
+    # sin/cos/tan of the same argument share their range reduction
+    import math
+    values = (-100.0, -2.5, -0.3, 0.0, 0.7, 3.0, 50.0)
+    x = t(values)
+    s, c, ta = dr.sin(x), dr.cos(x), dr.tan(x)
+    dr.eval(s, c, ta)
+    for i, v in enumerate(values):
+        assert dr.allclose(s[i], math.sin(v), atol=1e-6)
+        assert dr.allclose(c[i], math.cos(v), atol=1e-6)
+        assert dr.allclose(ta[i], math.tan(v), rtol=1e-5, atol=1e-6)
+
+def test25_static_scalar_fast_path():
+    # Static scalar arrays are initialized and combined without
+    # per-entry dispatch through Python
+    from drjit.scalar import Array3f, Array3f64, Array3i, Array3b
+
+    a = Array3f(1, 2.5, -3)
+    b = Array3f([4, 5, 6])
+    assert a[0] == 1 and a[1] == 2.5 and a[2] == -3
+    assert Array3f(2)[2] == 2
+    assert Array3i(1, -2, 3)[1] == -2
+    assert Array3b(True, False, True)[1] is False
+    assert Array3f64((1, 2**60, 3))[1] == 2**60
+
+    assert a + b == Array3f(5, 7.5, 3)
+    assert a - b == Array3f(-3, -2.5, -9)
+    assert a * b == Array3f(4, 12.5, -18)
+    assert a + 1 == Array3f(2, 3.5, -2)
+    assert -a == Array3f(-1, -2.5, 3)
+    assert abs(a) == Array3f(1, 2.5, 3)
+    assert dr.minimum(a, b) == a and dr.maximum(a, b) == b
+    assert type(a + b) is Array3f
+
+    # Results are rounded to single precision like before
+    import struct
+    f32 = lambda v: struct.unpack('f', struct.pack('f', v))[0]
+    c = Array3f(0.1, 0.2, 0.3) * Array3f(0.7, 0.3, 0.4)
+    assert c[0] == f32(f32(0.1) * f32(0.7))
+
+    with pytest.raises(TypeError, match='wrong size'):
+        Array3f(1, 2)
+
+
+def test26_builtin_dispatch():
+    # Math functions dispatch builtin Python numbers without trying the
+    # array overloads first
+    assert dr.fma(2, 3, 4) == 10 and type(dr.fma(2, 3, 4)) is int
+    assert dr.fma(2.0, 3, 4) == 10.0 and type(dr.fma(2.0, 3, 4)) is float
+    assert dr.minimum(2, 3) == 2 and type(dr.minimum(2, 3)) is int
+    assert dr.maximum(2, 3.5) == 3.5
+    assert dr.minimum(2**70, 1) == 1
+    assert dr.abs(-3) == 3 and type(dr.abs(-3)) is int
+    assert dr.abs(-2**70) == 2**70
+    assert dr.abs(-3.5) == 3.5
+    assert dr.sqrt(4) == 2.0 and type(dr.sqrt(4)) is float
+    assert dr.atan2(0, 1) == 0.0
+    assert dr.power(2, 10) == 1024.0
+    assert dr.select(True, 1, 2) == 1 and dr.select(False, 1, 2) == 2
+    assert dr.select(False, (1, 2), (3, 4)) == (3, 4)
+
+    with pytest.raises(TypeError):
+        dr.fma('a', 2, 3)
+    with pytest.raises(TypeError):
+        dr.sqrt('a')
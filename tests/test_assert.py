@@ -116,3 +116,26 @@ def test04_assert_false_loop(t, mode, capsys):
             dr.eval(i)
             captured = capsys.readouterr()
             assert "Assertion failure!" in str(captured.err)
+
+
+@pytest.test_arrays('shape=(*), uint32, jit')
+def test05_assert_deferred(t):
+    with dr.scoped_set_flag(dr.JitFlag.Debug, True):
+        i = t(1, 2, 3, 4, 5, 6)
+
+        # Unanimous
+        dr.assert_true(i > 0, deferred=True)
+        dr.sync_thread()
+
+        # Reported at the next synchronization point
+        dr.assert_true(i < 3, 'value={}', i, deferred=True)
+        dr.assert_false(i == 2, deferred=True)
+        with pytest.raises(AssertionError, match=r'entry 2\): value=\[3\]'):
+            dr.sync_thread()
+
+        # Pending checks are discarded once reported
+        dr.check_asserts()
+
+        dr.assert_equal(i, 4, deferred=True)
+        with pytest.raises(AssertionError, match=r'entry 0\)'):
+            dr.check_asserts()
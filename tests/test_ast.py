@@ -23,3 +23,67 @@ def test01_comprehensions(t):
         i += 1
 
     assert result[0] == 3
+
+
+@pytest.test_arrays('shape=(*), uint32, jit')
+def test02_hoist_invariants(t):
+    # Loop-invariant assignments are moved in front of the loop
+    class Counter:
+        reads = 0
+
+        @property
+        def value(self):
+            Counter.reads += 1
+            return 3
+
+    @dr.syntax
+    def f(c, i, n):
+        result = i * 0
+        while dr.hint(i < n, mode='evaluated'):
+            scale = c.value * 2 + 1  # invariant, hoisted
+            offset = scale + i       # depends on 'i', stays in the loop
+            result += offset
+            i += 1
+        return result
+
+    result = f(Counter(), t(0, 2), 4)
+    assert dr.all(result == t(7+8+9+10, 9+10))
+    assert Counter.reads == 1
+
+
+@pytest.test_arrays('shape=(*), uint32, jit')
+def test03_read_only_state(t):
+    # Variables that the loop only reads are accessed as implicit inputs
+    # and don't become part of the loop state
+
+    def labels(code):
+        for c in code.co_consts:
+            if isinstance(c, tuple) and c and all(isinstance(v, str) for v in c):
+                yield c
+            elif hasattr(c, 'co_consts'):
+                yield from labels(c)
+
+    @dr.syntax
+    def f(i, n, scale, buf):
+        result = i * 0
+        while i < n:
+            result += i * scale + buf[0]
+            i += 1
+        return result
+
+    assert ('i', 'result') in labels(f.__code__)
+
+    for mode in ('symbolic', 'evaluated'):
+        with dr.scoped_set_flag(dr.JitFlag.SymbolicLoops, mode == 'symbolic'):
+            result = f(t(0, 2), t(4), 2, [t(1)])
+            assert dr.all(result == t(2*(0+1+2+3) + 4, 2*(2+3) + 2))
+
+    # Loop state compression requires carrying read-only variables
+    @dr.syntax
+    def g(i, n):
+        while dr.hint(i < n, mode='evaluated', compress=True):
+            i += 1
+        return i
+
+    assert ('i', 'n') in labels(g.__code__)
+    assert dr.all(g(t(0, 2, 5), t(4, 3, 6)) == t(4, 3, 6))
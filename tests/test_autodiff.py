@@ -2104,3 +2104,503 @@ def test135_backward_from_complex(t):
     b = 2 * a
     dr.backward_from(b)
     assert dr.allclose(dr.grad(a), t(0, 2))
+
+@pytest.mark.parametrize("sorted_reuse", [False, True])
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test136_sorted_reuse(t, sorted_reuse):
+    # Gradients must not depend on the policy used to recycle AD slots
+    backup = dr.detail.ad_sorted_reuse()
+    try:
+        dr.detail.set_ad_sorted_reuse(sorted_reuse)
+        assert dr.detail.ad_sorted_reuse() == sorted_reuse
+
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        for i in range(10):
+            tmp = [x * (j + 1) for j in range(5)]
+            del tmp
+        y = x * x + x
+        dr.backward_from(y)
+        assert dr.all(x.grad == t(3, 5, 7))
+    finally:
+        dr.detail.set_ad_sorted_reuse(backup)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test137_level_schedule(t):
+    # Wide fan-in: many independent branches depend on the same parameter
+    def run(flags):
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        y = t(0)
+        for i in range(16):
+            y += dr.sin(x * (i + 1)) + dr.sum(x) * i
+        dr.backward_from(y, flags=flags)
+        return x.grad
+
+    g0 = run(dr.ADFlag.Default)
+    g1 = run(dr.ADFlag.Default | dr.ADFlag.LevelSchedule)
+    assert dr.allclose(g0, g1)
+
+    # Forward mode
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+    y = x * x + dr.exp(x) * 2 + x
+    dr.forward_from(x, flags=dr.ADFlag.Default | dr.ADFlag.LevelSchedule)
+    assert dr.allclose(y.grad, 2 * x + 2 * dr.exp(x) + 1)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test138_checkpoint(t):
+    def f(x, scale=1):
+        for i in range(4):
+            x = dr.sin(x) * scale + x
+        return x, x * 2
+
+    def run(func, mode):
+        x = t(0.1, 0.2, 0.3)
+        dr.enable_grad(x)
+        a, b = func(x, scale=2)
+        if mode == dr.ADMode.Backward:
+            dr.backward_from(a + b)
+            return x.grad
+        else:
+            dr.forward_from(x)
+            return a.grad + b.grad
+
+    for mode in (dr.ADMode.Backward, dr.ADMode.Forward):
+        g0 = run(f, mode)
+        g1 = run(dr.checkpoint(f), mode)
+        assert dr.allclose(g0, g1)
+
+    # The interior of the region is not part of the AD graph
+    x = t(0.1, 0.2, 0.3)
+    dr.enable_grad(x)
+    y, _ = dr.checkpoint(f)(x)
+    assert dr.grad_enabled(y)
+    assert 'sin' not in dr.graphviz_ad(as_string=True)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test139_traverse_budget(t):
+    # Evaluating gradients in chunks must not change the result
+    def run():
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        y = x
+        for i in range(32):
+            y = dr.sin(y) * 0.5 + y
+        dr.backward_from(y)
+        return x.grad
+
+    g0 = run()
+    backup = dr.detail.ad_traverse_budget()
+    try:
+        dr.detail.set_ad_traverse_budget(16)
+        assert dr.detail.ad_traverse_budget() == 16
+        with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+            g1 = run()
+            history = dr.kernel_history()
+        assert len(history) > 1
+    finally:
+        dr.detail.set_ad_traverse_budget(backup)
+    assert dr.allclose(g0, g1)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test140_edge_folding(t):
+    # Edges with the same source are merged, unit weights are not stored
+    for flags in (dr.ADFlag.Default, dr.ADFlag.Default | dr.ADFlag.LevelSchedule):
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        y = x * x + (x + x) - x
+        z = y * 1 + x * 0
+        dr.backward_from(z, flags=flags)
+        assert dr.all(x.grad == 2 * x + 1)
+
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        y = x * x + (x + x) - x
+        dr.forward_from(x, flags=flags)
+        assert dr.all(y.grad == 2 * dr.detach(x) + 1)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test141_forward_tangents(t):
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+    y = dr.sin(x) * x
+
+    tangents = [t(1, 0, 0), t(0, 1, 0), t(0, 0, 1), t(2)]
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        grads = dr.forward_tangents(x, tangents, y)
+        history = dr.kernel_history()
+    assert len(history) == 1
+
+    d = dr.cos(dr.detach(x)) * dr.detach(x) + dr.sin(dr.detach(x))
+    for tangent, g in zip(tangents, grads):
+        assert dr.allclose(g, d * tangent)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test142_cache_plan(t):
+    # Repeated traversals of identically structured graphs reuse cached plans
+    def run(flags, scale):
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        y = dr.sin(x) * scale
+        z = y * x + dr.exp(y)
+        dr.backward_from(z, flags=flags)
+        return x.grad
+
+    for flags in (dr.ADFlag.CachePlan,
+                  dr.ADFlag.LevelSchedule | dr.ADFlag.CachePlan):
+        for i in range(3):
+            g0 = run(dr.ADFlag.Default, i + 1)
+            g1 = run(dr.ADFlag.Default | flags, i + 1)
+            assert dr.allclose(g0, g1)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test143_gather_adjoint_merging(t):
+    # Adjoints of gathers sharing their source and offsets are merged
+    UInt32 = dr.uint32_array_t(t)
+    x = dr.arange(t, 4)
+    dr.enable_grad(x)
+    i0 = UInt32(0, 1, 1, 3)
+    i1 = UInt32(2, 2, 2, 2)
+    y = t(0)
+    for k in range(4):
+        y += dr.gather(t, x, i0) * (k + 1) + dr.gather(t, x, i1)
+    dr.backward_from(y)
+    assert dr.all(x.grad == t(10, 20, 16, 10))
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+@pytest.mark.parametrize('ratio', [0, 1, 16])
+def test144_local_reduce_ratio(t, ratio):
+    # Contended gather adjoints produce the same result with any strategy
+    UInt32 = dr.uint32_array_t(t)
+    backup = dr.detail.ad_local_reduce_ratio()
+    try:
+        dr.detail.set_ad_local_reduce_ratio(ratio)
+        assert dr.detail.ad_local_reduce_ratio() == ratio
+        x = dr.zeros(t, 3)
+        dr.enable_grad(x)
+        y = dr.gather(t, x, dr.arange(UInt32, 1000) % 3)
+        dr.backward_from(y)
+        assert dr.all(x.grad == t(334, 333, 333))
+    finally:
+        dr.detail.set_ad_local_reduce_ratio(backup)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test145_deterministic_gather_adjoint(t):
+    # Reproducible accumulation of gather adjoints
+    UInt32 = dr.uint32_array_t(t)
+    backup = dr.detail.ad_deterministic()
+    try:
+        dr.detail.set_ad_deterministic(True)
+        assert dr.detail.ad_deterministic()
+
+        grads = []
+        for _ in range(2):
+            x = dr.zeros(t, 3)
+            dr.enable_grad(x)
+            i = dr.arange(UInt32, 1000)
+            y = dr.gather(t, x, i % 3)
+            dr.backward_from(y * dr.sin(t(i)))
+            grads.append(x.grad.numpy())
+
+        assert (grads[0] == grads[1]).all()
+
+        x = dr.zeros(t, 3)
+        dr.enable_grad(x)
+        y = dr.gather(t, x, dr.arange(UInt32, 1000) % 3)
+        dr.backward_from(y)
+        assert dr.all(x.grad == t(334, 333, 333))
+    finally:
+        dr.detail.set_ad_deterministic(backup)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test146_kahan_gather_adjoint(t):
+    # Compensated accumulation of contended gather adjoints
+    UInt32 = dr.uint32_array_t(t)
+    backup = dr.detail.ad_kahan()
+    try:
+        dr.detail.set_ad_kahan(True)
+        assert dr.detail.ad_kahan()
+        x = dr.zeros(t, 2)
+        dr.enable_grad(x)
+        y = dr.gather(t, x, UInt32(1, 1, 1))
+        dr.backward_from(y * t(1, dr.epsilon(t), dr.epsilon(t)))
+        assert dr.all(x.grad == [0, 1 + dr.epsilon(t)*2])
+    finally:
+        dr.detail.set_ad_kahan(backup)
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test147_sparse_grad(t):
+    # Gathers from an input variable produce a sparse gradient
+    UInt32 = dr.uint32_array_t(t)
+    x = dr.zeros(t, 1000)
+    dr.enable_grad(x)
+    y = dr.gather(t, x, UInt32(3, 5, 3))
+    dr.backward_from(y * t(1, 2, 4), flags=dr.ADFlag.Default | dr.ADFlag.SparseGrad)
+
+    entries = dr.grad_sparse(x)
+    assert len(entries) == 1
+    index, value, active = entries[0]
+    assert dr.all(index == [3, 5, 3])
+    assert dr.all(value == [1, 2, 4])
+    assert dr.all(active)
+
+    # Reading the gradient makes it dense
+    g = dr.grad(x)
+    assert g[3] == 5 and g[5] == 2 and dr.sum(g) == 7
+    assert len(dr.grad_sparse(x)) == 0
+
+    # Dense contributions prevent a sparse representation
+    x2 = dr.zeros(t, 10)
+    dr.enable_grad(x2)
+    y2 = dr.gather(t, x2, UInt32(1)) + dr.sum(x2)
+    dr.backward_from(y2, flags=dr.ADFlag.Default | dr.ADFlag.SparseGrad)
+    assert len(dr.grad_sparse(x2)) == 0
+    assert dr.grad(x2)[1] == 2
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test148_freeze(t):
+    # Calls with the same argument layout reuse the recording
+    @dr.freeze
+    def f(x, scale):
+        return x * scale + 1
+
+    y = f(t(1, 2, 3), 2)
+    assert dr.all(y == [3, 5, 7]) and f.n_recordings == 1
+    f(t(4, 5, 6), 2)
+    assert f.n_recordings == 1 and f.n_cache_hits == 1
+
+    # Different widths and Python scalars produce new recordings
+    f(t(1, 2), 2)
+    f(t(1, 2), 3)
+    assert f.n_recordings == 3 and f.n_cache_hits == 1
+
+    f.clear()
+    assert f.n_recordings == 0 and f.n_cache_hits == 0
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test149_memory_report(t):
+    x = dr.arange(t, 1024)
+    dr.set_label(x, 'x')
+    dr.make_opaque(x)
+
+    report = dr.memory_report(x, [x, x])
+    assert report['labels']['x'] == { 'live': 4096, 'arrays': 1 }
+    assert report['used'] >= 0
+
+    # Gradients held by the AD graph
+    dr.enable_grad(x)
+    dr.set_label(x, 'x')
+    dr.backward(dr.sum(x * x))
+    dr.eval(dr.grad(x))
+    report = dr.memory_report()
+    assert report['ad']['x']['grad'] == 4096
+    assert report['ad_total'] >= 4096
+    assert report['peak'] is None and report['ranges'] == {}
+
+    # Threshold callback and profile range statistics
+    calls = []
+    dr.enable_memory_monitor(threshold=1, callback=lambda info: calls.append(info))
+    try:
+        with dr.profile_range('step'):
+            y = dr.arange(t, 1024) + 1
+            dr.eval(y)
+        report = dr.memory_report()
+        assert report['ranges']['step']['count'] == 1
+        assert report['peak'] is not None
+        assert len(calls) == 1 and calls[0]['projected'] == 4096
+    finally:
+        dr.disable_memory_monitor()
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test150_prune_dead(t):
+    # Backward traversals can skip edges into variables nobody can read
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+
+    def make_y():
+        z = t(3, 4, 5)
+        dr.enable_grad(z)
+        w = dr.sin(z) # only reachable through the released 'z'
+        return x * w, w
+
+    y, w = make_y()
+    kept = dr.square(w)
+    dr.backward(y + kept, flags=dr.ADFlag.Default | dr.ADFlag.PruneDead)
+
+    w_ref = dr.sin(t(3, 4, 5))
+    assert dr.allclose(x.grad, w_ref)
+
+    # Interior variables that are still referenced keep their gradient
+    a = t(1, 2)
+    dr.enable_grad(a)
+    b = a * 2
+    c = dr.square(b)
+    dr.backward(c, flags=dr.ADFlag.ClearEdges | dr.ADFlag.PruneDead)
+    assert dr.all(b.grad == t(4, 8))
+    assert dr.all(a.grad == t(8, 16))
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test151_grad_type(t):
+    # Gradients can be stored using a different precision
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+    dr.set_grad_type(x, dr.VarType.Float16)
+    dr.backward(x * 1.5 + x * 0.25)
+    g = dr.grad(x)
+    assert type(g) is t
+    assert dr.allclose(g, 1.75)
+
+    # Half-precision variable with a single precision accumulator
+    Float16 = dr.float16_array_t(t)
+    y = Float16(1, 2)
+    dr.enable_grad(y)
+    dr.set_grad_type(y, dr.VarType.Float32)
+    z = y * 1
+    for i in range(4):
+        z = z + y * (1.0 / 3.0)
+    dr.backward(z)
+    g = dr.grad(y)
+    assert type(g) is Float16
+    assert dr.allclose(g, 1 + 4 / 3, rtol=1e-2)
+
+    dr.set_grad_type(y, None)
+    dr.clear_grad(y)
+    dr.backward(y * 2)
+    assert dr.all(dr.grad(y) == 2)
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test152_traverse_chunk(t):
+    # Evaluating the traversal in chunks of edges must not change the result
+    def run():
+        x = t(1, 2, 3)
+        dr.enable_grad(x)
+        y = x
+        for i in range(32):
+            y = dr.sin(y) * 0.5 + y
+        dr.backward_from(y)
+        return x.grad
+
+    g0 = run()
+    backup = dr.detail.ad_traverse_chunk()
+    try:
+        dr.detail.set_ad_traverse_chunk(8)
+        assert dr.detail.ad_traverse_chunk() == 8
+        with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+            g1 = run()
+            history = dr.kernel_history()
+        assert len(history) > 1
+    finally:
+        dr.detail.set_ad_traverse_chunk(backup)
+    assert dr.allclose(g0, g1)
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test153_memo(t):
+    calls = []
+
+    @dr.memo
+    def f(x, scale):
+        calls.append(scale)
+        return x * scale + 1
+
+    x = t(1, 2, 3)
+    y = f(x, 2)
+    assert dr.all(y == [3, 5, 7]) and len(calls) == 1
+
+    # Unchanged inputs reuse the evaluated outputs
+    assert dr.all(f(x, 2) == [3, 5, 7]) and len(calls) == 1
+    assert f.n_cache_hits == 1 and f.n_cache_misses == 1
+
+    # Modifying the input or a Python scalar re-runs the function
+    dr.scatter(x, 10, 0)
+    assert dr.all(f(x, 2) == [21, 5, 7]) and len(calls) == 2
+    f(x, 3)
+    assert len(calls) == 3
+
+    # Writes to a returned array don't affect the cached outputs
+    y = f(x, 3)
+    dr.scatter(y, 0, 0)
+    assert f(x, 3)[0] == 31 and len(calls) == 3
+
+    # Gradient-enabled inputs are never memoized
+    dr.enable_grad(x)
+    f(x, 3)
+    f(x, 3)
+    assert len(calls) == 5
+
+    f.clear()
+    assert f.n_cache_hits == 0 and f.n_cache_misses == 0
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test154_custom_op_layout(t):
+    # The parameter layout of 'eval()' is cached per class. Redefining
+    # 'eval()' must invalidate the cached entry.
+    class Op(dr.CustomOp):
+        def eval(self, x, scale=2):
+            self.scale = scale
+            return x * scale
+
+        def forward(self):
+            self.set_grad_out(self.grad_in('x') * self.scale)
+
+        def backward(self):
+            self.set_grad_in('x', self.grad_out() * self.scale)
+
+    for i in range(3):
+        x = t(1, 2)
+        dr.enable_grad(x)
+        y = dr.custom(Op, x, scale=i)
+        dr.backward(y)
+        assert dr.all(y == [i, 2 * i]) and dr.all(x.grad == i)
+
+    def eval_varargs(self, x, *args):
+        self.scale = len(args)
+        return x * self.scale
+
+    Op.eval = eval_varargs
+    x = t(1, 2)
+    dr.enable_grad(x)
+    y = dr.custom(Op, x, 0, 0, 0)
+    dr.backward(y)
+    assert dr.all(y == [3, 6]) and dr.all(x.grad == 3)
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test155_hvp(t):
+    # Exact for cubic functions, since their gradient is quadratic
+    x = t(1, 2, 3)
+    hv = dr.hvp(lambda x: dr.sum(x**3), x, t(1, 0, 2))
+    assert dr.allclose(hv, [6, 0, 36])
+    assert not dr.grad_enabled(hv)
+
+    # General case: the Hessian of sum(sin(x)) is diag(-sin(x))
+    hv = dr.hvp(lambda x: dr.sin(x), x, t(1, 1, 1))
+    assert dr.allclose(hv, -dr.sin(x), rtol=1e-3, atol=1e-3)
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test156_ad_stats(t):
+    dr.ad_stats(reset=True)
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+    y = dr.gather(t, x * 2, dr.uint32_array_t(t)(0, 2))
+    stats = dr.ad_stats()
+    assert stats['variables'] >= 3 and stats['edges'] >= 2
+    assert stats['traversals'] == 0
+
+    dr.backward(y)
+    stats = dr.ad_stats(reset=True)
+    assert dr.all(x.grad == [2, 0, 2])
+    assert stats['traversals'] == 1
+    assert stats['edges_traversed'] == 2
+    assert stats['edges_special'] == 1
+    assert stats['edges_custom'] == 0
+    assert stats['traverse_time'] >= 0
+
+    stats = dr.ad_stats()
+    assert stats['traversals'] == 0 and stats['edges_traversed'] == 0
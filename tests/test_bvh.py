@@ -0,0 +1,72 @@
+import drjit as dr
+from drjit.bvh import BVH, nearest, radius_query, morton_encode
+import pytest
+import sys
+
+
+def make_points(t, n, seed):
+    m = sys.modules[t.__module__]
+    rng = m.PCG32(n, seed)
+    return m.Array3f(rng.next_float32(), rng.next_float32(), rng.next_float32())
+
+
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+def test01_morton(t):
+    m = sys.modules[t.__module__]
+    p = m.Array3f([0, 1, 0, 1], [0, 0, 1, 1], [0, 0, 0, 1])
+    code = morton_encode(p, m.Array3f(0), m.Array3f(1))
+    assert dr.all(code == [0, 0x09249249, 0x12492492, 0x3FFFFFFF])
+
+
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+@pytest.mark.parametrize('n', [1, 2, 3, 100, 1000])
+@pytest.mark.parametrize('mode', ['symbolic', 'evaluated'])
+def test02_nearest(t, n, mode):
+    points = make_points(t, n, 1)
+    queries = make_points(t, 50, 2)
+    bvh = BVH(points)
+    assert bvh.size == n
+
+    index, dist = nearest(bvh, queries, mode=mode)
+
+    # Brute-force reference
+    p, q = points.numpy(), queries.numpy()
+    for k in range(50):
+        d = ((p - q[:, k:k+1]) ** 2).sum(axis=0) ** 0.5
+        assert index[k] == d.argmin()
+        assert dr.allclose(dist[k], d.min())
+
+
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+def test03_nearest_max_dist(t):
+    m = sys.modules[t.__module__]
+    bvh = BVH(m.Array3f([0, 1], 0, 0))
+    index, dist = nearest(bvh, m.Array3f([0.1, 10], 0, 0), max_dist=1)
+    assert index[0] == 0 and dr.allclose(dist[0], 0.1)
+    assert index[1] == 0xFFFFFFFF
+
+
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+@pytest.mark.parametrize('mode', ['symbolic', 'evaluated'])
+def test04_radius_query(t, mode):
+    UInt32 = dr.uint32_array_t(t)
+    Bool = dr.mask_t(t)
+    points = make_points(t, 500, 3)
+    queries = make_points(t, 50, 4)
+    bvh = BVH(points)
+
+    def count_fn(state, index, dist2, active):
+        count, total = state
+        count = dr.select(active, count + 1, count)
+        total = dr.select(active, total + index, total)
+        return (count, total), Bool(True)
+
+    count, total = radius_query(bvh, queries, 0.2, count_fn,
+                                (UInt32(0), UInt32(0)), mode=mode)
+
+    p, q = points.numpy(), queries.numpy()
+    for k in range(50):
+        d2 = ((p - q[:, k:k+1]) ** 2).sum(axis=0)
+        inside = (d2 <= 0.2**2).nonzero()[0]
+        assert count[k] == len(inside)
+        assert total[k] == inside.sum()
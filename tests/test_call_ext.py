@@ -2,6 +2,7 @@ import drjit as dr
 import pytest
 import re
 import gc
+import sys
 
 def get_pkg(t):
     with dr.detail.scoped_rtld_deepbind():
@@ -1046,3 +1047,132 @@ def test23_dispatch_partial_registry_bwd(t, symbolic):
     assert dr.all(a2.value.grad == t(0))
     assert dr.all(b2.value.grad == t(2))
     assert dr.all(b3.value.grad == t(0))
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test24_dispatch_skip_nondiff_bwd(t):
+    # Callables without differentiable outputs aren't traced again by the
+    # backward pass of a symbolic call
+    pkg = get_pkg(t)
+
+    A, B, BasePtr = pkg.A, pkg.B, pkg.BasePtr
+    a, b = A(), B()
+    a.value, b.value = t(2), t(3)
+    traced = []
+
+    def my_func(self, x):
+        traced.append(type(self))
+        if type(self) is A:
+            return self.value
+        else:
+            return self.value * x
+
+    x = t(1, 2, 3, 4)
+    dr.enable_grad(x)
+    c = BasePtr(a, b, a, b)
+
+    with dr.scoped_set_flag(dr.JitFlag.SymbolicCalls, True):
+        out = dr.dispatch(c, my_func, x)
+        assert traced.count(A) == 1 and traced.count(B) == 1
+        dr.backward(out)
+
+    assert traced.count(A) == 1 and traced.count(B) == 2
+    assert dr.all(x.grad == t(0, 3, 0, 3))
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test25_nested_call_flatten(t):
+    # Nested calls with a literal instance index are inlined into the caller
+    pkg = get_pkg(t)
+
+    A, B, BasePtr = pkg.A, pkg.B, pkg.BasePtr
+    a, b = A(), B()
+    a.value, b.value = t(2), t(3)
+    dr.enable_grad(a.value)
+
+    def my_func(self, x):
+        other = BasePtr(b) if type(self) is A else BasePtr(a)
+        return other.g(x)
+
+    c = BasePtr(a, b, a, b)
+    x = t(1, 2, 3, 4)
+    dr.enable_grad(x)
+
+    backup = dr.detail.ad_call_flatten()
+    try:
+        dr.detail.set_ad_call_flatten(True)
+        assert dr.detail.ad_call_flatten()
+        with dr.scoped_set_flag(dr.JitFlag.SymbolicCalls, True):
+            out = dr.dispatch(c, my_func, x)
+    finally:
+        dr.detail.set_ad_call_flatten(backup)
+
+    assert dr.all(out == t(3, 2, 9, 2))
+    dr.backward(out)
+    assert dr.all(x.grad == t(3, 0, 3, 0))
+    assert dr.all(a.value.grad == t(2))
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test26_getter_cache(t):
+    # Getters can reuse the buffer of a previous call while the instance
+    # fields remain unchanged
+    pkg = get_pkg(t)
+
+    A, B, BasePtr = pkg.A, pkg.B, pkg.BasePtr
+    a, b = A(), B()
+    c = BasePtr(a, a, None, b, b)
+
+    backup = dr.detail.ad_call_cache()
+    try:
+        dr.detail.set_ad_call_cache(True)
+        arr1 = c.opaque_getter()
+        arr2 = c.opaque_getter()
+        assert dr.all(arr1 == t(1, 1, 0, 2, 2))
+        assert dr.all(arr2 == t(1, 1, 0, 2, 2))
+
+        a.opaque = dr.opaque(t, 5)
+        arr3 = c.opaque_getter()
+        assert dr.all(arr3 == t(5, 5, 0, 2, 2))
+    finally:
+        dr.detail.set_ad_call_cache(backup)
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test27_native_traverse(t):
+    # Types bound via bind_traverse() are traversed without Python callbacks
+    pkg = get_pkg(t)
+    m = sys.modules[t.__module__]
+    assert type(pkg.Ray._traverse_1_cb_native).__name__ == 'PyCapsule'
+
+    # DRJIT_STRUCT types have value semantics
+    r = pkg.Ray()
+    r.o = m.Array3f(1, 2, 3)
+    r.maxt = t(4, 5)
+    dr.enable_grad(r.maxt)
+    r2 = dr.detach(r)
+    assert type(r2) is pkg.Ray and r2 is not r
+    assert dr.grad_enabled(r.maxt) and not dr.grad_enabled(r2.maxt)
+    assert dr.all(r2.maxt == t(4, 5)) and dr.all(r2.o == m.Array3f(1, 2, 3))
+
+    # Evaluation and loop state tracking
+    r2.maxt = r2.maxt + 1
+    dr.eval(r2)
+    assert r2.maxt.state == dr.VarState.Evaluated
+
+    def body(r, i):
+        r.maxt += 1
+        return r, i + 1
+
+    r3, i = dr.while_loop(
+        state=(r2, m.UInt32(0, 2)),
+        cond=lambda r, i: i < 3,
+        body=body
+    )
+    assert dr.all(r3.maxt == t(8, 7))
+
+    # Classes with traversal callbacks are updated in-place
+    sampler = pkg.Sampler(3)
+    sampler.next()
+    dr.eval(sampler)
+    assert sampler.rng.state.state == dr.VarState.Evaluated
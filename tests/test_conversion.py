@@ -134,3 +134,67 @@ def test11_conversion_ad(t):
     assert dr.grad_enabled(x)
     assert i != 0
     assert i == x.index_ad
+
+
+# Test uploads of page-locked NumPy arrays to the CUDA backend
+@pytest.test_arrays('tensor, float32')
+def test12_pinned_numpy_import(t):
+    np = pytest.importorskip("numpy")
+    if dr.backend_v(t) != dr.JitBackend.CUDA:
+        pytest.skip("CUDA-specific test")
+
+    x = np.arange(1024, dtype=np.float32).reshape(32, 32)
+    dr.detail.cuda_host_register(x)
+    try:
+        y = t(x)
+        assert np.all(y.numpy() == x)
+        dr.sync_thread()
+    finally:
+        dr.detail.cuda_host_register(x, enable=False)
+
+
+# Test sharding arrays across CUDA devices and combining the results
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+def test13_scatter_gather_devices(t):
+    if dr.backend_v(t) != dr.JitBackend.CUDA:
+        pytest.skip("CUDA-specific test")
+
+    x = dr.arange(t, 1000)
+    n = dr.cuda_device_count()
+    shards = dr.scatter_devices(x)
+    assert len(shards) == n
+    assert sum(dr.width(s) for s in shards) == 1000
+
+    sums = []
+    for i, s in enumerate(shards):
+        with dr.scoped_set_device(i):
+            sums.append(dr.sum(s * 2))
+            dr.eval(sums[-1])
+    dr.sync_all_devices()
+
+    assert dr.all(dr.gather_devices(shards) == x)
+    assert dr.gather_devices(sums, device=0, reduce=dr.ReduceOp.Add)[0] == 999000
+
+
+# Test bfloat16 conversions and zero-copy imports of PyTorch bfloat16 tensors
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+def test14_bfloat16(t):
+    UInt16 = dr.uint_array_t(dr.float16_array_t(t))
+    x = t(1.0, -2.5, 1.00390625, 1.01171875, float('inf'), float('nan'), 3e38)
+    y = dr.float_to_bfloat16(x)
+    assert type(y) is UInt16
+
+    # 1+2^-8 and 1+3*2^-8 lie halfway and round to the even neighbor
+    assert dr.all(y == UInt16(0x3F80, 0xC020, 0x3F80, 0x3F82, 0x7F80, 0x7FC0, 0x7F62))
+    z = dr.bfloat16_to_float(y)
+    assert dr.all((z == t(1.0, -2.5, 1.0, 1.015625, float('inf'), 0, 3.0040553e38)) |
+                  dr.isnan(x))
+
+    torch = pytest.importorskip("torch")
+    if dr.backend_v(t) != dr.JitBackend.LLVM:
+        pytest.skip("LLVM-specific test")
+
+    a = torch.tensor([1.0, 0.5, -3.0], dtype=torch.bfloat16)
+    b = dr.detail.import_tensor(a)
+    assert dr.type_v(b) == dr.VarType.UInt16
+    assert dr.all(dr.bfloat16_to_float(b.array) == t(1.0, 0.5, -3.0))
@@ -69,3 +69,29 @@ def test03_cpp_make_opaque(t):
 
     pkg.cpp_make_opaque(holder)
     assert holder.value().state == dr.VarState.Evaluated
+
+@pytest.test_arrays("float32,is_diff,shape=(*),jit")
+def test04_cpp_custom_op(t):
+    pkg = get_pkg(t)
+    Float = t
+
+    # Backward mode: the adjoint of the C++ CustomOp is traced symbolically
+    # and evaluated along with the surrounding gradient arithmetic
+    x = Float(1, 2, 3)
+    dr.enable_grad(x)
+    y = pkg.cpp_custom_square(x * 2) + x
+    assert dr.all(y == Float(5, 18, 39))
+
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        dr.backward(y)
+        g = dr.grad(x)
+        dr.eval(g)
+        assert len(dr.kernel_history([dr.KernelType.JIT])) == 1
+    assert dr.all(g == Float(9, 17, 25))
+
+    # Forward mode
+    x = Float(1, 2, 3)
+    dr.enable_grad(x)
+    y = pkg.cpp_custom_square(x)
+    dr.forward(x)
+    assert dr.all(dr.grad(y) == Float(2, 4, 6))
@@ -490,4 +490,63 @@ def test20_zero_direction_no_hit(face, direction):
         grid_res = (3, 3, 3),
         grid_min = (-1, -1, -1),
         grid_max = (1, 1, 1)
-    )
\ No newline at end of file
+    )
+
+@pytest.test_arrays('jit, float32, shape=(3, *), -diff')
+@pytest.mark.parametrize('batch', [1, 3])
+@pytest.mark.parametrize('mode', ['symbolic', 'evaluated'])
+def test21_integrate_occupancy(t, batch, mode):
+    """Empty-space skipping and batching must not change the integral"""
+    m = sys.modules[t.__module__]
+    Float = dr.value_t(t)
+    UInt32 = dr.uint32_array_t(Float)
+    res = 9
+
+    # Volume that is zero in the lower half along Z
+    index = dr.arange(UInt32, res**3)
+    data = m.PCG32(res**3).next_float32() * Float(index // (res*res) >= 5)
+    vol = dr.tensor_t(t)(data, shape=(res,)*3)
+
+    # 2x2x2 macro cells over the 8x8x8 grid cells
+    occ = dr.tensor_t(UInt32)(UInt32(0, 0, 0, 0, 1, 1, 1, 1), shape=(2, 2, 2))
+
+    rng = m.PCG32(64)
+    p0 = t(rng.next_float32(), rng.next_float32(), rng.next_float32())*2-1
+    p1 = t(rng.next_float32(), rng.next_float32(), rng.next_float32())*2-1
+
+    args = dict(ray_o=p0, ray_d=p1 - p0, ray_max=Float(1),
+                grid_min=t(-1), grid_max=t(1), vol=vol, mode=mode)
+    ref = integrate(**args)
+    val = integrate(**args, occupancy=occ, batch=batch)
+    assert dr.allclose(ref, val)
+
+
+@pytest.test_arrays('jit, float32, shape=(3, *), -diff')
+@pytest.mark.parametrize('batch', [1, 4])
+def test22_dda_occupancy_visits(t, batch):
+    """Cells within empty macro cells are never visited"""
+    m = sys.modules[t.__module__]
+    Float = dr.value_t(t)
+    UInt32 = dr.uint32_array_t(Float)
+    ArrayNu = dr.uint32_array_t(t)
+
+    # Only the macro cell with index (z, y, x) = (1, 1, 1) is occupied
+    occ = dr.tensor_t(UInt32)(UInt32(0, 0, 0, 0, 0, 0, 0, 1), shape=(2, 2, 2))
+
+    def count_fn(state, idx, p0, p1, active):
+        count, outside = state
+        inside = dr.all(idx >= 4)
+        count = dr.select(active, count + 1, count)
+        outside = dr.select(active & ~inside, outside + 1, outside)
+        return (count, outside), dr.mask_t(Float)(True)
+
+    ray_o = t(-0.1, -0.1, -0.1)
+    ray_d = t(1, 1, 1)
+    args = dict(ray_o=ray_o, ray_d=ray_d, ray_max=Float(dr.inf),
+                grid_res=ArrayNu(8), grid_min=t(0), grid_max=t(1),
+                func=count_fn, state=(UInt32(0), UInt32(0)),
+                active=dr.mask_t(Float)(True))
+
+    count_ref, _ = dda(**args)
+    count, outside = dda(**args, occupancy=occ, batch=batch)
+    assert count_ref[0] == 8 and count[0] == 4 and outside[0] == 0
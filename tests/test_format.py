@@ -265,4 +265,17 @@ def test13_evaluated_print(t):
     j = t([2, 1, 0])
     b = AppendBuffer()
     foo(i, b, j < 2)
-    assert b.value == '[2]'
\ No newline at end of file
+    assert b.value == '[2]'
+
+@pytest.test_arrays('tensor, uint32, jit')
+def test14_format_big_tensor(t):
+    # Only the displayed entries of large arrays are gathered and read
+    x = t(dr.arange(dr.array_t(t), 60), (30, 2))
+    assert dr.format("{}", x) == \
+        '[[0, 1],\n [2, 3],\n [4, 5],\n .. 24 skipped ..,\n [54, 55],\n [56, 57],\n [58, 59]]'
+
+    y = t(dr.arange(dr.array_t(t), 3000), (30, 100))
+    s = dr.format("{}", y)
+    assert s.startswith('[[0, 1, 2, .. 94 skipped .., 97, 98, 99],\n [100, 101, 102,')
+    assert s.endswith('[2900, 2901, 2902, .. 94 skipped .., 2997, 2998, 2999]]')
+    assert repr(y) == s
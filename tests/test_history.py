@@ -24,3 +24,119 @@ def test01_kernel_history(t):
 
     # Kernel history should be erased after queried
     assert len(dr.kernel_history()) == 0
+
+
+@pytest.test_arrays('float32,shape=(*),jit,-diff')
+def test02_kernel_history_report(t):
+    import json
+    dr.kernel_history_clear()
+
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        with dr.profile_range("outer"):
+            for i in range(3):
+                dr.eval(dr.arange(t, 10) + i)
+            with dr.profile_range("inner"):
+                dr.eval(dr.arange(t, 20) * 2)
+        history = dr.kernel_history()
+
+    assert [h['label'] for h in history] == ['outer'] * 3 + ['outer/inner']
+
+    report = dr.kernel_history_report(history, group_by=('label',))
+    assert len(report) == 2
+    counts = { s['label']: s['count'] for s in report }
+    assert counts == { 'outer': 3, 'outer/inner': 1 }
+    for s in report:
+        assert s['p95_time'] <= s['total_time']
+        assert s['mean_time'] * s['count'] == pytest.approx(s['total_time'])
+
+    trace = json.loads(dr.kernel_history_trace(history))
+    names = [e['name'] for e in trace['traceEvents']]
+    assert names.count('outer') == 1 and names.count('inner') == 1
+    assert len(names) == 6
+
+
+@pytest.test_arrays('float32,shape=(*),jit,is_diff')
+def test03_trace_spans(t):
+    import json
+
+    dr.trace_start()
+    with dr.profile_range("step"):
+        x = dr.arange(t, 16)
+        dr.enable_grad(x)
+        y = dr.sum(x * x)
+        dr.eval(y)
+        dr.backward(y)
+    spans = dr.trace_stop()
+
+    assert spans[0]['name'] == 'step' and spans[0]['parent'] is None
+    categories = set(s['category'] for s in spans)
+    assert {'profile_range', 'eval', 'ad_traverse', 'kernel'} <= categories
+
+    for s in spans:
+        assert s['start'] <= s['end']
+        assert s['file'].endswith('test_history.py') and s['line'] > 0
+        if s['category'] in ('eval', 'ad_traverse'):
+            assert s['parent'] == 0
+        elif s['category'] == 'kernel':
+            assert s['parent'] is not None
+
+    # Tracing is disabled after being stopped
+    dr.eval(dr.arange(t, 4) + 1)
+    assert dr.trace_stop() == []
+
+    otlp = json.loads(dr.trace_export(spans))
+    result = otlp['resourceSpans'][0]['scopeSpans'][0]['spans']
+    assert len(result) == len(spans)
+    assert 'parentSpanId' not in result[0]
+    ids = set(r['spanId'] for r in result)
+    assert all(r['parentSpanId'] in ids for r in result[1:])
+
+
+@pytest.test_arrays('float32,shape=(*),jit,-diff')
+def test04_bench(t):
+    x = dr.arange(t, 1000)
+    stats = dr.bench(lambda x, c: dr.sin(x) * c, x, 2, repeat=5, warmup=2)
+
+    assert stats['repeat'] == 5 and stats['kernels'] == 1
+    assert stats['cache_hit_ratio'] == 1
+    for k in ('tracing', 'codegen', 'backend', 'execution', 'wall'):
+        s = stats[k]
+        assert len(stats['samples'][k]) == 5
+        assert s['min'] <= s['median'] <= s['max']
+        assert s['min'] <= s['p95'] <= s['max']
+        assert s['mad'] >= 0 and s['std'] >= 0
+    assert dr.allclose(stats['result'], dr.sin(x) * 2)
+
+    # Kernel history is restored afterwards, and cold runs recompile
+    assert not dr.flag(dr.JitFlag.KernelHistory)
+    stats = dr.bench(lambda: dr.arange(t, 10) + 1, repeat=2, warmup=0,
+                     flush_caches=True)
+    assert stats['cache_hit_ratio'] == 0
+
+
+@pytest.test_arrays('float32,shape=(*),jit,-diff')
+def test05_kernel_manifest(t, tmp_path):
+    import os
+    cache = tmp_path / 'cache'
+    cache.mkdir()
+
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        dr.eval(dr.arange(t, 10) * 3)
+        history = dr.kernel_history()
+
+    # Simulate the cache file that Dr.Jit-Core wrote for this kernel
+    h = history[0]['hash']
+    (cache / f'{h}.bin').write_bytes(b'kernel')
+
+    fname = str(tmp_path / 'kernels.json')
+    manifest = dr.kernel_manifest_save(fname, history, cache_dir=str(cache))
+    assert list(manifest['kernels'].keys()) == [h]
+    assert len(manifest['kernels'][h]['ir']) > 0
+
+    target = tmp_path / 'target'
+    assert dr.precompile(fname, threads=2, cache_dir=str(target)) == 1
+    assert (target / f'{h}.bin').read_bytes() == b'kernel'
+
+    # Already installed kernels are skipped
+    assert dr.precompile(manifest, cache_dir=str(target)) == 0
+    assert os.listdir(target) == [f'{h}.bin']
@@ -613,3 +613,40 @@ def test18_if_stmt_preserve_unused_ad(t, mode):
         assert not dr.grad_enabled(x)
         assert dr.grad_enabled(y)
         assert y.index_ad == y_id
+
+
+@pytest.test_arrays('float32,is_jit,shape=(*)')
+@pytest.mark.parametrize('label', [None, 'auto_cond'])
+def test24_if_stmt_auto(t, label):
+    # The 'auto' mode only runs the taken branch when the condition is uniform
+    # and otherwise falls back to symbolic mode
+    calls = []
+
+    def true_fn(x):
+        calls.append(True)
+        return x + 1
+
+    def false_fn(x):
+        calls.append(False)
+        return x * 2
+
+    x = dr.opaque(t, 0, 5) + dr.arange(t, 5)
+    for cond, ref in ((x < 10, [1, 2, 3, 4, 5]),
+                      (x > 10, [0, 2, 4, 6, 8]),
+                      (x < 2, [1, 2, 4, 6, 8])):
+        calls.clear()
+        r = dr.if_stmt(
+            args=(x,),
+            cond=cond,
+            true_fn=true_fn,
+            false_fn=false_fn,
+            label=label,
+            mode='auto'
+        )
+        assert dr.all(r == t(ref))
+        if ref[0] == 1 and ref[2] == 3:
+            assert calls == [True]
+        elif ref[0] == 0:
+            assert calls == [False]
+        else:
+            assert calls == [True, False]
@@ -330,3 +330,57 @@ def test11_bwd_in_cond(t, mode):
         dr.backward(2 * d)
 
     assert dr.allclose(buf1.grad, [2, 2, 0, 0])
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test12_bwd_uniform_evaluated_cond(t):
+    # When the condition has been evaluated and all entries take the same
+    # branch, the derivative only traces that branch
+    calls = [0, 0]
+
+    def f(x, cond):
+        calls[0] += 1
+        return x * x
+
+    def g(x, cond):
+        calls[1] += 1
+        return x * 3
+
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+    cond = x > 0
+    dr.eval(cond)
+
+    y = dr.if_stmt((x, cond), cond, f, g, mode='symbolic')
+    assert calls == [1, 1]
+
+    dr.backward(y)
+    assert calls == [2, 1]
+    assert dr.all(x.grad == [2, 4, 6])
+    assert dr.all(y == [1, 4, 9])
+
+
+@pytest.mark.parametrize('mode', ['evaluated', 'symbolic'])
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+@pytest.skip_on(RuntimeError, "backend does not support the requested type of atomic reduction")
+@dr.syntax
+def test13_ad_bwd_repeated_implicit_dep(t, mode):
+    # Nested scopes read the same implicit dependencies many times
+    y = t(1)
+    buf = dr.zeros(t, 11)
+    dr.enable_grad(y, buf)
+
+    x = dr.arange(t, 10)
+    idx = dr.uint32_array_t(t)(x)
+
+    if dr.hint(x < 8, mode=mode, exclude=[y, buf]):
+        z = x*y + y
+        if dr.hint(x > 2, mode=mode, exclude=[y, buf]):
+            z += y*y + dr.gather(t, buf, idx) + dr.gather(t, buf, idx + 1)
+        z += y
+    else:
+        z = x - y
+
+    dr.backward_from(z)
+    assert dr.all(dr.grad(y) == 52)
+    assert dr.all(dr.grad(buf) == [0, 0, 0, 1, 2, 2, 2, 2, 1, 0, 0])
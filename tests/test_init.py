@@ -624,3 +624,128 @@ def test28_width(t):
     assert dr.width([t(1, 2), t(1)]) == 2
     with pytest.raises(RuntimeError, match='ragged'):
         dr.width([t(1, 2), t(2, 3, 3)])
+
+
+# The fields of dataclasses are cached; make sure this is robust when the
+# type is garbage collected and another one is created
+@pytest.test_arrays('float32, shape=(*), jit')
+def test29_dataclass_cache(t):
+    from dataclasses import dataclass
+    import gc
+
+    for i in range(3):
+        @dataclass
+        class Test:
+            x: t = t(0)
+            y: t = t(1)
+
+        v = dr.zeros(Test, i + 1)
+        dr.eval(v)
+        assert len(v.x) == i + 1 and len(v.y) == i + 1
+        del Test, v
+        gc.collect()
+
+
+# Test the fast path for lists/tuples of builtin Python types
+@pytest.test_arrays('shape=(*), jit, -tensor')
+def test30_init_seq_fast(t):
+    vt = dr.type_v(t)
+    n = 1000
+
+    if vt == dr.VarType.Bool:
+        values = [i % 3 == 0 for i in range(n)]
+    elif dr.is_float_v(t):
+        # Mix of 'int' and 'float' entries
+        values = [i * 0.5 if i % 2 else i for i in range(n)]
+    elif dr.is_signed_v(t):
+        values = [i - n // 2 for i in range(n)]
+    else:
+        values = list(range(n))
+
+    v1, v2 = t(values), t(tuple(values))
+    assert v1.numpy().tolist() == values
+    assert v2.numpy().tolist() == values
+
+    # Falls back to the general path for other types of entries
+    if dr.is_integral_v(t) and vt != dr.VarType.Bool:
+        import numpy as np
+        v3 = t([np.int32(1), 2, 3])
+        assert v3.numpy().tolist() == [1, 2, 3]
+
+    with pytest.raises(TypeError, match='invalid type in input'):
+        t([1, 2, None])
+
+
+# Nested lists initialize each component via the fast path
+@pytest.test_arrays('float32, shape=(3, *), jit')
+def test31_init_seq_fast_nested(t):
+    v = t([[1, 2], [3.5, 4], [5, 6.5]])
+    assert dr.all(v == t([1, 2], [3.5, 4], [5, 6.5]), axis=None)
+
+
+# Backend modules are bound on first access and remain introspectable
+@pytest.test_arrays('float32, shape=(*), jit')
+def test32_lazy_backend_module(t):
+    import sys
+    mod = sys.modules[t.__module__]
+    assert 'Float' in dir(mod)
+    assert mod.Float is getattr(mod, 'Float')
+
+    with pytest.raises(AttributeError, match='has no attribute'):
+        mod.DoesNotExist
+
+
+@pytest.test_arrays('float32, shape=(*), llvm')
+def test33_thread_affinity(t):
+    import sys
+    assert dr.thread_affinity() == 'none'
+
+    with pytest.raises(RuntimeError, match='must equal'):
+        dr.set_thread_affinity('spread')
+
+    if not sys.platform.startswith('linux'):
+        pytest.skip('thread pinning is only supported on Linux')
+
+    nodes = dr.numa_nodes()
+    assert len(nodes) >= 1 and all(len(n) > 0 for n in nodes)
+
+    count = dr.thread_count()
+    try:
+        for policy in ('numa', 'compact'):
+            dr.set_thread_affinity(policy)
+            assert dr.thread_affinity() == policy
+            x = dr.arange(t, 100000)
+            assert dr.allclose(dr.sum(x * 2), 9999900000)
+        dr.set_thread_count(max(count // 2, 1))
+        dr.set_thread_count(count)
+    finally:
+        dr.set_thread_affinity('none')
+        dr.set_thread_count(count)
+
+
+@pytest.test_arrays('float32, shape=(*), llvm, is_diff')
+def test34_parallel_for(t):
+    def task(i):
+        x = dr.arange(t, 10) + i
+        dr.enable_grad(x)
+        y = dr.sum(x * x)
+        dr.backward(y)
+        dr.eval(y)
+        return y[0], x.grad
+
+    results = dr.parallel_for(8, task)
+    assert len(results) == 8
+    for i, (y, g) in enumerate(results):
+        x = dr.arange(t, 10) + i
+        assert dr.allclose(y, dr.sum(x * x)[0])
+        assert dr.all(g == 2 * x)
+
+    assert dr.parallel_for(0, task) == []
+
+    def fail(i):
+        if i % 3 == 2:
+            raise RuntimeError(f"task {i}")
+        return i
+
+    with pytest.raises(RuntimeError, match='task 2'):
+        dr.parallel_for(10, fail)
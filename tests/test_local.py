@@ -196,3 +196,29 @@ def test10_loop_read_then_write(t, capsys):
         local[size] = t(4)
 
     assert val[0] == 16
+
+
+@pytest.test_arrays('jit,-diff,uint32,shape=(*)')
+def test11_register_placement(t):
+    s = dr.alloc_local(t, 3, value=t(7), placement='registers')
+    assert s[1].state == dr.VarState.Literal
+
+    # Entries are ordinary variables, masked accesses become selects
+    x = t(1, 2, 3)
+    s[0] = x
+    s.write(t(9), 2, active=x > 1)
+    assert dr.all(s[0] == x)
+    assert dr.all(s[2] == t(7, 9, 9))
+    assert dr.all(s.read(2, active=x < 3) == t(7, 9, 0))
+
+    with pytest.raises(RuntimeError, match='literal'):
+        s[t(0, 1, 2)]
+    with pytest.raises(RuntimeError, match='out of bounds'):
+        s[3] = t(0)
+    with pytest.raises(RuntimeError, match='placement'):
+        dr.alloc_local(t, 3, placement='texture')
+
+    # Fallback placements behave like ordinary local memory
+    s = dr.alloc_local(t, 2, value=t(0), placement='shared')
+    s[t(1)] = t(5)
+    assert dr.all(s[1] == 5)
@@ -243,4 +243,67 @@ def test18_init_upcast(t):
     assert dr.all(Matrix43f(2) == t(2), axis=None)
     assert dr.all(Matrix41f(2) == t(2), axis=None)
     with pytest.raises(TypeError):
-        t(Matrix41f(2))
\ No newline at end of file
+        t(Matrix41f(2))
+
+def _linalg_inputs(t):
+    # A batch of nonsymmetric 3x3 matrices (the second one requires pivoting)
+    # along with symmetric positive definite matrices derived from them
+    v = dr.value_t(t)
+    s = dr.value_t(v)
+    a = t(s(2, 0), s(-1, 1), s(0.5, 3),
+          s(1, 4), s(3, -2), s(-1, 1),
+          s(0, 1), s(2, 0.5), s(4, 2))
+    spd = a @ a.T + t(1)
+    b = v(s(1, -2), s(2, 0.5), s(3, 1))
+    return a, spd, b
+
+
+@pytest.test_arrays('-float16, matrix,shape=(3, 3, *)')
+def test19_cholesky_lu(t):
+    a, spd, b = _linalg_inputs(t)
+
+    L = dr.cholesky(spd)
+    assert dr.allclose(L @ L.T, spd)
+    assert dr.all((L[0, 1] == 0) & (L[0, 2] == 0) & (L[1, 2] == 0))
+    assert dr.allclose(spd @ dr.cholesky_solve(L, b), b)
+
+    LU, perm = dr.lu(a)
+    assert dr.all(perm[0] == dr.value_t(perm)(0, 1))
+    assert dr.allclose(a @ dr.lu_solve(LU, perm, b), b)
+
+
+@pytest.test_arrays('-float16, matrix,shape=(3, 3, *)')
+def test20_eigh_svd(t):
+    a, spd, _ = _linalg_inputs(t)
+
+    w, V = dr.eigh(spd)
+    assert dr.allclose(V @ dr.diag(w) @ V.T, spd)
+    assert dr.allclose(V.T @ V, t(1))
+    assert dr.all((w[0] <= w[1]) & (w[1] <= w[2]))
+
+    U, sigma, V = dr.svd(a)
+    assert dr.allclose(U @ dr.diag(sigma) @ V.T, a)
+    assert dr.allclose(U.T @ U, t(1))
+    assert dr.allclose(V.T @ V, t(1))
+    assert dr.all((sigma[0] >= sigma[1]) & (sigma[1] >= sigma[2]) & (sigma[2] >= 0))
+
+
+@pytest.test_arrays('-float16, quaternion')
+def test21_slerp_squad(t):
+    m = sys.modules[t.__module__]
+    Array3f = dr.replace_type_t(m.Array3f, dr.type_v(t))
+
+    q0 = t(0, 0, 0, 1)
+    q1 = dr.rotate(t, Array3f(0, 0, 1), 1.2)
+    assert dr.allclose(dr.slerp(q0, q1, 0), q0)
+    assert dr.allclose(dr.slerp(q0, q1, 1), q1)
+    assert dr.allclose(dr.slerp(q0, q1, 0.25), dr.rotate(t, Array3f(0, 0, 1), 0.3))
+
+    # Shortest arc, nearly parallel and identical inputs
+    assert dr.allclose(dr.slerp(q0, -q1, 0.5), dr.rotate(t, Array3f(0, 0, 1), 0.6))
+    q2 = dr.rotate(t, Array3f(0, 0, 1), 1e-3)
+    assert dr.allclose(dr.slerp(q0, q2, 0.5), dr.rotate(t, Array3f(0, 0, 1), 5e-4))
+    assert dr.allclose(dr.slerp(q1, q1, 0.7), q1)
+
+    # Degenerate control points reduce squad to slerp
+    assert dr.allclose(dr.squad(q0, q1, q0, q1, 0.4), dr.slerp(q0, q1, 0.4))
@@ -565,6 +565,23 @@ def test22_repeat(t):
     y = dr.repeat(x, 3)
     assert dr.all(y == [1, 1, 1, 2, 2, 2])
 
+@pytest.test_arrays('jit,float32,shape=(*)')
+def test22_repeat_tile_broadcast(t):
+    # Literals and single-element arrays broadcast without a gather
+    for f in (dr.repeat, dr.tile):
+        y = f(dr.full(t, 3, 2), 4)
+        assert y.state == dr.VarState.Literal and len(y) == 8
+        assert dr.all(y == 3)
+
+        x = t(1) + dr.opaque(t, 2)
+        y = f(x, 5)
+        assert x.state == dr.VarState.Unevaluated and len(y) == 5
+        assert dr.all(y == 3)
+
+    a, b = dr.meshgrid(dr.zeros(t, 3), t(4, 5))
+    assert a.state == dr.VarState.Literal
+    assert dr.all(a == 0) and dr.all(b == t(4, 4, 4, 5, 5, 5))
+
 @pytest.test_arrays('shape=(*),-bool')
 def test23_block_sum(t):
     x = t(1, 2, 3, 4, 5, 6)
@@ -838,3 +855,169 @@ def test34_ravel_builtin(t, order):
 
     assert type(x) is type(y)
     assert x == y
+
+@pytest.test_arrays('float32,tensor,jit')
+def test35_scatter_add_kahan_tensor(t):
+    buf1 = dr.zeros(t, shape=(2, 2))
+    buf2 = dr.zeros(t, shape=(2, 2))
+    m = dr.array_t(t)
+    ti = dr.uint32_array_t(m)
+    dr.scatter_add_kahan(
+        buf1,
+        buf2,
+        m(1, dr.epsilon(m), dr.epsilon(m)),
+        dr.full(ti, 3, 3)
+    )
+    assert buf1.shape == (2, 2)
+    assert dr.all((buf1 + buf2).array == [0, 0, 0, 1+dr.epsilon(m)*2])
+
+@pytest.test_arrays('float32,shape=(*),jit')
+def test36_gather_scatter_record(t):
+    # Array-of-structures records with mixed field types
+    m = sys.modules[t.__module__]
+    UInt32 = dr.uint32_array_t(t)
+
+    class Record:
+        DRJIT_STRUCT = { 'p' : m.Array3f, 'id' : UInt32 }
+        def __init__(self, p: m.Array3f = m.Array3f(), id: UInt32 = UInt32()):
+            self.p = p
+            self.id = id
+
+    buf = dr.zeros(t, 8)
+    dr.scatter(buf, Record(m.Array3f([1, 2], [3, 4], [5, 6]), UInt32(7, 8)),
+               UInt32(1, 0))
+    assert dr.all(dr.reinterpret_array(UInt32, buf)[[3, 7]] == [8, 7])
+    assert dr.all(buf[0:3] == [2, 4, 6])
+
+    r = dr.gather(Record, buf, UInt32(1, 0, 1))
+    assert type(r) is Record
+    assert dr.all(r.p == m.Array3f([1, 2, 1], [3, 4, 3], [5, 6, 5]), axis=None)
+    assert dr.all(r.id == [7, 8, 7])
+
+    class Record3:
+        DRJIT_STRUCT = { 'uv' : m.Array2f, 'id' : UInt32 }
+        def __init__(self, uv: m.Array2f = m.Array2f(), id: UInt32 = UInt32()):
+            self.uv = uv
+            self.id = id
+
+    r = dr.gather(Record3, buf, UInt32(0))
+    assert dr.all(r.uv == m.Array2f(2, 4), axis=None)
+    assert dr.reinterpret_array(t, r.id)[0] == 6
+
+
+@pytest.test_arrays('jit, float32, -diff, shape=(4, 4, *)')
+def test37_packet_ravel_unravel_nested(t, capsys, drjit_verbose):
+    # Nested arrays (e.g., matrices) are interleaved via a single packet op
+    vt = dr.value_t(dr.value_t(t))
+    x = dr.zeros(t, 2)
+    for i in range(4):
+        for j in range(4):
+            x[i][j] = vt(16 * i + 4 * j, 16 * i + 4 * j + 1)
+    y = dr.ravel(x, order='F')
+    dr.eval(y)
+    z = dr.unravel(t, y, order='F')
+    dr.eval(z)
+
+    transcript = capsys.readouterr().out
+    assert transcript.count('jit_var_scatter_packet') == 1
+    assert transcript.count('jit_var_gather_packet') == 1
+
+    ref = [16 * i + 4 * j + k for k in range(2) for j in range(4) for i in range(4)]
+    assert dr.all(y == ref)
+    assert dr.all(z == x, axis=None)
+
+
+@pytest.test_arrays('float32,shape=(*),jit,-diff')
+def test38_queue(t):
+    m = sys.modules[t.__module__]
+    q = dr.Queue(m.Array2f, capacity=4)
+
+    x = dr.arange(t, 6)
+    q.push(m.Array2f(x, -x), active=(x == 1) | (x == 4))
+    assert dr.all(q.size() == 2) and not dr.any(q.overflowed())
+
+    value, active = q.items()
+    assert dr.all(active == [True, True, False, False])
+    assert set(dr.select(active, value.x, -1).numpy().tolist()) == {-1, 1, 4}
+    assert dr.all(dr.select(active, value.x + value.y, 0) == 0)
+
+    # Entries beyond the capacity are dropped
+    q.push(m.Array2f(x, x))
+    assert dr.all(q.size() == 4) and dr.all(q.overflowed())
+
+    q.reset()
+    assert dr.all(q.size() == 0)
+    assert not dr.any(q.items()[1])
+
+
+@pytest.test_arrays('float32,shape=(*),jit,-diff')
+def test39_quantized_array(t):
+    m = sys.modules[t.__module__]
+    x = t(-1.0, -0.5, 0.0, 0.25, 1.0, 3.0)
+    q = dr.QuantizedArray(x)
+    assert type(q.data) is m.UInt8 and len(q) == 6
+    assert dr.allclose(q.dequantize(), x, atol=q.scale / 2)
+
+    index = m.UInt32(4, 0, 2)
+    assert dr.allclose(q.gather(index), dr.gather(t, x, index), atol=q.scale / 2)
+
+    # Stochastic rounding keeps many small updates unbiased
+    n = 100000
+    q = dr.QuantizedArray(dr.zeros(t, 2), signed=True, scale=1.0, zero_point=0)
+    assert type(q.data) is m.Int8
+    q.scatter_add(dr.full(t, 0.25 / n * 400, n), dr.zeros(m.UInt32, n))
+    assert abs(q.gather(m.UInt32(0))[0] - 100) <= 40
+    assert q.gather(m.UInt32(1))[0] == 0
+
+    # Updates saturate at the limits of the storage type
+    q.scatter_add(t(1000.0, -1000.0), m.UInt32(0, 1))
+    assert dr.all(q.dequantize() == t(127, -128))
+
+
+@pytest.test_arrays('float32,shape=(*),jit')
+def test40_to_host_many(t):
+    np = pytest.importorskip("numpy")
+    m = sys.modules[t.__module__]
+    loss = dr.sum(t(1.5, 2.5))
+    count = m.UInt32(7, 8, 9)
+    flag = m.Bool(False, True)
+    big = m.Int64(-2**40, 5)
+    x = m.Float64(0.1, -3)
+
+    result = dr.to_host_many({'loss': loss, 'count': (count, 'other'),
+                              'flag': flag, 'big': big, 'x': [x]})
+    assert result == {'loss': 4.0, 'count': (7, 'other'), 'flag': False,
+                      'big': -2**40, 'x': [0.1]}
+    assert type(result['count'][0]) is int and type(result['flag']) is bool
+
+    assert dr.to_host_many((count, flag, big), index=-1) == (9, True, 5)
+
+    full = dr.to_host_many([x, count, m.TensorXf(t(1, 2, 3, 4), shape=(2, 2))],
+                           index=None)
+    assert np.all(full[0] == [0.1, -3]) and full[0].dtype == np.float64
+    assert np.all(full[1] == [7, 8, 9]) and full[1].dtype == np.uint32
+    assert full[2].shape == (2, 2) and full[2][1, 0] == 3
+
+    with pytest.raises(IndexError):
+        dr.to_host_many(count, index=3)
+
+
+@pytest.test_arrays('float32,shape=(*),jit')
+def test41_eval_async(t):
+    m = sys.modules[t.__module__]
+
+    # A pending scatter of the calling thread must be visible to the worker
+    buf = dr.zeros(t, 4)
+    dr.scatter(buf, t(1, 2), m.UInt32(1, 3))
+    futures = [dr.eval_async(buf * i + dr.arange(t, 4)) for i in range(6)]
+
+    for i, f in enumerate(futures):
+        x = f.result()
+        assert x.state == dr.VarState.Evaluated
+        assert dr.all(x == t(0, 1 + i, 2, 3 + 2 * i))
+
+    a, b = dr.eval_async(t(1, 2) + 1, {'y': t(3) * 2}, stream=1).result()
+    assert dr.all(a == t(2, 3)) and b['y'][0] == 6
+
+    # Results can be consumed by further computation on the calling thread
+    assert dr.sum(dr.eval_async(a * 2).result())[0] == 10
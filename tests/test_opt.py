@@ -0,0 +1,110 @@
+import drjit as dr
+import drjit.opt
+import pytest
+import sys
+
+
+@pytest.test_arrays('is_diff, float32, shape=(*)')
+def test01_sgd(t):
+    opt = dr.opt.SGD(lr=0.25)
+    opt['x'] = t(1, 2, 3)
+
+    for i in range(2):
+        loss = dr.sum(dr.square(opt['x']))
+        dr.backward(loss)
+        opt.step()
+
+    # x <- x - 0.25 * 2x = x / 2
+    assert dr.allclose(opt['x'], t(0.25, 0.5, 0.75))
+    assert dr.grad_enabled(opt['x'])
+    assert dr.all(dr.grad(opt['x']) == 0)
+
+
+@pytest.test_arrays('is_diff, float32, shape=(*)')
+def test02_sgd_momentum(t):
+    opt = dr.opt.SGD(lr=1, momentum=0.5)
+    opt['x'] = t(0, 0)
+
+    for i in range(2):
+        dr.backward(dr.sum(opt['x'] * t(1, 2)))
+        opt.step()
+
+    # v1 = g, v2 = 0.5 * g + g, x = -(v1 + v2)
+    assert dr.allclose(opt['x'], -2.5 * t(1, 2))
+
+
+@pytest.test_arrays('is_diff, float32, shape=(*)')
+def test03_adam(t):
+    opt = dr.opt.Adam(lr=0.1)
+    opt['x'] = t(1, -2, 3)
+    opt['y'] = t(5)
+
+    for i in range(3):
+        loss = dr.sum(dr.square(opt['x'])) + dr.sum(dr.square(opt['y']))
+        dr.backward(loss)
+        opt.step()
+
+    # Reference implementation
+    b1, b2, eps = 0.9, 0.999, 1e-8
+    x, m, v = [1.0, -2.0, 3.0, 5.0], [0.0] * 4, [0.0] * 4
+    for it in range(1, 4):
+        for j in range(4):
+            g = 2 * x[j]
+            m[j] = b1 * m[j] + (1 - b1) * g
+            v[j] = b2 * v[j] + (1 - b2) * g * g
+            lr_t = 0.1 * (1 - b2 ** it) ** 0.5 / (1 - b1 ** it)
+            x[j] -= lr_t * m[j] / (v[j] ** 0.5 + eps)
+
+    assert dr.allclose(opt['x'], t(x[:3]))
+    assert dr.allclose(opt['y'], x[3])
+
+
+@pytest.test_arrays('is_diff, float32, shape=(*)')
+def test04_tensor_and_reset(t):
+    TensorXf = dr.tensor_t(t)
+    opt = dr.opt.Adam(lr=0.5)
+    opt['w'] = dr.ones(TensorXf, (2, 2))
+
+    dr.backward(dr.sum(opt['w'], axis=None))
+    opt.step()
+    assert opt['w'].shape == (2, 2)
+    assert dr.allclose(opt['w'], 0.5)
+
+    # Assigning a value with a different shape resets the moments
+    opt['w'] = dr.zeros(TensorXf, (3,))
+    assert 'w' not in opt.state
+    with pytest.raises(TypeError):
+        opt['z'] = 1.0
+
+
+@pytest.test_arrays('is_diff, float32, shape=(*)')
+def test05_parameter_pack(t):
+    m = sys.modules[t.__module__]
+    pack = dr.opt.ParameterPack({
+        'a': t(1, 2),
+        'b': m.Array3f(3, 4, 5),
+        'c': m.TensorXf(t(6, 7, 8, 9), shape=(2, 2))
+    })
+    assert len(pack) == 9 and 'b' in pack
+    assert dr.all(pack.data == t(1, 2, 3, 4, 5, 6, 7, 8, 9))
+
+    opt = dr.opt.SGD(lr=0.5)
+    opt['pack'] = pack.data
+
+    p = pack.unpack(opt['pack'])
+    assert type(p['b']) is m.Array3f and p['c'].shape == (2, 2)
+    loss = dr.sum(p['a']) + dr.sum(p['b'] * m.Array3f(1, 2, 3)) + \
+        dr.sum(dr.square(p['c'].array))
+    dr.backward(loss)
+
+    # All gradients accumulate into a single flat buffer
+    assert dr.allclose(dr.grad(opt['pack']), t(1, 1, 1, 2, 3, 12, 14, 16, 18))
+    opt.step()
+
+    p = pack.unpack(opt['pack'])
+    assert dr.allclose(p['a'], t(.5, 1.5))
+    assert dr.allclose(p['b'], m.Array3f(2.5, 3, 3.5))
+    assert dr.allclose(p['c'].array, t(0, 0, 0, 0))
+
+    with pytest.raises(TypeError, match="same backend and precision"):
+        dr.opt.ParameterPack({'x': t(1), 'y': m.Float64(2)})
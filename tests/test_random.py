@@ -0,0 +1,73 @@
+import drjit as dr
+import pytest
+import sys
+
+@pytest.test_arrays('uint64, shape=(*)')
+def test01_philox_known_answer(t):
+    # Known-answer vectors from the Random123 reference implementation
+    m = sys.modules[t.__module__]
+
+    rng = m.Philox4x32(1, seed=0)
+    assert dr.all(rng.next_uint32x4() == m.Array4u(0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8), axis=None)
+
+    rng = m.Philox4x32(1, seed=0xffffffffffffffff,
+                       counter=0xffffffffffffffff,
+                       stream=0xffffffffffffffff)
+    assert dr.all(rng.next_uint32x4() == m.Array4u(0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd), axis=None)
+
+    rng = m.Philox4x32(1, seed=0x299f31d0a4093822,
+                       counter=0x85a308d3243f6a88,
+                       stream=0x0370734413198a2e)
+    assert dr.all(rng.next_uint32x4() == m.Array4u(0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1), axis=None)
+
+
+@pytest.test_arrays('uint64, shape=(*)')
+def test02_philox_counter(t):
+    # Outputs only depend on the counter, and masked lanes don't advance
+    m = sys.modules[t.__module__]
+
+    rng = m.Philox4x32(4)
+    v0 = rng.next_uint32()
+    v1 = rng.next_uint32()
+    assert dr.all(rng.counter == 2)
+    assert dr.all(v0 != v1)
+
+    rng2 = m.Philox4x32(4, counter=1)
+    assert dr.all(rng2.next_uint32() == v1)
+
+    rng = m.Philox4x32(4)
+    rng.next_uint32(m.Bool(True, False, True, False))
+    assert dr.all(rng.counter == t(1, 0, 1, 0))
+    assert dr.all(rng.next_uint32(m.Bool(False, True, False, True)) == m.UInt32(v1[0], v0[1], v1[2], v0[3]))
+
+    x = rng.next_float32()
+    assert dr.all((x >= 0) & (x < 1))
+    x = rng.next_float64()
+    assert dr.all((x >= 0) & (x < 1))
+
+
+@pytest.test_arrays('uint32, shape=(*)')
+def test03_sobol_stratified(t):
+    # Each dimension of a power-of-two point set is stratified, and the
+    # first two dimensions form a (0, 4, 2)-net
+    m = sys.modules[t.__module__]
+    n = 16
+    s = m.Sobol(n, seed=1234)
+    for _ in range(6):
+        cell = m.UInt32(s.next_float32() * n)
+        assert sorted(cell.numpy().tolist()) == list(range(n))
+
+    s = m.Sobol(n, seed=7)
+    x = m.UInt32(s.next_float32() * 4)
+    y = m.UInt32(s.next_float32() * 4)
+    assert len(set((x * 4 + y).numpy().tolist())) == n
+
+
+@pytest.test_arrays('uint32, shape=(*)')
+def test04_sobol_integrate(t):
+    m = sys.modules[t.__module__]
+    s = m.Sobol(4096, seed=5)
+    x = s.next_float32()
+    y = s.next_float32()
+    assert dr.all(s.dim == 2)
+    assert dr.all(dr.abs(dr.mean(x * y) - 0.25) < 1e-4)
@@ -460,3 +460,137 @@ def test13_test_prefix_reduction(t, reverse, exclusive):
     test_red((9, 5, 7), 1)
     test_red((9, 5, 7), 2)
     test_red((9, 5, 7), -1)
+
+
+@pytest.mark.parametrize('op', [dr.ReduceOp.Add, dr.ReduceOp.Max])
+@pytest.test_arrays('float32, tensor, -is_diff')
+def test14_tensor_reduce_fused(t, op):
+    # Reductions over non-contiguous axis combinations in a single pass
+    np = pytest.importorskip("numpy")
+    x = np.arange(2 * 4 * 2 * 8, dtype=np.float32).reshape(2, 4, 2, 8) % 13
+
+    for axis in [(0,), (0, 1), (0, 2), (1, 3), (0, 1, 3), (2, 3)]:
+        if op is dr.ReduceOp.Add:
+            ref = x.sum(axis=axis)
+        else:
+            ref = x.max(axis=axis)
+        y = dr.reduce(op, t(x), axis, 'evaluated')
+        assert y.shape == ref.shape
+        assert np.all(y.numpy() == ref)
+
+    y = dr.mean(t(x), axis=(2, 3))
+    assert np.allclose(y.numpy(), x.mean(axis=(2, 3)))
+
+
+@pytest.test_arrays('float32, shape=(*), jit')
+def test15_segmented_reduce(t):
+    m = sys.modules[t.__module__]
+    x = t(1, 2, 3, 4, 5, 6, 7)
+    offsets = m.UInt32(0, 3, 3, 4, 7)
+
+    assert dr.all(dr.segmented_reduce(dr.ReduceOp.Add, x, offsets) == t(6, 0, 4, 18))
+    assert dr.all(dr.segmented_reduce(dr.ReduceOp.Max, x, offsets) == t(3, -dr.inf, 4, 7))
+
+    assert dr.all(dr.segmented_prefix_reduce(dr.ReduceOp.Add, x, offsets) ==
+                  t(0, 1, 3, 0, 0, 5, 11))
+    assert dr.all(dr.segmented_prefix_reduce(dr.ReduceOp.Add, x, offsets, exclusive=False) ==
+                  t(1, 3, 6, 4, 5, 11, 18))
+    assert dr.all(dr.segmented_prefix_reduce(dr.ReduceOp.Add, x, offsets, reverse=True) ==
+                  t(5, 3, 0, 0, 13, 7, 0))
+
+
+@pytest.test_arrays('float32, shape=(*), is_diff')
+def test16_segmented_reduce_ad(t):
+    m = sys.modules[t.__module__]
+    x = t(1, 2, 3, 4, 5)
+    offsets = m.UInt32(0, 2, 5)
+    dr.enable_grad(x)
+
+    y = dr.segmented_reduce(dr.ReduceOp.Add, x, offsets)
+    dr.backward(y * t(10, 100))
+    assert dr.all(x.grad == t(10, 10, 100, 100, 100))
+
+    dr.clear_grad(x)
+    y = dr.segmented_prefix_reduce(dr.ReduceOp.Add, x, offsets, exclusive=False)
+    dr.backward(y)
+    assert dr.all(x.grad == t(2, 1, 3, 2, 1))
+
+
+@pytest.test_arrays('float32, shape=(*), jit')
+def test17_stream(t):
+    np = pytest.importorskip("numpy")
+    m = sys.modules[t.__module__]
+    data = np.arange(1000, dtype=np.float32)
+    calls = []
+
+    def f(x, scale):
+        calls.append(len(x))
+        x = t(x) * scale
+        return {'sum': dr.sum(x), 'max': dr.max(x), 'sq': (x * x, m.Array2f(x, -x))}
+
+    r = dr.stream(f, (data, 2.0), chunk_size=300,
+                  reduce={'sum': dr.ReduceOp.Add, 'max': dr.ReduceOp.Max, 'sq': None})
+    assert calls == [300, 300, 300, 100]
+    assert dr.allclose(r['sum'], 2 * data.sum())
+    assert dr.all(r['max'] == 2 * 999)
+    sq, arr = r['sq']
+    assert isinstance(sq, np.ndarray) and np.allclose(sq, (2 * data) ** 2)
+    assert arr.shape == (2, 1000) and np.allclose(arr[1], -2 * data)
+
+    # Dr.Jit inputs are sliced via gathers
+    x = dr.arange(t, 10)
+    assert np.all(dr.stream(lambda v: v + 1, x, 4) == np.arange(1, 11))
+
+
+@pytest.test_arrays('float32, shape=(*), jit')
+def test18_reduce_many(t):
+    x = dr.arange(t, 100) - 30
+    r = dr.reduce_many((dr.ReduceOp.Add, dr.ReduceOp.Max, dr.ReduceOp.Min,
+                        dr.ReduceOp.Mul), (x, x, x * 2, t(1, 2, 3, 4)))
+    assert len(r) == 4
+    assert dr.all(r[0] == dr.sum(x)) and dr.all(r[1] == 69)
+    assert dr.all(r[2] == -60) and dr.all(r[3] == 24)
+
+    r = dr.reduce_many(dr.ReduceOp.Add, (x, dr.square(x)), mode='symbolic')
+    assert r[0].state == dr.VarState.Dirty
+    dr.eval(r)
+    assert dr.all(r[0] == dr.sum(x)) and dr.all(r[1] == dr.sum(x * x))
+
+    # Reductions of inputs with the same size share one kernel
+    y = dr.arange(t, 1000)
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        r = dr.reduce_many(dr.ReduceOp.Add, (y, y * 2, dr.square(y)))
+        history = dr.kernel_history([dr.KernelType.JIT])
+    assert len(history) == 1
+    assert dr.allclose(r[2], dr.sum(dr.square(y), mode='evaluated'))
+
+    with pytest.raises(RuntimeError, match="same length"):
+        dr.reduce_many((dr.ReduceOp.Add,), (x, x))
+
+
+@pytest.test_arrays('float32, shape=(*), jit, is_diff')
+def test19_reduce_pairwise(t):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(0)
+    data = rng.random(100003, dtype=np.float32)
+    ref = data.astype(np.float64).sum()
+
+    x = t(data)
+    r = dr.sum(x, mode='pairwise')
+    assert abs(r[0] - ref) <= 1e-6 * ref
+
+    # Non-sum reductions are unaffected
+    assert dr.all(dr.max(x, mode='pairwise') == dr.max(x))
+    assert dr.all(dr.sum(t(3), mode='pairwise') == 3)
+
+    # The gradient matches that of a regular reduction
+    x = dr.arange(t, 70)
+    dr.enable_grad(x)
+    dr.backward(dr.sum(x * x, mode='pairwise'))
+    assert dr.all(x.grad == 2 * dr.arange(t, 70))
+
+    # Tensor reductions along an axis
+    T = dr.tensor_t(t)
+    v = T(dr.arange(t, 3 * 50), shape=(3, 50))
+    assert dr.allclose(dr.sum(v, axis=1, mode='pairwise'), dr.sum(v, axis=1))
+    assert dr.allclose(dr.sum(v, axis=0, mode='pairwise'), dr.sum(v, axis=0))
@@ -27,3 +27,51 @@ def test00_sh_eval():
     for i in range(9):
         r3 = dr.sh_eval(v, order=i)
         assert r[:len(r3)] == r3
+
+
+def test01_sh_eval_high_order():
+    sph_harm = pytest.importorskip("scipy.special").sph_harm
+    np = pytest.importorskip("numpy")
+    from drjit.scalar import Array3f
+
+    v = dr.normalize(Array3f(1, 2, 3))
+    theta, phi = np.arccos(v.z), np.arctan2(v.y, v.x)
+
+    r2 = []
+    for l in range(16):
+        for m in range(-l, l + 1):
+            Y = sph_harm(abs(m), l, phi, theta)
+            if m > 0:
+                Y = np.sqrt(2) * Y.real
+            elif m < 0:
+                Y = np.sqrt(2) * Y.imag
+            r2.append(Y.real)
+
+    r = dr.sh_eval(v, order=15)
+    assert dr.allclose(r, r2)
+    assert dr.allclose(r[:100], dr.sh_eval(v, order=9))
+
+
+@pytest.test_arrays('is_jit, float32, shape=(*)')
+def test02_sh_rotate(t):
+    import sys
+    m = sys.modules[t.__module__]
+    order = 12
+
+    # Batch of expansions with per-lane rotations
+    coeffs = [dr.sin(dr.arange(t, 4) * 1.3 + i) for i in range((order + 1) ** 2)]
+    q = dr.normalize(m.Quaternion4f(dr.arange(t, 4) + 0.3, -0.5, 0.8, 1.1))
+    R = dr.quat_to_matrix(q, size=3)
+    rotated = dr.sh_rotate(R, coeffs)
+
+    # f_rotated(d) == f(R^T d)
+    d = dr.normalize(m.Array3f(0.2, 0.4, -0.7))
+    f1 = sum(a * b for a, b in zip(rotated, dr.sh_eval(d, order)))
+    f2 = sum(a * b for a, b in zip(coeffs, dr.sh_eval(dr.matmul(dr.transpose(R), d), order)))
+    assert dr.allclose(f1, f2, rtol=1e-4, atol=1e-4)
+
+    # Rotations preserve the energy of each band
+    for l in range(order + 1):
+        e1 = sum(c * c for c in coeffs[l * l:(l + 1) ** 2])
+        e2 = sum(c * c for c in rotated[l * l:(l + 1) ** 2])
+        assert dr.allclose(e1, e2, rtol=1e-4)
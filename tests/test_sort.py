@@ -0,0 +1,80 @@
+import drjit as dr
+import pytest
+import sys
+
+@pytest.test_arrays('uint32, shape=(*), jit')
+def test01_argsort_uint32(t):
+    m = sys.modules[t.__module__]
+    x = t(5, 3, 0xFFFFFFFF, 3, 0, 7)
+    perm = dr.argsort(x)
+    assert dr.all(perm == m.UInt32(4, 1, 3, 0, 5, 2))
+    assert dr.all(dr.sort(x) == t(0, 3, 3, 5, 7, 0xFFFFFFFF))
+    assert dr.all(dr.argsort(x, reverse=True) == m.UInt32(2, 5, 0, 1, 3, 4))
+
+
+@pytest.test_arrays('float32, shape=(*), jit')
+def test02_sort_float32(t):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(1)
+    x = rng.standard_normal(1000).astype(np.float32)
+    x[::7] = 0.5  # Duplicate keys
+    assert np.all(dr.sort(t(x)).numpy() == np.sort(x))
+    assert np.all(dr.argsort(t(x)).numpy() == np.argsort(x, kind='stable'))
+
+
+@pytest.test_arrays('int64, shape=(*), jit')
+def test03_sort_int64(t):
+    x = t(-5, 1 << 40, -(1 << 40), 0, 3)
+    assert dr.all(dr.sort(x) == t(-(1 << 40), -5, 0, 3, 1 << 40))
+
+
+@pytest.test_arrays('float32, shape=(*), is_diff')
+def test04_sort_by_key_ad(t):
+    m = sys.modules[t.__module__]
+    keys = m.UInt32(3, 1, 2)
+    v = t(10, 20, 30)
+    dr.enable_grad(v)
+    k, (a, b) = dr.sort_by_key(keys, (v, v * 2))
+    assert dr.all(k == m.UInt32(1, 2, 3))
+    assert dr.all(a == t(20, 30, 10)) and dr.all(b == t(40, 60, 20))
+    dr.backward(a * t(1, 2, 3))
+    assert dr.all(v.grad == t(3, 1, 2))
+
+
+@pytest.test_arrays('uint32, shape=(*), jit')
+def test05_histogram(t):
+    m = sys.modules[t.__module__]
+    keys = t(0, 2, 2, 5, 2, 9, 0)
+    assert dr.all(dr.histogram(keys, 6) == t(2, 0, 3, 0, 0, 1))
+
+    w = m.Float(1, 2, 3, 4, 5, 6, 7)
+    assert dr.all(dr.histogram(keys, 3, weights=w) == m.Float(8, 0, 10))
+
+
+@pytest.test_arrays('int32, shape=(*), jit')
+def test06_unique_rle(t):
+    m = sys.modules[t.__module__]
+    values, counts = dr.run_length_encode(t(1, 1, 2, 1, 1, 1))
+    assert dr.all(values == t(1, 2, 1)) and dr.all(counts == m.UInt32(2, 1, 3))
+
+    values, counts = dr.unique(t(4, -1, 4, 0, -1, 4), return_counts=True)
+    assert dr.all(values == t(-1, 0, 4)) and dr.all(counts == m.UInt32(2, 1, 3))
+    assert dr.all(dr.unique(t(3)) == t(3))
+
+
+@pytest.mark.parametrize('side', ['left', 'right'])
+@pytest.test_arrays('float32, shape=(*), jit')
+def test07_searchsorted(t, side):
+    import bisect
+    m = sys.modules[t.__module__]
+    ref_func = bisect.bisect_left if side == 'left' else bisect.bisect_right
+
+    for n in [1, 2, 3, 5, 8, 9, 17]:
+        data = [float(i // 2) for i in range(n)]
+        queries = [-1.0, 0.0, 0.5, 1.0, n / 4, n / 2, n + 1.0]
+        ref = m.UInt32([ref_func(data, q) for q in queries])
+
+        a = t(data)
+        assert dr.all(dr.searchsorted(a, t(queries), side=side) == ref)
+        assert dr.all(dr.searchsorted(a, t(queries), side=side,
+                                      layout=dr.eytzinger(a)) == ref)
@@ -679,3 +679,115 @@ def test17_bwd_in_switch(t, symbolic):
         result = dr.switch(index, funcs, a, b)
         assert dr.allclose(result, [3, 6, 3, 4])
         assert dr.allclose(buf1.grad, [2, 2, 0, 0])
+
+@pytest.test_arrays('int32,-uint32,shape=(*),jit')
+def test18_switch_call_cache(t):
+    # Consecutive evaluated calls reuse the partition of the instance array
+    UInt32 = dr.uint32_array_t(t)
+    c = [lambda a: a * 4, lambda a: a * 8]
+    index = UInt32(0, 1, 0, 1)
+    a = t(1, 2, 3, 4)
+
+    backup = dr.detail.ad_call_cache()
+    try:
+        dr.detail.set_ad_call_cache(True)
+        assert dr.detail.ad_call_cache()
+        with dr.scoped_set_flag(dr.JitFlag.SymbolicCalls, False), \
+             dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+            dr.kernel_history()
+            r1 = dr.switch(index, c, a)
+            dr.eval(r1)
+            h1 = dr.kernel_history()
+            r2 = dr.switch(index, c, a + 1)
+            dr.eval(r2)
+            h2 = dr.kernel_history()
+
+        assert dr.all(r1 == [4, 16, 12, 32])
+        assert dr.all(r2 == [8, 24, 16, 40])
+        assert len(h2) <= len(h1)
+    finally:
+        dr.detail.set_ad_call_cache(backup)
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test19_switch_sorted(t):
+    # The sorted mode groups lanes by callable but preserves the output order
+    UInt32 = dr.uint32_array_t(t)
+    Bool = dr.mask_t(t)
+    c = [lambda a, b: a * 2 + b, lambda a, b: a - b, lambda a, b: a * b]
+
+    index = UInt32(2, 0, 1, 2, 0, 1, 1, 0)
+    m = Bool(True, True, False, True, True, True, True, True)
+    a = t(1, 2, 3, 4, 5, 6, 7, 8)
+    b = t(3)
+    dr.enable_grad(a)
+
+    r_ref = dr.switch(index, c, a, b, m, mode='symbolic')
+    r = dr.switch(index, c, a, b, m, mode='sorted')
+    assert dr.all(r == r_ref)
+    assert dr.all(r == [3, 7, 0, 12, 13, 3, 4, 19])
+
+    dr.backward(r)
+    assert dr.all(a.grad == [3, 2, 0, 3, 2, 1, 1, 2])
+
+    with pytest.raises(RuntimeError, match="'sorted'"):
+        dr.switch(index, c, a, b, mode='unsorted')
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test20_switch_inline(t):
+    # Tiny callables can be merged into the caller via select()
+    UInt32 = dr.uint32_array_t(t)
+    Bool = dr.mask_t(t)
+    buf = dr.zeros(t, 4)
+
+    def f0(a):
+        dr.scatter_add(buf, 1, UInt32(0))
+        return a * 2
+
+    c = [f0, lambda a: a + 1, lambda a: t(5)]
+    index = UInt32(0, 1, 2, 0)
+    m = Bool(True, True, True, False)
+    a = t(1, 2, 3, 4)
+    dr.enable_grad(a)
+
+    backup = dr.detail.ad_call_inline()
+    try:
+        dr.detail.set_ad_call_inline(4)
+        assert dr.detail.ad_call_inline() == 4
+        with dr.scoped_set_flag(dr.JitFlag.SymbolicCalls, True):
+            r = dr.switch(index, c, a, m)
+    finally:
+        dr.detail.set_ad_call_inline(backup)
+
+    assert dr.all(r == [2, 3, 5, 0])
+    assert dr.all(buf == [1, 0, 0, 0])
+    dr.backward(r)
+    assert dr.all(a.grad == [2, 1, 0, 0])
+
+
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test21_switch_reduce_batch(t):
+    # Evaluated calls can batch rarely targeted callables into one kernel
+    UInt32 = dr.uint32_array_t(t)
+    buf = dr.zeros(t, 4)
+
+    def f3(a):
+        dr.scatter_add(buf, 1, UInt32(3))
+        return a - 1
+
+    c = [lambda a: a * 2, lambda a: a + 1, lambda a: t(5), f3]
+    index = UInt32(0, 0, 1, 0, 2, 0, 3, 0)
+    a = t(1, 2, 3, 4, 5, 6, 7, 8)
+    dr.enable_grad(a)
+
+    backup = dr.detail.ad_call_reduce_batch()
+    try:
+        dr.detail.set_ad_call_reduce_batch(2)
+        assert dr.detail.ad_call_reduce_batch() == 2
+        r = dr.switch(index, c, a, mode='evaluated')
+    finally:
+        dr.detail.set_ad_call_reduce_batch(backup)
+
+    assert dr.all(r == [2, 4, 4, 8, 5, 12, 6, 16])
+    assert dr.all(buf == [0, 0, 0, 1])
+    dr.backward(r)
+    assert dr.all(a.grad == [2, 2, 1, 2, 0, 2, 1, 2])
@@ -565,3 +565,169 @@ def test18_tensor_index_signed_vec(t):
     x = t([1, 2, 3], shape=(1, 3))
     A = dr.int32_array_t(dr.array_t(x))
     assert dr.all(x[:, A([-1, 0])] == t([3, 1]))
+
+
+@pytest.test_arrays('is_tensor, float32')
+def test19_tensor_matmul(t):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(0)
+    a = rng.standard_normal((3, 5), dtype=np.float32)
+    b = rng.standard_normal((5, 4), dtype=np.float32)
+    v = rng.standard_normal(5, dtype=np.float32)
+
+    assert dr.allclose((t(a) @ t(b)).numpy(), a @ b)
+    assert dr.allclose(dr.matmul(t(a), t(v)).numpy(), a @ v)
+    assert dr.allclose(dr.matmul(t(v), t(b)).numpy(), v @ b)
+    assert (t(a) @ t(b)).shape == (3, 4)
+    assert dr.matmul(t(v), t(v)).shape == ()
+
+    with pytest.raises(RuntimeError, match='incompatible shapes'):
+        t(a) @ t(a)
+
+
+@pytest.test_arrays('is_tensor, is_diff, float32')
+def test20_tensor_matmul_ad(t):
+    a = t([1, 2, 3, 4, 5, 6], shape=(2, 3))
+    b = t([1, 0, 2, 1, 0, 3], shape=(3, 2))
+    dr.enable_grad(a, b)
+    c = a @ b
+    dr.backward(dr.sum(c.array))
+    # d/dA sum(A @ B) = 1 @ B^T, d/dB = A^T @ 1
+    assert dr.allclose(a.grad, t([1, 3, 3, 1, 3, 3], shape=(2, 3)))
+    assert dr.allclose(b.grad, t([5, 5, 7, 7, 9, 9], shape=(3, 2)))
+
+
+@pytest.test_arrays('is_tensor, is_diff, float32')
+def test21_mlp(t):
+    m = sys.modules[t.__module__]
+    w0 = t([1, -1, 2, 0.5], shape=(2, 2))
+    b0 = t([0, -1], shape=(2,))
+    w1 = t([1, 2], shape=(1, 2))
+    dr.enable_grad(w0)
+
+    x = m.Array2f([1, 2], [3, -4])
+    y, = dr.mlp(x, [(w0, b0), (w1, None)])
+
+    # Reference: h = relu(W0 x + b0), y = W1 h
+    h0 = dr.maximum(x[0] - x[1], 0)
+    h1 = dr.maximum(2 * x[0] + 0.5 * x[1] - 1, 0)
+    assert dr.allclose(y, h0 + 2 * h1)
+
+    dr.backward(dr.sum(y))
+    assert dr.allclose(w0.grad, t([2, -4, 6, -2], shape=(2, 2)))
+
+
+@pytest.test_arrays('is_tensor, uint32')
+def test22_tensor_view(t):
+    np = pytest.importorskip("numpy")
+    a = np.arange(2 * 3 * 4, dtype=np.uint32).reshape(2, 3, 4)
+    x = t(a)
+
+    v = dr.view(x)
+    assert v.is_contiguous and v.tensor() is x
+    assert dr.all(x[...].array == x.array)
+
+    # Slicing and transposition only update the view metadata
+    w = v[1, :, ::2].T
+    assert w.shape == (2, 3) and w.strides == (2, 4) and w.offset == 12
+    assert not w.is_contiguous
+    assert np.all(w.numpy() == a[1, :, ::2].T)
+
+    assert np.all(v[:, None, ::-1, 1:3].numpy() == a[:, None, ::-1, 1:3])
+    assert np.all(v.transpose(2, 0, 1)[..., 1].numpy() == a.transpose(2, 0, 1)[..., 1])
+    assert np.all(v[1].reshape((-1,)).numpy() == a[1].reshape(-1))
+    assert np.all(w.reshape((6,)).numpy() == a[1, :, ::2].T.reshape(6))
+
+    with pytest.raises(IndexError, match='out of bounds'):
+        v[2]
+
+
+@pytest.mark.parametrize('filter', ['box', 'tent', 'lanczos', 'mitchell'])
+@pytest.test_arrays('is_tensor, float32, is_diff')
+def test23_resample(t, filter):
+    # Normalized filters reproduce constant signals
+    a = dr.full(t, 2, (3, 5, 2))
+    b = dr.resample(a, (7, 2), filter=filter)
+    assert b.shape == (7, 2, 2)
+    assert dr.allclose(b.array, 2)
+
+    # Downsampling a box-filtered signal averages neighboring samples
+    x = t([1, 3, 5, 7], shape=(4,))
+    dr.enable_grad(x)
+    y = dr.resample(x, (2,), filter='box')
+    assert dr.allclose(y.array, [2, 6])
+    dr.backward(dr.sum(y))
+    assert dr.allclose(x.grad.array, .5)
+
+    # Upsampling with a tent filter interpolates linearly
+    z = dr.resample(t([0, 1], shape=(2,)), (4,), filter='tent')
+    assert dr.allclose(z.array, [0, .25, .75, 1])
+
+    with pytest.raises(RuntimeError, match="'filter' must equal"):
+        dr.resample(a, (2,), filter='gaussian')
+
+
+@pytest.test_arrays('is_tensor, float32, jit')
+def test24_gather_scatter_nd(t):
+    np = pytest.importorskip("numpy")
+    m = sys.modules[t.__module__]
+    a = np.arange(3 * 4 * 4, dtype=np.float32).reshape(3, 4, 4)
+    x = t(a)
+    iy, ix = m.UInt32(2, 0, 1), m.UInt32(3, 1, 1)
+
+    # Power-of-two rows (packet gather), general rows, and single entries
+    y = dr.gather_nd(x, (iy, ix))
+    assert y.shape == (3, 4) and np.all(y.numpy() == a[[2, 0, 1], [3, 1, 1]])
+    y = dr.gather_nd(t(a[..., :3]), (iy, ix), m.Bool(True, False, True))
+    assert np.all(y.numpy() == a[[2, 0, 1], [3, 1, 1], :3] * [[1], [0], [1]])
+    y = dr.gather_nd(x, (iy, ix, m.UInt32(0, 1, 2)))
+    assert y.shape == (3,) and np.all(y.numpy() == a[[2, 0, 1], [3, 1, 1], [0, 1, 2]])
+    assert dr.gather_nd(x, iy).shape == (3, 4, 4)
+
+    z = dr.zeros(t, (3, 4, 4))
+    dr.scatter_nd(z, dr.gather_nd(x, (iy, ix)), (iy, ix))
+    ref = np.zeros_like(a)
+    ref[[2, 0, 1], [3, 1, 1]] = a[[2, 0, 1], [3, 1, 1]]
+    assert np.all(z.numpy() == ref)
+
+    w = dr.zeros(t, (2, 3))
+    dr.scatter_nd_reduce(dr.ReduceOp.Add, w, t([1, 2, 3, 4, 5, 6], shape=(2, 3)),
+                         m.UInt32(1, 1))
+    assert np.all(w.numpy() == [[0, 0, 0], [5, 7, 9]])
+
+
+@pytest.test_arrays('is_tensor, float32, jit, -diff')
+def test25_full_slice_assignment(t):
+    m = sys.modules[t.__module__]
+    x = t(dr.arange(m.Float, 12), (4, 3))
+    y = t(dr.arange(m.Float, 12) * 2, (4, 3))
+    dr.eval(x, y)
+
+    # Assigning a tensor of the same shape shares its storage
+    x[:] = y
+    assert x.array.index == y.array.index
+
+    # .. until one of them is modified (copy-on-write)
+    x[0, 1] = 5
+    assert x.array.index != y.array.index
+    assert dr.all(x.array == [0, 5, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22])
+    assert dr.all(y.array == dr.arange(m.Float, 12) * 2)
+
+    # Scalar assignments produce a literal
+    x[...] = 3
+    assert x.shape == (4, 3) and x.array.state == dr.VarState.Literal
+    assert dr.all(x.array == 3)
+
+
+@pytest.test_arrays('is_tensor, float32, jit')
+def test26_broadcast_groups(t):
+    # Broadcasting along leading, trailing, interior, and all axes
+    np = pytest.importorskip("numpy")
+    a = np.arange(2 * 3 * 4, dtype=np.float32).reshape(2, 3, 4)
+    for shape in [(1, 1, 4), (2, 3, 1), (2, 1, 4), (1, 3, 1), (1, 1, 1), (3, 4), (4,)]:
+        b = np.arange(np.prod(shape), dtype=np.float32).reshape(shape) + 1
+        ref = a * b
+        for x, y in ((t(a), t(b)), (t(b), t(a))):
+            z = x * y
+            assert z.shape == ref.shape
+            assert np.all(z.numpy() == ref)
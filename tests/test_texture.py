@@ -756,3 +756,289 @@ def test23_set_tensor(t, texture_type):
     dr.eval(result_accel)
     assert dr.allclose(result_drjit, result_accel, 5e-3, 5e-3)
     assert dr.allclose(result_drjit, Array2f(4.5, 4))
+
+
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test24_texture_array(t):
+    mod = sys.modules[t.__module__]
+    Array2f = getattr(mod, 'Array2f')
+    TensorXf = getattr(mod, 'TensorXf')
+
+    a = TensorXf(dr.arange(t, 4*4*3), shape=(4, 4, 3))
+    b = TensorXf(dr.arange(t, 4*4*1) * 10, shape=(4, 4, 1))
+
+    for use_accel in (True, False):
+        arr = mod.TextureArray2f([a, b], use_accel, False)
+        tex_a = mod.Texture2f(a, use_accel, False)
+        tex_b = mod.Texture2f(b, use_accel, False)
+        assert arr.layer_count() == 2
+        assert arr.texture().shape == (4, 4, 4)
+
+        pos = Array2f(dr.linspace(t, 0, 1, 7), dr.linspace(t, 0.2, 0.9, 7))
+        res = arr.eval(pos)
+        assert len(res) == 2 and len(res[0]) == 3 and len(res[1]) == 1
+        for out, ref in zip(res[0] + res[1], tex_a.eval(pos) + tex_b.eval(pos)):
+            assert dr.allclose(out, ref)
+
+    with pytest.raises(RuntimeError, match="same resolution"):
+        mod.TextureArray2f([a, TensorXf(dr.zeros(t, 2*4), shape=(2, 4, 1))])
+
+
+def decode_bc4_ref(w0, w1, texel):
+    r0, r1 = w0 & 0xFF, (w0 >> 8) & 0xFF
+    code = (((w1 << 32) | w0) >> (16 + 3 * texel)) & 7
+    if code == 0:
+        v = r0
+    elif code == 1:
+        v = r1
+    elif r0 > r1:
+        v = ((8 - code) * r0 + (code - 1) * r1) / 7
+    elif code == 6:
+        v = 0
+    elif code == 7:
+        v = 255
+    else:
+        v = ((6 - code) * r0 + (code - 1) * r1) / 5
+    return v / 255
+
+
+def decode_bc1_ref(w0, w1, texel):
+    c0, c1 = w0 & 0xFFFF, w0 >> 16
+    code = (w1 >> (2 * texel)) & 3
+    result = []
+    for shift, bits in ((11, 31), (5, 63), (0, 31)):
+        e0, e1 = ((c0 >> shift) & bits) / bits, ((c1 >> shift) & bits) / bits
+        if code == 0:
+            v = e0
+        elif code == 1:
+            v = e1
+        elif c0 > c1:
+            v = (2 * e0 + e1) / 3 if code == 2 else (e0 + 2 * e1) / 3
+        else:
+            v = (e0 + e1) / 2 if code == 2 else 0
+        result.append(v)
+    return result
+
+
+@pytest.mark.parametrize("fmt", ['BC1', 'BC4', 'BC5'])
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test25_compressed_texture(t, fmt):
+    import random
+    mod = sys.modules[t.__module__]
+    Array2f = getattr(mod, 'Array2f')
+    UInt32 = getattr(mod, 'UInt32')
+    TensorXf = getattr(mod, 'TensorXf')
+
+    rng = random.Random(fmt)
+    w, h = 8, 4
+    words = 4 if fmt == 'BC5' else 2
+    data = [rng.getrandbits(32) for _ in range((w // 4) * (h // 4) * words)]
+    if fmt != 'BC1':
+        # Exercise both BC4 interpolation modes
+        data[0] = (data[0] & ~0xFFFF) | 0x10F0
+        data[words] = (data[words] & ~0xFFFF) | 0xF010
+
+    # Decode on the CPU
+    ref = []
+    for y in range(h):
+        for x in range(w):
+            b = ((y // 4) * (w // 4) + x // 4) * words
+            texel = (y % 4) * 4 + x % 4
+            if fmt == 'BC1':
+                ref += decode_bc1_ref(data[b], data[b + 1], texel)
+            else:
+                ref.append(decode_bc4_ref(data[b], data[b + 1], texel))
+                if fmt == 'BC5':
+                    ref.append(decode_bc4_ref(data[b + 2], data[b + 3], texel))
+    channels = len(ref) // (w * h)
+
+    bf = getattr(dr.BlockFormat, fmt)
+    tex = mod.CompressedTexture2f(w, h, bf, UInt32(data), dr.FilterMode.Nearest)
+    assert tex.shape == (h, w, channels)
+
+    xs, ys = dr.meshgrid(dr.arange(t, w), dr.arange(t, h))
+    pos = Array2f((xs + .5) / w, (ys + .5) / h)
+    out = tex.eval(pos)
+    for ch in range(channels):
+        assert dr.allclose(out[ch], t(ref[ch::channels]))
+
+    # Bilinear filtering must match a regular texture holding the decoded texels
+    for wrap_mode in wrap_modes:
+        tex = mod.CompressedTexture2f(w, h, bf, UInt32(data),
+                                      dr.FilterMode.Linear, wrap_mode)
+        tex_ref = mod.Texture2f(TensorXf(t(ref), shape=(h, w, channels)), False,
+                                False, dr.FilterMode.Linear, wrap_mode)
+        pos = Array2f(dr.linspace(t, -0.3, 1.4, 31), dr.linspace(t, 1.2, -0.2, 31))
+        for a, b in zip(tex.eval(pos), tex_ref.eval(pos)):
+            assert dr.allclose(a, b)
+
+    with pytest.raises(RuntimeError, match="unexpected array size"):
+        mod.CompressedTexture2f(w, h, bf, UInt32(data[:-1]))
+
+
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test26_mip_texture(t):
+    mod = sys.modules[t.__module__]
+    Array2f = getattr(mod, 'Array2f')
+    TensorXf = getattr(mod, 'TensorXf')
+
+    value = TensorXf(dr.arange(t, 8*4*2), shape=(4, 8, 2))
+    for use_accel in (True, False):
+        tex = mod.MipTexture2f(value, use_accel=use_accel, migrate=False)
+        assert tex.level_count() == 4
+        assert tex.level(1).shape == (2, 4, 2)
+        assert tex.level(3).shape == (1, 1, 2)
+
+        # Level 1 is a 2x2 box filter of level 0
+        ref = dr.zeros(t, 2*4*2)
+        v = value.array
+        for y in range(2):
+            for x in range(4):
+                for ch in range(2):
+                    s = sum(v[((2*y+dy)*8 + 2*x+dx)*2 + ch] for dy in range(2) for dx in range(2))
+                    ref[(y*4 + x)*2 + ch] = s / 4
+        assert dr.allclose(tex.level(1).value(), ref)
+
+        pos = Array2f(dr.linspace(t, 0.1, 0.9, 9), dr.linspace(t, 0.8, 0.2, 9))
+        l0 = tex.level(0).eval(pos)
+        l1 = tex.level(1).eval(pos)
+
+        for lod, w in ((0, 0), (1, 1), (0.25, 0.25), (-3, 0)):
+            out = tex.eval(pos, t(lod))
+            for ch in range(2):
+                assert dr.allclose(out[ch], dr.lerp(l0[ch], l1[ch], w))
+
+        # A footprint of two texels selects level 1
+        dx = Array2f(2/8, 0)
+        dy = Array2f(0, 1/4)
+        out = tex.eval_grad(pos, dx, dy)
+        for ch in range(2):
+            assert dr.allclose(out[ch], l1[ch])
+
+
+@pytest.mark.parametrize("migrate", [True, False])
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test27_update_region(t, migrate):
+    mod = sys.modules[t.__module__]
+    TensorXf = getattr(mod, 'TensorXf')
+
+    value = TensorXf(dr.arange(t, 5*6*2), shape=(5, 6, 2))
+    tex = mod.Texture2f(value, True, migrate)
+    tex.update_region([1, 2], [3, 2], dr.full(t, -1, 3*2*2))
+
+    ref = value.numpy().copy()
+    ref[1:4, 2:4, :] = -1
+    assert tex.migrated() == (migrate and tex.use_accel())
+    assert dr.all(tex.tensor().array == t(ref.ravel()))
+
+    with pytest.raises(RuntimeError, match="out of bounds"):
+        tex.update_region([4, 0], [2, 1], dr.zeros(t, 4))
+    with pytest.raises(RuntimeError, match="unexpected array size"):
+        tex.update_region([0, 0], [2, 1], dr.zeros(t, 3))
+
+
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test28_sparse_texture(t):
+    mod = sys.modules[t.__module__]
+    Array3f = getattr(mod, 'Array3f')
+    TensorXf = getattr(mod, 'TensorXf')
+
+    # 12^3 volume with two non-empty regions, split into 4^3 bricks
+    res = 12
+    z, y, x = dr.meshgrid(dr.arange(mod.UInt32, res), dr.arange(mod.UInt32, res),
+                          dr.arange(mod.UInt32, res), indexing='ij')
+    value = dr.select(((x < 4) & (y < 4) & (z < 4)) | ((x >= 6) & (x < 10) & (y == 9) & (z == 5)),
+                      t(x + y * 2 + z * 3 + 1), 0)
+    value = TensorXf(value, shape=(res, res, res, 1))
+
+    dense = mod.Texture3f(value, False, False)
+    for use_accel in (True, False):
+        tex = mod.SparseTexture3f(value, brick_size=4, use_accel=use_accel,
+                                  migrate=False)
+        assert tex.brick_count() == 3
+        occ = tex.occupancy()
+        assert occ.shape == (3, 3, 3)
+        assert dr.sum(occ.array) == 3
+
+        rng = mod.PCG32(1000)
+        pos = Array3f(rng.next_float32(), rng.next_float32(), rng.next_float32()) * 1.2 - .1
+        assert dr.allclose(tex.eval(pos)[0], dense.eval(pos)[0], atol=1e-5)
+        assert dr.allclose(tex.eval_cubic(pos)[0], dense.eval_cubic(pos)[0], atol=1e-4)
+
+        fetch_s, fetch_d = tex.eval_fetch(pos), dense.eval_fetch(pos)
+        for a, b in zip(fetch_s, fetch_d):
+            assert dr.allclose(a[0], b[0])
+
+
+@pytest.mark.parametrize("wrap_mode", wrap_modes)
+@pytest.test_arrays("is_diff, float32, shape=(*), llvm")
+def test29_tiled_layout(t, wrap_mode):
+    # Lookups through the tiled LLVM layout must match the row-major layout
+    import math
+    mod = sys.modules[t.__module__]
+    PCG32 = getattr(mod, 'PCG32')
+    rng = PCG32(1000)
+
+    for dim, shape in ((2, (13, 21)), (3, (5, 9, 6))):
+        TexType = getattr(mod, f'Texture{dim}f')
+        ArrayType = getattr(mod, f'Array{dim}f')
+        value = t(PCG32(math.prod(shape) * 3).next_float32())
+
+        tex = TexType(shape, 3, True, dr.FilterMode.Linear, wrap_mode)
+        ref = TexType(shape, 3, False, dr.FilterMode.Linear, wrap_mode)
+        dr.enable_grad(value)
+        tex.set_value(value)
+        ref.set_value(value)
+        assert dr.all(tex.value() == value)
+
+        pos = ArrayType([rng.next_float32() * 1.4 - 0.2 for _ in range(dim)])
+        for name in ('eval', 'eval_cubic'):
+            out, out_ref = getattr(tex, name)(pos), getattr(ref, name)(pos)
+            for ch in range(3):
+                assert dr.allclose(out[ch], out_ref[ch])
+
+        out, out_ref = tex.eval_fetch(pos), ref.eval_fetch(pos)
+        for i in range(len(out)):
+            for ch in range(3):
+                assert dr.all(out[i][ch] == out_ref[i][ch])
+
+        # Gradients propagate to the row-major texels
+        dr.backward(dr.sum(tex.eval(pos)[1]))
+        grad = dr.grad(value)
+        dr.clear_grad(value)
+        dr.backward(dr.sum(ref.eval(pos)[1]))
+        assert dr.allclose(grad, dr.grad(value))
+
+
+@pytest.mark.parametrize("channels", [2, 4, 8])
+@pytest.test_arrays("is_diff, float32, shape=(*), jit")
+def test30_packet_texel_gather(t, channels):
+    # Multi-channel texels are fetched with a single packet gather. Compare
+    # against one single-channel texture per channel.
+    mod = sys.modules[t.__module__]
+    PCG32 = getattr(mod, 'PCG32')
+    TensorXf = getattr(mod, 'TensorXf')
+    shape = (7, 10)
+
+    value = t(PCG32(70 * channels).next_float32())
+    index = dr.arange(mod.UInt32, 70) * channels
+    ref = [mod.Texture2f(TensorXf(dr.gather(t, value, index + ch), shape=(*shape, 1)),
+                         use_accel=False) for ch in range(channels)]
+    pos = mod.Array2f(PCG32(100).next_float32(), PCG32(100, 3).next_float32())
+
+    # On the LLVM backend, 'use_accel' selects the tiled texel layout
+    use_accel = [False]
+    if dr.backend_v(t) == dr.JitBackend.LLVM:
+        use_accel.append(True)
+
+    for accel in use_accel:
+        tex = mod.Texture2f(TensorXf(value, shape=(*shape, channels)),
+                            use_accel=accel)
+        out, out_cubic = tex.eval(pos), tex.eval_cubic(pos)
+        fetch = tex.eval_fetch(pos)
+        for ch in range(channels):
+            assert dr.allclose(out[ch], ref[ch].eval(pos)[0])
+            assert dr.allclose(out_cubic[ch], ref[ch].eval_cubic(pos)[0])
+            fetch_ref = ref[ch].eval_fetch(pos)
+            for i in range(4):
+                assert dr.all(fetch[i][ch] == fetch_ref[i][0])
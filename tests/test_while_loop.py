@@ -692,3 +692,247 @@ def test29_preserve_differentiability_suspend(t, mode):
     assert not dr.grad_enabled(x)
     assert dr.grad_enabled(y)
     assert y.index_ad == y_id
+
+
+@pytest.mark.parametrize('ratio', [0, 0.5, 1])
+@pytest.test_arrays('uint32,is_jit,shape=(*)')
+@dr.syntax
+def test30_compress_ratio(t, ratio):
+    # Compress the loop state only when the occupancy falls below 'ratio'
+    backup = dr.detail.ad_loop_compress_ratio()
+    dr.detail.set_ad_loop_compress_ratio(ratio)
+    assert dr.detail.ad_loop_compress_ratio() == ratio
+
+    try:
+        state = dr.arange(t, 10000) + 1
+        it_count = dr.zeros(t, 10000)
+
+        while dr.hint(state != 1, mode='evaluated', compress=True):
+            state = dr.select(
+                state & 1 == 0,
+                state // 2,
+                3*state + 1
+            )
+            it_count += 1
+    finally:
+        dr.detail.set_ad_loop_compress_ratio(backup)
+
+    assert dr.all(state == 1)
+    assert dr.sum(it_count) == 849666
+
+
+@pytest.mark.parametrize('unroll', [1, 2, 3])
+@pytest.test_arrays('uint32,is_jit,shape=(*)')
+@dr.syntax
+def test31_unroll(t, unroll):
+    # Recording several copies of the loop body must not change the result
+    state = dr.arange(t, 10000) + 1
+    it_count = dr.zeros(t, 10000)
+
+    while dr.hint(state != 1, mode='symbolic', unroll=unroll):
+        state = dr.select(
+            state & 1 == 0,
+            state // 2,
+            3*state + 1
+        )
+        it_count += 1
+
+    assert dr.all(state == 1)
+    assert dr.sum(it_count) == 849666
+
+    with pytest.raises(RuntimeError, match="'unroll' must be >= 1"):
+        i = t(0)
+        while dr.hint(i < 10, mode='symbolic', unroll=0):
+            i += 1
+
+
+@pytest.test_arrays('uint32,is_jit,shape=(*)')
+@dr.syntax
+def test32_loop_batch(t):
+    # Evaluated loops can trace the body once per batch of iterations
+    backup = dr.detail.ad_loop_batch()
+    dr.detail.set_ad_loop_batch(16)
+    assert dr.detail.ad_loop_batch() == 16
+
+    try:
+        with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+            state = dr.arange(t, 10000) + 1
+            it_count = dr.zeros(t, 10000)
+            dr.eval(state, it_count)
+            dr.kernel_history()
+
+            while dr.hint(state != 1, mode='evaluated'):
+                state = dr.select(
+                    state & 1 == 0,
+                    state // 2,
+                    3*state + 1
+                )
+                it_count += 1
+
+            dr.eval(state, it_count)
+            history = dr.kernel_history()
+    finally:
+        dr.detail.set_ad_loop_batch(backup)
+
+    assert dr.all(state == 1)
+    assert dr.sum(it_count) == 849666
+    # The longest sequence has 262 steps, hence far fewer than 262 launches
+    assert len(history) < 262 // 4
+
+
+@pytest.mark.parametrize('interval', [1, 3])
+@pytest.test_arrays('uint32,is_jit,shape=(*)')
+@dr.syntax
+def test33_loop_check_interval(t, interval):
+    # Speculative iterations following termination must not change the state
+    backup = dr.detail.ad_loop_check_interval()
+    dr.detail.set_ad_loop_check_interval(interval)
+    assert dr.detail.ad_loop_check_interval() == interval
+
+    try:
+        i = dr.arange(t, 10)
+        y = dr.zeros(t, 10)
+        while dr.hint(i < 5, mode='evaluated', compress=False):
+            y += i
+            i += 1
+    finally:
+        dr.detail.set_ad_loop_check_interval(backup)
+
+    assert dr.all(i == [5, 5, 5, 5, 5, 5, 6, 7, 8, 9])
+    assert dr.all(y == [10, 10, 9, 7, 4, 0, 0, 0, 0, 0])
+
+
+@pytest.mark.parametrize('mode', ['symbolic', 'evaluated'])
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+@dr.syntax
+def test34_loop_many_diff_state(t, mode):
+    # Mixes attached and detached state variables, which the variable tracker
+    # stores using different (packed vs. arena-backed) index encodings
+    xs = [t(i, i + 1) for i in range(64)]
+    ys = [dr.zeros(t, 2) for _ in range(64)]
+    for x, y in zip(xs[::2], ys[::2]):
+        dr.enable_grad(x, y)
+
+    i = dr.zeros(dr.uint32_array_t(t), 2)
+
+    while dr.hint(i < 3, mode=mode, exclude=xs):
+        ys = [y + x for x, y in zip(xs, ys)]
+        i += 1
+
+    for k, y in enumerate(ys):
+        assert dr.all(y == t(3 * k, 3 * (k + 1)))
+        assert dr.grad_enabled(y) == (k % 2 == 0)
+
+
+@pytest.mark.parametrize('pool_size', [1, 3, 100])
+@pytest.test_arrays('uint32,is_jit,shape=(*)')
+def test35_persistent_loop(t, pool_size):
+    # Divergent trip counts: work item 'i' runs for 'i % 5' iterations
+    n = dr.arange(t, 17) % 5
+    i, y, s = dr.persistent_loop(
+        state=(dr.zeros(t, 17), dr.arange(t, 17), t(10)),
+        cond=lambda i, y, s: i < y % 5,
+        body=lambda i, y, s: (i + 1, y, s + 1),
+        pool_size=pool_size,
+    )
+
+    assert dr.all(y == dr.arange(t, 17))
+    assert dr.all(i == n)
+    assert dr.all(s == 10 + n)
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+@dr.syntax
+def test36_loop_fwd_fused(t):
+    # Primal state and tangents are computed by a single loop
+    UInt32 = dr.uint32_array_t(t)
+    x = t(1, 2, 3)
+    dr.enable_grad(x)
+    dr.set_grad(x, 1)
+
+    with dr.scoped_set_flag(dr.JitFlag.KernelHistory, True):
+        i, y = UInt32(0), t(x)
+        while dr.hint(i < 3, mode='symbolic', ad_mode='fwd_fused'):
+            y = y * x
+            i += 1
+
+        grad_y = dr.forward_to(y)
+        dr.eval(y, grad_y)
+        history = dr.kernel_history([dr.KernelType.JIT])
+
+    assert len(history) == 1
+    assert dr.allclose(y, x**4)
+    assert dr.allclose(grad_y, 4 * x**3)
+
+    # Changed input gradients cause the loop to be re-run
+    i, y = UInt32(0), t(x)
+    while dr.hint(i < 3, mode='symbolic', ad_mode='fwd_fused'):
+        y = y * x
+        i += 1
+
+    dr.set_grad(x, 2)
+    assert dr.allclose(dr.forward_to(y), 8 * x**3)
+
+    with pytest.raises(RuntimeError, match="ad_mode"):
+        dr.while_loop((UInt32(0),), lambda i: i < 3, lambda i: (i + 1,),
+                      ad_mode='bwd')
+
+
+@pytest.mark.parametrize('compress', [False, True])
+@pytest.test_arrays('float32,is_jit,shape=(*)')
+def test37_loop_evaluated_nested_state(t, compress):
+    # Evaluated loops write the state back after each iteration. This
+    # exercises that path with a nested PyTree holding several leaf types
+    UInt32 = dr.uint32_array_t(t)
+
+    def body(i, state):
+        state['x'][1] += state['x'][0] + 5
+        state['y'] = (state['y'][0] + 1, state['y'][1])
+        return i + 1, state
+
+    i, state = dr.while_loop(
+        state=(dr.arange(UInt32, 4), {
+            'x': [t(0, 1, 2, 3), dr.zeros(t, 4)],
+            'y': (dr.zeros(t, 4), UInt32(0, 10, 20, 30))
+        }),
+        cond=lambda i, state: i < 6,
+        body=body,
+        mode='evaluated',
+        compress=compress
+    )
+
+    assert dr.all(i == 6)
+    assert dr.all(state['x'][0] == [0, 1, 2, 3])
+    assert dr.all(state['x'][1] == [30, 30, 28, 24])
+    assert dr.all(state['y'][0] == [6, 5, 4, 3])
+    assert dr.all(state['y'][1] == [0, 10, 20, 30])
+
+
+@pytest.mark.parametrize('ratio', [1.0, 0.5])
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+@pytest.skip_on(RuntimeError, "backend does not support the requested type of atomic reduction")
+@dr.syntax
+def test38_loop_compress_bwd(t, ratio):
+    # Reverse-mode AD through an evaluated loop whose state shrinks
+    UInt32 = dr.uint32_array_t(t)
+    backup = dr.detail.ad_loop_compress_ratio()
+    dr.detail.set_ad_loop_compress_ratio(ratio)
+
+    try:
+        x = t(1, 2, 3, 4, 5, 6)
+        dr.enable_grad(x)
+        xi = x
+        i, y = UInt32(0, 1, 2, 3, 4, 5), t(x)
+
+        while dr.hint(i < 6, mode='evaluated', compress=True):
+            y = y * x
+            i += 1
+
+        dr.backward_from(y)
+    finally:
+        dr.detail.set_ad_loop_compress_ratio(backup)
+
+    # Lane 'k' computes x**(7 - k)
+    n = t(7, 6, 5, 4, 3, 2)
+    assert dr.allclose(y, xi**n)
+    assert dr.allclose(xi.grad, n * xi**(n - 1))
@@ -240,3 +240,47 @@ def test09_sum_loop_extra(t, mode):
 
         dr.backward(loss)
 
+
+
+@pytest.mark.parametrize('variant', ['inverse', 'checkpoint', 'checkpoint_bound'])
+@pytest.test_arrays('float32,diff,shape=(*)')
+def test10_loop_rev_no_state(t, variant):
+    # Reverse-mode derivative of a symbolic loop with loop-carried dependences
+    # without storing the state of every iteration
+    UInt32 = dr.uint32_array_t(t)
+    x = t(1, 2, 3)
+    p = t(1.5)
+    dr.enable_grad(x, p)
+
+    def cond(i, y):
+        return i < 5
+
+    def body(i, y):
+        return i + 1, y * p
+
+    def inverse(i, y):
+        return i - 1, y / p
+
+    kwargs = {}
+    if variant == 'inverse':
+        kwargs['inverse'] = inverse
+    else:
+        kwargs['checkpoint'] = 2
+        if variant == 'checkpoint_bound':
+            kwargs['max_iterations'] = 5
+
+    i, y = dr.while_loop(
+        state=(UInt32(0, 1, 2), t(x)),
+        cond=cond,
+        body=body,
+        labels=('i', 'y'),
+        mode='symbolic',
+        **kwargs
+    )
+
+    k = t(5, 4, 3)
+    assert dr.allclose(y, x * 1.5 ** k)
+
+    dr.backward_from(y)
+    assert dr.allclose(x.grad, 1.5 ** k)
+    assert dr.allclose(p.grad, dr.sum(k * x * 1.5 ** (k - 1)))
@@ -845,3 +845,46 @@ def test30_nested(t, config):
     torch.autograd.backward(out, torch.tensor([1, 2, 3], dtype=dt))
     assert torch.all(x.grad == torch.tensor([0, 12, 36], dtype=dt))
     assert torch.all(y.grad == torch.tensor([0, 2, 6], dtype=dt))
+
+
+def test31_flatten_struct():
+    # Flatten/unflatten PyTrees containing custom data structures
+    from drjit.interop import flatten, unflatten
+
+    class Point:
+        DRJIT_STRUCT = { 'x': float, 'y': float }
+
+    p = Point()
+    p.x, p.y = 1.0, 2.0
+    tree = { 'a': [p, 3.0], 'b': (4.0,) }
+
+    desc, *flat = flatten(tree)
+    assert flat == [1.0, 2.0, 3.0, 4.0]
+
+    r = unflatten(desc, *flat)
+    assert type(r['a'][0]) is Point
+    assert r['a'][0].x == 1.0 and r['a'][0].y == 2.0
+    assert r['a'][1] == 3.0 and r['b'] == (4.0,)
+
+
+@pytest.mark.parametrize('config', configs_jax)
+@pytest.test_arrays('is_diff,float32,shape=(*)')
+def test32_jax_bwd_no_reevaluation(t, config):
+    # The wrapped JAX function is linearized during the primal evaluation,
+    # hence reverse-mode differentiation does not evaluate it again
+    calls = []
+
+    @wrap(config)
+    def test_fn(x):
+        calls.append(1)
+        return x * x
+
+    x = dr.arange(t, 3)
+    dr.enable_grad(x)
+    y = test_fn(x)
+    y.grad = [1, 1, 1]
+    dr.backward_to(x)
+
+    assert dr.all(y == [0, 1, 4])
+    assert dr.all(x.grad == [0, 2, 4])
+    assert len(calls) == 1